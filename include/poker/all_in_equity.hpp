@@ -0,0 +1,226 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include <poker/card_set.hpp>
+#include "poker/detail/error.hpp"
+#include "poker/detail/hand_value.hpp"
+#include "poker/detail/span.hpp"
+
+namespace poker::detail {
+
+// Calls 'f(runout)' for every 'k'-card subset of 'live', as card masks.
+template<class F>
+void for_each_runout(const std::uint64_t* live, std::size_t n, int k, std::size_t first, std::uint64_t runout, F& f) {
+    if (k == 0) {
+        f(runout);
+        return;
+    }
+    for (auto i = first; i + static_cast<std::size_t>(k) <= n; ++i) {
+        for_each_runout(live, n, k - 1, i + 1, runout | live[i], f);
+    }
+}
+
+} // namespace poker::detail
+
+namespace poker {
+
+// Exact all-in equities of 'hands' on 'board', by enumerating every way the
+// board can be completed from the cards not in any hand. Ties share equally.
+// Writes the equity of every hand to 'equities', without allocating.
+inline void all_in_equities(span<const card_set> hands, card_set board, span<double> equities) POKER_NOEXCEPT {
+    const auto n = static_cast<std::size_t>(hands.size());
+    POKER_DETAIL_ASSERT(n >= 1 && n <= 23, "There must be between 1 and 23 hands");
+    POKER_DETAIL_ASSERT(board.size() <= 5, "The board has at most five cards");
+    POKER_DETAIL_ASSERT(equities.size() == hands.size(), "There must be one equity per hand");
+
+    auto dead = board;
+    for (const auto& h : hands) dead |= h;
+    auto live = std::array<std::uint64_t, 52>{};
+    auto num_live = std::size_t{0};
+    (card_set::full_deck() - dead).for_each([&] (card c) { live[num_live++] = card_set::bit(c); });
+
+    std::fill(equities.begin(), equities.end(), 0.0);
+    auto values = std::array<std::uint32_t, 23>{};
+    auto num_runouts = std::size_t{0};
+    auto f = [&] (std::uint64_t runout) {
+        const auto full_board = board | card_set{runout};
+        auto best = std::uint32_t{0};
+        auto num_best = 0;
+        for (auto i = std::size_t{0}; i < n; ++i) {
+            values[i] = detail::hand_value(hands[i] | full_board);
+            if (values[i] > best) {
+                best = values[i];
+                num_best = 1;
+            } else if (values[i] == best) {
+                ++num_best;
+            }
+        }
+        const auto share = 1.0 / num_best;
+        for (auto i = std::size_t{0}; i < n; ++i) {
+            if (values[i] == best) equities[i] += share;
+        }
+        ++num_runouts;
+    };
+    detail::for_each_runout(live.data(), num_live, static_cast<int>(5 - board.size()), 0, 0, f);
+    for (auto& e : equities) e /= static_cast<double>(num_runouts);
+}
+
+inline auto all_in_equities(span<const card_set> hands, card_set board) -> std::vector<double> {
+    auto equities = std::vector<double>(hands.size());
+    all_in_equities(hands, board, equities);
+    return equities;
+}
+
+// Remembers the equities of the last situations it has seen, up to
+// 'capacity' of them. Situations that only differ by the order of the hands
+// or by a relabeling of the suits are the same one, keyed by their
+// suit-isomorphic form (see hand_indexer). Preflop all-ins enumerate 1.7
+// million boards, so simulations that see the same matchups again and again
+// should keep one of these around.
+//
+// The entries are grouped in sets of 'ways', and a full set forgets its least
+// recently used entry. They are all allocated up front, so that looking up
+// equities never allocates.
+class all_in_equity_cache {
+public:
+    //
+    // Constants
+    //
+    static constexpr auto max_hands = std::size_t{16}; // More are not cached.
+    static constexpr auto ways = std::size_t{4};
+
+    //
+    // Constructors
+    //
+
+    // EXPECTS: 'capacity' is a positive multiple of 'ways'
+    explicit all_in_equity_cache(std::size_t capacity = 4096);
+
+    //
+    // Observers
+    //
+    auto capacity() const noexcept -> std::size_t { return _entries.size(); }
+    auto size()     const noexcept -> std::size_t { return _size; }
+    auto hits()     const noexcept -> std::uint64_t { return _hits; }
+    auto misses()   const noexcept -> std::uint64_t { return _misses; }
+
+    //
+    // Modifiers
+    //
+    void equities(span<const card_set> hands, card_set board, span<double> equities) POKER_NOEXCEPT;
+    auto equities(span<const card_set> hands, card_set board) -> std::vector<double>;
+
+    void clear() noexcept;
+
+private:
+    // The board, then the hands in increasing order, after relabeling the
+    // suits so that the sequence is smallest.
+    struct key {
+        std::array<std::uint64_t, max_hands + 1> cards = {};
+        std::size_t num_hands = 0;
+
+        friend auto operator==(const key& x, const key& y) noexcept -> bool {
+            return x.num_hands == y.num_hands && x.cards == y.cards;
+        }
+    };
+
+    struct entry {
+        key k;
+        std::array<double, max_hands> equities = {};
+        std::uint64_t last_used = 0; // 0 for an empty entry.
+    };
+
+    static auto permute_suits(std::uint64_t cards, const std::array<int, 4>& suits) noexcept -> std::uint64_t;
+    static auto hash(const key&) noexcept -> std::size_t;
+
+private:
+    std::vector<entry> _entries;
+    std::size_t _size = 0;
+    std::uint64_t _clock = 0;
+    std::uint64_t _hits = 0;
+    std::uint64_t _misses = 0;
+};
+
+inline all_in_equity_cache::all_in_equity_cache(std::size_t capacity)
+{
+    POKER_DETAIL_ASSERT(capacity > 0 && capacity % ways == 0, "Capacity must be a positive multiple of the ways");
+    _entries.resize(capacity);
+}
+
+inline auto all_in_equity_cache::permute_suits(std::uint64_t cards, const std::array<int, 4>& suits) noexcept -> std::uint64_t {
+    auto permuted = std::uint64_t{0};
+    for (auto s = 0; s < 4; ++s) permuted |= (cards >> (16 * s) & 0xffff) << (16 * suits[s]);
+    return permuted;
+}
+
+inline auto all_in_equity_cache::hash(const key& k) noexcept -> std::size_t {
+    auto h = std::uint64_t{0xcbf29ce484222325};
+    for (auto i = std::size_t{0}; i <= k.num_hands; ++i) h = (h ^ k.cards[i]) * 0x100000001b3;
+    return static_cast<std::size_t>(h ^ (h >> 32));
+}
+
+inline void all_in_equity_cache::equities(span<const card_set> hands, card_set board, span<double> equities) POKER_NOEXCEPT {
+    const auto n = static_cast<std::size_t>(hands.size());
+    POKER_DETAIL_ASSERT(equities.size() == hands.size(), "There must be one equity per hand");
+    if (n > max_hands) {
+        all_in_equities(hands, board, equities);
+        return;
+    }
+
+    // order[i] is the hand at position i of the key.
+    auto best = key{};
+    auto best_order = std::array<std::size_t, max_hands>{};
+    auto suits = std::array<int, 4>{0, 1, 2, 3};
+    auto first = true;
+    do {
+        auto k = key{};
+        k.num_hands = n;
+        k.cards[0] = permute_suits(board.bits(), suits);
+        auto permuted = std::array<std::uint64_t, max_hands>{};
+        auto order = std::array<std::size_t, max_hands>{};
+        for (auto i = std::size_t{0}; i < n; ++i) permuted[i] = permute_suits(hands[i].bits(), suits);
+        std::iota(order.begin(), order.begin() + n, std::size_t{0});
+        std::sort(order.begin(), order.begin() + n, [&] (auto x, auto y) { return permuted[x] < permuted[y]; });
+        for (auto i = std::size_t{0}; i < n; ++i) k.cards[i + 1] = permuted[order[i]];
+        if (first || std::lexicographical_compare(k.cards.begin(), k.cards.begin() + n + 1, best.cards.begin(), best.cards.begin() + n + 1)) {
+            best = k;
+            best_order = order;
+            first = false;
+        }
+    } while (std::next_permutation(suits.begin(), suits.end()));
+
+    const auto set = _entries.begin() + static_cast<std::ptrdiff_t>(hash(best) % (_entries.size() / ways) * ways);
+    auto e = std::find_if(set, set + ways, [&] (const entry& x) { return x.last_used != 0 && x.k == best; });
+    if (e != set + ways) {
+        ++_hits;
+    } else {
+        ++_misses;
+        e = std::min_element(set, set + ways, [] (const entry& x, const entry& y) { return x.last_used < y.last_used; });
+        if (e->last_used == 0) ++_size;
+        auto sorted = std::array<card_set, max_hands>{};
+        for (auto i = std::size_t{0}; i < n; ++i) sorted[i] = hands[best_order[i]];
+        all_in_equities(span<const card_set>(sorted).first(n), board, span<double>(e->equities).first(n));
+        e->k = best;
+    }
+    e->last_used = ++_clock;
+
+    for (auto i = std::size_t{0}; i < n; ++i) equities[best_order[i]] = e->equities[i];
+}
+
+inline auto all_in_equity_cache::equities(span<const card_set> hands, card_set board) -> std::vector<double> {
+    auto result = std::vector<double>(hands.size());
+    equities(hands, board, result);
+    return result;
+}
+
+inline void all_in_equity_cache::clear() noexcept {
+    for (auto& e : _entries) e.last_used = 0;
+    _size = 0;
+}
+
+} // namespace poker
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <poker/card_set.hpp>
+#include "poker/detail/bits.hpp"
+#include "poker/detail/error.hpp"
+#include "poker/detail/random.hpp"
+#include "poker/detail/span.hpp"
+
+namespace poker {
+
+// Deals many hands at once into structure-of-arrays buffers: hole cards as
+// one card_set per seat and hand, seat by seat, and boards as one card_set
+// per hand, ready to be OR-ed together and evaluated in a loop.
+//
+// Hands are dealt 'num_lanes' at a time, each lane from its own copy of the
+// live cards, laid out position by position so that one step of the lanes
+// touches neighbouring bytes and writes neighbouring outputs. Like
+// sampling_deck, a lane never restores its cards between hands; every draw
+// picks uniformly among all the cards the hand has not drawn yet.
+class batch_dealer {
+public:
+    //
+    // Constants
+    //
+    static constexpr auto num_lanes = std::size_t{8};
+
+    //
+    // Constructors
+    //
+    explicit batch_dealer(std::size_t num_seats, card_set dead = {}) POKER_NOEXCEPT;
+
+    //
+    // Observers
+    //
+    auto num_seats() const noexcept -> std::size_t { return _num_seats; }
+    auto dead()      const noexcept -> card_set    { return _dead; }
+
+    //
+    // Modifiers
+    //
+
+    // Deals 'boards.size()' hands. Seat s of hand h gets hole_cards[s * boards.size() + h].
+    template<class URBG>
+    void deal(span<card_set> hole_cards, span<card_set> boards, URBG& g) POKER_NOEXCEPT;
+
+private:
+    template<class URBG>
+    void deal_lanes(std::size_t first_hand, std::size_t lanes, span<card_set> hole_cards, span<card_set> boards, URBG& g) noexcept;
+
+private:
+    std::size_t _num_seats;
+    card_set _dead;
+    std::size_t _num_live = 0;
+    // _cards[position * num_lanes + lane], as bit positions in a card_set.
+    std::array<std::uint8_t, 52 * num_lanes> _cards = {};
+};
+
+inline batch_dealer::batch_dealer(std::size_t num_seats, card_set dead) POKER_NOEXCEPT
+    : _num_seats{num_seats}
+    , _dead{dead}
+{
+    POKER_DETAIL_ASSERT(num_seats >= 1, "There must be at least one seat");
+    POKER_DETAIL_ASSERT(2 * num_seats + 5 + dead.size() <= 52, "Not enough live cards to deal every hand");
+    (card_set::full_deck() - dead).for_each([&] (card c) {
+        for (auto lane = std::size_t{0}; lane < num_lanes; ++lane) {
+            _cards[_num_live * num_lanes + lane] = static_cast<std::uint8_t>(detail::countr_zero(card_set::bit(c)));
+        }
+        ++_num_live;
+    });
+}
+
+template<class URBG>
+void batch_dealer::deal(span<card_set> hole_cards, span<card_set> boards, URBG& g) POKER_NOEXCEPT {
+    const auto num_hands = static_cast<std::size_t>(boards.size());
+    POKER_DETAIL_ASSERT(static_cast<std::size_t>(hole_cards.size()) == _num_seats * num_hands, "There must be hole cards for every seat of every hand");
+
+    for (auto first_hand = std::size_t{0}; first_hand < num_hands; first_hand += num_lanes) {
+        deal_lanes(first_hand, std::min(num_lanes, num_hands - first_hand), hole_cards, boards, g);
+    }
+}
+
+template<class URBG>
+void batch_dealer::deal_lanes(std::size_t first_hand, std::size_t lanes, span<card_set> hole_cards, span<card_set> boards, URBG& g) noexcept {
+    const auto num_hands = static_cast<std::size_t>(boards.size());
+
+    // Partial Fisher-Yates on every lane: step k moves a uniformly chosen
+    // card among the first _num_live - k into position _num_live - 1 - k.
+    auto step = std::size_t{0};
+    auto draw = [&] (card_set* out) {
+        const auto last = _num_live - 1 - step++;
+        auto indices = std::array<std::size_t, num_lanes>{};
+        for (auto lane = std::size_t{0}; lane < lanes; ++lane) {
+            indices[lane] = detail::uniform_index(g, static_cast<std::uint32_t>(last + 1));
+        }
+        for (auto lane = std::size_t{0}; lane < lanes; ++lane) {
+            auto& x = _cards[indices[lane] * num_lanes + lane];
+            auto& y = _cards[last * num_lanes + lane];
+            std::swap(x, y);
+            out[lane] |= card_set{std::uint64_t{1} << y};
+        }
+    };
+
+    for (auto lane = std::size_t{0}; lane < lanes; ++lane) {
+        for (auto s = std::size_t{0}; s < _num_seats; ++s) hole_cards[s * num_hands + first_hand + lane] = {};
+        boards[first_hand + lane] = {};
+    }
+    for (auto s = std::size_t{0}; s < _num_seats; ++s) {
+        draw(&hole_cards[s * num_hands + first_hand]);
+        draw(&hole_cards[s * num_hands + first_hand]);
+    }
+    for (auto i = 0; i < 5; ++i) draw(&boards[first_hand]);
+}
+
+} // namespace poker
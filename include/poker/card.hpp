@@ -6,8 +6,8 @@
 
 namespace poker {
 
-enum class card_rank { _2, _3, _4, _5, _6, _7, _8, _9, T, J, Q, K, A };
-enum class card_suit { clubs, diamonds, hearts, spades };
+enum class card_rank : unsigned char { _2, _3, _4, _5, _6, _7, _8, _9, T, J, Q, K, A };
+enum class card_suit : unsigned char { clubs, diamonds, hearts, spades };
 
 struct card {
     card_rank rank;
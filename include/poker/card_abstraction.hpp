@@ -0,0 +1,418 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <poker/community_cards.hpp>
+#include <poker/hand_indexer.hpp>
+#include <poker/hole_cards.hpp>
+#include "poker/detail/error.hpp"
+#include "poker/detail/mapped_file.hpp"
+#include "poker/detail/parallel.hpp"
+#include "poker/detail/span.hpp"
+
+namespace poker {
+
+// A dense, row-major matrix of hand strength histograms with one row per
+// canonical situation. Rows need not be normalized.
+class histogram_matrix {
+public:
+    histogram_matrix() = default;
+
+    histogram_matrix(span<const float> data, std::size_t num_bins) POKER_NOEXCEPT
+        : _data{data}
+        , _num_bins{num_bins}
+    {
+        POKER_DETAIL_ASSERT(num_bins > 0, "Histograms must have at least one bin");
+        POKER_DETAIL_ASSERT(data.size() % num_bins == 0, "Data must hold a whole number of histograms");
+    }
+
+    auto num_rows() const noexcept -> std::size_t { return _num_bins == 0 ? 0 : _data.size() / _num_bins; }
+    auto num_bins() const noexcept -> std::size_t { return _num_bins; }
+
+    auto row(std::size_t i) const POKER_NOEXCEPT -> span<const float> {
+        POKER_DETAIL_ASSERT(i < num_rows(), "Row index must be in the valid range");
+        return _data.subspan(i * _num_bins, _num_bins);
+    }
+
+private:
+    span<const float> _data;
+    std::size_t _num_bins = 0;
+};
+
+// Histograms stored in a file as raw native-endian 32-bit floats, mapped
+// into memory rather than read.
+class histogram_file {
+public:
+    histogram_file(const std::string& path, std::size_t num_bins)
+        : _file{path}
+        , _num_bins{num_bins}
+    {
+        POKER_DETAIL_ASSERT(num_bins > 0, "Histograms must have at least one bin");
+        if (_file.size() % (num_bins * sizeof(float)) != 0) {
+            throw std::invalid_argument{"Histogram file size is not a multiple of the row size: " + path};
+        }
+    }
+
+    auto histograms() const noexcept -> histogram_matrix {
+        const auto data = reinterpret_cast<const float*>(_file.data());
+        return {span<const float>(data, _file.size() / sizeof(float)), _num_bins};
+    }
+
+private:
+    detail::mapped_file _file;
+    std::size_t _num_bins;
+};
+
+struct kmeans_options {
+    std::size_t num_clusters = 0;
+    std::size_t max_iterations = 100;
+    // k-means++ seeding runs over a uniform sample of at most this many rows.
+    std::size_t seeding_sample_size = 1 << 16;
+    std::uint64_t seed = 0;
+    unsigned num_threads = 0; // 0 means all cores
+};
+
+struct kmeans_result {
+    std::vector<std::uint32_t> buckets; // one per row
+    std::vector<float> centroids;       // num_clusters normalized histograms, row-major
+    std::size_t iterations = 0;
+    double cost = 0;                    // sum of distances to the assigned centroids
+};
+
+} // namespace poker
+
+namespace poker::detail {
+
+// Writes the normalized cumulative distribution of 'histogram' to 'cdf'.
+inline void histogram_cdf(span<const float> histogram, span<float> cdf) noexcept {
+    auto total = 0.0;
+    for (auto x : histogram) total += x;
+    const auto scale = total > 0 ? 1 / total : 0.0;
+    auto sum = 0.0;
+    for (auto i = std::size_t{0}; i < histogram.size(); ++i) {
+        sum += histogram[i];
+        cdf[i] = static_cast<float>(sum * scale);
+    }
+}
+
+// In one dimension, the earth mover's distance between two distributions is
+// the L1 distance between their cumulative distributions.
+inline auto cdf_distance(const float* x, const float* y, std::size_t n) noexcept -> float {
+    auto sum = 0.0f;
+    for (auto i = std::size_t{0}; i < n; ++i) sum += std::abs(x[i] - y[i]);
+    return sum;
+}
+
+class kmeans {
+public:
+    kmeans(const histogram_matrix& data, const kmeans_options& options)
+        : _data{data}
+        , _options{options}
+        , _n{data.num_rows()}
+        , _k{options.num_clusters}
+        , _bins{data.num_bins()}
+        , _threads{num_threads(options.num_threads)}
+        , _centroids(_k * _bins)
+        , _assignments(_n)
+        , _upper(_n)
+        , _lower(_n)
+        , _rng{options.seed}
+    {
+    }
+
+    auto run() -> kmeans_result;
+
+private:
+    auto centroid(std::size_t c) noexcept -> float* { return _centroids.data() + c * _bins; }
+    auto centroid(std::size_t c) const noexcept -> const float* { return _centroids.data() + c * _bins; }
+
+    void seed_centroids();
+    void initial_assignment();
+    auto update_centroids() -> bool;
+    auto reassign() -> std::size_t;
+    void nearest_two(const float* cdf, std::uint32_t& best, float& best_distance, float& second_distance) const noexcept;
+
+private:
+    const histogram_matrix& _data;
+    const kmeans_options& _options;
+    std::size_t _n;
+    std::size_t _k;
+    std::size_t _bins;
+    unsigned _threads;
+
+    std::vector<float> _centroids;           // as cumulative distributions
+    std::vector<std::uint32_t> _assignments;
+    std::vector<float> _upper;               // bound on the distance to the assigned centroid
+    std::vector<float> _lower;               // bound on the distance to any other centroid
+    std::vector<float> _movement;            // how far each centroid moved in the last update
+    std::vector<float> _half_separation;     // half the distance to the closest other centroid
+    std::mt19937_64 _rng;
+};
+
+inline void kmeans::nearest_two(const float* cdf, std::uint32_t& best, float& best_distance, float& second_distance) const noexcept {
+    best_distance = std::numeric_limits<float>::max();
+    second_distance = std::numeric_limits<float>::max();
+    for (auto c = std::size_t{0}; c < _k; ++c) {
+        const auto d = cdf_distance(cdf, centroid(c), _bins);
+        if (d < best_distance) {
+            second_distance = best_distance;
+            best_distance = d;
+            best = static_cast<std::uint32_t>(c);
+        } else if (d < second_distance) {
+            second_distance = d;
+        }
+    }
+}
+
+// k-means++: every next centroid is picked with probability proportional to
+// the squared distance to the closest centroid picked so far.
+inline void kmeans::seed_centroids() {
+    auto sample = std::vector<std::size_t>{};
+    if (_n <= _options.seeding_sample_size) {
+        sample.resize(_n);
+        for (auto i = std::size_t{0}; i < _n; ++i) sample[i] = i;
+    } else {
+        sample.resize(_options.seeding_sample_size);
+        auto pick = std::uniform_int_distribution<std::size_t>{0, _n - 1};
+        std::generate(sample.begin(), sample.end(), [&] { return pick(_rng); });
+    }
+    const auto m = sample.size();
+    auto cdfs = std::vector<float>(m * _bins);
+    parallel_for(m, _threads, [&] (std::size_t, std::size_t first, std::size_t last) {
+        for (auto i = first; i < last; ++i) {
+            histogram_cdf(_data.row(sample[i]), span<float>(cdfs.data() + i * _bins, _bins));
+        }
+    });
+    auto weights = std::vector<double>(m, std::numeric_limits<double>::max());
+    auto next = std::uniform_int_distribution<std::size_t>{0, m - 1}(_rng);
+    for (auto c = std::size_t{0}; c < _k; ++c) {
+        std::copy_n(cdfs.data() + next * _bins, _bins, centroid(c));
+        parallel_for(m, _threads, [&] (std::size_t, std::size_t first, std::size_t last) {
+            for (auto i = first; i < last; ++i) {
+                const auto d = static_cast<double>(cdf_distance(cdfs.data() + i * _bins, centroid(c), _bins));
+                weights[i] = std::min(weights[i], d * d);
+            }
+        });
+        auto total = 0.0;
+        for (auto w : weights) total += w;
+        if (total <= 0) {
+            next = std::uniform_int_distribution<std::size_t>{0, m - 1}(_rng);
+            continue;
+        }
+        auto target = std::uniform_real_distribution<double>{0, total}(_rng);
+        next = m - 1;
+        for (auto i = std::size_t{0}; i < m; ++i) {
+            target -= weights[i];
+            if (target < 0) {
+                next = i;
+                break;
+            }
+        }
+    }
+}
+
+inline void kmeans::initial_assignment() {
+    parallel_for(_n, _threads, [&] (std::size_t, std::size_t first, std::size_t last) {
+        auto cdf = std::vector<float>(_bins);
+        for (auto i = first; i < last; ++i) {
+            histogram_cdf(_data.row(i), cdf);
+            nearest_two(cdf.data(), _assignments[i], _upper[i], _lower[i]);
+        }
+    });
+}
+
+// Recomputes every centroid as the mean of its members, then updates the
+// Hamerly bounds by how far the centroids moved. Returns false if none did.
+inline auto kmeans::update_centroids() -> bool {
+    // Bucket the rows by cluster so that each thread owns a range of clusters
+    // and no partial sums need to be merged.
+    auto offsets = std::vector<std::size_t>(_k + 1, 0);
+    for (auto a : _assignments) ++offsets[a + 1];
+    for (auto c = std::size_t{0}; c < _k; ++c) offsets[c + 1] += offsets[c];
+    auto members = std::vector<std::uint32_t>(_n);
+    {
+        auto cursor = std::vector<std::size_t>(offsets.begin(), offsets.end() - 1);
+        for (auto i = std::size_t{0}; i < _n; ++i) members[cursor[_assignments[i]]++] = static_cast<std::uint32_t>(i);
+    }
+
+    _movement.assign(_k, 0);
+    parallel_for(_k, _threads, [&] (std::size_t, std::size_t first, std::size_t last) {
+        auto cdf = std::vector<float>(_bins);
+        auto sum = std::vector<double>(_bins);
+        for (auto c = first; c < last; ++c) {
+            const auto count = offsets[c + 1] - offsets[c];
+            if (count == 0) continue; // An empty cluster keeps its centroid.
+            std::fill(sum.begin(), sum.end(), 0.0);
+            for (auto j = offsets[c]; j < offsets[c + 1]; ++j) {
+                histogram_cdf(_data.row(members[j]), cdf);
+                for (auto b = std::size_t{0}; b < _bins; ++b) sum[b] += cdf[b];
+            }
+            for (auto b = std::size_t{0}; b < _bins; ++b) cdf[b] = static_cast<float>(sum[b] / static_cast<double>(count));
+            _movement[c] = cdf_distance(cdf.data(), centroid(c), _bins);
+            std::copy(cdf.begin(), cdf.end(), centroid(c));
+        }
+    });
+
+    const auto max_it = std::max_element(_movement.begin(), _movement.end());
+    if (*max_it == 0) return false;
+    const auto max_index = static_cast<std::uint32_t>(max_it - _movement.begin());
+    auto second_max = 0.0f;
+    for (auto c = std::size_t{0}; c < _k; ++c) {
+        if (c != max_index) second_max = std::max(second_max, _movement[c]);
+    }
+    parallel_for(_n, _threads, [&] (std::size_t, std::size_t first, std::size_t last) {
+        for (auto i = first; i < last; ++i) {
+            const auto a = _assignments[i];
+            _upper[i] += _movement[a];
+            _lower[i] -= a == max_index ? second_max : *max_it;
+        }
+    });
+
+    _half_separation.assign(_k, std::numeric_limits<float>::max());
+    parallel_for(_k, _threads, [&] (std::size_t, std::size_t first, std::size_t last) {
+        for (auto c = first; c < last; ++c) {
+            auto closest = std::numeric_limits<float>::max();
+            for (auto other = std::size_t{0}; other < _k; ++other) {
+                if (other != c) closest = std::min(closest, cdf_distance(centroid(c), centroid(other), _bins));
+            }
+            _half_separation[c] = closest / 2;
+        }
+    });
+    return true;
+}
+
+// Hamerly's algorithm: a row keeps its centroid without scanning the others
+// whenever the triangle inequality proves that none of them can be closer.
+inline auto kmeans::reassign() -> std::size_t {
+    auto changed = std::vector<std::size_t>(_threads, 0);
+    parallel_for(_n, _threads, [&] (std::size_t thread, std::size_t first, std::size_t last) {
+        auto cdf = std::vector<float>(_bins);
+        for (auto i = first; i < last; ++i) {
+            const auto a = _assignments[i];
+            const auto bound = std::max(_half_separation[a], _lower[i]);
+            if (_upper[i] <= bound) continue;
+            histogram_cdf(_data.row(i), cdf);
+            _upper[i] = cdf_distance(cdf.data(), centroid(a), _bins);
+            if (_upper[i] <= bound) continue;
+            nearest_two(cdf.data(), _assignments[i], _upper[i], _lower[i]);
+            if (_assignments[i] != a) ++changed[thread];
+        }
+    });
+    auto total = std::size_t{0};
+    for (auto c : changed) total += c;
+    return total;
+}
+
+inline auto kmeans::run() -> kmeans_result {
+    auto result = kmeans_result{};
+    seed_centroids();
+    initial_assignment();
+    for (result.iterations = 0; result.iterations < _options.max_iterations;) {
+        ++result.iterations;
+        if (!update_centroids() || reassign() == 0) break;
+    }
+
+    auto costs = std::vector<double>(_threads, 0.0);
+    parallel_for(_n, _threads, [&] (std::size_t thread, std::size_t first, std::size_t last) {
+        auto cdf = std::vector<float>(_bins);
+        for (auto i = first; i < last; ++i) {
+            histogram_cdf(_data.row(i), cdf);
+            costs[thread] += cdf_distance(cdf.data(), centroid(_assignments[i]), _bins);
+        }
+    });
+    for (auto c : costs) result.cost += c;
+
+    result.centroids.resize(_k * _bins);
+    for (auto c = std::size_t{0}; c < _k; ++c) {
+        auto previous = 0.0f;
+        for (auto b = std::size_t{0}; b < _bins; ++b) {
+            result.centroids[c * _bins + b] = centroid(c)[b] - previous;
+            previous = centroid(c)[b];
+        }
+    }
+    result.buckets = std::move(_assignments);
+    return result;
+}
+
+} // namespace poker::detail
+
+namespace poker {
+
+// Earth mover's distance between two histograms over the same ordered bins,
+// after normalizing both to unit mass.
+inline auto earth_movers_distance(span<const float> x, span<const float> y) -> float {
+    POKER_DETAIL_ASSERT(x.size() == y.size(), "Histograms must have the same number of bins");
+    auto x_cdf = std::vector<float>(x.size());
+    auto y_cdf = std::vector<float>(y.size());
+    detail::histogram_cdf(x, x_cdf);
+    detail::histogram_cdf(y, y_cdf);
+    return detail::cdf_distance(x_cdf.data(), y_cdf.data(), x.size());
+}
+
+// Clusters the rows of 'histograms' into 'options.num_clusters' buckets under
+// the earth mover's distance, using k-means++ seeding and Hamerly's
+// triangle-inequality pruning. Deterministic for a given seed and thread count.
+inline auto cluster_histograms(const histogram_matrix& histograms, const kmeans_options& options) -> kmeans_result {
+    POKER_DETAIL_ASSERT(options.num_clusters > 0, "There must be at least one cluster");
+    POKER_DETAIL_ASSERT(options.num_clusters <= histograms.num_rows(), "There cannot be more clusters than histograms");
+    POKER_DETAIL_ASSERT(options.num_clusters <= std::numeric_limits<std::uint32_t>::max(), "Bucket ids must fit 32 bits");
+
+    return detail::kmeans{histograms, options}.run();
+}
+
+// Maps live situations to the buckets of a card abstraction, one bucket table
+// per round of betting. 'Indexer' maps (hole_cards, community_cards) to the
+// dense index of the situation on the current street.
+template<class Indexer = hand_indexer>
+class card_abstraction {
+public:
+    card_abstraction() = default;
+
+    explicit card_abstraction(Indexer indexer)
+        : _indexer{std::move(indexer)}
+    {
+    }
+
+    auto indexer() const noexcept -> const Indexer& {
+        return _indexer;
+    }
+
+    auto buckets(round_of_betting rob) const noexcept -> span<const std::uint32_t> {
+        return _buckets[street(rob)];
+    }
+
+    void set_buckets(round_of_betting rob, std::vector<std::uint32_t> buckets) noexcept {
+        _buckets[street(rob)] = std::move(buckets);
+    }
+
+    auto bucket(const hole_cards& hc, const community_cards& cc) const POKER_NOEXCEPT -> std::uint32_t {
+        const auto& buckets = _buckets[street(static_cast<round_of_betting>(cc.cards().size()))];
+        const auto index = static_cast<std::size_t>(_indexer(hc, cc));
+        POKER_DETAIL_ASSERT(index < buckets.size(), "Situation must have a bucket");
+        return buckets[index];
+    }
+
+private:
+    static constexpr auto street(round_of_betting rob) noexcept -> std::size_t {
+        switch (rob) {
+        case round_of_betting::preflop: return 0;
+        case round_of_betting::flop:    return 1;
+        case round_of_betting::turn:    return 2;
+        default:                        return 3;
+        }
+    }
+
+private:
+    Indexer _indexer = {};
+    std::array<std::vector<std::uint32_t>, 4> _buckets;
+};
+
+} // namespace poker
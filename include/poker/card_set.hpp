@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+
+#include <poker/card.hpp>
+#include <poker/hole_cards.hpp>
+#include "poker/detail/bits.hpp"
+#include "poker/detail/utility.hpp"
+
+namespace poker {
+
+// Dense index of a card in [0, 52).
+constexpr auto card_index(card c) noexcept -> std::size_t {
+    using poker::detail::to_underlying;
+    return static_cast<std::size_t>(to_underlying(c.suit)) * 13 + static_cast<std::size_t>(to_underlying(c.rank));
+}
+
+constexpr auto card_from_index(std::size_t index) noexcept -> card {
+    return {static_cast<card_rank>(index % 13), static_cast<card_suit>(index / 13)};
+}
+
+// A set of cards as a 64-bit mask. Every suit occupies its own 16-bit lane in
+// which bit 'r' stands for the card of rank 'r'.
+class card_set {
+public:
+    //
+    // Constructors
+    //
+    constexpr card_set() noexcept = default;
+
+    constexpr explicit card_set(std::uint64_t bits) noexcept
+        : _bits{bits}
+    {
+    }
+
+    constexpr card_set(std::initializer_list<card> cards) noexcept {
+        for (auto c : cards) insert(c);
+    }
+
+    constexpr card_set(const hole_cards& hc) noexcept
+        : card_set{hc.first, hc.second}
+    {
+    }
+
+    template<class Range, class = decltype(std::declval<const Range&>().begin())>
+    constexpr explicit card_set(const Range& cards) noexcept {
+        for (card c : cards) insert(c);
+    }
+
+    static constexpr auto bit(card c) noexcept -> std::uint64_t {
+        using poker::detail::to_underlying;
+        return std::uint64_t{1} << (16 * to_underlying(c.suit) + to_underlying(c.rank));
+    }
+
+    static constexpr auto full_deck() noexcept -> card_set {
+        return card_set{0x1fff1fff1fff1fff};
+    }
+
+    //
+    // Observers
+    //
+    constexpr auto bits() const noexcept -> std::uint64_t { return _bits; }
+    constexpr auto empty() const noexcept -> bool         { return _bits == 0; }
+    constexpr auto contains(card c) const noexcept -> bool { return (_bits & bit(c)) != 0; }
+
+    auto size() const noexcept -> std::size_t {
+        return static_cast<std::size_t>(detail::popcount(_bits));
+    }
+
+    // The ranks present in the given suit as a 13-bit mask.
+    constexpr auto ranks(card_suit s) const noexcept -> std::uint16_t {
+        using poker::detail::to_underlying;
+        return static_cast<std::uint16_t>((_bits >> (16 * to_underlying(s))) & 0x1fff);
+    }
+
+    //
+    // Modifiers
+    //
+    constexpr void insert(card c) noexcept { _bits |= bit(c); }
+    constexpr void erase(card c) noexcept  { _bits &= ~bit(c); }
+    constexpr void clear() noexcept        { _bits = 0; }
+
+    //
+    // Iteration (in increasing card_index order)
+    //
+    template<class F>
+    void for_each(F&& f) const {
+        for (auto bits = _bits; bits != 0; bits &= bits - 1) {
+            const auto position = detail::countr_zero(bits);
+            f(card{static_cast<card_rank>(position % 16), static_cast<card_suit>(position / 16)});
+        }
+    }
+
+    //
+    // Set operations
+    //
+    friend constexpr auto operator|(card_set x, card_set y) noexcept -> card_set { return card_set{x._bits | y._bits}; }
+    friend constexpr auto operator&(card_set x, card_set y) noexcept -> card_set { return card_set{x._bits & y._bits}; }
+    friend constexpr auto operator-(card_set x, card_set y) noexcept -> card_set { return card_set{x._bits & ~y._bits}; }
+    friend constexpr auto operator|=(card_set& x, card_set y) noexcept -> card_set& { return x = x | y; }
+    friend constexpr auto operator&=(card_set& x, card_set y) noexcept -> card_set& { return x = x & y; }
+    friend constexpr auto operator-=(card_set& x, card_set y) noexcept -> card_set& { return x = x - y; }
+    friend constexpr auto operator==(card_set x, card_set y) noexcept -> bool { return x._bits == y._bits; }
+    friend constexpr auto operator!=(card_set x, card_set y) noexcept -> bool { return x._bits != y._bits; }
+
+private:
+    std::uint64_t _bits = 0;
+};
+
+} // namespace poker
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace poker {
+
+// A cryptographically secure generator: the ChaCha20 keystream of a 256-bit
+// key, in Bernstein's original layout with a 64-bit block counter and a
+// 64-bit stream number (nonce).
+//
+// The keystream is generated four blocks (256 bytes) at a time, the four
+// blocks side by side so that every step of the rounds is the same operation
+// on four independent words, which compilers turn into vector instructions.
+// operator() then only reads the next word of the buffer.
+//
+// The generator takes over 300 bytes, too many for a deck to store, so a deck
+// is shuffled from it up front, unless its owner keeps the generator and
+// passes it to every draw (see deck::fill), as a table does.
+//
+// Reseeding reads the OS entropy pool, which may block or take a system call,
+// so it is not done behind the caller's back: fetch a key with entropy_key()
+// where it is cheap, e.g. on another thread between hands, and pass it to
+// reseed().
+class chacha20 {
+public:
+    //
+    // Types
+    //
+    using result_type = std::uint32_t;
+    using key_type = std::array<std::uint32_t, 8>;
+
+    //
+    // Constants
+    //
+    static constexpr auto block_words = std::size_t{16};
+    static constexpr auto blocks_per_refill = std::size_t{4};
+
+    static constexpr auto min() noexcept -> result_type { return 0; }
+    static constexpr auto max() noexcept -> result_type { return std::numeric_limits<result_type>::max(); }
+
+    //
+    // Constructors
+    //
+
+    // Seeded from the OS entropy pool.
+    chacha20() : chacha20{entropy_key()} {}
+
+    explicit chacha20(const key_type& key, std::uint64_t stream = 0, std::uint64_t block = 0) noexcept {
+        reseed(key, stream, block);
+    }
+
+    // A key read from std::random_device.
+    static auto entropy_key() -> key_type;
+
+    //
+    // Observers
+    //
+    auto key()    const noexcept -> const key_type& { return _key; }
+    auto stream() const noexcept -> std::uint64_t   { return _stream; }
+
+    // The keystream block of the next word.
+    auto block() const noexcept -> std::uint64_t {
+        return _counter - blocks_per_refill + _index / block_words;
+    }
+
+    //
+    // Modifiers
+    //
+    auto operator()() noexcept -> result_type {
+        if (_index == _buffer.size()) refill();
+        return _buffer[_index++];
+    }
+
+    void discard(unsigned long long n) noexcept {
+        while (n-- > 0) (*this)();
+    }
+
+    // Restarts the keystream of another key, at the given block of a stream.
+    void reseed(const key_type& key, std::uint64_t stream = 0, std::uint64_t block = 0) noexcept;
+
+    friend auto operator==(const chacha20& x, const chacha20& y) noexcept -> bool {
+        return x._key == y._key && x._stream == y._stream && x.block() == y.block() && x._index % block_words == y._index % block_words;
+    }
+
+    friend auto operator!=(const chacha20& x, const chacha20& y) noexcept -> bool {
+        return !(x == y);
+    }
+
+private:
+    void refill() noexcept;
+
+private:
+    key_type _key = {};
+    std::uint64_t _stream = 0;
+    std::uint64_t _counter = 0; // Block after those in the buffer.
+    std::array<std::uint32_t, block_words * blocks_per_refill> _buffer = {};
+    std::size_t _index = 0;
+};
+
+inline auto chacha20::entropy_key() -> key_type {
+    auto device = std::random_device{};
+    auto key = key_type{};
+    for (auto& k : key) k = static_cast<std::uint32_t>(device());
+    return key;
+}
+
+inline void chacha20::reseed(const key_type& key, std::uint64_t stream, std::uint64_t block) noexcept {
+    _key = key;
+    _stream = stream;
+    _counter = block;
+    refill();
+}
+
+inline void chacha20::refill() noexcept {
+    constexpr auto lanes = blocks_per_refill;
+    constexpr auto rotl = [] (std::uint32_t x, int k) { return (x << k) | (x >> (32 - k)); };
+
+    // input[word][lane]
+    std::uint32_t input[block_words][lanes];
+    for (auto lane = std::size_t{0}; lane < lanes; ++lane) {
+        const auto counter = _counter + lane;
+        input[0][lane] = 0x61707865;
+        input[1][lane] = 0x3320646e;
+        input[2][lane] = 0x79622d32;
+        input[3][lane] = 0x6b206574;
+        for (auto i = 0; i < 8; ++i) input[4 + i][lane] = _key[i];
+        input[12][lane] = static_cast<std::uint32_t>(counter);
+        input[13][lane] = static_cast<std::uint32_t>(counter >> 32);
+        input[14][lane] = static_cast<std::uint32_t>(_stream);
+        input[15][lane] = static_cast<std::uint32_t>(_stream >> 32);
+    }
+
+    std::uint32_t x[block_words][lanes];
+    for (auto w = std::size_t{0}; w < block_words; ++w) {
+        for (auto lane = std::size_t{0}; lane < lanes; ++lane) x[w][lane] = input[w][lane];
+    }
+    auto quarter_round = [&] (int a, int b, int c, int d) {
+        for (auto lane = std::size_t{0}; lane < lanes; ++lane) {
+            x[a][lane] += x[b][lane]; x[d][lane] = rotl(x[d][lane] ^ x[a][lane], 16);
+            x[c][lane] += x[d][lane]; x[b][lane] = rotl(x[b][lane] ^ x[c][lane], 12);
+            x[a][lane] += x[b][lane]; x[d][lane] = rotl(x[d][lane] ^ x[a][lane], 8);
+            x[c][lane] += x[d][lane]; x[b][lane] = rotl(x[b][lane] ^ x[c][lane], 7);
+        }
+    };
+    for (auto round = 0; round < 10; ++round) {
+        quarter_round(0, 4,  8, 12);
+        quarter_round(1, 5,  9, 13);
+        quarter_round(2, 6, 10, 14);
+        quarter_round(3, 7, 11, 15);
+        quarter_round(0, 5, 10, 15);
+        quarter_round(1, 6, 11, 12);
+        quarter_round(2, 7,  8, 13);
+        quarter_round(3, 4,  9, 14);
+    }
+
+    for (auto lane = std::size_t{0}; lane < lanes; ++lane) {
+        for (auto w = std::size_t{0}; w < block_words; ++w) {
+            _buffer[lane * block_words + w] = x[w][lane] + input[w][lane];
+        }
+    }
+    _counter += lanes;
+    _index = 0;
+}
+
+} // namespace poker
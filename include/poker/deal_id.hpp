@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+
+#include <poker/chacha20.hpp>
+#include <poker/deck.hpp>
+
+namespace poker {
+
+// Identifies the cards of a hand: the deck of hand 'hand_number' at a table
+// seeded with 'table_seed' is shuffled from the ChaCha20 keystream keyed by
+// the seed, in the stream of the hand number. Any hand can be dealt again
+// from its 40-byte identifier alone, without replaying the hands before it
+// and whatever thread deals it.
+//
+// The seed is a whole 256-bit key, so that nobody can search the deals of a
+// table; draw it once per table, e.g. with chacha20::entropy_key().
+struct deal_id {
+    chacha20::key_type table_seed = {};
+    std::uint64_t hand_number = 0;
+
+    // The generator the deck of this deal is shuffled from.
+    auto generator() const noexcept -> chacha20 {
+        return chacha20{key(), hand_number};
+    }
+
+    auto key() const noexcept -> const chacha20::key_type& {
+        return table_seed;
+    }
+
+    friend auto operator==(const deal_id& x, const deal_id& y) noexcept -> bool {
+        return x.table_seed == y.table_seed && x.hand_number == y.hand_number;
+    }
+
+    friend auto operator!=(const deal_id& x, const deal_id& y) noexcept -> bool {
+        return !(x == y);
+    }
+};
+
+// The deck of a deal, shuffled up front. A table dealing the deal shuffles
+// the same cards as they are dealt.
+inline auto make_deck(const deal_id& id) noexcept -> deck {
+    return deck{id.generator()};
+}
+
+} // namespace poker
@@ -5,11 +5,16 @@
 #include <bitset>
 #include <climits>
 #include <new>
+#include <numeric>
 #include <iterator>
+#include <type_traits>
 
+#include <poker/all_in_equity.hpp>
+#include <poker/chacha20.hpp>
 #include <poker/community_cards.hpp>
 #include <poker/deck.hpp>
 #include <poker/hand.hpp>
+#include <poker/hand_event.hpp>
 #include <poker/player.hpp>
 #include <poker/pot.hpp>
 #include <poker/slot_array.hpp>
@@ -17,6 +22,7 @@
 #include "poker/detail/betting_round.hpp"
 #include "poker/detail/error.hpp"
 #include "poker/detail/pot_manager.hpp"
+#include "poker/detail/undo_log.hpp"
 #include "poker/detail/utility.hpp"
 
 namespace poker {
@@ -47,13 +53,18 @@ constexpr auto operator!=(const forced_bets& x, const forced_bets& y) noexcept -
     return !(x == y);
 }
 
-class dealer {
-public:
-    //
-    // Constants
-    //
-    static constexpr auto num_seats = 9;
+// How the pots are paid when every remaining player is all-in before the
+// river: by dealing out the board, or by each player's equity in every pot.
+// Paying by equity leaves the board undealt and removes the luck of the
+// runout from the results, which is what simulations care about.
+enum class all_in_settlement : unsigned char {
+    runout,
+    equity
+};
 
+// What does not depend on the number of seats, shared by every basic_dealer.
+class dealer_base {
+public:
     //
     // Types
     //
@@ -67,10 +78,10 @@ public:
     POKER_DETAIL_DEFINE_FRIEND_FLAG_OPERATIONS(action)
 
     struct action_range {
-        dealer::action action = dealer::action::fold; // you can always fold
+        dealer_base::action action = dealer_base::action::fold; // you can always fold
         poker::chip_range chip_range;
 
-        auto contains(dealer::action, poker::chips bet = 0) const POKER_NOEXCEPT -> bool;
+        auto contains(dealer_base::action, poker::chips bet = 0) const POKER_NOEXCEPT -> bool;
     };
 
     //
@@ -78,20 +89,42 @@ public:
     //
     static           auto is_valid(action)      noexcept -> bool;
     static constexpr auto is_aggressive(action) noexcept -> bool;
+};
+
+template<std::size_t N>
+struct basic_dealer_snapshot;
+
+// Tells 'EventSink' what happens in the hand, one hand_event at a time; see
+// hand_event. The sink is called with every event as it happens, and must
+// outlive the hand.
+template<std::size_t N, class EventSink = null_event_sink>
+class basic_dealer : public dealer_base {
+public:
+    //
+    // Constants
+    //
+    static constexpr auto num_seats = N;
+    static constexpr auto max_undo_depth = std::size_t{32};
+
+    //
+    // Types
+    //
+    using seat_array = basic_seat_array<N>;
+    using seat_array_view = basic_seat_array_view<N>;
 
     //
     // Special functions
     //
-    dealer()              = default;
-    dealer(const dealer&) = delete;
-    dealer(dealer&&)      = delete;
-    auto operator=(const dealer&) -> dealer& = delete;
-    auto operator=(dealer&&)      -> dealer& = delete;
+    basic_dealer()                    = default;
+    basic_dealer(const basic_dealer&) = delete;
+    basic_dealer(basic_dealer&&)      = delete;
+    auto operator=(const basic_dealer&) -> basic_dealer& = delete;
+    auto operator=(basic_dealer&&)      -> basic_dealer& = delete;
 
     //
     // Construction
     //
-    dealer(seat_array_view players, seat_index button, forced_bets, deck&, community_cards&) POKER_NOEXCEPT;
+    basic_dealer(seat_array_view players, seat_index button, forced_bets, deck&, community_cards&, EventSink* = nullptr) POKER_NOEXCEPT;
 
     //
     // Observers
@@ -107,109 +140,185 @@ public:
     auto betting_round_in_progress() const noexcept       -> bool;
     auto legal_actions()             const POKER_NOEXCEPT -> action_range;
     auto pots()                      const POKER_NOEXCEPT -> span<const pot>;
+    auto pot_transactions()          const POKER_NOEXCEPT -> span<const pot_transaction>;
     auto button()                    const noexcept       -> seat_index;
     auto hole_cards()                const POKER_NOEXCEPT -> slot_view<const poker::hole_cards, num_seats>;
+    auto all_in_settlement()         const noexcept       -> poker::all_in_settlement;
+    auto settled_by_equity()         const noexcept       -> bool;
+    auto fractional_chips()          const noexcept       -> span<const double, num_seats>;
+    auto snapshot()                  const POKER_NOEXCEPT -> basic_dealer_snapshot<N>;
+    auto undo_depth()                const noexcept       -> std::size_t;
+    auto num_undoable_actions()      const noexcept       -> std::size_t;
 
     //
     // Modifiers
     //
+
+    // Resumes a snapshot, dealing from 'd' and 'cc' to the players in 'players'
+    // as the dealer it was taken from did from its own.
+    void restore(const basic_dealer_snapshot<N>&, seat_array& players, deck& d, community_cards& cc, all_in_equity_cache* = nullptr, EventSink* = nullptr);
+    void set_all_in_settlement(poker::all_in_settlement, all_in_equity_cache* = nullptr) POKER_NOEXCEPT;
+    // Draws from a deck filled by deck::fill() with 'g', which must outlive
+    // the hand.
+    void set_deal_generator(chacha20* g) noexcept;
     void start_hand()                          POKER_NOEXCEPT;
     void action_taken(action, chips bet = 0)   POKER_NOEXCEPT;
     void end_betting_round()                   POKER_NOEXCEPT;
     void showdown()                            POKER_NOEXCEPT;
 
+    // Keeps what the last 'depth' actions of the betting round changed, up to
+    // max_undo_depth, so that undo() can take them back. 0 keeps nothing.
+    void set_undo_depth(std::size_t depth)     POKER_NOEXCEPT;
+    // Takes back the last action. Ending the betting round forgets its
+    // actions; to go back further, see snapshot().
+    void undo()                                POKER_NOEXCEPT;
+
 private:
+    // What an action changed.
+    struct undo_record {
+        typename detail::basic_betting_round<N>::undo_type betting_round;
+        poker::player                                      player;
+        bool                                               folded = false;
+    };
+
     auto next_or_wrap(seat_index) noexcept -> seat_index;
+    auto draw() noexcept -> card;
     void collect_ante() noexcept;
     auto post_blinds() noexcept -> seat_index;
     void deal_hole_cards() noexcept;
     void deal_community_cards() noexcept; // Deals community cards up until the current round of betting.
+    void settle_by_equity() noexcept;
+    void emit(hand_event) noexcept;
+    void emit(hand_event_type, seat_index, chips amount = 0, std::size_t pot = 0) noexcept;
 
 private:
     seat_array_view                     _players;
     seat_index                          _button                   = 0;
 
-    detail::betting_round               _betting_round;
+    detail::basic_betting_round<N>      _betting_round;
     forced_bets                         _forced_bets;
 
     deck*                               _deck                     = nullptr;
+    chacha20*                           _deal_generator           = nullptr;
     community_cards*                    _community_cards          = nullptr;
     std::array<poker::hole_cards, num_seats> _hole_cards               = {};
 
     bool                                _hand_in_progress         = false;
     poker::round_of_betting             _round_of_betting         = poker::round_of_betting::preflop;
     bool                                _betting_rounds_completed = false;
-    detail::pot_manager                 _pot_manager              = {};
+    detail::basic_pot_manager<N>        _pot_manager              = {};
+
+    poker::all_in_settlement            _all_in_settlement        = poker::all_in_settlement::runout;
+    all_in_equity_cache*                _equity_cache             = nullptr;
+    bool                                _settled_by_equity        = false;
+    // Chips won by equity minus the whole chips actually paid, per seat.
+    std::array<double, num_seats>       _fractional_chips         = {};
+
+    EventSink*                          _events                   = nullptr;
+    detail::undo_log<undo_record, max_undo_depth> _undo_log;
+};
+
+// The state of a dealer by value, without the players, deck and community
+// cards it deals with.
+template<std::size_t N>
+struct basic_dealer_snapshot {
+    seat_set                                                   players;
+    seat_index                                                 button                   = 0;
+    typename detail::basic_betting_round<N>::snapshot_type     betting_round;
+    poker::forced_bets                                         forced_bets;
+    std::array<poker::hole_cards, N>                           hole_cards               = {};
+    bool                                                       hand_in_progress         = false;
+    poker::round_of_betting                                    round_of_betting         = poker::round_of_betting::preflop;
+    bool                                                       betting_rounds_completed = false;
+    typename detail::basic_pot_manager<N>::snapshot_type       pots;
+    poker::all_in_settlement                                   all_in_settlement        = poker::all_in_settlement::runout;
+    bool                                                       settled_by_equity        = false;
+    std::array<double, N>                                      fractional_chips         = {};
 };
 
-inline auto dealer::action_range::contains(dealer::action a, poker::chips bet/* = 0*/) const POKER_NOEXCEPT -> bool {
+using dealer = basic_dealer<9>;
+using dealer_snapshot = basic_dealer_snapshot<9>;
+
+inline auto dealer_base::action_range::contains(dealer_base::action a, poker::chips bet/* = 0*/) const POKER_NOEXCEPT -> bool {
     POKER_DETAIL_ASSERT(is_valid(a), "The dealer::action representation must be valid");
     return static_cast<bool>(a & action) && (is_aggressive(a) ? chip_range.contains(bet) : true);
 }
 
-inline auto dealer::is_valid(action a) noexcept -> bool {
+inline auto dealer_base::is_valid(action a) noexcept -> bool {
     return std::bitset<CHAR_BIT>(static_cast<unsigned char>(a)).count() == 1;
 }
 
-inline constexpr auto dealer::is_aggressive(action a) noexcept -> bool {
+inline constexpr auto dealer_base::is_aggressive(action a) noexcept -> bool {
     return static_cast<bool>(a & action::bet) || static_cast<bool>(a & action::raise);
 }
 
-inline dealer::dealer(seat_array_view players, seat_index button, forced_bets fb, deck& d, community_cards& cc) POKER_NOEXCEPT
+template<std::size_t N, class EventSink>
+inline basic_dealer<N, EventSink>::basic_dealer(seat_array_view players, seat_index button, forced_bets fb, deck& d, community_cards& cc, EventSink* events) POKER_NOEXCEPT
     : _players{players}
     , _button{button}
     , _forced_bets{fb}
     , _deck{&d}
     , _community_cards{&cc}
+    , _events{events}
 {
     POKER_DETAIL_ASSERT(d.size() == 52, "Deck must be whole");
     POKER_DETAIL_ASSERT(cc.cards().size() == 0, "No community cards should have been dealt");
 }
 
-inline auto dealer::hand_in_progress() const noexcept -> bool {
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::hand_in_progress() const noexcept -> bool {
     return _hand_in_progress;
 }
 
-inline auto dealer::betting_rounds_completed() const POKER_NOEXCEPT -> bool {
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::betting_rounds_completed() const POKER_NOEXCEPT -> bool {
     POKER_DETAIL_ASSERT(hand_in_progress(), "Hand must be in progress");
 
     return _betting_rounds_completed;
 }
 
-inline auto dealer::player_to_act() const POKER_NOEXCEPT -> seat_index {
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::player_to_act() const POKER_NOEXCEPT -> seat_index {
     POKER_DETAIL_ASSERT(betting_round_in_progress(), "Betting round must be in progress");
 
     return _betting_round.player_to_act();
 }
 
-inline auto dealer::players() const noexcept -> seat_array_view {
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::players() const noexcept -> seat_array_view {
     return _betting_round.players();
 }
 
 // All the players who started in the current betting round.
-inline auto dealer::betting_round_players() const noexcept -> seat_array_view {
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::betting_round_players() const noexcept -> seat_array_view {
     return _players;
 }
 
-inline auto dealer::round_of_betting() const POKER_NOEXCEPT -> poker::round_of_betting {
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::round_of_betting() const POKER_NOEXCEPT -> poker::round_of_betting {
     POKER_DETAIL_ASSERT(hand_in_progress(), "Hand must be in progress");
 
     return _round_of_betting;
 }
 
-inline auto dealer::num_active_players() const noexcept -> std::size_t {
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::num_active_players() const noexcept -> std::size_t {
     return _betting_round.num_active_players();
 }
 
-inline auto dealer::biggest_bet() const noexcept -> chips {
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::biggest_bet() const noexcept -> chips {
     return _betting_round.biggest_bet();
 }
 
-inline auto dealer::betting_round_in_progress() const noexcept -> bool {
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::betting_round_in_progress() const noexcept -> bool {
     return _betting_round.in_progress();
 }
 
-inline auto dealer::legal_actions() const POKER_NOEXCEPT -> action_range {
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::legal_actions() const POKER_NOEXCEPT -> action_range {
     POKER_DETAIL_ASSERT(betting_round_in_progress(), "Betting round must be in progress");
 
     const auto& player = _players[_betting_round.player_to_act()];
@@ -234,65 +343,203 @@ inline auto dealer::legal_actions() const POKER_NOEXCEPT -> action_range {
     return ar;
 }
 
-inline auto dealer::pots() const POKER_NOEXCEPT -> span<const pot> {
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::pots() const POKER_NOEXCEPT -> span<const pot> {
     POKER_DETAIL_ASSERT(hand_in_progress(), "Hand must be in progress");
 
     return _pot_manager.pots();
 }
 
+// The chips moved into the pots when the bets were last collected.
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::pot_transactions() const POKER_NOEXCEPT -> span<const pot_transaction> {
+    POKER_DETAIL_ASSERT(hand_in_progress(), "Hand must be in progress");
+
+    return _pot_manager.transactions();
+}
+
 
-inline auto dealer::button() const noexcept -> seat_index {
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::button() const noexcept -> seat_index {
     return _button;
 }
 
-inline auto dealer::hole_cards() const POKER_NOEXCEPT -> slot_view<const poker::hole_cards, num_seats> {
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::hole_cards() const POKER_NOEXCEPT -> slot_view<const poker::hole_cards, num_seats> {
     POKER_DETAIL_ASSERT(hand_in_progress() || betting_rounds_completed(), "Hand must be in progress or showdown must have ended");
 
     return {_hole_cards, _players.filter()};
 }
 
-inline void dealer::start_hand() POKER_NOEXCEPT {
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::all_in_settlement() const noexcept -> poker::all_in_settlement {
+    return _all_in_settlement;
+}
+
+// Whether the last showdown paid the pots by equity, leaving the board undealt.
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::settled_by_equity() const noexcept -> bool {
+    return _settled_by_equity;
+}
+
+// What every seat won by equity in the last showdown beyond the whole chips
+// it was paid; negative when it was paid a leftover chip.
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::fractional_chips() const noexcept -> span<const double, num_seats> {
+    return _fractional_chips;
+}
+
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::snapshot() const POKER_NOEXCEPT -> basic_dealer_snapshot<N> {
+    auto s = basic_dealer_snapshot<N>{};
+    s.players = _players.filter();
+    s.button = _button;
+    s.betting_round = _betting_round.snapshot();
+    s.forced_bets = _forced_bets;
+    s.hole_cards = _hole_cards;
+    s.hand_in_progress = _hand_in_progress;
+    s.round_of_betting = _round_of_betting;
+    s.betting_rounds_completed = _betting_rounds_completed;
+    s.pots = _pot_manager.snapshot();
+    s.all_in_settlement = _all_in_settlement;
+    s.settled_by_equity = _settled_by_equity;
+    s.fractional_chips = _fractional_chips;
+    return s;
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_dealer<N, EventSink>::restore(const basic_dealer_snapshot<N>& s, seat_array& players, deck& d, community_cards& cc, all_in_equity_cache* cache, EventSink* events) {
+    _players = seat_array_view{players, s.players};
+    _button = s.button;
+    new (&_betting_round) detail::basic_betting_round<N>{players, s.betting_round};
+    _forced_bets = s.forced_bets;
+    _deck = &d;
+    _community_cards = &cc;
+    _hole_cards = s.hole_cards;
+    _hand_in_progress = s.hand_in_progress;
+    _round_of_betting = s.round_of_betting;
+    _betting_rounds_completed = s.betting_rounds_completed;
+    _pot_manager.restore(s.pots);
+    _all_in_settlement = s.all_in_settlement;
+    _equity_cache = cache;
+    _settled_by_equity = s.settled_by_equity;
+    _fractional_chips = s.fractional_chips;
+    _events = events;
+    _undo_log.clear();
+}
+
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::undo_depth() const noexcept -> std::size_t {
+    return _undo_log.depth();
+}
+
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::num_undoable_actions() const noexcept -> std::size_t {
+    return _undo_log.size();
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_dealer<N, EventSink>::set_undo_depth(std::size_t depth) POKER_NOEXCEPT {
+    _undo_log.set_depth(depth);
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_dealer<N, EventSink>::undo() POKER_NOEXCEPT {
+    POKER_DETAIL_ASSERT(hand_in_progress(), "Hand must be in progress");
+    POKER_DETAIL_ASSERT(num_undoable_actions() > 0, "There must be an action to undo");
+
+    const auto r = _undo_log.pop();
+    const auto seat = seat_index{r.betting_round.round.player_to_act};
+    if (r.folded) {
+        _pot_manager.take_back_folded_bet(r.player.bet_size());
+        _players.include_player(seat);
+    }
+    _players[seat] = r.player;
+    _betting_round.undo(r.betting_round);
+    emit(hand_event_type::action_undone, seat);
+}
+
+// The cache, if any, must outlive the hand.
+template<std::size_t N, class EventSink>
+inline void basic_dealer<N, EventSink>::set_all_in_settlement(poker::all_in_settlement s, all_in_equity_cache* cache) POKER_NOEXCEPT {
+    POKER_DETAIL_ASSERT(!hand_in_progress(), "Hand must not be in progress");
+
+    _all_in_settlement = s;
+    _equity_cache = cache;
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_dealer<N, EventSink>::set_deal_generator(chacha20* g) noexcept {
+    _deal_generator = g;
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_dealer<N, EventSink>::start_hand() POKER_NOEXCEPT {
     POKER_DETAIL_ASSERT(!hand_in_progress(), "Hand must not be in progress");
 
     _betting_rounds_completed = false;
     _round_of_betting = round_of_betting::preflop;
+    _settled_by_equity = false;
+    _fractional_chips = {};
+    _undo_log.clear();
+    emit(hand_event_type::hand_started, _button);
     collect_ante();
     const auto first_action = next_or_wrap(post_blinds());
     deal_hole_cards();
     if (std::count_if(_players.begin(), _players.end(), [] (const auto& p) { return p.stack() != 0; }) > 1) {
-        new (&_betting_round) detail::betting_round{_players, first_action, _forced_bets.blinds.big, _forced_bets.blinds.big};
+        new (&_betting_round) detail::basic_betting_round<N>{_players, first_action, _forced_bets.blinds.big, _forced_bets.blinds.big};
     }
     _hand_in_progress = true;
 }
 
-inline void dealer::action_taken(action a, chips bet/* = 0*/) POKER_NOEXCEPT {
+template<std::size_t N, class EventSink>
+inline void basic_dealer<N, EventSink>::action_taken(action a, chips bet/* = 0*/) POKER_NOEXCEPT {
     POKER_DETAIL_ASSERT(betting_round_in_progress(), "Betting round must be in progress");
     POKER_DETAIL_ASSERT(legal_actions().contains(a, bet), "Action must be legal");
 
+    const auto seat = player_to_act();
+    _undo_log.push({_betting_round.undo_state(), _players[seat], static_cast<bool>(a & action::fold)});
+    auto e = hand_event{hand_event_type::fold, static_cast<std::uint8_t>(seat)};
     if (static_cast<bool>(a & action::check) || static_cast<bool>(a & action::call)) {
-        _betting_round.action_taken(detail::betting_round::action::match);
+        _betting_round.action_taken(detail::betting_round_base::action::match);
+        e.type = static_cast<bool>(a & action::check) ? hand_event_type::check : hand_event_type::call;
+        e.amount = _players[seat].bet_size();
     } else if (static_cast<bool>(a & action::bet) || static_cast<bool>(a & action::raise)) {
-        _betting_round.action_taken(detail::betting_round::action::raise, bet);
+        _betting_round.action_taken(detail::betting_round_base::action::raise, bet);
+        e.type = static_cast<bool>(a & action::bet) ? hand_event_type::bet : hand_event_type::raise;
+        e.amount = bet;
     } else {
         assert(static_cast<bool>(a & action::fold));
-        auto& folding_player = _players[player_to_act()];
+        auto& folding_player = _players[seat];
         _pot_manager.bet_folded(folding_player.bet_size());
         folding_player.take_from_bet(folding_player.bet_size());
-        _players.exclude_player(player_to_act());
-        _betting_round.action_taken(detail::betting_round::action::leave);
+        _players.exclude_player(seat);
+        _betting_round.action_taken(detail::betting_round_base::action::leave);
     }
+    emit(e);
 }
 
-inline void dealer::end_betting_round() POKER_NOEXCEPT {
+template<std::size_t N, class EventSink>
+inline void basic_dealer<N, EventSink>::end_betting_round() POKER_NOEXCEPT {
     POKER_DETAIL_ASSERT(!_betting_rounds_completed, "Betting rounds must not be completed");
     POKER_DETAIL_ASSERT(!betting_round_in_progress(), "Betting round must not be in progress");
 
-    _pot_manager.collect_bets_from(_players);
+    _undo_log.clear();
+    _pot_manager.collect_bets_from(_players, [&] (std::size_t index, const pot& p) {
+        auto e = hand_event{hand_event_type::pot_collected};
+        e.pot = static_cast<std::uint8_t>(index);
+        e.amount = p.size();
+        e.players = p.eligible_players().bits();
+        emit(e);
+    });
     if (_betting_round.num_active_players() <= 1) {
         _round_of_betting = round_of_betting::river;
         // If there is only one pot, and there is only one player in it...
         if (_pot_manager.pots().size() == 1 && _pot_manager.pots()[0].eligible_players().size() == 1) {
             // ...there is no need to deal the undealt community cards.
+        } else if (_all_in_settlement == poker::all_in_settlement::equity && _community_cards->cards().size() < 5) {
+            // The pots are paid by equity at showdown, so the board is never dealt.
+            _settled_by_equity = true;
         } else {
             deal_community_cards();
         }
@@ -302,7 +549,7 @@ inline void dealer::end_betting_round() POKER_NOEXCEPT {
         // Start the next betting round.
         _round_of_betting = next(_round_of_betting);
         _players = _betting_round.players();
-        new (&_betting_round) detail::betting_round{_players, next_or_wrap(_button), _forced_bets.blinds.big};
+        new (&_betting_round) detail::basic_betting_round<N>{_players, next_or_wrap(_button), _forced_bets.blinds.big};
         deal_community_cards();
         assert(_betting_rounds_completed == false);
     } else {
@@ -312,81 +559,184 @@ inline void dealer::end_betting_round() POKER_NOEXCEPT {
     }
 }
 
-inline void dealer::showdown() POKER_NOEXCEPT {
+template<std::size_t N, class EventSink>
+inline void basic_dealer<N, EventSink>::showdown() POKER_NOEXCEPT {
     POKER_DETAIL_ASSERT(_round_of_betting == round_of_betting::river, "Round of betting must be river");
     POKER_DETAIL_ASSERT(!betting_round_in_progress(), "Betting round must not be in progress");
     POKER_DETAIL_ASSERT(betting_rounds_completed(), "Betting rounds must be completed");
 
     _hand_in_progress = false;
+    // Players who went all-in on an earlier street are no longer in the
+    // view, but can still win the pots.
     if (_pot_manager.pots().size() == 1 && _pot_manager.pots()[0].eligible_players().size() == 1) {
         // No need to evaluate the hand. There is only one player.
         const auto index = _pot_manager.pots().front().eligible_players().front();
-        _players[index].add_to_stack(_pot_manager.pots().front().size());
+        _players.underlying()[index].add_to_stack(_pot_manager.pots().front().size());
+        emit(hand_event_type::pot_awarded, index, _pot_manager.pots().front().size());
+        emit(hand_event{hand_event_type::hand_ended});
         return;
 
         // TODO: Also, no reveals in this case. Reveals are only necessary when there is >=2 players.
     }
-    for (auto& p : _pot_manager.pots()) {
-        auto player_results = std::vector<std::pair<seat_index, hand>>{};
-        player_results.reserve(p.eligible_players().size());
-        std::transform(p.eligible_players().begin(), p.eligible_players().end(), std::back_inserter(player_results), [&] (seat_index i) {
+    if (_settled_by_equity) {
+        settle_by_equity();
+        emit(hand_event{hand_event_type::hand_ended});
+        return;
+    }
+    for (auto pot_index = std::size_t{0}; pot_index < _pot_manager.pots().size(); ++pot_index) {
+        const auto& p = _pot_manager.pots()[pot_index];
+        auto player_results = std::array<std::pair<seat_index, hand>, num_seats>{};
+        const auto results_end = std::transform(p.eligible_players().begin(), p.eligible_players().end(), player_results.begin(), [&] (seat_index i) {
             /* return std::pair{i, hand{_players[i].hole_cards, *_community_cards}}; */
             return std::pair{i, hand{_hole_cards[i], *_community_cards}};
         });
-        std::sort(player_results.begin(), player_results.end(), [] (auto&& lhs, auto&& rhs) {
+        std::sort(player_results.begin(), results_end, [] (auto&& lhs, auto&& rhs) {
             return lhs.second > rhs.second;
         });
         auto first_winner = player_results.begin();
-        auto last_winner = std::adjacent_find(player_results.begin(), player_results.end(), [] (auto&& lhs, auto&& rhs) {
+        auto last_winner = std::adjacent_find(player_results.begin(), results_end, [] (auto&& lhs, auto&& rhs) {
             return lhs.second != rhs.second;
         });
-        if (last_winner != player_results.end()) ++last_winner;
+        if (last_winner != results_end) ++last_winner;
         const auto payout = p.size() / static_cast<chips>(std::distance(first_winner, last_winner));
         std::for_each(first_winner, last_winner, [&] (auto&& winner) {
-            _players[winner.first].add_to_stack(payout);
+            _players.underlying()[winner.first].add_to_stack(payout);
+            emit(hand_event_type::pot_awarded, winner.first, payout, pot_index);
         });
     }
+    emit(hand_event{hand_event_type::hand_ended});
 }
 
-inline auto dealer::next_or_wrap(seat_index seat) noexcept -> seat_index {
-    do {
-        ++seat;
-        if (seat == num_seats) seat = 0;
-    } while (!_players.filter()[seat]);
-    return seat;
+template<std::size_t N, class EventSink>
+inline void basic_dealer<N, EventSink>::settle_by_equity() noexcept {
+    const auto board = card_set{_community_cards->cards()};
+    auto exact = std::array<double, num_seats>{};
+    auto total = chips{0};
+    auto hands = std::array<card_set, num_seats>{};
+    auto eligible = std::array<seat_index, num_seats>{};
+    auto equities = std::array<double, num_seats>{};
+    for (const auto& p : _pot_manager.pots()) {
+        total += p.size();
+        auto num_hands = std::size_t{0};
+        for (auto s : p.eligible_players()) {
+            eligible[num_hands] = s;
+            hands[num_hands++] = card_set{_hole_cards[s]};
+        }
+        if (num_hands == 1) {
+            // E.g. the chips of the biggest stack that nobody could match.
+            exact[eligible[0]] += static_cast<double>(p.size());
+            continue;
+        }
+        const auto pot_hands = span<const card_set>(hands).first(num_hands);
+        const auto pot_equities = span<double>(equities).first(num_hands);
+        if (_equity_cache) {
+            _equity_cache->equities(pot_hands, board, pot_equities);
+        } else {
+            all_in_equities(pot_hands, board, pot_equities);
+        }
+        for (auto i = std::size_t{0}; i < num_hands; ++i) {
+            exact[eligible[i]] += equities[i] * static_cast<double>(p.size());
+        }
+    }
+
+    // Pay the whole part of every share, then the chips left over to the
+    // largest remainders, so that no chips are made or lost.
+    auto paid = std::array<chips, num_seats>{};
+    auto remaining = total;
+    for (auto s = seat_index{0}; s < num_seats; ++s) {
+        paid[s] = static_cast<chips>(exact[s]);
+        remaining -= paid[s];
+    }
+    auto seats = std::array<seat_index, num_seats>{};
+    std::iota(seats.begin(), seats.end(), seat_index{0});
+    // Ties go to the lower seat. std::stable_sort would allocate a buffer.
+    std::sort(seats.begin(), seats.end(), [&] (auto x, auto y) {
+        const auto x_remainder = exact[x] - static_cast<double>(paid[x]);
+        const auto y_remainder = exact[y] - static_cast<double>(paid[y]);
+        return x_remainder > y_remainder || (x_remainder == y_remainder && x < y);
+    });
+    for (auto i = std::size_t{0}; remaining > 0 && i < num_seats; ++i, --remaining) ++paid[seats[i]];
+
+    for (auto s = seat_index{0}; s < num_seats; ++s) {
+        if (exact[s] == 0) continue;
+        _players.underlying()[s].add_to_stack(paid[s]);
+        _fractional_chips[s] = exact[s] - static_cast<double>(paid[s]);
+        // One award for all the pots, which are paid together.
+        emit(hand_event_type::pot_awarded, s, paid[s]);
+    }
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_dealer<N, EventSink>::emit(hand_event e) noexcept {
+    if constexpr (!std::is_same_v<EventSink, null_event_sink>) {
+        if (_events) (*_events)(e);
+    }
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_dealer<N, EventSink>::emit(hand_event_type type, seat_index seat, chips amount, std::size_t pot) noexcept {
+    auto e = hand_event{type, static_cast<std::uint8_t>(seat)};
+    e.pot = static_cast<std::uint8_t>(pot);
+    e.amount = amount;
+    emit(e);
+}
+
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::next_or_wrap(seat_index seat) noexcept -> seat_index {
+    return _players.filter().next_or_wrap(seat);
+}
+
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::draw() noexcept -> card {
+    return _deal_generator ? _deck->draw(*_deal_generator) : _deck->draw();
 }
 
-inline void dealer::collect_ante() noexcept {
-    for (auto& p : _players) {
-        p.take_from_stack(std::min(_forced_bets.ante, p.total_chips()));
+template<std::size_t N, class EventSink>
+inline void basic_dealer<N, EventSink>::collect_ante() noexcept {
+    if (_forced_bets.ante == 0) return;
+    for (auto it = _players.begin(); it != _players.end(); ++it) {
+        const auto ante = std::min(_forced_bets.ante, (*it).total_chips());
+        (*it).take_from_stack(ante);
+        emit(hand_event_type::ante_posted, it.index(), ante);
     }
 }
 
-inline auto dealer::post_blinds() noexcept -> seat_index {
+template<std::size_t N, class EventSink>
+inline auto basic_dealer<N, EventSink>::post_blinds() noexcept -> seat_index {
     auto seat = _button;
-    const auto num_players = std::count(_players.filter().begin(), _players.filter().end(), true);
+    const auto num_players = _players.filter().size();
     if (num_players != 2) seat = next_or_wrap(seat);
     _players[seat].bet(std::min(_forced_bets.blinds.small, _players[seat].total_chips()));
+    emit(hand_event_type::small_blind_posted, seat, _players[seat].bet_size());
     seat = next_or_wrap(seat);
     _players[seat].bet(std::min(_forced_bets.blinds.big, _players[seat].total_chips()));
+    emit(hand_event_type::big_blind_posted, seat, _players[seat].bet_size());
     return seat;
 }
 
-inline void dealer::deal_hole_cards() noexcept {
-    for (auto i = 0; i < num_seats; ++i) {
-        if (_players.filter()[i]) {
-            _hole_cards[i] = {_deck->draw(), _deck->draw()};
-        }
+template<std::size_t N, class EventSink>
+inline void basic_dealer<N, EventSink>::deal_hole_cards() noexcept {
+    for (auto i : _players.filter()) {
+        _hole_cards[i] = {draw(), draw()};
+        auto e = hand_event{hand_event_type::hole_cards_dealt, static_cast<std::uint8_t>(i)};
+        e.num_cards = 2;
+        e.cards = {_hole_cards[i].first, _hole_cards[i].second};
+        emit(e);
     }
 }
 
 // Deals community cards up until the current round of betting.
-inline void dealer::deal_community_cards() noexcept {
+template<std::size_t N, class EventSink>
+inline void basic_dealer<N, EventSink>::deal_community_cards() noexcept {
     using poker::detail::to_underlying;
-    auto cards = std::vector<card>{};
-    const auto num_cards_to_deal = to_underlying(_round_of_betting) - _community_cards->cards().size();
-    std::generate_n(std::back_inserter(cards), num_cards_to_deal, [&] { return _deck->draw(); });
-    _community_cards->deal(cards);
+    // A street at a time: the flop, the turn and the river.
+    while (_community_cards->cards().size() < static_cast<std::size_t>(to_underlying(_round_of_betting))) {
+        auto e = hand_event{hand_event_type::community_cards_dealt};
+        e.num_cards = _community_cards->cards().empty() ? 3 : 1;
+        for (auto i = 0; i < e.num_cards; ++i) e.cards[i] = draw();
+        _community_cards->deal(e.dealt_cards());
+        emit(e);
+    }
 }
 
 } // namespace poker
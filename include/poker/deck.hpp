@@ -1,56 +1,264 @@
 #pragma once
 
 #include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
 
 #include <poker/card.hpp>
 #include "poker/detail/error.hpp"
+#include "poker/detail/random.hpp"
+#include "poker/detail/span.hpp"
 #include "poker/detail/utility.hpp"
 
 namespace poker {
 
+// A shuffled deck that shuffles as it deals: every draw() performs one step
+// of a Fisher-Yates shuffle, so a hand only pays for the random numbers and
+// swaps of the cards it actually uses. The deck is a uniformly random
+// permutation, and the same generator state always deals the same cards,
+// drawn lazily or not.
+//
+// The indices of the shuffle come from detail::uniform_index, not from
+// std::shuffle, so a seeded generator deals other cards than it did when
+// decks were shuffled with std::shuffle: hands recorded as seeds from then
+// do not replay.
+//
+// A deck never refers to the generator it was given:
+// - a small, trivially copyable rvalue (e.g. std::minstd_rand) is stored in
+//   the deck, and copies of the deck deal the same cards;
+// - an lvalue shuffles the whole deck up front, taking all the random
+//   numbers of the shuffle from it, so that the next deck from it deals
+//   other cards;
+// - any other rvalue shuffles the whole deck up front too;
+// - fill() leaves the generator with the owner of the deck, who passes it to
+//   every draw(g), e.g. a table dealing from its own ChaCha20 generator.
 class deck {
-    std::array<card, 52> _cards;
-    std::size_t _size = {0};
-
 public:
-    deck() noexcept = default;
+    //
+    // Constants
+    //
+    static constexpr auto max_inline_generator_size = std::size_t{64};
+
+    //
+    // Constructors
+    //
+    deck() noexcept = default; // An empty deck, with its cards in order.
+
+    template<class URBG, class = detail::enable_if_urbg_t<URBG, deck>>
+    deck(URBG&& g) noexcept {
+        fill_and_shuffle(std::forward<URBG>(g));
+    }
+
+    // A whole deck dealing the cards of 'order', first to last, e.g. to
+    // replay an archived hand.
+    explicit deck(span<const card, 52> order) POKER_NOEXCEPT;
+
+    //
+    // Observers
+    //
+    auto size() const noexcept -> std::size_t {
+        return _size;
+    }
 
+    // Whether the rest of the shuffle needs the generator of the owner; see
+    // fill().
+    auto needs_generator() const noexcept -> bool {
+        return _shuffled_by_owner;
+    }
+
+    //
+    // Modifiers
+    //
     template<class URBG>
-    deck(URBG&& g)
-        : _size{52}
-    {
-        using poker::detail::to_underlying;
-        constexpr auto first_suit = to_underlying(card_suit::clubs);
-        constexpr auto last_suit = to_underlying(card_suit::spades);
-        constexpr auto first_rank = to_underlying(card_rank::_2);
-        constexpr auto last_rank = to_underlying(card_rank::A);
-        auto i =  std::size_t{0};
-        for (auto suit = first_suit; suit <= last_suit; ++suit) {
-            for (auto rank = first_rank; rank <= last_rank; ++rank) {
-                const auto arank = static_cast<card_rank>(rank);
-                const auto asuit = static_cast<card_suit>(suit);
-                _cards[i] = card{arank, asuit};
-                ++i;
-            }
+    void fill_and_shuffle(URBG&& g) noexcept;
+
+    // Fills the deck to be shuffled as it deals by the generator given to
+    // every draw(g), which the owner of the deck keeps between draws.
+    void fill() noexcept;
+
+    [[nodiscard]]
+    auto draw() POKER_NOEXCEPT -> card;
+
+    // Draws with 'g' when the deck was filled by fill(), and like draw()
+    // otherwise.
+    template<class URBG>
+    [[nodiscard]]
+    auto draw(URBG& g) POKER_NOEXCEPT -> card;
+
+    // Every card in the order it is dealt, including those drawn already.
+    // Finishes the shuffle.
+    auto order() noexcept -> std::array<card, 52>;
+
+    // Performs the rest of the shuffle now, after which the deck no longer
+    // uses its generator, e.g. to hand it over to another thread. A deck
+    // filled by fill() must be given the generator of its owner.
+    void finish_shuffle() noexcept;
+
+    template<class URBG>
+    void finish_shuffle(URBG& g) noexcept;
+
+private:
+    template<class Engine>
+    static auto uniform_index(void* engine, std::size_t bound) noexcept -> std::size_t {
+        return detail::uniform_index(*static_cast<Engine*>(engine), static_cast<std::uint32_t>(bound));
+    }
+
+    static constexpr auto ordered_cards() noexcept -> std::array<card, 52> {
+        auto cards = std::array<card, 52>{};
+        for (auto i = std::size_t{0}; i < 52; ++i) {
+            cards[i] = card{static_cast<card_rank>(i % 13), static_cast<card_suit>(i / 13)};
         }
-        std::shuffle(begin(_cards), end(_cards), std::forward<URBG>(g));
+        return cards;
+    }
+
+    auto engine() noexcept -> void* {
+        return _inline_engine ? static_cast<void*>(_engine_storage) : _engine;
     }
 
+    void shuffle_step() noexcept;
     template<class URBG>
-    void fill_and_shuffle(URBG&& g) noexcept {
-        _size = 52;
-        std::shuffle(begin(_cards), end(_cards), std::forward<URBG>(g));
+    void shuffle_step(URBG& g) noexcept;
+    void swap_into_place(std::size_t j) noexcept;
+    void unshuffle() noexcept;
+
+private:
+    std::array<card, 52> _cards = ordered_cards();
+    std::size_t _size = 0;
+    // Index swapped into place by every shuffle step so far, the first step
+    // fixing _cards[51]. Undoing them puts the cards back in order, which is
+    // cheaper than refilling the deck.
+    std::array<std::uint8_t, 52> _swaps = {};
+    std::size_t _num_steps = 0;
+
+    auto (*_uniform_index)(void*, std::size_t) noexcept -> std::size_t = nullptr;
+    void* _engine = nullptr;
+    bool _inline_engine = false;
+    bool _shuffled_by_owner = false;
+    alignas(std::max_align_t) unsigned char _engine_storage[max_inline_generator_size] = {};
+};
+
+template<class URBG>
+void deck::fill_and_shuffle(URBG&& g) noexcept {
+    using engine_type = detail::remove_cvref_t<URBG>;
+    constexpr auto storable = std::is_trivially_copyable_v<engine_type>
+        && sizeof(engine_type) <= max_inline_generator_size
+        && alignof(engine_type) <= alignof(std::max_align_t);
+
+    unshuffle();
+    _size = 52;
+    _uniform_index = &uniform_index<engine_type>;
+    _inline_engine = false;
+    _shuffled_by_owner = false;
+    if constexpr (!std::is_lvalue_reference_v<URBG> && storable) {
+        ::new (static_cast<void*>(_engine_storage)) engine_type(std::move(g));
+        _inline_engine = true;
+    } else {
+        _engine = std::addressof(g);
+        finish_shuffle();
     }
+}
 
-    [[nodiscard]]
-    auto draw() POKER_NOEXCEPT -> card {
-        POKER_DETAIL_ASSERT(_size > 0, "Cannot draw from an empty deck");
-        return _cards[--_size];
+inline void deck::fill() noexcept {
+    unshuffle();
+    _size = 52;
+    _uniform_index = nullptr;
+    _engine = nullptr;
+    _inline_engine = false;
+    _shuffled_by_owner = true;
+}
+
+// Moves a uniformly chosen card among the first 52 - _num_steps into
+// position 51 - _num_steps.
+inline void deck::shuffle_step() noexcept {
+    const auto i = 51 - _num_steps;
+    // The last card has nowhere else to go, and costs no random number.
+    swap_into_place(i == 0 ? 0 : _uniform_index(engine(), i + 1));
+}
+
+template<class URBG>
+void deck::shuffle_step(URBG& g) noexcept {
+    const auto i = 51 - _num_steps;
+    swap_into_place(i == 0 ? 0 : detail::uniform_index(g, static_cast<std::uint32_t>(i + 1)));
+}
+
+inline void deck::swap_into_place(std::size_t j) noexcept {
+    const auto i = 51 - _num_steps;
+    std::swap(_cards[i], _cards[j]);
+    _swaps[_num_steps++] = static_cast<std::uint8_t>(j);
+}
+
+inline void deck::unshuffle() noexcept {
+    while (_num_steps > 0) {
+        --_num_steps;
+        std::swap(_cards[51 - _num_steps], _cards[_swaps[_num_steps]]);
     }
+}
 
-    auto size() const noexcept -> std::size_t {
-        return _size;
+inline deck::deck(span<const card, 52> order) POKER_NOEXCEPT
+    : _size{52}
+{
+    // Replays the shuffle steps that deal 'order', so that refilling the
+    // deck undoes them like any other shuffle.
+    auto positions = std::array<std::uint8_t, 52>{};
+    for (auto i = std::size_t{0}; i < 52; ++i) positions[i] = static_cast<std::uint8_t>(i);
+    auto index = [] (card c) {
+        return static_cast<std::size_t>(detail::to_underlying(c.suit) * 13 + detail::to_underlying(c.rank));
+    };
+    for (; _num_steps < 52; ++_num_steps) {
+        const auto i = 51 - _num_steps;
+        const auto j = std::size_t{positions[index(order[_num_steps])]};
+        POKER_DETAIL_ASSERT(j <= i, "Cards must not repeat");
+        positions[index(_cards[i])] = static_cast<std::uint8_t>(j);
+        positions[index(_cards[j])] = static_cast<std::uint8_t>(i);
+        std::swap(_cards[i], _cards[j]);
+        _swaps[_num_steps] = static_cast<std::uint8_t>(j);
     }
-};
+}
+
+inline auto deck::order() noexcept -> std::array<card, 52> {
+    finish_shuffle();
+    auto result = std::array<card, 52>{};
+    for (auto i = std::size_t{0}; i < 52; ++i) result[i] = _cards[51 - i];
+    return result;
+}
+
+inline void deck::finish_shuffle() noexcept {
+    assert(!_shuffled_by_owner && "The deck must be given the generator of its owner");
+    if (_uniform_index == nullptr) return;
+    while (_num_steps < 52) shuffle_step();
+    _uniform_index = nullptr;
+    _engine = nullptr;
+    _inline_engine = false;
+}
+
+template<class URBG>
+void deck::finish_shuffle(URBG& g) noexcept {
+    if (!_shuffled_by_owner) {
+        finish_shuffle();
+        return;
+    }
+    while (_num_steps < 52) shuffle_step(g);
+    _shuffled_by_owner = false;
+}
+
+inline auto deck::draw() POKER_NOEXCEPT -> card {
+    POKER_DETAIL_ASSERT(_size > 0, "Cannot draw from an empty deck");
+    POKER_DETAIL_ASSERT(!_shuffled_by_owner, "The deck must be given the generator of its owner");
+    if (_num_steps < 53 - _size) shuffle_step();
+    return _cards[--_size];
+}
+
+template<class URBG>
+auto deck::draw(URBG& g) POKER_NOEXCEPT -> card {
+    if (!_shuffled_by_owner) return draw();
+    POKER_DETAIL_ASSERT(_size > 0, "Cannot draw from an empty deck");
+    if (_num_steps < 53 - _size) shuffle_step(g);
+    if (_num_steps == 52) _shuffled_by_owner = false;
+    return _cards[--_size];
+}
 
 } // namespace poker
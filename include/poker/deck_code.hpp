@@ -0,0 +1,125 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <poker/card_set.hpp>
+#include <poker/deck.hpp>
+#include "poker/detail/bits.hpp"
+#include "poker/detail/error.hpp"
+#include "poker/detail/span.hpp"
+
+namespace poker {
+
+// The order of a whole deck in 29 bytes: its rank among the 52! < 2^226
+// permutations, little endian. Digit i of the rank in the factorial number
+// system (its Lehmer code) is the number of cards dealt after card i that
+// come before it in card_index order, which is a popcount over the cards not
+// dealt yet.
+using deck_code = std::array<std::uint8_t, 29>;
+
+namespace detail {
+
+// Consecutive radices 52 - i of the Lehmer digits, grouped so that the
+// product of each group fits in 32 bits and the big number only gets one
+// multiplication or division per group.
+struct lehmer_group {
+    std::size_t first;
+    std::size_t last;
+    std::uint32_t radix;
+};
+
+constexpr auto make_lehmer_groups() noexcept -> std::array<lehmer_group, 8> {
+    auto groups = std::array<lehmer_group, 8>{};
+    auto g = std::size_t{0};
+    auto first = std::size_t{0};
+    auto radix = std::uint64_t{1};
+    for (auto i = std::size_t{0}; i < 52; ++i) {
+        if (radix * (52 - i) > 0xffffffff) {
+            groups[g++] = {first, i, static_cast<std::uint32_t>(radix)};
+            first = i;
+            radix = 1;
+        }
+        radix *= 52 - i;
+    }
+    groups[g] = {first, 52, static_cast<std::uint32_t>(radix)};
+    return groups;
+}
+
+inline constexpr auto lehmer_groups = make_lehmer_groups();
+
+// The rank as 32-bit limbs, least significant first.
+using deck_rank = std::array<std::uint32_t, 8>;
+
+} // namespace detail
+
+inline auto encode_deck_order(span<const card, 52> order) POKER_NOEXCEPT -> deck_code {
+    auto rank = detail::deck_rank{};
+    auto remaining = card_set::full_deck().bits();
+    auto digit = [&] (std::size_t i) -> std::uint32_t {
+        const auto b = card_set::bit(order[i]);
+        POKER_DETAIL_ASSERT((remaining & b) != 0, "Cards must not repeat");
+        remaining &= ~b;
+        return static_cast<std::uint32_t>(detail::popcount(remaining & (b - 1)));
+    };
+    for (const auto& group : detail::lehmer_groups) {
+        auto chunk = std::uint64_t{0};
+        for (auto i = group.first; i < group.last; ++i) chunk = chunk * (52 - i) + digit(i);
+        // rank = rank * radix + chunk
+        auto carry = chunk;
+        for (auto& limb : rank) {
+            const auto x = std::uint64_t{limb} * group.radix + carry;
+            limb = static_cast<std::uint32_t>(x);
+            carry = x >> 32;
+        }
+    }
+
+    auto code = deck_code{};
+    for (auto i = std::size_t{0}; i < code.size(); ++i) {
+        code[i] = static_cast<std::uint8_t>(rank[i / 4] >> (8 * (i % 4)));
+    }
+    return code;
+}
+
+inline auto encode_deck_order(deck& d) noexcept -> deck_code {
+    return encode_deck_order(d.order());
+}
+
+// EXPECTS: 'code' was made by encode_deck_order
+inline auto decode_deck_order(const deck_code& code) POKER_NOEXCEPT -> std::array<card, 52> {
+    auto rank = detail::deck_rank{};
+    for (auto i = std::size_t{0}; i < code.size(); ++i) {
+        rank[i / 4] |= std::uint32_t{code[i]} << (8 * (i % 4));
+    }
+
+    // Digits come out last first.
+    auto digits = std::array<std::uint8_t, 52>{};
+    const auto& groups = detail::lehmer_groups;
+    for (auto g = groups.size(); g-- > 0;) {
+        // chunk = rank % radix, rank /= radix
+        auto remainder = std::uint64_t{0};
+        for (auto limb = rank.size(); limb-- > 0;) {
+            const auto x = (remainder << 32) | rank[limb];
+            rank[limb] = static_cast<std::uint32_t>(x / groups[g].radix);
+            remainder = x % groups[g].radix;
+        }
+        for (auto i = groups[g].last; i-- > groups[g].first;) {
+            digits[i] = static_cast<std::uint8_t>(remainder % (52 - i));
+            remainder /= 52 - i;
+        }
+    }
+    POKER_DETAIL_ASSERT(std::all_of(rank.begin(), rank.end(), [] (auto limb) { return limb == 0; }), "Invalid deck code");
+
+    auto order = std::array<card, 52>{};
+    auto remaining = card_set::full_deck().bits();
+    for (auto i = std::size_t{0}; i < 52; ++i) {
+        const auto position = detail::nth_set_bit(remaining, digits[i]);
+        remaining &= ~(std::uint64_t{1} << position);
+        order[i] = card_from_index(static_cast<std::size_t>(position % 16 + 13 * (position / 16)));
+    }
+    return order;
+}
+
+} // namespace poker
@@ -20,13 +20,10 @@ struct chip_range {
 
 namespace poker::detail {
 
-class betting_round {
+// What does not depend on the number of seats, shared by every
+// basic_betting_round.
+class betting_round_base {
 public:
-    //
-    // Constants
-    //
-    static constexpr auto num_seats = 9;
-
     //
     // Types
     //
@@ -36,20 +33,52 @@ public:
         bool can_raise;
         poker::chip_range chip_range = {0, 0};
     };
+};
+
+template<std::size_t N>
+class basic_betting_round : public betting_round_base {
+public:
+    //
+    // Constants
+    //
+    static constexpr auto num_seats = N;
+
+    //
+    // Types
+    //
+    using round = basic_round<N>;
+    using seat_array = basic_seat_array<N>;
+    using seat_array_view = basic_seat_array_view<N>;
+
+    // What an action changes, but for the player who acts.
+    struct undo_type {
+        typename basic_round<N>::undo_type round;
+        chips biggest_bet = 0;
+        chips min_raise = 0;
+    };
+
+    // Everything but the players, which stay where they are.
+    struct snapshot_type {
+        basic_round<N> round;
+        chips biggest_bet = 0;
+        chips min_raise = 0;
+    };
 
     //
     // Special functions
     //
-    betting_round()                     = default;
-    betting_round(const betting_round&) = delete;
-    betting_round(betting_round&&)      = delete;
-    auto operator=(const betting_round&) -> betting_round& = delete;
-    auto operator=(betting_round&&)      -> betting_round& = delete;
+    basic_betting_round()                           = default;
+    basic_betting_round(const basic_betting_round&) = delete;
+    basic_betting_round(basic_betting_round&&)      = delete;
+    auto operator=(const basic_betting_round&) -> basic_betting_round& = delete;
+    auto operator=(basic_betting_round&&)      -> basic_betting_round& = delete;
 
     //
     // Constructors
     //
-    betting_round(seat_array_view players, seat_index first_to_act, chips min_raise, chips biggest_bet = 0) POKER_NOEXCEPT;
+    basic_betting_round(seat_array_view players, seat_index first_to_act, chips min_raise, chips biggest_bet = 0) POKER_NOEXCEPT;
+    // Resumes a snapshot of a betting round of 'players'.
+    basic_betting_round(seat_array& players, const snapshot_type&) noexcept;
 
     //
     // Observers
@@ -59,14 +88,19 @@ public:
     auto biggest_bet()        const noexcept -> chips;
     auto min_raise()          const noexcept -> chips;
     auto players()            const noexcept -> seat_array_view;
-    auto active_players()     const noexcept -> const std::array<bool,num_seats>&;
+    auto active_players()     const noexcept -> seat_set;
     auto num_active_players() const noexcept -> std::size_t;
     auto legal_actions()      const noexcept -> action_range;
+    auto snapshot()           const noexcept -> snapshot_type;
+    auto undo_state()         const noexcept -> undo_type;
 
     //
     // Modifiers
     //
     void action_taken(action, chips bet = 0) noexcept;
+    // Takes back the actions since 'undo_state()' returned 'u', but for what
+    // they did to the players.
+    void undo(const undo_type& u) noexcept;
 
 private:
     auto is_raise_valid(chips bet) const noexcept -> bool;
@@ -79,7 +113,8 @@ private:
     chips _min_raise = 0;
 };
 
-inline betting_round::betting_round(
+template<std::size_t N>
+inline basic_betting_round<N>::basic_betting_round(
     seat_array_view players, seat_index first_to_act, chips min_raise, chips biggest_bet/*= 0*/) POKER_NOEXCEPT
     : _round{players.filter(), first_to_act}
     , _players{&players.underlying()}
@@ -90,35 +125,52 @@ inline betting_round::betting_round(
     POKER_DETAIL_ASSERT(players.filter()[first_to_act], "First player to act must exist");
 }
 
-inline auto betting_round::in_progress() const noexcept -> bool {
+template<std::size_t N>
+inline basic_betting_round<N>::basic_betting_round(seat_array& players, const snapshot_type& s) noexcept
+    : _round{s.round}
+    , _players{&players}
+    , _biggest_bet{s.biggest_bet}
+    , _min_raise{s.min_raise}
+{
+}
+
+template<std::size_t N>
+inline auto basic_betting_round<N>::in_progress() const noexcept -> bool {
     return _round.in_progress();
 }
 
-inline auto betting_round::player_to_act() const noexcept -> seat_index {
+template<std::size_t N>
+inline auto basic_betting_round<N>::player_to_act() const noexcept -> seat_index {
     return _round.player_to_act();
 }
 
-inline auto betting_round::biggest_bet() const noexcept -> chips {
+template<std::size_t N>
+inline auto basic_betting_round<N>::biggest_bet() const noexcept -> chips {
     return _biggest_bet;
 }
 
-inline auto betting_round::min_raise() const noexcept -> chips {
+template<std::size_t N>
+inline auto basic_betting_round<N>::min_raise() const noexcept -> chips {
     return _min_raise;
 }
 
-inline auto betting_round::players() const noexcept -> seat_array_view {
+template<std::size_t N>
+inline auto basic_betting_round<N>::players() const noexcept -> seat_array_view {
     return {*_players, _round.active_players()};
 }
 
-inline auto betting_round::active_players() const noexcept -> const std::array<bool,num_seats>& {
+template<std::size_t N>
+inline auto basic_betting_round<N>::active_players() const noexcept -> seat_set {
     return _round.active_players();
 }
 
-inline auto betting_round::num_active_players() const noexcept -> std::size_t {
+template<std::size_t N>
+inline auto basic_betting_round<N>::num_active_players() const noexcept -> std::size_t {
     return _round.num_active_players();
 }
 
-inline auto betting_round::legal_actions() const noexcept -> action_range {
+template<std::size_t N>
+inline auto basic_betting_round<N>::legal_actions() const noexcept -> action_range {
     // A player can raise if his stack+bet_size is greater than _biggest_bet
     const auto& player = (*_players)[_round.player_to_act()];
     const auto player_chips = player.total_chips();
@@ -132,7 +184,25 @@ inline auto betting_round::legal_actions() const noexcept -> action_range {
     }
 }
 
-inline void betting_round::action_taken(action a, chips bet/*= 0*/) noexcept {
+template<std::size_t N>
+inline auto basic_betting_round<N>::snapshot() const noexcept -> snapshot_type {
+    return {_round, _biggest_bet, _min_raise};
+}
+
+template<std::size_t N>
+inline auto basic_betting_round<N>::undo_state() const noexcept -> undo_type {
+    return {_round.undo_state(), _biggest_bet, _min_raise};
+}
+
+template<std::size_t N>
+inline void basic_betting_round<N>::undo(const undo_type& u) noexcept {
+    _round.undo(u.round);
+    _biggest_bet = u.biggest_bet;
+    _min_raise = u.min_raise;
+}
+
+template<std::size_t N>
+inline void basic_betting_round<N>::action_taken(action a, chips bet/*= 0*/) noexcept {
     // chips bet is ignored when not needed
     auto& player = (*_players)[_round.player_to_act()];
     if (a == action::raise) {
@@ -158,7 +228,8 @@ inline void betting_round::action_taken(action a, chips bet/*= 0*/) noexcept {
     }
 }
 
-inline auto betting_round::is_raise_valid(chips bet) const noexcept -> bool {
+template<std::size_t N>
+inline auto basic_betting_round<N>::is_raise_valid(chips bet) const noexcept -> bool {
     const auto& player = (*_players)[_round.player_to_act()];
     const auto player_chips = player.stack() + player.bet_size();
     const auto min_bet = _biggest_bet + _min_raise;
@@ -168,4 +239,6 @@ inline auto betting_round::is_raise_valid(chips bet) const noexcept -> bool {
         return bet >= min_bet && bet <= player_chips;
 }
 
+using betting_round = basic_betting_round<9>;
+
 } // namespace poker::detail
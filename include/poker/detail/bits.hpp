@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#   include <intrin.h>
+#endif
+
+namespace poker::detail {
+
+inline auto popcount(std::uint64_t x) noexcept -> int {
+#if defined(_MSC_VER) && !defined(__clang__)
+    return static_cast<int>(__popcnt64(x));
+#else
+    return __builtin_popcountll(x);
+#endif
+}
+
+// EXPECTS: x != 0
+inline auto countr_zero(std::uint64_t x) noexcept -> int {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(x);
+#endif
+}
+
+// EXPECTS: x != 0
+inline auto bit_width(std::uint64_t x) noexcept -> int {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanReverse64(&index, x);
+    return static_cast<int>(index) + 1;
+#else
+    return 64 - __builtin_clzll(x);
+#endif
+}
+
+// Position of the n-th (zero-based) set bit of x.
+// EXPECTS: popcount(x) > n
+inline auto nth_set_bit(std::uint64_t x, int n) noexcept -> int {
+    for (; n > 0; --n) x &= x - 1;
+    return countr_zero(x);
+}
+
+} // namespace poker::detail
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+
+#include <poker/card_set.hpp>
+#include "poker/detail/bits.hpp"
+
+namespace poker::detail {
+
+// Keeps the 'n' most significant set bits of 'mask'.
+inline auto top_bits(std::uint32_t mask, int n) noexcept -> std::uint32_t {
+    while (popcount(mask) > n) mask &= mask - 1;
+    return mask;
+}
+
+// Rank bit of the highest card of a straight within 'ranks', or 0.
+inline auto straight_top(std::uint32_t ranks) noexcept -> std::uint32_t {
+    // The ace also plays low.
+    const auto with_low_ace = (ranks << 1) | (ranks >> 12 & 1);
+    const auto runs = with_low_ace & (with_low_ace >> 1) & (with_low_ace >> 2) & (with_low_ace >> 3) & (with_low_ace >> 4);
+    if (runs == 0) return 0;
+    // 'runs' has bit r+1-4 set for a straight topped by rank r.
+    return std::uint32_t{1} << (bit_width(runs) - 1 + 3);
+}
+
+// Strength of the best five-card hand within 5 to 7 cards, such that a higher
+// value is a better hand and equal values tie. The ranking orders like
+// hand_ranking; the rest holds the ranks that break ties as bit masks.
+inline auto hand_value(card_set cards) noexcept -> std::uint32_t {
+    enum : std::uint32_t { high_card, pair, two_pair, three_of_a_kind, straight, flush, full_house, four_of_a_kind, straight_flush };
+    const auto make = [] (std::uint32_t category, std::uint32_t primary, std::uint32_t secondary) {
+        return category << 26 | primary << 13 | secondary;
+    };
+
+    const auto c = std::uint32_t{cards.ranks(card_suit::clubs)};
+    const auto d = std::uint32_t{cards.ranks(card_suit::diamonds)};
+    const auto h = std::uint32_t{cards.ranks(card_suit::hearts)};
+    const auto s = std::uint32_t{cards.ranks(card_suit::spades)};
+    const auto ranks = c | d | h | s;
+
+    for (auto suited : {c, d, h, s}) {
+        if (popcount(suited) >= 5) {
+            if (const auto top = straight_top(suited)) return make(straight_flush, top, 0);
+            return make(flush, top_bits(suited, 5), 0);
+        }
+    }
+
+    const auto four = c & d & h & s;
+    if (four) return make(four_of_a_kind, four, top_bits(ranks & ~four, 1));
+
+    const auto three = (c & d & h) | (c & d & s) | (c & h & s) | (d & h & s);
+    const auto two = (c & d) | (c & h) | (c & s) | (d & h) | (d & s) | (h & s);
+    if (three) {
+        const auto trips = top_bits(three, 1);
+        const auto pairs = two & ~trips;
+        if (pairs) return make(full_house, trips, top_bits(pairs, 1));
+    }
+    if (const auto top = straight_top(ranks)) return make(straight, top, 0);
+    if (three) return make(three_of_a_kind, three, top_bits(ranks & ~three, 2));
+    if (popcount(two) >= 2) {
+        const auto pairs = top_bits(two, 2);
+        return make(two_pair, pairs, top_bits(ranks & ~pairs, 1));
+    }
+    if (two) return make(pair, two, top_bits(ranks & ~two, 3));
+    return make(high_card, 0, top_bits(ranks, 5));
+}
+
+} // namespace poker::detail
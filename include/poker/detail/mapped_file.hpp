@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#ifdef _WIN32
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include <windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace poker::detail {
+
+// Read-only memory mapping of a whole file.
+class mapped_file {
+public:
+    //
+    // Special functions
+    //
+    mapped_file() noexcept = default;
+    mapped_file(const mapped_file&) = delete;
+    auto operator=(const mapped_file&) -> mapped_file& = delete;
+
+    mapped_file(mapped_file&& other) noexcept
+        : _data{std::exchange(other._data, nullptr)}
+        , _size{std::exchange(other._size, 0)}
+    {
+    }
+
+    auto operator=(mapped_file&& other) noexcept -> mapped_file& {
+        if (this != &other) {
+            unmap();
+            _data = std::exchange(other._data, nullptr);
+            _size = std::exchange(other._size, 0);
+        }
+        return *this;
+    }
+
+    ~mapped_file() {
+        unmap();
+    }
+
+    //
+    // Constructors
+    //
+    explicit mapped_file(const std::string& path);
+
+    //
+    // Observers
+    //
+    auto data() const noexcept -> const std::byte* { return _data; }
+    auto size() const noexcept -> std::size_t      { return _size; }
+
+private:
+    void unmap() noexcept;
+
+private:
+    const std::byte* _data = nullptr;
+    std::size_t      _size = 0;
+};
+
+#ifdef _WIN32
+
+inline mapped_file::mapped_file(const std::string& path) {
+    const auto file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::system_error{static_cast<int>(::GetLastError()), std::system_category(), "Cannot open " + path};
+    }
+    auto size = LARGE_INTEGER{};
+    if (!::GetFileSizeEx(file, &size)) {
+        const auto error = ::GetLastError();
+        ::CloseHandle(file);
+        throw std::system_error{static_cast<int>(error), std::system_category(), "Cannot stat " + path};
+    }
+    _size = static_cast<std::size_t>(size.QuadPart);
+    if (_size == 0) {
+        ::CloseHandle(file);
+        return;
+    }
+    const auto mapping = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    ::CloseHandle(file);
+    if (mapping == nullptr) {
+        throw std::system_error{static_cast<int>(::GetLastError()), std::system_category(), "Cannot map " + path};
+    }
+    const auto view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    ::CloseHandle(mapping);
+    if (view == nullptr) {
+        throw std::system_error{static_cast<int>(::GetLastError()), std::system_category(), "Cannot map " + path};
+    }
+    _data = static_cast<const std::byte*>(view);
+}
+
+inline void mapped_file::unmap() noexcept {
+    if (_data != nullptr) ::UnmapViewOfFile(_data);
+    _data = nullptr;
+    _size = 0;
+}
+
+#else
+
+inline mapped_file::mapped_file(const std::string& path) {
+    const auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        throw std::system_error{errno, std::generic_category(), "Cannot open " + path};
+    }
+    struct ::stat st = {};
+    if (::fstat(fd, &st) == -1) {
+        const auto error = errno;
+        ::close(fd);
+        throw std::system_error{error, std::generic_category(), "Cannot stat " + path};
+    }
+    _size = static_cast<std::size_t>(st.st_size);
+    if (_size == 0) {
+        ::close(fd);
+        return;
+    }
+    const auto addr = ::mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+    const auto error = errno;
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        _size = 0;
+        throw std::system_error{error, std::generic_category(), "Cannot map " + path};
+    }
+    _data = static_cast<const std::byte*>(addr);
+}
+
+inline void mapped_file::unmap() noexcept {
+    if (_data != nullptr) ::munmap(const_cast<std::byte*>(_data), _size);
+    _data = nullptr;
+    _size = 0;
+}
+
+#endif
+
+} // namespace poker::detail
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "poker/detail/error.hpp"
+
+namespace poker::detail {
+
+// A bounded multi-producer multi-consumer queue without locks (Vyukov's):
+// every cell carries a sequence number telling producers and consumers
+// whose turn it is, so they only contend on the position counters.
+// T must be default constructible and nothrow move assignable.
+template<class T>
+class mpmc_ring {
+public:
+    // EXPECTS: capacity is a power of 2
+    explicit mpmc_ring(std::size_t capacity) POKER_NOEXCEPT
+        : _cells{std::make_unique<cell[]>(capacity)}
+        , _mask{capacity - 1}
+    {
+        POKER_DETAIL_ASSERT(capacity >= 2 && (capacity & (capacity - 1)) == 0, "Capacity must be a power of 2");
+        for (auto i = std::size_t{0}; i < capacity; ++i) _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    mpmc_ring(const mpmc_ring&) = delete;
+    auto operator=(const mpmc_ring&) -> mpmc_ring& = delete;
+
+    auto capacity() const noexcept -> std::size_t { return _mask + 1; }
+
+    // Approximate while other threads push or pop.
+    auto size() const noexcept -> std::size_t {
+        const auto tail = _tail.load(std::memory_order_relaxed);
+        const auto head = _head.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+    // Returns false if the ring is full.
+    auto try_push(T&& value) noexcept -> bool {
+        auto position = _tail.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& c = _cells[position & _mask];
+            const auto sequence = c.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+            if (difference == 0) {
+                if (_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    c.value = std::move(value);
+                    c.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = _tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Returns false if the ring is empty.
+    auto try_pop(T& value) noexcept -> bool {
+        auto position = _head.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& c = _cells[position & _mask];
+            const auto sequence = c.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+            if (difference == 0) {
+                if (_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    value = std::move(c.value);
+                    c.sequence.store(position + _mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = _head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    struct cell {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<cell[]> _cells;
+    std::size_t _mask;
+    // On separate cache lines, so that producers and consumers do not slow
+    // each other down.
+    alignas(64) std::atomic<std::size_t> _tail = 0;
+    alignas(64) std::atomic<std::size_t> _head = 0;
+};
+
+} // namespace poker::detail
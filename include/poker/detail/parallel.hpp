@@ -0,0 +1,38 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace poker::detail {
+
+// Number of worker threads to use when the caller asked for 'requested'
+// (0 meaning "all cores").
+inline auto num_threads(unsigned requested = 0) noexcept -> unsigned {
+    if (requested != 0) return requested;
+    const auto n = std::thread::hardware_concurrency();
+    return n == 0 ? 1 : n;
+}
+
+// Splits [0, n) into at most 'threads' contiguous chunks and calls
+// f(chunk_index, first, last) for each of them concurrently. The calling
+// thread processes the first chunk. 'f' must not throw.
+template<class F>
+void parallel_for(std::size_t n, unsigned threads, F&& f) {
+    if (n == 0) return;
+    const auto num_chunks = static_cast<std::size_t>(std::min<std::size_t>(std::max(threads, 1u), n));
+    const auto chunk_size = (n + num_chunks - 1) / num_chunks;
+    auto workers = std::vector<std::thread>{};
+    workers.reserve(num_chunks - 1);
+    for (auto chunk = std::size_t{1}; chunk < num_chunks; ++chunk) {
+        const auto first = chunk * chunk_size;
+        const auto last = std::min(n, first + chunk_size);
+        if (first >= last) break;
+        workers.emplace_back([&f, chunk, first, last] { f(chunk, first, last); });
+    }
+    f(std::size_t{0}, std::size_t{0}, std::min(n, chunk_size));
+    for (auto& w : workers) w.join();
+}
+
+} // namespace poker::detail
@@ -1,46 +1,153 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
 #include <poker/pot.hpp>
+#include "poker/detail/error.hpp"
 
 namespace poker::detail {
 
-class pot_manager {
-    std::vector<pot> _pots; // FIXME: static_vector with max_players-1 capacity
+template<std::size_t N>
+class basic_pot_manager {
+public:
+    // Every pot but the last is capped by a player who is all-in in it.
+    static constexpr auto max_pots = N;
+
+    // One per bettor for each pot up to their bet, one per pot for the folded
+    // bets it takes, and one for the folded bets left over.
+    static constexpr auto max_transactions = N * (N + 1) / 2 + N + 1;
+
+private:
+    std::array<pot, max_pots> _pots = {};
+    std::size_t _num_pots = 1;
     chips _aggregate_folded_bets = {0};
+    std::array<pot_transaction, max_transactions> _transactions;
+    std::size_t _num_transactions = 0;
 
 public:
-    pot_manager() noexcept : _pots{1} {}
+    // The pots by value, with their eligible players as seat masks.
+    struct snapshot_type {
+        std::array<chips, max_pots> sizes = {};
+        std::array<seat_set, max_pots> eligible_players = {};
+        std::uint8_t num_pots = 0;
+        chips aggregate_folded_bets = 0;
+    };
 
-    auto pots() const noexcept -> span<const pot> { return _pots; }
+    auto pots() const noexcept -> span<const pot> { return span<const pot>(_pots).first(_num_pots); }
+
+    // The chips moved by the last collection of bets, pot by pot.
+    auto transactions() const noexcept -> span<const pot_transaction> {
+        return span<const pot_transaction>(_transactions).first(_num_transactions);
+    }
+
+    auto snapshot() const noexcept -> snapshot_type {
+        auto s = snapshot_type{};
+        s.num_pots = static_cast<std::uint8_t>(_num_pots);
+        s.aggregate_folded_bets = _aggregate_folded_bets;
+        for (auto i = std::size_t{0}; i < _num_pots; ++i) {
+            s.sizes[i] = _pots[i].size();
+            s.eligible_players[i] = _pots[i].eligible_players();
+        }
+        return s;
+    }
+
+    void restore(const snapshot_type& s) POKER_NOEXCEPT {
+        POKER_DETAIL_ASSERT(s.num_pots >= 1 && s.num_pots <= max_pots, "Invalid number of pots");
+        _num_pots = s.num_pots;
+        for (auto i = std::size_t{0}; i < _num_pots; ++i) _pots[i] = pot{s.eligible_players[i], s.sizes[i]};
+        _aggregate_folded_bets = s.aggregate_folded_bets;
+        _num_transactions = 0;
+    }
 
     void bet_folded(chips amount) noexcept {
         _aggregate_folded_bets += amount;
     }
 
-    void collect_bets_from(seat_array_view players) noexcept {
-        // TODO: Return a list of transactions.
-        for (;;) {
-            const auto min_bet = _pots.back().collect_bets_from(players);
+    void take_back_folded_bet(chips amount) POKER_NOEXCEPT {
+        POKER_DETAIL_ASSERT(amount <= _aggregate_folded_bets, "Cannot take back more than was folded");
+        _aggregate_folded_bets -= amount;
+    }
+
+    void collect_bets_from(basic_seat_array_view<N> players) POKER_NOEXCEPT {
+        collect_bets_from(players, [] (std::size_t, const pot&) {});
+    }
+
+    // Calls 'on_pot(index, pot)' for every pot the bets went to, once they are
+    // all collected.
+    //
+    // The bets are sorted once. Every distinct bet, smallest first, closes a
+    // pot that all the players who bet at least as much are eligible for, and
+    // that the folded bets fill up to what each of them put in.
+    template<class OnPot>
+    void collect_bets_from(basic_seat_array_view<N> players, OnPot&& on_pot) POKER_NOEXCEPT {
+        auto bets = std::array<chips, N>{};
+        auto levels = std::array<chips, N>{};
+        auto num_levels = std::size_t{0};
+        auto bettors = seat_set{};
+        for (auto it = players.begin(); it != players.end(); ++it) {
+            const auto seat = it.index();
+            bets[seat] = (*it).bet_size();
+            if (bets[seat] == 0) continue;
+            bettors.insert(seat);
+            // Insertion sort: there are only a few seats.
+            auto i = num_levels++;
+            for (; i > 0 && levels[i - 1] > bets[seat]; --i) levels[i] = levels[i - 1];
+            levels[i] = bets[seat];
+        }
+
+        _num_transactions = 0;
+        const auto first_pot = _num_pots - 1;
+        if (bettors.empty()) {
+            // If no players have bet, the pot stays with the players still in it.
+            // It is possible that some player has folded even if nobody has bet.
+            _pots[_num_pots - 1] = pot{players.filter(), _pots[_num_pots - 1].size()};
+        }
+        auto collected = chips{0};
+        for (auto l = std::size_t{0}; l < num_levels; ++l) {
+            if (levels[l] == collected) continue;
+            if (collected != 0) {
+                POKER_DETAIL_ASSERT(_num_pots < max_pots, "There cannot be more pots than seats");
+                _pots[_num_pots++] = pot{};
+            }
+            const auto index = _num_pots - 1;
+            const auto amount = levels[l] - collected;
+            for (auto seat : bettors) record(seat, index, amount);
 
             // Calculate the right amount of folded bets to add to the pot.
             // Logic: If 'x' is chips which a player committed to the pot and 'n' is number of (eligible) players in that pot,
             // a player can win exactly x*n chips (from that particular pot).
-            const auto num_eligible_players = static_cast<chips>(_pots.back().eligible_players().size());
-            const auto aggregate_folded_bets_consumed_amount = std::min(_aggregate_folded_bets, num_eligible_players * min_bet);
-            _pots.back().add(aggregate_folded_bets_consumed_amount);
+            const auto num_eligible_players = static_cast<chips>(bettors.size());
+            const auto aggregate_folded_bets_consumed_amount = std::min(_aggregate_folded_bets, num_eligible_players * amount);
+            _pots[index] = pot{bettors, _pots[index].size() + num_eligible_players * amount + aggregate_folded_bets_consumed_amount};
             _aggregate_folded_bets -= aggregate_folded_bets_consumed_amount;
+            record(pot_transaction::folded_bets, index, aggregate_folded_bets_consumed_amount);
 
-            auto it = std::find_if(players.begin(), players.end(), [] (const auto& p) { return p.bet_size() != 0; });
-            if (it != players.end()) {
-                _pots.emplace_back();
-                continue;
-            } else if (_aggregate_folded_bets != 0) {
-                _pots.back().add(_aggregate_folded_bets);
-                _aggregate_folded_bets = 0;
+            collected = levels[l];
+            for (auto seat : bettors) {
+                if (bets[seat] == collected) bettors.erase(seat);
             }
-            break;
         }
+        if (_aggregate_folded_bets != 0) {
+            _pots[_num_pots - 1].add(_aggregate_folded_bets);
+            record(pot_transaction::folded_bets, _num_pots - 1, _aggregate_folded_bets);
+            _aggregate_folded_bets = 0;
+        }
+        for (auto it = players.begin(); it != players.end(); ++it) {
+            if (bets[it.index()] != 0) (*it).take_from_bet(bets[it.index()]);
+        }
+
+        for (auto i = first_pot; i < _num_pots; ++i) on_pot(i, static_cast<const pot&>(_pots[i]));
+    }
+
+private:
+    void record(std::size_t seat, std::size_t pot, chips amount) noexcept {
+        if (amount == 0) return;
+        _transactions[_num_transactions++] = {static_cast<std::uint8_t>(seat), static_cast<std::uint8_t>(pot), amount};
     }
 };
 
+using pot_manager = basic_pot_manager<9>;
+
 } // namespace poker::detail
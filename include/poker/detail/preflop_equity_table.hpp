@@ -0,0 +1,2892 @@
+#pragma once
+
+#include <cstdint>
+
+// Generated by tools/preflop_equity_table.cpp; do not edit.
+
+namespace poker::detail {
+
+// For every matchup of preflop classes 'hero <= villain', row by row: over
+// every pair of non-conflicting combinations and every board of the 48
+// other cards, how many the hero wins and how many tie.
+inline constexpr std::uint32_t preflop_wins[14365] = {
+    214008, 39156000, 38918616, 38681232, 39624564, 40294560, 40058208, 40058208, 40023288, 40260672,
+    40498056, 40735440, 40064412, 12306540, 10530612, 62627976, 62203680, 63002772, 63182196, 64891944,
+    64467648, 64397448, 64821744, 65246040, 65670336, 65097828, 12234000, 19860852, 10512864, 60730632,
+    61529724, 61709148, 63418896, 64467648, 63973152, 64397448, 64821744, 65246040, 64673532, 12161460,
+    19731000, 19277988, 10495116, 60056676, 60236100, 61945848, 62994600, 63973152, 63973152, 64397448,
+    64821744, 64249236, 12450468, 19985820, 19532808, 19079796, 10743516, 58600008, 60362604, 61411356,
+    62389908, 63862956, 63862956, 64287252, 65048328, 12656316, 20045112, 19592100, 19139088, 18630108,
+    10725768, 58742316, 59791068, 60769620, 62242668, 63715716, 63715716, 64232856, 12583776, 20575512,
+    20122500, 19669488, 19177944, 18674976, 10991916, 58884264, 59862816, 61335864, 62808912, 64281960,
+    64374804, 12583776, 20445660, 20445660, 19992648, 19501104, 18998136, 18719844, 10991916, 58814064,
+    60287112, 61760160, 63233208, 64799100, 12573156, 20424240, 20294388, 20294388, 19802844, 19299876,
+    19021584, 18698424, 10991916, 58743864, 60216912, 61689960, 63255852, 12645696, 20554092, 20424240,
+    20294388, 20255856, 19752888, 19474596, 19151436, 18677004, 11009664, 60641208, 62114256, 63680148,
+    12718236, 20683944, 20554092, 20424240, 20255856, 20205900, 19927608, 19604448, 19130016, 19259868,
+    11027412, 62538552, 64104444, 12790776, 20813796, 20683944, 20554092, 20385708, 20205900, 20380620,
+    20057460, 19583028, 19712880, 19842732, 11045160, 64528740, 12584928, 20628756, 20498904, 20369052,
+    20623872, 20368272, 20413140, 20542992, 20068560, 20198412, 20328264, 20458116, 10796760, 2167296,
+    41581860, 41502756, 45172176, 47358912, 47281356, 48022932, 48022932, 48102036, 48181140, 48260244,
+    45331392, 863760, 4646772, 39158532, 39079428, 41977500, 41872692, 45422736, 45345180, 45345180,
+    45424284, 45503388, 45582492, 42684456, 13340388, 12696300, 13204944, 71924904, 76040100, 78080364,
+    81009360, 82313820, 82102428, 82313820, 82525212, 82736604, 79378452, 13316100, 12672012, 22958556,
+    13204944, 74816820, 76857084, 79786080, 81090540, 82102428, 82102428, 82313820, 82525212, 79167060,
+    14411112, 13529880, 24242124, 23867076, 15366996, 75355128, 78363756, 80551512, 81563400, 82786680,
+    82786680, 82998072, 83282256, 15059916, 13470600, 24870648, 24495600, 23978748, 16352316, 74365956,
+    79001280, 80013168, 81236448, 82459728, 82459728, 82033560, 15035628, 14572608, 25780272, 25405224,
+    24914448, 23634960, 16771824, 78616188, 79628076, 80851356, 82074636, 83297916, 82660356, 15264216,
+    14548320, 26192544, 25817496, 25598460, 25080228, 24964392, 17320716, 79501032, 80724312, 81947592,
+    83170872, 83756592, 15264216, 14548320, 26127888, 26127888, 25908852, 25390620, 25274784, 25238148,
+    17320716, 79360632, 80583912, 81807192, 82533312, 15288504, 14572608, 26192544, 26127888, 26283900,
+    25765668, 25649832, 25613196, 25195308, 17320716, 80795304, 82018584, 82744704, 15312792, 14596896,
+    26257200, 26192544, 26283900, 26140716, 26024880, 25988244, 25570356, 25635012, 17320716, 82229976,
+    82956096, 15337080, 14621184, 26321856, 26257200, 26348556, 26140716, 26399928, 26363292, 25945404,
+    26010060, 26074716, 17320716, 83167488, 14461212, 13755396, 25270152, 25205496, 26489064, 26050740,
+    26245296, 26583708, 26208660, 26273316, 26337972, 26402628, 15443964, 2184852, 41684304, 45470508,
+    48304356, 48227808, 48148704, 48890280, 48969384, 49048488, 49127592, 46187076, 17139564, 34289568,
+    39620880, 82435572, 86140656, 88855380, 91785888, 90817488, 91702332, 91913724, 92125116, 92336508,
+    89494164, 868776, 12703824, 4654296, 38547240, 41445312, 41340540, 44892096, 45360228, 45282672,
+    45361776, 45440880, 45519984, 42621948, 13380108, 26193264, 12510516, 13399956, 73903284, 76594896,
+    79540956, 81231732, 82536192, 82536192, 82747584, 82958976, 79600824, 14510832, 27345000, 13368384,
+    23599776, 15632208, 75976236, 79001928, 80692704, 82137564, 83360844, 83360844, 83572236, 83821716,
+    15358332, 28190460, 13309104, 24437676, 24192564, 17059212, 77451732, 79142508, 81330264, 82553544,
+    83776824, 83776824, 83350656, 15334560, 29100084, 14411112, 25352160, 25133124, 24614892, 17480232,
+    78758928, 80946684, 82169964, 83393244, 84616524, 83978964, 15303360, 28792212, 14555844, 25864476,
+    25645440, 25127208, 25011372, 17329104, 79643772, 80867052, 82090332, 83313612, 83899332, 15531948,
+    29065968, 14531556, 26276748, 26100552, 25811220, 25695888, 25285128, 17877996, 80388216, 81611496,
+    82834776, 83560896, 15556236, 29130624, 14555844, 26276748, 26475600, 26186268, 26070936, 25660176,
+    25516044, 17877996, 81822888, 83046168, 83772288, 15580524, 29195280, 14580132, 26341404, 26475600,
+    26561316, 26445984, 26035224, 25891092, 25955748, 17877996, 83257560, 83983680, 15604812, 29259936,
+    14604420, 26406060, 26540256, 26561316, 26821032, 26410272, 26266140, 26330796, 26395452, 17877996,
+    84195072, 14725272, 28373904, 13738632, 25354356, 26671764, 26471340, 26666400, 26630688, 26529396,
+    26594052, 26658708, 26723364, 16001244, 2195352, 45656664, 48595632, 48519108, 49076436, 48997332,
+    49818012, 49897116, 49976220, 47035704, 24679632, 35239752, 94702176, 39555276, 86476140, 89296560,
+    92242656, 92053368, 91841976, 92938212, 93149604, 93360996, 90518652, 24610692, 30094344, 34482168,
+    39008040, 83357676, 86178096, 89124192, 91927080, 90958680, 92054916, 92266308, 92477700, 89635356,
+    871776, 12684036, 12515016, 4658796, 40907076, 40802304, 44353896, 44823540, 45291672, 45293220,
+    45372324, 45451428, 42553392, 14576496, 27460416, 26492556, 13203864, 15824196, 75181500, 78207228,
+    80566380, 82257156, 83773008, 83773008, 83984400, 84233880, 15456036, 28339716, 27371856, 13144584,
+    23960220, 17321400, 77399928, 79759080, 81449856, 83106108, 84329388, 84329388, 83903220, 15432276,
+    29254200, 28286340, 14246592, 24900780, 24611448, 17742456, 79375536, 81066312, 82722564, 83945844,
+    85169124, 84531564, 15596604, 29184732, 29155704, 14391324, 25627332, 25338000, 25222668, 18034488,
+    79764912, 82164060, 83387340, 84610620, 85196340, 15565404, 29109924, 28847832, 14536056, 26139648,
+    25850316, 25734984, 25324224, 17883360, 80509356, 81732636, 82955916, 83682036, 15818280, 29448336,
+    29186244, 14536056, 26616576, 26370084, 26254764, 26073396, 25555140, 18432252, 82828872, 84052152,
+    84778272, 15842568, 29512992, 29250900, 14560344, 26616576, 26745132, 26629812, 26448444, 25930188,
+    26268600, 18432252, 84263544, 84989664, 15866856, 29577648, 29315556, 14584632, 26681232, 26745132,
+    27004860, 26823492, 26305236, 26643648, 26708304, 18432252, 85201056, 14987316, 28691616, 28429524,
+    13718844, 26812740, 26655156, 26850228, 27043908, 26568492, 26906904, 26971560, 27036216, 16555500,
+    2201148, 45761064, 45684540, 46347012, 46904340, 46904340, 47725020, 47804124, 47881680, 29226768,
+    35353008, 111591000, 111227256, 39456372, 85766040, 88712136, 88663284, 89196300, 89196300, 90292536,
+    90503928, 88320564, 29151384, 35237952, 34512480, 107525088, 38909136, 82632024, 85578120, 88502292,
+    88313004, 88313004, 89409240, 89620632, 87331572, 29078556, 35130600, 33973596, 33679728, 38361900,
+    79513560, 82459656, 85383828, 88186716, 87429708, 88525944, 88737336, 86448276, 873432, 12619320,
+    12450300, 12281280, 3480588, 37258260, 40809852, 41279532, 41749176, 42296412, 42297960, 42377064,
+    42455136, 14583696, 27211644, 26238924, 25271064, 12045060, 14795136, 72229680, 74694564, 77053716,
+    78955884, 80471736, 80471736, 80681580, 14559936, 28126128, 27153408, 26185548, 13147584, 23009472,
+    15216192, 74311020, 76670172, 78572340, 80088192, 81311472, 81309924, 14756316, 28099512, 28061472,
+    27093612, 13292316, 23769864, 23654544, 15578460, 76111704, 78013872, 79670124, 80893404, 82115136,
+    14920644, 28254096, 27992004, 27962976, 13437048, 24496416, 24381096, 24199728, 15870492, 76501080,
+    78900228, 80123508, 81345240, 14913732, 28243944, 27981852, 27719760, 13606068, 25073388, 24958068,
+    24776700, 24301284, 15719364, 78820596, 80043876, 81265608, 15166608, 28582356, 28320264, 28058172,
+    13606068, 25550316, 25434996, 25296480, 25050456, 25014744, 16268256, 81140112, 82361844, 15190896,
+    28647012, 28384920, 28122828, 13630356, 25550316, 25810044, 25671528, 25425504, 25389792, 25728204,
+    16268256, 82573236, 15215184, 27976068, 27681648, 27419556, 13654128, 25614456, 25809528, 26046060,
+    25800036, 25764324, 26102736, 26167392, 16267068, 2203956, 42757764, 43420236, 44082708, 44719140,
+    44719140, 45539820, 45070140, 32549256, 35655804, 122002812, 121587372, 124620444, 39352140, 85945356,
+    86002200, 86675652, 87420060, 87420060, 88516296, 86146596, 32274456, 38409132, 34732296, 117869616,
+    120902688, 38804868, 82811304, 85735476, 85686624, 86431032, 86431032, 87527268, 85157568, 32199072,
+    38286072, 37124208, 33826968, 117216072, 38257632, 79677288, 82601460, 85525632, 85547736, 85547736,
+    86643972, 84274272, 33252456, 39226140, 38064276, 36912456, 33285456, 37712976, 77585616, 80509788,
+    83433960, 86448240, 85691232, 86787468, 86756688, 874224, 12561228, 12392208, 12223188, 12046248,
+    2572356, 38002212, 38471892, 38941572, 39490320, 40037556, 40039104, 39376632, 13658772, 27243468,
+    26270748, 25298028, 24633588, 12274836, 13235976, 69865524, 72330408, 74900952, 76803120, 78318972,
+    77513760, 13855152, 27249180, 27178812, 26206092, 25541652, 12419568, 22276812, 13598244, 71912340,
+    74482884, 76385052, 77900904, 78318972, 14051532, 27446616, 27152196, 27114156, 26449716, 12564300,
+    23037204, 22898688, 13960512, 73713024, 75615192, 77271444, 77689512, 14240148, 27665856, 27371436,
+    27109344, 27383736, 12733320, 23828412, 23689896, 23443872, 14252544, 75537072, 77936220, 78354288,
+    14233236, 27655704, 27361284, 27099192, 27140520, 12902340, 24405384, 24266868, 24020844, 23985132,
+    14101416, 77856588, 78274656, 14486112, 27994116, 27699696, 27437604, 27478932, 12902340, 24882312,
+    24743796, 24540624, 24734304, 24698592, 14650308, 79370892, 14341380, 27264144, 26969724, 26707632,
+    27480000, 12705960, 24645780, 24882312, 24679140, 24872820, 24837108, 25175520, 14288040, 2205084,
+    42739800, 43402272, 44143848, 44780280, 44780280, 45052176, 35376900, 36965808, 131040684, 129847608,
+    132688584, 134275176, 39902364, 86970348, 87643800, 88528644, 89273052, 89273052, 87788196, 35102100,
+    41211660, 35957844, 126128340, 128969316, 130555908, 39353580, 86702112, 86653260, 87538104, 88282512,
+    88282512, 86797656, 35026716, 40850208, 39688344, 34979904, 125267112, 126853704, 38806308, 83568060,
+    86492232, 86654772, 87399180, 87399180, 85914324, 36109596, 41730216, 40568352, 39411672, 34305984,
+    123185736, 39002196, 81320436, 84244608, 87380172, 87402276, 87402276, 88370676, 36933108, 42217464,
+    41055600, 39898920, 38741136, 33235488, 38456472, 78203484, 81127656, 84263220, 87277500, 86520492,
+    86811516, 874536, 12738636, 12569616, 12400596, 12451236, 12275304, 2846160, 38745240, 39214920,
+    39763704, 40312452, 40859688, 40119660, 13654236, 27558420, 27488052, 26515332, 25803192, 24825180,
+    12503892, 13784652, 70813692, 73489968, 76060512, 77962680, 78673320, 13850616, 27755856, 27461436,
+    27423396, 26711256, 25733244, 12648624, 22570536, 14146920, 72860508, 75431052, 77333220, 78043860,
+    14071284, 28017948, 27723528, 27461436, 27683976, 26705964, 12817644, 23395584, 23192412, 14509188,
+    76095864, 77998032, 78849072, 14259900, 28237188, 27942768, 27680676, 27679164, 27639984, 12986664,
+    24186792, 23983620, 24177300, 14801220, 77919912, 79513848, 14252988, 28227036, 27932616, 27670524,
+    27669012, 27396768, 13155684, 24763764, 24560592, 24754272, 24718560, 14650092, 79434216, 14336844,
+    27770820, 27476400, 27214308, 27978396, 27498648, 12935016, 25004160, 24800988, 25037520, 25231200,
+    25195488, 14836716, 2205336, 42789948, 43531524, 44273100, 44909532, 44360748, 37347216, 37327248,
+    135097272, 133902684, 136743624, 138384216, 142237980, 39822072, 86821704, 87706548, 88591392, 89335800,
+    86754708, 37312224, 42457428, 36923760, 131410332, 133508376, 135008568, 138862332, 39822072, 86821704,
+    87706548, 88591392, 89335800, 86754708, 37041312, 42095976, 41325480, 35871732, 129804660, 131304852,
+    135158616, 39273288, 86553468, 86716008, 87600852, 88345260, 85764168, 38092140, 42975984, 41977608,
+    40820928, 35135568, 127621296, 131580756, 39469140, 84305808, 87441372, 87603912, 88348320, 88220484,
+    38945148, 43479864, 42438636, 41281956, 40119312, 34013232, 127926756, 38923416, 81173304, 84308868,
+    87444432, 87466536, 86661324, 38883984, 44682216, 43640988, 42484308, 41356020, 40204920, 33629796,
+    39198372, 79152588, 82288152, 85423716, 88437996, 86875776, 874608, 12714456, 12714456, 12545436,
+    12596076, 12420144, 12504000, 2846268, 38745456, 39294240, 39843024, 40391772, 40197432, 13670076,
+    27513888, 27513888, 27443520, 26731380, 25748508, 25119060, 12504000, 13785624, 70862292, 73538568,
+    76109112, 77206068, 13890744, 27775980, 27775980, 27481560, 27704100, 26721228, 26091780, 12673020,
+    22585800, 14147892, 74343780, 76914324, 78011280, 14111412, 28038072, 28038072, 27743652, 27742140,
+    27693948, 27064500, 12842040, 23410848, 23647380, 14510160, 77579136, 78676092, 14300028, 28257312,
+    28257312, 27962892, 27961380, 27689136, 27998520, 13011060, 24202056, 24438588, 24632268, 14802192,
+    78597972, 14124096, 27452532, 27452532, 27158112, 27922200, 27442452, 27518772, 12959412, 24542496,
+    24779028, 24972708, 24936996, 14288796, 2205336, 42907284, 43648860, 44390436, 44583228, 38953704,
+    37805256, 137098368, 136973952, 139070484, 140570640, 144478404, 144178380, 39822072, 87081480, 87966324,
+    88851168, 87154920, 38698896, 43080948, 37264464, 133669224, 135765756, 137265912, 141173676, 144052452,
+    39741456, 86868576, 87753420, 88638264, 86942016, 38667792, 43039476, 42018060, 36827280, 133288956,
+    134046216, 137813580, 140692356, 39741456, 86868576, 87753420, 88638264, 86942016, 39523092, 43691604,
+    42670188, 41904876, 36027396, 130361148, 134234208, 137112984, 39935796, 87486732, 87649272, 88534116,
+    89291124, 40344048, 44152632, 43131216, 42138024, 40975380, 34853184, 130564620, 133443396, 39390036,
+    84354192, 87489756, 87652296, 87731928, 40312380, 45371616, 44350200, 43314156, 42185868, 41029908,
+    34428276, 130901184, 39664992, 82317924, 85453488, 88589052, 87946380, 40474920, 45285000, 45243528,
+    44207484, 43079196, 41923236, 41125884, 33556572, 39198372, 79412364, 82547928, 85683492, 87998292,
+    874608, 12714456, 12690168, 12690168, 12740808, 12564876, 12648732, 12504000, 2846268, 38745456,
+    39294240, 39843024, 39650232, 13707468, 27595212, 27530556, 27530556, 27720768, 26737896, 26103588,
+    25200384, 12504000, 13821984, 71758116, 74434392, 76305456, 13928136, 27857304, 27792648, 27792648,
+    27758808, 27710616, 27076308, 26173104, 12673020, 22862136, 14184252, 75239604, 77110668, 14148804,
+    28119396, 28054740, 28054740, 28020900, 27748656, 28049028, 27145824, 12842040, 23687184, 23923716,
+    14546520, 77915880, 14200452, 27586860, 27522204, 27522204, 28253964, 27774216, 27850536, 27877152,
+    12790392, 24275700, 24512232, 24748764, 14546520, 2205252, 42933768, 43675344, 43868136, 40021452,
+    37710720, 138435264, 137460744, 140627448, 141383196, 145150524, 144904500, 145468620, 39901068, 87114204,
+    87999048, 86302800, 39766644, 43495176, 37086984, 134156016, 137322720, 138078468, 141845796, 144778572,
+    144494100, 39820452, 86901300, 87786144, 86089896, 39515724, 43193496, 42172080, 36522864, 134033544,
+    134789292, 138556620, 141489396, 144383724, 39739836, 86688396, 87573240, 85876992, 40610832, 44165604,
+    43144188, 42127956, 36348192, 132331140, 135461268, 138253644, 141147972, 40482960, 87574788, 88459632,
+    89216640, 41236260, 44398752, 43377336, 42361104, 41589828, 35120628, 131790168, 134582544, 137476872,
+    39935688, 87308064, 87470604, 87550236, 41172540, 45574884, 44553468, 43537236, 42572436, 41416476,
+    34654212, 132024744, 134919072, 40210608, 85271760, 88407324, 87764652, 41364576, 45504900, 45463428,
+    44447196, 43439544, 42283584, 41481372, 33751404, 132144768, 39743988, 82350648, 85486212, 87816564,
+    41532012, 45685188, 45383508, 45347220, 44339568, 43183608, 42381396, 41510520, 32820660, 39198264,
+    78582384, 81717948, 84048300, 874584, 12738708, 12714420, 12690132, 12909792, 12733860, 12817716,
+    12672984, 12503964, 2846232, 39371724, 39920508, 39727716, 13707948, 27593808, 27529152, 27464496,
+    27725076, 27644556, 27010248, 26102184, 24933588, 12697272, 13636188, 74354868, 76225932, 13928616,
+    27855900, 27791244, 27726588, 27987168, 27682596, 27982968, 27074904, 25906308, 12866292, 23650500,
+    13998456, 77031144, 13980264, 27323364, 27258708, 27194052, 28220232, 27708156, 27784476, 27811092,
+    26642496, 12814644, 24239016, 24475548, 13998456, 2205168, 42948588, 43141380, 40787520, 37608408,
+    139206096, 138231576, 140548176, 142374096, 145397016, 145010556, 145628676, 146447676, 39980064, 87131376,
+    85435128, 40532712, 43734360, 36901728, 134926848, 137243448, 139069368, 142092288, 144884628, 144654156,
+    145473156, 39899448, 86918472, 85222224, 40281792, 43432680, 42411264, 36265032, 133954272, 135780192,
+    138803112, 141595452, 144543780, 144514188, 39818832, 86705568, 85009320, 41157084, 44144580, 43123164,
+    42106932, 35973792, 132509664, 135638280, 138430620, 141378948, 144528156, 40481340, 87379056, 88136064,
+    42022320, 44697708, 43676292, 42660060, 41637864, 35381808, 133194096, 135243540, 138051468, 141200676,
+    40482852, 87380568, 87460200, 41763072, 45645960, 44624544, 43608312, 42620472, 41855880, 34872408,
+    132684228, 135492156, 138641364, 40756260, 88210080, 87567408, 41923056, 45533124, 45491652, 44475420,
+    43487580, 42495108, 41692896, 33938460, 132702264, 135851472, 40289604, 85288932, 87619284, 42119988,
+    45730044, 45428364, 45392076, 44404236, 43368912, 42566700, 41690964, 32986980, 132150384, 39743880,
+    81505116, 83835468, 42332028, 45979884, 45678204, 45381708, 45373812, 44338488, 43536276, 42660540,
+    41503896, 32878908, 39824496, 81718020, 84048372, 874560, 12762960, 12738672, 12714384, 12909756,
+    12902844, 12986700, 12841968, 12672948, 12697236, 2846196, 39997992, 39805200, 13704756, 27587544,
+    27522888, 27458232, 27654156, 27644004, 27912048, 27003984, 25830528, 25895184, 12890544, 13450392,
+    76146408, 13756404, 27055008, 26990352, 26925696, 27887220, 27669564, 27713556, 27740172, 26566716,
+    26631372, 12838896, 24202332, 13450392, 2205084, 42402960, 41394900, 37498320, 139626864, 138652344,
+    140968944, 141944760, 146037852, 144906984, 145384668, 146203668, 147038220, 40059060, 84551904, 41140092,
+    43865028, 36708696, 135347616, 137664216, 138640032, 142733124, 144781056, 144410148, 145229148, 146063700,
+    39978444, 84339000, 40889172, 43563348, 42541932, 35999424, 134375040, 135350856, 139443948, 141491880,
+    144299772, 144270180, 145104732, 39897828, 84126096, 41764464, 44275248, 43253832, 42237600, 35645976,
+    132080328, 136279116, 138327048, 141134940, 144284148, 144270108, 40560336, 87252840, 42409884, 44568168,
+    43546752, 42530520, 41508324, 34947792, 133022556, 135070488, 137878380, 141027588, 144192348, 40481232,
+    86364072, 42390444, 45836400, 44814984, 43798752, 42810912, 41795400, 35084340, 133738092, 135662688,
+    138811896, 141976656, 41303424, 87461820, 42354900, 45495684, 45454212, 44437980, 43450140, 42434628,
+    42023784, 34117776, 132871284, 136020492, 139185252, 40835256, 87406488, 42519780, 45649752, 45348072,
+    45311784, 44323944, 43308432, 42626856, 41751120, 33145524, 132303816, 135468576, 40289496, 83622636,
+    42731820, 45899592, 45597912, 45301416, 45293520, 44278008, 43596432, 42720696, 41559192, 33027084,
+    136303128, 40370112, 83835540, 42947748, 46154616, 45852936, 45556440, 45288336, 45252768, 44571192,
+    43695456, 42533952, 42788976, 32988996, 40450728, 84048444, 874536, 12787212, 12762924, 12738636,
+    12934008, 12902808, 13155684, 13010952, 12841932, 12866220, 12890508, 2846160, 39882684, 13528872,
+    26781792, 26717136, 26652480, 27614004, 27331692, 27670104, 27664392, 26490936, 26555592, 26620248,
+    12863148, 12902328, 2205048, 43004784, 38005776, 142497072, 141522552, 143132796, 145345320, 148588308,
+    148527612, 148120452, 148939452, 149774004, 150624108, 40165344, 42753864, 44781720, 37133208, 138217824,
+    139843620, 142056144, 145299132, 148417236, 147161484, 147980484, 148815036, 149665140, 40084728, 42502944,
+    44480040, 43458624, 36351360, 136554444, 138766968, 142009956, 145128060, 147051108, 147021516, 147856068,
+    148706172, 40004112, 42385668, 44968008, 43951776, 42935544, 36583524, 132421140, 136341504, 139459608,
+    141382656, 144531864, 144517824, 145367928, 42899088, 43271736, 45658752, 44642520, 43626288, 41613672,
+    36402624, 133921620, 137039724, 138962772, 142111980, 145276740, 145278252, 42820020, 43032480, 46666776,
+    45650544, 44634312, 42839868, 42093216, 36443340, 134894952, 136818000, 139967208, 143131968, 146312280,
+    43561596, 43236744, 46646040, 46609752, 45593520, 43799076, 43052424, 42390660, 36133092, 134370216,
+    137519424, 140684184, 143864496, 43642212, 43174044, 46529376, 46232880, 46196592, 44402148, 43655496,
+    42993732, 42238632, 35138556, 133801200, 136965960, 140146272, 43094904, 43386084, 46779216, 46482720,
+    46186224, 45371724, 44625072, 43963308, 43208208, 42046704, 35009748, 137800512, 140980824, 43175520,
+    43602012, 47034240, 46737744, 46441248, 45366540, 45599832, 44938068, 44182968, 43021464, 43276488,
+    34971660, 141830928, 43256136, 43821828, 47294448, 46997952, 46701456, 45626748, 45599832, 45918012,
+    45162912, 44001408, 44256432, 44516640, 35024292, 43336752, 874536, 12846492, 12822204, 12797916,
+    13655784, 13631496, 13860084, 13884372, 13715352, 13739640, 13763928, 13788216, 3754548, 1465776,
+    2627268, 15830556, 15805260, 16733520, 16727760, 17820840, 17796060, 17796060, 17821356, 17846652,
+    17871948, 16952124, 5331552, 5123856, 6181584, 27298224, 28620972, 29285208, 30228624, 30636804,
+    30569124, 30636804, 30704484, 30772164, 29694420, 5323944, 5116248, 8502624, 6181584, 28227204,
+    28891440, 29834856, 30243036, 30569124, 30569124, 30636804, 30704484, 29626740, 5670336, 5389968,
+    8919360, 8797032, 6853644, 28408980, 29377956, 30056352, 30382440, 30776208, 30776208, 30843888,
+    30949488, 5878008, 5379480, 9125892, 9003564, 8841316, 7158600, 28129176, 29559756, 29885844,
+    30279612, 30673380, 30673380, 30547596, 5870400, 5716932, 9422460, 9300132, 9146164, 8741236,
+    7292988, 29434764, 29760852, 30154620, 30548388, 30942156, 30748692, 5939760, 5709324, 9553068,
+    9430740, 9361856, 9198728, 9160604, 7461696, 29703984, 30097752, 30491520, 30885288, 31085592,
+    5939760, 5709324, 9532044, 9532044, 9463160, 9300032, 9261908, 9245688, 7461696, 29661144,
+    30054912, 30448680, 30691824, 5947368, 5716932, 9553068, 9532044, 9585488, 9422360, 9384236,
+    9368016, 9232304, 7461696, 30122592, 30516360, 30759504, 5954976, 5724540, 9574092, 9553068,
+    9585488, 9544688, 9506564, 9490344, 9354632, 9375656, 7461696, 30584040, 30827184, 5962584,
+    5732148, 9595116, 9574092, 9606512, 9544688, 9628892, 9612672, 9476960, 9497984, 9519008,
+    7461696, 30894864, 5685552, 5458428, 9254304, 9233280, 9650016, 9513148, 9576328, 9682436,
+    9560108, 9581132, 9602156, 9623180, 6877656, 217872, 38487348, 38249964, 39203688, 39885060,
+    40555056, 40318704, 40283784, 40521168, 40758552, 40995936, 40314540, 26578920, 12107604, 10553724,
+    62656200, 63508176, 64027800, 64207224, 65916972, 65422476, 65846772, 66271068, 66695364, 66122856,
+    26432148, 12035064, 19874556, 10535976, 62035128, 62554752, 62734176, 64443924, 65422476, 65422476,
+    65846772, 66271068, 65698560, 26548764, 12327312, 20146296, 19693284, 10819512, 60971544, 61150968,
+    62860716, 63839268, 65312316, 65312316, 65736612, 66550536, 26595600, 12536400, 20314416, 19861404,
+    19369860, 11032776, 59532192, 61294788, 62273340, 63746388, 65219436, 65219436, 65736576, 26323080,
+    12742248, 20373708, 19920696, 19429152, 18926184, 11015028, 59674500, 60653052, 62126100, 63599148,
+    65072196, 65165040, 26351028, 12669708, 20904108, 20451096, 19959564, 19474020, 18971052, 11281176,
+    59746248, 61219296, 62692344, 64165392, 65731284, 26329608, 12659088, 20752836, 20752836, 20261304,
+    19775760, 19272792, 18994500, 11281176, 59676048, 61149096, 62622144, 64188036, 26476380, 12731628,
+    20882688, 20752836, 20714316, 20228772, 19725804, 19447512, 18973080, 11298924, 61573392, 63046440,
+    64612332, 26623152, 12804168, 21012540, 20882688, 20714316, 20681784, 20178816, 19900524, 19426092,
+    19555944, 11316672, 63470736, 65036628, 26769924, 12876708, 21142392, 21012540, 20844168, 20681784,
+    20631828, 20353536, 19879104, 20008956, 20138808, 11334420, 65460924, 26723088, 12667620, 20957352,
+    20827500, 21099240, 20844156, 20664348, 20839068, 20364636, 20494488, 20624340, 20754192, 11086020,
+    2200308, 41703888, 45490128, 48325488, 50512224, 50434668, 51176244, 51255348, 51334452, 51413556,
+    48473040, 16959648, 876504, 5840316, 39408996, 43074708, 45259248, 45154440, 48704484, 48626928,
+    48706032, 48785136, 48864240, 45939132, 31231980, 13416612, 12816528, 14066820, 76773600, 79946388,
+    81986652, 84915648, 86220108, 86220108, 86431500, 86642892, 83284740, 32184924, 14547336, 13910172,
+    24522648, 16351956, 79407396, 81447660, 84376656, 85821516, 87044796, 87044796, 87256188, 87585300,
+    32863884, 15394836, 14557608, 25514952, 25295916, 18105624, 79898976, 82907604, 85095360, 86318640,
+    87541920, 87541920, 87115752, 32425560, 16043640, 14498328, 26143476, 25924440, 25406208, 19090944,
+    78909804, 83545128, 84768408, 85991688, 87214968, 86577408, 32620116, 16019352, 15600336, 27053100,
+    26834076, 26341908, 25062420, 19510452, 83160036, 84383316, 85606596, 86829876, 87415596, 32893872,
+    16247940, 15576048, 27465372, 27289188, 27025920, 26507688, 26391852, 20059344, 83904480, 85127760,
+    86351040, 87077160, 32958528, 16272228, 15600336, 27465372, 27664236, 27400968, 26882736, 26766900,
+    26622768, 20059344, 85339152, 86562432, 87288552, 33023184, 16296516, 15624624, 27530028, 27664236,
+    27776016, 27257784, 27141948, 26997816, 27062472, 20059344, 86773824, 87499944, 33087840, 16320804,
+    15648912, 27594684, 27728892, 27776016, 27632832, 27516996, 27372864, 27437520, 27502176, 20059344,
+    87711336, 32375040, 15441264, 14774412, 26542980, 27885948, 27686040, 27478200, 27737412, 27636120,
+    27700776, 27765432, 27830088, 18182592, 2210808, 45664620, 48605100, 51438948, 51362400, 51283296,
+    52103976, 52183080, 52262184, 49321668, 35127876, 24503532, 35496360, 39869796, 86664168, 89506476,
+    92221200, 95151708, 94183308, 95279544, 95490936, 95702328, 92859984, 16939860, 879504, 12821028,
+    5844816, 42536472, 44721012, 44616240, 48167796, 48635928, 48637476, 48716580, 48795684, 45870576,
+    32305200, 14609328, 27555540, 13745652, 16543944, 78612660, 81304272, 84250332, 85941108, 87456960,
+    87456960, 87668352, 87997464, 33018000, 15488868, 28441572, 14393088, 25063572, 18367812, 80498484,
+    83524176, 85214952, 86871204, 88094484, 88094484, 87668316, 32817576, 16336368, 29287032, 14333808,
+    25901472, 25612140, 19794816, 81973980, 83664756, 86063904, 87287184, 88510464, 87872904, 33012636,
+    16312596, 30196656, 15435816, 26815968, 26552700, 26034468, 20215836, 83281176, 85680324, 86903604,
+    88126884, 88712604, 32937828, 16281396, 29888784, 15580548, 27328284, 27065016, 26546784, 26430948,
+    20064708, 84025620, 85248900, 86472180, 87198300, 33276240, 16534272, 30227196, 15580548, 27805212,
+    27584784, 27295452, 27180120, 26661864, 20613600, 86345136, 87568416, 88294536, 33340896, 16558560,
+    30291852, 15604836, 27805212, 27959832, 27670500, 27555168, 27036912, 27375324, 20613600, 87779808,
+    88505928, 33405552, 16582848, 30356508, 15629124, 27869868, 27959832, 28045548, 27930216, 27411960,
+    27750372, 27815028, 20613600, 88717320, 32692752, 15703308, 29470476, 14754624, 28026924, 27869856,
+    27890916, 28150632, 27675216, 28013628, 28078284, 28142940, 18736848, 2216604, 45770496, 48709464,
+    48632940, 49190268, 49190268, 50010948, 50090052, 50167608, 40077552, 29040552, 35526672, 111154176,
+    39798000, 85960404, 88780824, 91726920, 91537632, 91537632, 92633868, 92845260, 90540648, 39975384,
+    28971612, 35140656, 34693920, 39250764, 82841940, 85662360, 88608456, 91411344, 90654336, 91750572,
+    91961964, 89657352, 17034060, 881160, 12765024, 12596004, 4666632, 41177004, 41072232, 44623824,
+    45093468, 45640704, 45642252, 45721356, 45799428, 32063160, 14616528, 27308640, 26340780, 13294080,
+    15841548, 75433932, 78459660, 80818812, 82720980, 84236832, 84236832, 84446676, 31937904, 15496068,
+    28187940, 27220080, 13234800, 24044004, 17338752, 77652360, 80011512, 81913680, 83569932, 84793212,
+    84791664, 32132976, 15472308, 29102424, 28134564, 14336820, 24984564, 24695232, 17759808, 79627968,
+    81530136, 83186388, 84409668, 85631400, 32287560, 15636636, 29032956, 29003928, 14481552, 25711116,
+    25421784, 25306452, 18051840, 80017344, 82416492, 83639772, 84861504, 32277408, 15629724, 29022804,
+    28760712, 14650572, 26288088, 25998756, 25883424, 25408008, 17900712, 82336860, 83560140, 84781872,
+    32615820, 15882600, 29361216, 29099124, 14650572, 26765016, 26518524, 26403204, 26157180, 26121468,
+    18449604, 84656376, 85878108, 32680476, 15906888, 29425872, 29163780, 14674860, 26765016, 26893572,
+    26778252, 26532228, 26496516, 26834928, 18449604, 86089500, 32184780, 15931176, 28717740, 28455648,
+    14698620, 26829156, 26893056, 27152784, 26906760, 26871048, 27209460, 27274116, 18448416, 2219412,
+    45781176, 45704652, 46367124, 47003556, 47003556, 47824236, 47354556, 43082124, 32163624, 35746488,
+    121498704, 124531812, 39722316, 86014008, 88960104, 88911252, 89655660, 89655660, 90751896, 88366644,
+    42964248, 32092128, 38291268, 34841160, 120845196, 39175080, 82879992, 85826088, 88750260, 88772364,
+    88772364, 89868600, 87483348, 44077548, 33145512, 39231336, 38079516, 34299684, 39370992, 80788356,
+    83734452, 86658624, 89672904, 88915896, 90012132, 90060984, 17115744, 881952, 12715644, 12546624,
+    12597264, 3759408, 38266104, 41817696, 42287376, 42836124, 43383360, 43384908, 42722436, 31410492,
+    14594904, 27305280, 26332560, 25668120, 12362052, 15358536, 73347264, 75812148, 78382692, 80284860,
+    81800712, 80995500, 31605564, 14571144, 28219764, 27247044, 26582616, 13464576, 23360340, 15779592,
+    75428604, 77999148, 79901316, 81417168, 81835236, 31803000, 14767524, 28193148, 28155108, 27490680,
+    13609308, 24120732, 24005412, 16141860, 77229288, 79131456, 80787708, 81205776, 32022240, 14956140,
+    28412388, 28150296, 28424700, 13778328, 24911940, 24796620, 24550596, 16433892, 79053336, 81452484,
+    81870552, 32012088, 14949228, 28402236, 28140144, 28181484, 13947348, 25488912, 25373592, 25127568,
+    25091856, 16282764, 81372852, 81790920, 32350500, 15202104, 28740648, 28478556, 28519896, 13947348,
+    25965840, 25850520, 25647348, 25841028, 25805316, 16831656, 82887156, 31472856, 15057372, 28005816,
+    27743724, 28546512, 13750968, 25729308, 25989036, 25785864, 25979544, 25943832, 26282244, 16469388,
+    2220540, 42764532, 43427004, 44168580, 44805012, 44805012, 45076908, 44539020, 34413288, 35957124,
+    127075572, 130056984, 132322464, 39615924, 86175612, 86232456, 87117300, 87861708, 87861708, 86361300,
+    44415960, 34142376, 39980580, 34979184, 126354780, 128620260, 39068652, 83041560, 85965732, 86128272,
+    86872680, 86872680, 85372272, 45545892, 35193204, 40904940, 39748260, 34375500, 125058024, 39264564,
+    80934372, 83858544, 86994108, 87016212, 87016212, 87949908, 46398468, 36016716, 41609844, 40453164,
+    39329736, 33765516, 38719848, 78702228, 81626400, 84761964, 87776244, 87019236, 87310260, 16166856,
+    882264, 12656832, 12487812, 12538452, 12362520, 2850456, 39008616, 39478296, 40027080, 40575828,
+    41123064, 40383036, 30415536, 13665828, 27331524, 26358804, 25689516, 24983736, 12591108, 13798656,
+    70966116, 73642392, 76212936, 78115104, 78825744, 30612972, 13862208, 27337236, 27266868, 26597580,
+    25891800, 12735840, 22622100, 14160924, 73012932, 75583476, 77485644, 78196284, 30875064, 14082876,
+    27599328, 27304908, 27570300, 26864520, 12904860, 23447148, 23243976, 14523192, 76248288, 78150456,
+    79001496, 31094304, 14271492, 27818568, 27524148, 27565488, 27798540, 13073880, 24238356, 24035184,
+    24228864, 14815224, 78072336, 79666272, 31084152, 14264580, 27808416, 27513996, 27555336, 27555324,
+    13242900, 24815328, 24612156, 24805836, 24770124, 14664096, 79586640, 30480264, 14348436, 27347340,
+    27052920, 27855708, 27657204, 13022232, 25055724, 24852552, 25089084, 25282764, 25247052, 14850720,
+    2220828, 42734064, 43475640, 44217216, 44853648, 44304864, 46287276, 36435252, 37175688, 133007940,
+    135211716, 137285100, 138887244, 40165068, 87183972, 88068816, 88953660, 89698068, 87101424, 45925824,
+    36164340, 41829912, 36123660, 131508000, 133581384, 135183528, 39616284, 86915736, 87078276, 87963120,
+    88707528, 86110884, 47012904, 37215168, 42515880, 41359200, 35457732, 130003560, 131605704, 39917280,
+    84808512, 87944076, 88106616, 88851024, 88688484, 47848272, 38068176, 43160724, 42004044, 40875756,
+    34725708, 127953216, 40007988, 82420416, 85555980, 88691544, 88713648, 87908436, 47538816, 38895576,
+    43653156, 42496476, 41368188, 40217088, 33642252, 39462264, 79303464, 82439028, 85574592, 88588872,
+    87026652, 16395552, 882336, 12833880, 12664860, 12747552, 12767148, 12591216, 3123900, 39750924,
+    40299708, 40848492, 41397240, 41202900, 30708900, 13657380, 27641256, 27570888, 26901600, 26148120,
+    25170108, 12819804, 14346972, 71898012, 74574288, 77144832, 78241788, 30970992, 13878048, 27903348,
+    27608928, 27874320, 27120840, 26142828, 12988824, 22910604, 14709240, 75379500, 77950044, 79047000,
+    31233084, 14098716, 28165440, 27871020, 27912360, 28093560, 27115548, 13157844, 23735652, 23972184,
+    15071508, 78614856, 79711812, 31452324, 14287332, 28384680, 28090260, 28131600, 28088748, 28049568,
+    13326864, 24526860, 24763392, 24957072, 15363540, 79633692, 30499872, 14111400, 27575040, 27280620,
+    28083408, 27842064, 27569820, 13275216, 24867300, 25103832, 25297512, 25261800, 14850144, 2220828,
+    42851400, 43592976, 44334552, 44527344, 46910796, 37821924, 37516392, 135266832, 137469096, 139542444,
+    141198588, 145067904, 40084452, 87230844, 88115688, 89000532, 87288732, 46869324, 37790820, 42522492,
+    37079208, 134992296, 136322748, 137838492, 141707808, 40084452, 87230844, 88115688, 89000532, 87288732,
+    47728524, 38646120, 43208460, 42443148, 36349560, 132743412, 134259156, 138128472, 40383936, 87989436,
+    88151976, 89036820, 89759124, 48521040, 39467076, 43853304, 42860112, 41731824, 35565660, 130591080,
+    134566092, 40474608, 85601304, 88736868, 88899408, 88979040, 48228216, 40323972, 44362368, 43326324,
+    42198036, 41042076, 34440732, 130927644, 39928884, 82468800, 85604364, 88739928, 88097256, 48480516,
+    40266696, 45569904, 44533860, 43405584, 42283968, 41138052, 34065072, 40203840, 80448084, 83583648,
+    86719212, 89034012, 16395552, 882336, 12809592, 12809592, 12892284, 12911880, 12735948, 12819804,
+    3123900, 39750924, 40299708, 40848492, 40655700, 30790224, 13694772, 27657924, 27657924, 27890988,
+    27137508, 26154636, 25525188, 12819804, 14383332, 72793836, 75470112, 77341176, 31052316, 13915440,
+    27920016, 27920016, 27929028, 28110228, 27127356, 26497908, 12988824, 23186940, 14745600, 76275324,
+    78146388, 31314408, 14136108, 28182108, 28182108, 28191120, 28148268, 28100076, 27470628, 13157844,
+    24011988, 24248520, 15107868, 78951600, 30634200, 14187756, 27644712, 27644712, 28415172, 28173828,
+    27901584, 28201956, 13106196, 24600504, 24837036, 25073568, 15107868, 2220744, 42877884, 43619460,
+    43812252, 47325024, 38889672, 37338912, 135753624, 139026060, 140355000, 141870708, 145794024, 145509552,
+    40163448, 87263568, 88148412, 86436612, 47023344, 38638752, 42676512, 36774792, 135736884, 137065824,
+    138581532, 142504848, 145399176, 40082832, 87050664, 87935508, 86223708, 48202524, 39733860, 43682460,
+    42666228, 36670356, 134713404, 135486216, 139269132, 142163460, 40931100, 88077492, 88962336, 89684640,
+    48767160, 40359288, 44099424, 43083192, 42346272, 35833104, 131816628, 135705240, 138599568, 41020260,
+    88555176, 88717716, 88797348, 48431484, 41184132, 44565636, 43549404, 42584604, 41428644, 34666668,
+    132051204, 134945532, 40474500, 85422636, 88558200, 87915528, 48700416, 41156352, 45789804, 44773572,
+    43765932, 42644316, 41493540, 34259904, 132418872, 40749456, 83386368, 86521932, 88852284, 48880704,
+    41323788, 45709884, 45673596, 44665956, 43544340, 42393564, 41601396, 33329160, 40203732, 79618104,
+    82753668, 85084020, 16419804, 882312, 12833844, 12809556, 13061268, 13080864, 12904932, 12988788,
+    12819768, 3123864, 40377192, 40925976, 40733184, 30788820, 13695252, 27656520, 27591864, 27895296,
+    28044168, 27061296, 26426988, 25258392, 13013076, 14197536, 75390588, 77261652, 31050912, 13915920,
+    27918612, 27853956, 28157388, 28082208, 28034016, 27399708, 26231112, 13182096, 23975304, 14559804,
+    78066864, 30370704, 13967568, 27381216, 27316560, 28381440, 28107768, 27835524, 28135896, 26967300,
+    13130448, 24563820, 24800352, 14559804, 2220660, 42892704, 43085496, 47564208, 39655740, 37153656,
+    136524456, 138946788, 141345900, 142117200, 145900080, 145669608, 146488608, 40242444, 87280740, 85568940,
+    47262528, 39404820, 42915696, 36516960, 135657612, 138056724, 138828024, 142610904, 145559232, 145529640,
+    40161828, 87067836, 85356036, 48181500, 40280112, 43661436, 42645204, 36295956, 134891928, 135663228,
+    139446108, 142394436, 145543644, 40929480, 87881760, 88604064, 49066116, 41145348, 44398380, 43382148,
+    42394308, 36094284, 133220556, 136366236, 139174164, 142323372, 41567424, 88627680, 88707312, 48502560,
+    41774664, 44636712, 43620480, 42632640, 41868048, 34884864, 132710688, 135518616, 138667824, 41020152,
+    88360956, 87718284, 48728640, 41714832, 45818028, 44801796, 43813968, 42855840, 41705064, 34446960,
+    132976368, 136125576, 41295072, 86324652, 88655004, 48925560, 41911764, 45754740, 45718452, 44730624,
+    43729644, 42578868, 41781840, 33495480, 132424488, 40749348, 82540836, 84871188, 49175400, 42123804,
+    46004580, 45708084, 45700200, 44699220, 43548444, 42751416, 41594772, 33387408, 40829964, 82753740,
+    85084092, 16444056, 882288, 12858096, 12833808, 13061232, 13249848, 13073916, 13157772, 12988752,
+    13013040, 3123828, 41003460, 40810668, 30782556, 13692060, 27650256, 27585600, 27824376, 28043616,
+    27963096, 27328788, 26155332, 26219988, 13206348, 14011740, 77182128, 30102348, 13743708, 27112860,
+    27048204, 28048428, 28069176, 27764604, 28064976, 26891520, 26956176, 13154700, 24527136, 14011740,
+    2220576, 42347076, 47694876, 40263120, 36960624, 136945224, 139367556, 140916564, 142758036, 145796508,
+    145425600, 146244600, 147079152, 40321440, 84685716, 47393196, 40012200, 43046364, 36251352, 136078380,
+    137627388, 139468860, 142507332, 145315224, 145285632, 146120184, 40240824, 84472812, 48312168, 40887492,
+    43792104, 42775872, 35968140, 134462592, 136304064, 139342536, 142150428, 145299636, 145285596, 41008476,
+    87720840, 48936576, 41532912, 44268840, 43252608, 42264768, 35660268, 133049016, 136193184, 139001076,
+    142150284, 145315044, 41565804, 87611184, 48693000, 42402036, 44827152, 43810920, 42823080, 41807568,
+    35096796, 133764552, 135689148, 138838356, 142003116, 41567316, 87612696, 48691200, 42146676, 45780588,
+    44764356, 43776528, 42795360, 42035952, 34626276, 133145388, 136294596, 139459356, 41840724, 88442208,
+    48845268, 42311556, 45674448, 45638160, 44650332, 43669164, 42639024, 41841996, 33654024, 132577920,
+    135742680, 41294964, 84658356, 49095108, 42523596, 45924288, 45627792, 45619908, 44638740, 43608600,
+    42811572, 41650068, 33535584, 136577232, 41375580, 84871260, 49350132, 42739524, 46179312, 45882816,
+    45614724, 45613500, 44583360, 43786332, 42624828, 42879852, 33497496, 41456196, 85084164, 16468308,
+    882264, 12882348, 12858060, 13085484, 13249812, 13242900, 13326756, 13157736, 13182024, 13206312,
+    3123792, 40888152, 29829132, 13516176, 26839644, 26774988, 27775212, 27731304, 27721152, 27989196,
+    26815740, 26880396, 26945052, 13178952, 13463676, 2220540, 48784800, 41876892, 37385136, 139815432,
+    142118640, 144332676, 145324044, 149432688, 148176936, 148995936, 149830488, 150680592, 40400652, 48483120,
+    41625972, 43963056, 36603288, 138829464, 141043500, 142034868, 146143512, 148066560, 148036968, 148871520,
+    149721624, 40320036, 49188744, 41508696, 44673864, 43657632, 37294488, 135375084, 136366452, 140580792,
+    142503840, 145653048, 145639008, 146489112, 43982652, 49879488, 42394764, 45364608, 44348376, 42553932,
+    37115100, 133948080, 138162420, 140085468, 143234676, 146399436, 146400948, 43904592, 49375704, 43044072,
+    45662712, 44646480, 42852036, 42105384, 36455796, 134921412, 136844460, 139993668, 143158428, 146338740,
+    43825488, 49693884, 43028520, 46936128, 45919896, 44159304, 43413156, 42402828, 36641592, 134644320,
+    137793528, 140958288, 144138600, 44647680, 49577220, 42965820, 46559256, 46522968, 44762376, 44016228,
+    43005900, 42329508, 35647056, 134075304, 137240064, 140420376, 44100372, 49827060, 43177860, 46809096,
+    46512600, 45731952, 44985804, 43975476, 43299084, 42137580, 35518248, 138074616, 141254928, 44180988,
+    50082084, 43393788, 47064120, 46767624, 45726768, 45960564, 44950236, 44273844, 43112340, 43367364,
+    35480160, 142105032, 44261604, 50342292, 43613604, 47324328, 47027832, 45986976, 45960564, 45930180,
+    45253788, 44092284, 44347308, 44607516, 35532792, 44342220, 16387812, 882264, 12932916, 12908628,
+    14002272, 13978500, 13947300, 14200176, 14031156, 14055444, 14079732, 14104020, 4032180, 1467780,
+    5125860, 2629272, 15633336, 16561608, 16556352, 17649432, 17800068, 17775288, 17800584, 17825880,
+    17851176, 16931352, 5342232, 9549240, 5065008, 6240552, 27919272, 28784820, 29733420, 30289092,
+    30697272, 30697272, 30764952, 30832632, 29754888, 5699532, 9922812, 5338728, 8705196, 6934044,
+    28572588, 29546748, 30102420, 30553440, 30947208, 30947208, 31014888, 31109976, 5968032, 10197240,
+    5328240, 8977140, 8899976, 7375368, 29050656, 29606328, 30284724, 30678492, 31072260, 31072260,
+    30946476, 5960424, 10493808, 5665692, 9275328, 9206444, 9043316, 7509756, 29481336, 30159732,
+    30553500, 30947268, 31341036, 31147572, 5952816, 10396860, 5711328, 9445896, 9377012, 9213884,
+    9175760, 7463988, 29750556, 30144324, 30538092, 30931860, 31132164, 6022176, 10481944, 5703720,
+    9576504, 9521004, 9429576, 9391452, 9260844, 7632696, 29976936, 30370704, 30764472, 31007616,
+    6029784, 10502968, 5711328, 9576504, 9643332, 9551904, 9513780, 9383172, 9332544, 7632696,
+    30438384, 30832152, 31075296, 6037392, 10523992, 5718936, 9597528, 9643332, 9674232, 9636108,
+    9505500, 9454872, 9475896, 7632696, 30899832, 31142976, 6045000, 10545016, 5726544, 9618552,
+    9664356, 9674232, 9758436, 9627828, 9577200, 9598224, 9619248, 7632696, 31210656, 5766780,
+    10257880, 5452824, 9277740, 9704988, 9642692, 9705872, 9697592, 9660348, 9681372, 9702396,
+    9723420, 7048656, 1467960, 2991552, 15873948, 17038284, 17740032, 17734272, 18827352, 18802572,
+    18827868, 18853164, 18878460, 17949636, 11171652, 5341980, 5149188, 6446724, 28807032, 29826876,
+    30491112, 31434528, 31842708, 31842708, 31910388, 31978068, 30900324, 11480784, 5699280, 5495112,
+    8992632, 7157136, 29640204, 30304440, 31247856, 31698876, 32092644, 32092644, 32160324, 32280972,
+    11701248, 5967780, 5702316, 9314652, 9245768, 7702824, 29808348, 30777324, 31455720, 31849488,
+    32243256, 32243256, 32117472, 11564380, 6175452, 5691828, 9521184, 9452300, 9289172, 8007780,
+    29528544, 30959124, 31352892, 31746660, 32140428, 31946964, 11627560, 6167844, 6029280, 9817752,
+    9748868, 9594020, 9189092, 8142168, 30834132, 31227900, 31621668, 32015436, 32215740, 11712644,
+    6237204, 6021672, 9948360, 9892860, 9809712, 9646584, 9608460, 8310876, 31060512, 31454280,
+    31848048, 32091192, 11733668, 6244812, 6029280, 9948360, 10015188, 9932040, 9768912, 9730788,
+    9680160, 8310876, 31521960, 31915728, 32158872, 11754692, 6252420, 6036888, 9969384, 10015188,
+    10054368, 9891240, 9853116, 9802488, 9823512, 8310876, 31983408, 32226552, 11775716, 6260028,
+    6044496, 9990408, 10036212, 10054368, 10013568, 9975444, 9924816, 9945840, 9966864, 8310876,
+    32294232, 11544740, 5981808, 5767932, 9649596, 10085124, 10022828, 9961004, 10045208, 10007964,
+    10028988, 10050012, 10071036, 7726836, 220380, 37766616, 38725524, 39412104, 40093476, 40763472,
+    40492200, 40729584, 40966968, 41204352, 40517772, 26926200, 26611020, 11891376, 10572768, 63869616,
+    64442124, 64961748, 65141172, 66780720, 66780720, 67205016, 67629312, 67056804, 27042816, 26727636,
+    12185244, 20259864, 10856304, 62858916, 63378540, 63557964, 65197512, 66670560, 66670560, 67094856,
+    67908780, 27089652, 26774472, 12395952, 20444904, 19953372, 11104704, 61812648, 61992072, 63631620,
+    65104668, 66577716, 66577716, 67094856, 26817648, 26821308, 12605040, 20613024, 20121492, 19635948,
+    11317968, 60373296, 62065692, 63538740, 65011788, 66484836, 66577680, 26620920, 26548788, 12810888,
+    20672316, 20180784, 19695240, 19192272, 11300220, 60445404, 61918452, 63391500, 64864548, 66430440,
+    26627448, 26555316, 12727728, 21181296, 20689764, 20204232, 19718688, 19215720, 11566368, 60517152,
+    61990200, 63463248, 65029140, 26774220, 26702088, 12800268, 21181296, 21142776, 20657244, 20171700,
+    19668732, 19239168, 11584116, 62414496, 63887544, 65453436, 26920992, 26848860, 12872808, 21311148,
+    21142776, 21110256, 20624712, 20121744, 19692180, 19822032, 11601864, 64311840, 65877732, 27067764,
+    26995632, 12945348, 21441000, 21272628, 21110256, 21077724, 20574756, 20145192, 20275044, 20404896,
+    11619612, 66302028, 27020928, 26948796, 12734640, 21255960, 21527700, 21272628, 21110244, 21060288,
+    20630724, 20760576, 20890428, 21020280, 11371212, 2220840, 45676068, 48616584, 51451944, 53638680,
+    53561124, 54381804, 54460908, 54540012, 51599496, 18008076, 16978224, 884520, 7029480, 43497924,
+    46333320, 48517860, 48413052, 51963096, 51964644, 52043748, 52122852, 49182336, 33515316, 32391396,
+    14641764, 14080992, 17206740, 81459288, 84632076, 86672340, 89601336, 91117188, 91117188, 91328580,
+    91657692, 34228116, 33104196, 15521304, 14928492, 25977528, 19083492, 83905956, 85946220, 88875216,
+    90531468, 91754748, 91754748, 91328580, 34028208, 33783156, 16368804, 15575928, 26969832, 26706564,
+    20837160, 84397536, 87406164, 89805312, 91028592, 92251872, 91614312, 33794808, 33344832, 17017608,
+    15516648, 27598356, 27335088, 26816856, 21822480, 83408364, 88255080, 89478360, 90701640, 91287360,
+    33989364, 33539388, 16993320, 16618656, 28507980, 28244724, 27752556, 26473068, 22241988, 87518196,
+    88741476, 89964756, 90690876, 34327776, 33877800, 17246196, 16618656, 28984908, 28764492, 28501224,
+    27982992, 27759660, 22790880, 89837712, 91060992, 91787112, 34392432, 33942456, 17270484, 16642944,
+    28984908, 29139540, 28876272, 28358040, 28134708, 28473120, 22790880, 91272384, 91998504, 34457088,
+    34007112, 17294772, 16667232, 29049564, 29139540, 29251320, 28733088, 28509756, 28848168, 28912824,
+    22790880, 92209896, 33744288, 33294312, 16415232, 15787692, 29206620, 29049564, 29096688, 28953504,
+    28773012, 29111424, 29176080, 29240736, 20914128, 2226636, 45770316, 48710796, 51544644, 51468096,
+    51468096, 52288776, 52367880, 52445436, 40993764, 39971328, 28860384, 35704044, 40107096, 86124744,
+    88967052, 91681776, 94612284, 93855276, 94951512, 95162904, 92858292, 18116100, 17086248, 886176,
+    12899304, 5851296, 42789312, 44973852, 44869080, 48420636, 48967872, 48969420, 49048524, 49126596,
+    33273276, 32149356, 14645292, 27394836, 13829496, 16557228, 78841404, 81533016, 84479076, 86381244,
+    87897096, 87897096, 88106940, 33148536, 32862156, 15524832, 28280868, 14476932, 25138428, 18381096,
+    80727228, 83752920, 85655088, 87311340, 88534620, 88533072, 33144036, 32661732, 16372332, 29126328,
+    14417652, 25976328, 25686996, 19808100, 82202724, 84104892, 86504040, 87727320, 88949052, 33339096,
+    32856792, 16348560, 30035952, 15519660, 26890824, 26627556, 26109324, 20229120, 83509920, 85909068,
+    87132348, 88354080, 33328944, 32846640, 16341648, 29792736, 15688680, 27467796, 27204528, 26686296,
+    26505804, 20077992, 85829436, 87052716, 88274448, 33667356, 33185052, 16594524, 30131148, 15688680,
+    27944724, 27724296, 27434964, 27254976, 27219264, 20626884, 88148952, 89370684, 33732012, 33249708,
+    16618812, 30195804, 15712968, 27944724, 28099344, 27810012, 27630024, 27594312, 27932724, 20626884,
+    89582076, 33231456, 32573904, 16643100, 29487672, 15736728, 28008864, 28098828, 28184544, 28004556,
+    27968844, 28307256, 28371912, 20625696, 2229444, 45782472, 48721440, 48644916, 49281348, 49281348,
+    50102028, 49632348, 43982628, 42953568, 31977228, 35851284, 124466148, 40046856, 86184684, 89005104,
+    91951200, 91973304, 91973304, 93069540, 90684288, 45101112, 44072052, 33034500, 39242508, 35309808,
+    40347888, 84093048, 86913468, 89859564, 92873844, 92116836, 93213072, 93261924, 18211608, 17181756,
+    886968, 12854964, 12937656, 4944096, 42167760, 42062988, 45614580, 46163328, 46710564, 46712112,
+    46049640, 32621124, 32127168, 14623668, 27393348, 26728920, 13604688, 16400880, 76527828, 79553556,
+    82124100, 84026268, 85542120, 84736908, 32659464, 32001912, 15503208, 28272648, 27608220, 13545408,
+    24385944, 17898084, 78746256, 81316800, 83218968, 84875220, 85293288, 32854536, 32196984, 15479448,
+    29187132, 28522704, 14647428, 25326504, 25037172, 18319140, 80721864, 82624032, 84280284, 84698352,
+    33073776, 32416224, 15668064, 29182320, 29456724, 14816448, 26117712, 25828380, 25648392, 18611172,
+    82545912, 84945060, 85363128, 33063624, 32406072, 15661152, 29172168, 29213508, 14985468, 26694684,
+    26405352, 26225364, 26189652, 18460044, 84865428, 85283496, 33402036, 32744484, 15914028, 29510580,
+    29551920, 14985468, 27171612, 26925120, 26745144, 26938824, 26903112, 19008936, 86379732, 32519532,
+    31861980, 15769296, 28775748, 29578536, 14789088, 26935080, 27063636, 26883660, 27077340, 27041628,
+    27380040, 18646668, 2230572, 45779808, 45703284, 46444860, 47081292, 47081292, 47353188, 45434340,
+    44476272, 34027476, 35989308, 129975732, 132241248, 39969012, 86220576, 89166672, 89329212, 90073620,
+    90073620, 88573212, 46569456, 45579048, 35082192, 40911252, 35385624, 128679012, 40270044, 84113388,
+    87059484, 90195048, 90217152, 90217152, 91150848, 47422032, 46431624, 35905704, 41616156, 40492740,
+    34775676, 40360776, 81881280, 84827376, 87962940, 90977220, 90220212, 90511236, 17263236, 17262720,
+    887280, 12804864, 12887556, 12907152, 4036152, 39255420, 42807012, 43355796, 43904544, 44451780,
+    43711752, 31469436, 31468920, 14597892, 27384408, 26715120, 26009340, 12671940, 15917148, 74424168,
+    77100444, 79670988, 81573156, 82283796, 31664508, 31663992, 14574132, 28298892, 27629604, 26923836,
+    13774464, 23696700, 16338204, 76505508, 79076052, 80978220, 81688860, 31926600, 31926084, 14794800,
+    28336932, 28602324, 27896556, 13943484, 24521748, 24341772, 16700472, 79740864, 81643032, 82494072,
+    32145840, 32145324, 14983416, 28556172, 28597512, 28830576, 14112504, 25312956, 25132980, 25326660,
+    16992504, 81564912, 83158848, 32135688, 32135172, 14976504, 28546020, 28587360, 28587360, 14281524,
+    25889928, 25709952, 25903632, 25867920, 16841376, 83079216, 31526940, 31526424, 15060360, 28084944,
+    28887732, 28689240, 14060856, 26130324, 25950348, 26186880, 26380560, 26344848, 17028000, 2230860,
+    42750660, 43492236, 44233812, 44870244, 44321460, 45971004, 44979972, 35471460, 36118872, 132447096,
+    134660916, 136941948, 39861540, 86365548, 86633784, 87518628, 88263036, 85666392, 47068596, 46077564,
+    36326760, 41647368, 35452944, 131083092, 133364124, 40162536, 84258324, 87393888, 87556428, 88300836,
+    88138296, 47937804, 46946772, 37147716, 42336564, 41208288, 34791156, 129817368, 40253268, 82010664,
+    85146228, 88281792, 88303896, 87498684, 47628864, 47804532, 37975116, 43046652, 41918376, 40801620,
+    34168212, 39708552, 79778520, 82914084, 86049648, 89063928, 87501708, 16553280, 16313472, 887352,
+    12745692, 12828384, 12847980, 12672048, 3126840, 39997212, 40545996, 41094780, 41643528, 41449188,
+    30756396, 30468744, 13664904, 27405432, 26736144, 26025516, 25319736, 12900636, 14356908, 72026748,
+    74703024, 77273568, 78370524, 31018488, 30730836, 13885572, 27475800, 27708864, 26998236, 26292456,
+    13069656, 22953240, 14719176, 75508236, 78078780, 79175736, 31280580, 30992928, 14106240, 27737892,
+    27746904, 27970956, 27265176, 13238676, 23778288, 24014820, 15081444, 78743592, 79840548, 31499820,
+    31212168, 14294856, 27957132, 27966144, 27966144, 28199196, 13407696, 24569496, 24806028, 24999708,
+    15373476, 79762428, 30542508, 30254856, 14118924, 27147492, 27917952, 27719460, 27719448, 13356048,
+    24909936, 25146468, 25340148, 25304436, 14860080, 2230896, 42787380, 43528956, 44270532, 44463324,
+    47166072, 46175040, 36909780, 37327068, 136581768, 138017952, 140106888, 141724584, 40410360, 87569424,
+    88454268, 89339112, 87627312, 48025272, 47034240, 37765080, 42943512, 36597420, 134438616, 136527552,
+    138145248, 40709844, 88328016, 88490556, 89375400, 90097704, 48851628, 47860596, 38586036, 43394316,
+    42266040, 35883756, 132965208, 134582904, 40905660, 86080320, 89215884, 89378424, 89458056, 48559320,
+    48701148, 39442932, 44044344, 42916068, 41794452, 35149140, 130945968, 40996368, 83692224, 86827788,
+    89963352, 89320680, 48488616, 48396876, 40274220, 44541960, 43413684, 42292068, 41146152, 34073460,
+    40450644, 80575272, 83710836, 86846400, 89161200, 16781868, 16542060, 887352, 12922632, 13005324,
+    13056972, 13076568, 12900636, 3400176, 40739304, 41288088, 41836872, 41644080, 31110960, 30823308,
+    13678008, 27776364, 28009428, 27298800, 26545320, 25567308, 13129224, 14940612, 73805868, 76482144,
+    78353208, 31373052, 31085400, 13898676, 28038456, 28047468, 28271520, 27518040, 26540028, 13298244,
+    23502816, 15302880, 77287356, 79158420, 31635144, 31347492, 14119344, 28300548, 28309560, 28309560,
+    28490760, 27512748, 13467264, 24327864, 24564396, 15665148, 79963632, 30950076, 30662424, 14170992,
+    27763152, 28533612, 28335120, 28292268, 28244076, 13415616, 24916380, 25152912, 25389444, 15665148,
+    2230812, 42813864, 43555440, 43748232, 47320092, 46329060, 37757712, 37022652, 137326356, 138761028,
+    140849928, 142521624, 146406492, 40408740, 87389244, 88274088, 86562288, 48499272, 47508240, 38852820,
+    43166592, 36918216, 136408608, 137754612, 139285908, 143170776, 41257008, 88416072, 89300916, 90023220,
+    49097748, 48106716, 39478248, 43617396, 42880488, 36151200, 134190756, 135722052, 139606920, 41451312,
+    89034192, 89196732, 89276364, 48762588, 48904416, 40303092, 44267424, 43302636, 42181020, 35375076,
+    132069528, 136060092, 41541984, 86646060, 89781624, 89138952, 48708516, 48616776, 41163876, 44781672,
+    43774032, 42652416, 41501640, 34268292, 132437196, 40996260, 83513556, 86649120, 88979472, 48967512,
+    48875772, 41111496, 45995904, 44988264, 43866660, 42750228, 41609496, 33833592, 41192112, 80630136,
+    83765700, 86096052, 16806120, 16566312, 887328, 12922596, 13174308, 13225956, 13245552, 13069620,
+    13129188, 3400140, 41365572, 41914356, 41721564, 31109556, 30821904, 13678488, 27710304, 28013736,
+    28205460, 27451980, 26469108, 25574268, 13322496, 14754816, 76402620, 78273684, 31371648, 31083996,
+    13899156, 27972396, 28275828, 28243500, 28424700, 27441828, 26546988, 13491516, 24291180, 15117084,
+    79078896, 30686580, 30398928, 13950804, 27435000, 28499880, 28269060, 28226208, 28178016, 27283176,
+    13439868, 24879696, 25116228, 15117084, 2230728, 42828684, 43021476, 47559276, 46568244, 38523780,
+    36764820, 137247084, 139751928, 141096420, 142627680, 146566548, 146536956, 40487736, 87406416, 85694616,
+    48478248, 47487216, 39399072, 43145568, 36543816, 136587132, 137931624, 139462884, 143401752, 146550960,
+    41255388, 88220340, 88942644, 49396704, 48405672, 40264308, 43916352, 42928524, 36412380, 135594684,
+    136383048, 140181516, 143330724, 41998476, 89106696, 89186328, 48833664, 48975492, 40893624, 44338500,
+    43350672, 42620424, 35593272, 132729012, 136633176, 139782384, 42087636, 89584380, 88941708, 48736740,
+    48645000, 41722356, 44809896, 43822068, 42863940, 41713164, 34455348, 132994692, 136143900, 41541876,
+    86451840, 88782192, 49012368, 48920628, 41699472, 46040760, 45052932, 44051964, 42935532, 41789940,
+    33999912, 132690456, 41737728, 83552868, 85883220, 49262208, 49170468, 41911512, 46030392, 46022508,
+    45021540, 43905108, 42759516, 41681580, 33891840, 41818344, 83765772, 86096124, 16830372, 16590564,
+    887304, 12946848, 13174272, 13394940, 13414536, 13238604, 13298172, 13322460, 3400104, 41991840,
+    41799048, 31103292, 30815640, 13675296, 27704040, 27942816, 28204908, 28353780, 27370908, 26471208,
+    26535864, 13515768, 14569020, 78194160, 30418224, 30130572, 13726944, 27166644, 28166868, 28230468,
+    28155288, 28107096, 27207396, 27272052, 13464120, 24843012, 14569020, 2230644, 42283056, 47689944,
+    46698912, 39131160, 36499212, 137667852, 139322592, 141737256, 142524108, 146322540, 146292948, 147127500,
+    40566732, 84811392, 48608916, 47617884, 40006452, 43276236, 36216000, 136157796, 138572460, 139359312,
+    143157744, 146306952, 146292912, 41334384, 88059420, 49267164, 48276132, 40651872, 43786812, 42798984,
+    35978364, 135423144, 136209996, 140008428, 143157636, 146322396, 41996856, 88090200, 49024104, 49165932,
+    41520996, 44528940, 43541112, 42559944, 35805204, 133782876, 136803708, 139952916, 143117676, 42634800,
+    88836120, 48699300, 48607560, 42154200, 44772456, 43784628, 42803460, 42044052, 34634664, 133163712,
+    136312920, 139477680, 42087528, 88569396, 48932076, 48840336, 42099264, 45960468, 44972640, 43991484,
+    42995688, 41850096, 34158456, 132843888, 136008648, 42283344, 85670388, 49181916, 49090176, 42311304,
+    45950100, 45942216, 44961060, 43965264, 42819672, 41736876, 34040016, 136843200, 42363960, 85883292,
+    49436940, 49345200, 42527232, 46205124, 45937032, 45935820, 44940024, 43794432, 42711636, 42966660,
+    34001928, 42444576, 86096196, 16854624, 16614816, 887280, 12971100, 13198524, 13394904, 13583520,
+    13407588, 13467156, 13491444, 13515732, 3400068, 41876532, 30145008, 29857356, 13499412, 26893428,
+    27893652, 27892596, 28111836, 28031316, 27131616, 27196272, 27260928, 13488372, 14020956, 2230608,
+    48779868, 47788836, 40744932, 36851148, 140524632, 142738704, 144303264, 146160288, 149073876, 149044284,
+    149878836, 150728940, 40630536, 49519332, 48533484, 40627656, 44191836, 37612548, 137175984, 138740544,
+    140597568, 143511156, 146660364, 146646324, 147496428, 44413680, 50210076, 49224228, 41513724, 44882580,
+    43121988, 37433196, 136322208, 138179232, 141092820, 144242028, 147406788, 147408300, 44335644, 49706808,
+    49853820, 42163032, 45364500, 43603908, 42857760, 37164204, 134939736, 137959020, 141108228, 144272988,
+    147453300, 44892972, 49701984, 49615428, 43036044, 45927996, 44167404, 43421256, 42410928, 36649980,
+    134662644, 137811852, 140976612, 144156924, 44894484, 49664028, 49577472, 42753528, 46845276, 45084684,
+    44338548, 43362564, 42337608, 36151488, 134341272, 137506032, 140686344, 45088752, 49913868, 49827312,
+    42965568, 46834908, 46054260, 45308124, 44332140, 43307184, 42224388, 36022680, 138340584, 141520896,
+    45169368, 50168892, 50082336, 43181496, 47089932, 46049076, 46282884, 45306900, 44281944, 43199148,
+    43454172, 35984592, 142371000, 45249984, 50429100, 50342544, 43401312, 47350140, 46309284, 46282884,
+    46286844, 45261888, 44179092, 44434116, 44694324, 36037224, 45330600, 16760304, 16520496, 887280,
+    13016628, 14147352, 14123592, 14287920, 14281008, 14340576, 14364864, 14389152, 14413440, 4308456,
+    1469280, 5119752, 5066508, 2630772, 16388676, 16383432, 17476512, 17627652, 17778288, 17778804,
+    17804100, 17829396, 16909572, 5718504, 9956868, 9641472, 5286984, 6992508, 28301304, 29275464,
+    30037632, 30593304, 31069164, 31069164, 31136844, 31231932, 5996724, 10241808, 9926412, 5276496,
+    8819400, 7455264, 29006760, 29768928, 30324600, 30843300, 31237068, 31237068, 31111284, 5989116,
+    10539996, 10224600, 5613948, 9125868, 9034440, 7589652, 29643936, 30199608, 30718308, 31112076,
+    31505844, 31312380, 6041148, 10517620, 10508460, 5659584, 9363468, 9272040, 9233916, 7680252,
+    29790936, 30537012, 30930780, 31324548, 31524852, 6033540, 10496596, 10411512, 5705220, 9534036,
+    9442608, 9404484, 9273876, 7634484, 30017316, 30411084, 30804852, 31047996, 6110508, 10602704,
+    10517620, 5705220, 9685668, 9607624, 9569500, 9510592, 9345576, 7803192, 30747984, 31141752,
+    31384896, 6118116, 10623728, 10538644, 5712828, 9685668, 9729952, 9691828, 9632920, 9467904,
+    9574012, 7803192, 31209432, 31452576, 6125724, 10644752, 10559668, 5720436, 9706692, 9729952,
+    9814156, 9755248, 9590232, 9696340, 9717364, 7803192, 31520256, 5847504, 10357616, 10272532,
+    5446716, 9747324, 9698412, 9761592, 9825012, 9673380, 9779488, 9800512, 9821536, 7219152,
+    1469280, 5150508, 2992872, 16864992, 17566752, 17561496, 18654576, 18805212, 18805728, 18831024,
+    18856320, 17927496, 11516280, 5716884, 9974124, 5443188, 7215420, 29368560, 30234108, 31182708,
+    31738380, 32214240, 32214240, 32281920, 32402568, 11747256, 5995104, 10261260, 5650392, 9165012,
+    7782540, 29965404, 30939564, 31495236, 32013936, 32407704, 32407704, 32281920, 11684960, 6263604,
+    10535688, 5639904, 9436956, 9345528, 8223864, 30443472, 30999144, 31745220, 32138988, 32532756,
+    32339292, 11748140, 6255996, 10832256, 5977356, 9735144, 9651996, 9488868, 8358252, 30874152,
+    31620228, 32013996, 32407764, 32608068, 11727116, 6248388, 10735308, 6022992, 9905712, 9822564,
+    9659436, 9621312, 8312484, 31100532, 31494300, 31888068, 32131212, 11833224, 6325356, 10841416,
+    6022992, 10057344, 9987580, 9896152, 9858028, 9693012, 8481192, 31831200, 32224968, 32468112,
+    11854248, 6332964, 10862440, 6030600, 10057344, 10109908, 10018480, 9980356, 9815340, 9921448,
+    8481192, 32292648, 32535792, 11875272, 6340572, 10883464, 6038208, 10078368, 10109908, 10140808,
+    10102684, 9937668, 10043776, 10064800, 8481192, 32603472, 11644296, 6062352, 10596328, 5761644,
+    10127280, 10078368, 10088244, 10172448, 10020816, 10126924, 10147948, 10168972, 7897152, 1469400,
+    3355092, 17137524, 18039420, 18741168, 18735408, 19828488, 19829004, 19854300, 19879596, 18945660,
+    11896356, 11532036, 5716572, 5537028, 7421532, 30251016, 31270860, 31935096, 32878512, 33354372,
+    33354372, 33422052, 33542700, 12127332, 11763012, 5994792, 5805528, 9450768, 8005572, 31027716,
+    31691952, 32635368, 33154068, 33547836, 33547836, 33422052, 12065036, 11983476, 6263292, 6012732,
+    9772788, 9689640, 8551260, 31195860, 32164836, 32910912, 33304680, 33698448, 33504984, 11994932,
+    11846608, 6470964, 6002244, 9979320, 9896172, 9733044, 8856216, 30916056, 32414316, 32808084,
+    33201852, 33402156, 12058112, 11909788, 6463356, 6339696, 10275888, 10192740, 10037892, 9632964,
+    8990604, 32178804, 32572572, 32966340, 33209484, 12164220, 12015896, 6540324, 6339696, 10427520,
+    10357756, 10274608, 10111480, 10038948, 9159312, 32909472, 33303240, 33546384, 12185244, 12036920,
+    6547932, 6347304, 10427520, 10480084, 10396936, 10233808, 10161276, 10267384, 9159312, 33370920,
+    33614064, 12206268, 12057944, 6555540, 6354912, 10448544, 10480084, 10519264, 10356136, 10283604,
+    10389712, 10410736, 9159312, 33681744, 11975292, 11826968, 6277320, 6076692, 10497456, 10448544,
+    10466700, 10425900, 10366752, 10472860, 10493884, 10514908, 8575272, 221880, 38196672, 38883252,
+    39569832, 40251204, 40886280, 40887312, 41124696, 41362080, 40675500, 27505332, 27190152, 26874972,
+    12026580, 10890072, 64604412, 65176920, 65696544, 65805768, 67939812, 67939812, 68364108, 69178032,
+    27552168, 27236988, 26921808, 12237288, 20491008, 11138472, 63611028, 64130652, 64239876, 66373920,
+    67846968, 67846968, 68364108, 27280176, 27283824, 26968644, 12447996, 20676048, 20190516, 11386872,
+    62564760, 62673984, 64808028, 66281076, 67754124, 67846968, 27083952, 27011820, 27015480, 12657084,
+    20844168, 20358636, 19873092, 11600136, 61055208, 63242100, 64715148, 66188196, 67754088, 26865804,
+    26793672, 26721540, 12852312, 20882040, 20396508, 19910964, 19407996, 11582388, 61127316, 62600364,
+    64073412, 65639304, 27040524, 26968392, 26896260, 12852312, 21542292, 21056760, 20571228, 20085684,
+    19431444, 11866284, 63166608, 64639656, 66205548, 27187296, 27115164, 27043032, 12924852, 21542292,
+    21509772, 21024240, 20538696, 19884456, 20059176, 11884032, 65063952, 66629844, 27334068, 27261936,
+    27189804, 12997392, 21672144, 21509772, 21477252, 20991708, 20337468, 20512188, 20642040, 11901780,
+    67054140, 27287232, 27215100, 27142968, 12786684, 21927216, 21672144, 21509772, 21477240, 20823000,
+    20997720, 21127572, 21257424, 11653380, 2232636, 45775716, 48716232, 51551592, 53738328, 53739876,
+    54560556, 54639660, 54717216, 21273372, 20973072, 20145372, 889176, 7034952, 43735068, 46570464,
+    48755004, 48650196, 52279344, 52280892, 52359996, 52438068, 34475508, 33351588, 32227668, 14674704,
+    14159148, 17217000, 81666432, 84839220, 86879484, 90019872, 91535724, 91535724, 91745568, 34350780,
+    34064388, 32940468, 15554244, 15006648, 26044500, 19093752, 84113100, 86153364, 89293752, 90950004,
+    92173284, 92171736, 34346784, 33864480, 33619428, 16401744, 15654084, 27036804, 26773536, 20847420,
+    84604680, 87824700, 90223848, 91447128, 92668860, 34113384, 33631080, 33181104, 17050548, 15594804,
+    27665328, 27402060, 26883828, 21832740, 83615508, 88462224, 89685504, 90907236, 34372596, 33890292,
+    33440316, 17050548, 16721100, 28639608, 28376352, 27884184, 26540040, 22252248, 89300412, 90523692,
+    91745424, 34711008, 34228704, 33778728, 17303424, 16721100, 29116536, 28896120, 28632852, 28049964,
+    28309176, 22801140, 91619928, 92841660, 34775664, 34293360, 33843384, 17327712, 16745388, 29116536,
+    29271168, 29007900, 28425012, 28684224, 29022636, 22801140, 93053052, 34275108, 33617556, 33135252,
+    17352000, 16769148, 29180676, 29270652, 29382432, 28799544, 29058756, 29397168, 29461824, 22799952,
+    2235444, 45776244, 48716724, 51550572, 51553128, 51553128, 52373808, 51904128, 46116468, 45087408,
+    44070156, 32920248, 36316908, 41188524, 87354252, 90196560, 92911284, 96053184, 95296176, 96392412,
+    96441264, 21379032, 21073620, 20240808, 889968, 13235268, 6127752, 43764372, 45948912, 45844140,
+    49474800, 50022036, 50023584, 49361112, 33823368, 33329400, 32205480, 14649408, 27775092, 14134416,
+    17113536, 79913700, 82605312, 85762764, 87664932, 89180784, 88375572, 33862212, 33204660, 32918280,
+    15528948, 28661124, 14781852, 25472484, 18937404, 81799524, 85036608, 86938776, 88595028, 89013096,
+    33857712, 33200160, 32717856, 16376448, 29506584, 14722572, 26310384, 26021052, 20364408, 83275020,
+    85177188, 87576336, 87994404, 34117428, 33459876, 32977572, 16376964, 30480864, 15848868, 27289536,
+    27026268, 26443380, 20785428, 86016888, 88416036, 88834104, 34107276, 33449724, 32967420, 16370052,
+    30237648, 16017888, 27866508, 27603240, 27020352, 27279564, 20634300, 88336404, 88754472, 34445688,
+    33788136, 33305832, 16622928, 30576060, 16017888, 28343436, 28123008, 27769020, 28028736, 27993024,
+    21183192, 89850708, 33563184, 32905632, 32423328, 16478196, 30602676, 15821508, 28106904, 28261524,
+    27907536, 28167252, 28131540, 28469952, 20820924, 2236572, 45775056, 48714024, 48716604, 49353036,
+    49353036, 49624932, 47584812, 46594404, 45570528, 34964268, 36392724, 132293916, 41126124, 87396480,
+    90216900, 93374388, 93396492, 93396492, 94330188, 48442572, 47452164, 46428288, 35791668, 41652708,
+    35782776, 41321976, 85164372, 87984792, 91142280, 94156560, 93399552, 93690576, 21174048, 21168408,
+    20335596, 890280, 13190208, 13241856, 5219832, 43141380, 43036608, 46667304, 47216052, 47763288,
+    47023260, 32672184, 32671668, 32177712, 14623632, 27768024, 27062256, 13908888, 16956468, 77583132,
+    80820252, 83390796, 85292964, 86003604, 32710524, 32710008, 32052456, 15503172, 28647324, 27941556,
+    13849608, 24714420, 18453672, 79801560, 82372104, 84274272, 85125312, 32970252, 32969736, 32312184,
+    15503700, 29626464, 28920696, 14975916, 25719636, 25365648, 18874728, 83211840, 85114008, 85965048,
+    33189492, 33188976, 32531424, 15692316, 29621652, 29854716, 15144936, 26510844, 26156856, 26416572,
+    19166760, 85035888, 86629824, 33179340, 33178824, 32521272, 15685404, 29611500, 29611500, 15313956,
+    27087816, 26733828, 26993544, 26957832, 19015632, 86550192, 32570592, 32570076, 31912524, 15769260,
+    29911872, 29713380, 15093288, 27328212, 27017064, 27276792, 27470472, 27434760, 19202256, 2236860,
+    45759888, 45762468, 46504044, 47140476, 46591692, 48083952, 47092920, 46140036, 36208836, 36460044,
+    134697996, 136979064, 41047200, 87415740, 90573228, 90735768, 91480176, 91317636, 48958344, 47967312,
+    46982088, 37033680, 42368256, 35798256, 133432308, 41243052, 85168080, 88325568, 91461132, 91483236,
+    90678024, 48649416, 48825072, 47839848, 37861080, 43078344, 41961600, 35175348, 41333784, 82935972,
+    86093460, 89229024, 92243304, 90681084, 20464596, 20421828, 20416200, 890352, 13139748, 13191396,
+    13210992, 4311528, 40228320, 43859016, 44407800, 44956548, 44762208, 31802412, 31514760, 31514244,
+    14593944, 27753864, 27043236, 26337456, 12975780, 16472376, 75463200, 78139476, 80710020, 81806976,
+    32062140, 31774488, 31773972, 14594472, 28733004, 28022376, 27316608, 14102592, 24019956, 16893432,
+    78979212, 81549756, 82646712, 32324232, 32036580, 32036064, 14815140, 28771044, 28995096, 28289328,
+    14271612, 24845004, 25104732, 17255700, 82214568, 83311524, 32543472, 32255820, 32255304, 15003756,
+    28990284, 28990284, 29223348, 14440632, 25636212, 25895940, 26089620, 17547732, 83233404, 31586160,
+    31298508, 31297992, 14827824, 28942092, 28743600, 28743600, 14388984, 25976652, 26236380, 26430060,
+    26394348, 17034336, 2236896, 42797928, 43539504, 44281080, 44473872, 48067428, 47076396, 46090548,
+    37069176, 36589608, 135371664, 137601036, 139897620, 40939404, 87756228, 88024464, 88909308, 89631612,
+    48904296, 47913264, 46927416, 37694604, 42551184, 35875944, 134038692, 136335276, 41135220, 85508532,
+    88644096, 88806636, 88886268, 48612000, 48787656, 47801808, 38519448, 43245564, 42123960, 35211564,
+    132804072, 41225952, 83260872, 86396436, 89532000, 88889328, 48575640, 48483900, 48664752, 39350736,
+    43960836, 42839232, 41727660, 34596396, 40681236, 81028728, 84164292, 87299856, 89614656, 19754532,
+    19711764, 19498884, 890352, 13080468, 13132116, 13151712, 12975780, 3402108, 40969896, 41518680,
+    42067464, 41874672, 31150572, 30862920, 30575268, 13682508, 27836088, 27125460, 26414832, 25709052,
+    13204368, 14947524, 73913004, 76589280, 78460344, 31412664, 31125012, 30837360, 13903176, 27906456,
+    28098180, 27387552, 26681772, 13373388, 23537568, 15309792, 77394492, 79265556, 31674756, 31387104,
+    31099452, 14123844, 28168548, 28136220, 28360272, 27654492, 13542408, 24362616, 24599148, 15672060,
+    80070768, 30989688, 30702036, 30414384, 14175492, 28392600, 28161780, 28161780, 28385820, 13490760,
+    24951132, 25187664, 25424196, 15672060, 2236848, 42743796, 43485372, 43678164, 48792996, 47801964,
+    46816116, 37968756, 37163052, 137992032, 139443768, 141548256, 143181504, 41567220, 88733052, 89617896,
+    90340200, 49391472, 48400440, 47414592, 38594184, 43377828, 36396036, 135879912, 137984400, 139617648,
+    41761524, 89351172, 89513712, 89593344, 49056324, 49231980, 48246132, 39419028, 43833816, 42712212,
+    35690148, 134437608, 136070856, 41957340, 87103476, 90239040, 89596368, 49036596, 48944856, 49091868,
+    40279812, 44489028, 43367424, 42250992, 34973676, 132449472, 42048048, 84715380, 87850944, 90181296,
+    48972588, 48880848, 48794292, 41115996, 44993340, 43871736, 42755304, 41614572, 33838956, 41423220,
+    80735724, 83871288, 86201640, 20007372, 19964604, 19751724, 890328, 13281660, 13333308, 13384956,
+    13404552, 13204332, 3675408, 42338256, 42887040, 42694248, 31422408, 31134756, 30847104, 13658700,
+    28124292, 28316016, 27605388, 26851908, 25608504, 13626228, 15309072, 77393052, 79264116, 31684500,
+    31396848, 31109196, 13879368, 28386384, 28354056, 28578108, 27824628, 26581224, 13795248, 24599172,
+    15671340, 80069328, 30999432, 30711780, 30424128, 13931016, 28610436, 28379616, 28379616, 28560816,
+    27317412, 13743600, 25187688, 25424220, 15671340, 2236764, 42758616, 42951408, 48771972, 47780940,
+    46795092, 38515008, 36788652, 138170556, 139620780, 141725232, 143412480, 147552228, 41565600, 88537320,
+    89259624, 49690428, 48699396, 47713548, 39380244, 43425864, 36657216, 137283840, 138645396, 140192244,
+    144331992, 42308688, 89423676, 89503308, 49127400, 49303056, 48317208, 40009560, 43881852, 43151616,
+    35908344, 135097092, 136643940, 140783688, 42502992, 90041796, 89399124, 49064820, 48973080, 49120092,
+    40838292, 44537064, 43578948, 42462516, 35160732, 133006968, 137252412, 42593664, 87653664, 89984016,
+    49017444, 48925704, 48839148, 41703972, 45058008, 44057040, 42940608, 41795016, 34005276, 132702732,
+    41968836, 83658456, 85988808, 49345992, 49254252, 49167696, 41696196, 46341792, 45340824, 44224404,
+    43113156, 41686656, 34393248, 42791028, 84756204, 87086556, 20031624, 19988856, 19775976, 890304,
+    13281624, 13502292, 13553940, 13573536, 13373316, 13626192, 3675372, 42964524, 42771732, 31416144,
+    31128492, 30840840, 13655508, 28053372, 28315464, 28507188, 27753708, 26505444, 26843856, 13819500,
+    15123276, 79184592, 30731076, 30443424, 30155772, 13707156, 28277424, 28341024, 28308696, 28489896,
+    27241632, 27580044, 13767852, 25151004, 15123276, 2236680, 42212988, 48902640, 47911608, 46925760,
+    39122388, 36460836, 137741220, 140261616, 141621660, 143168472, 147308220, 147294180, 41644596, 88376400,
+    49560888, 48569856, 47584008, 39767808, 43296324, 36223200, 137112300, 138472344, 140019156, 144158904,
+    147323664, 42307068, 88407180, 49317840, 49493496, 48507648, 40636932, 44072292, 43091136, 36120276,
+    136150956, 136814472, 140954220, 144118980, 43050156, 89293536, 49027380, 48935640, 49082652, 41270136,
+    44499624, 43518468, 42793404, 35340048, 133175988, 137421432, 140586192, 43139316, 89771220, 48937152,
+    48845412, 48758856, 42103764, 44977716, 43996560, 43000764, 41855172, 34163820, 132856164, 136020924,
+    42514452, 85775976, 49265700, 49173960, 49087404, 42095988, 46261500, 45280344, 44284560, 43173312,
+    41741952, 34541424, 137103120, 43336644, 86873724, 49520724, 49428984, 49342428, 42311916, 46256316,
+    46255104, 45259320, 44148072, 42716712, 43050444, 34503336, 43417260, 87086628, 20055876, 20013108,
+    19800228, 890280, 13305876, 13502256, 13722924, 13742520, 13542300, 13795176, 13819464, 3675336,
+    42849216, 30457860, 30170208, 29882556, 13479624, 28004208, 28003152, 28265244, 28414116, 27165852,
+    27504264, 27568920, 13792104, 14575212, 2236644, 49813056, 48827208, 47841360, 39743592, 37857384,
+    138759408, 140429700, 142859916, 143521884, 147661632, 147647592, 148497696, 44723892, 50503800, 49517952,
+    48532104, 40629660, 43619328, 37678032, 138011364, 140441580, 141103548, 145243296, 148408056, 148409568,
+    44645856, 50000544, 50181384, 49195536, 41278968, 44135088, 43388952, 37479276, 137307816, 137969784,
+    142109532, 145274292, 148454604, 45308328, 50030064, 49943508, 50090520, 42151980, 44882400, 44136264,
+    43160280, 37355364, 134674920, 138920364, 142085124, 145265436, 45946272, 49669104, 49582548, 49495992,
+    42758028, 45089760, 44343624, 43367640, 42342684, 36156852, 134353548, 137518308, 140698620, 45319860,
+    49997652, 49911096, 49824540, 42750252, 46373544, 45627408, 44651436, 43660824, 42229464, 36524088,
+    138600504, 141780816, 46142052, 50252676, 50166120, 50079564, 42966180, 46368360, 46602168, 45626196,
+    44635584, 43204224, 43537956, 36486000, 142630920, 46222668, 50512884, 50426328, 50339772, 43185996,
+    46628568, 46602168, 46606140, 45615528, 44184168, 44517900, 44778108, 36538632, 46303284, 19951404,
+    19913748, 19705980, 890280, 14254704, 14230944, 14427324, 14615940, 14415720, 14668596, 14692884,
+    14717172, 4583724, 1470108, 5110092, 5056848, 5003604, 2269644, 15289092, 16382172, 16533324,
+    16684464, 16860396, 16860912, 16886208, 16911504, 5729628, 9886392, 9569376, 9253980, 4939872,
+    6666636, 27385704, 28180212, 28942380, 29565732, 30041592, 30041592, 30109272, 5722020, 10184580,
+    9867564, 9552168, 5277324, 8521692, 6801024, 28055220, 28817388, 29440740, 29916600, 30310368,
+    30310368, 5783772, 10175588, 10163556, 9848160, 5322960, 8769804, 8731680, 6913056, 28636104,
+    29259456, 29778156, 30171924, 30565692, 5835804, 10226264, 10141180, 10132020, 5368596, 9007404,
+    8969280, 8910372, 7003656, 28783104, 29529180, 29922948, 30316716, 5835804, 10226264, 10141180,
+    10056096, 5421840, 9198996, 9160872, 9101964, 8950332, 6957888, 29513772, 29907540, 30301308,
+    5912772, 10332372, 10247288, 10162204, 5421840, 9350628, 9312504, 9266980, 9187048, 9178768,
+    7126596, 30244440, 30638208, 5920380, 10353396, 10268312, 10183228, 5429448, 9350628, 9434832,
+    9389308, 9309376, 9301096, 9407204, 7126596, 30705888, 5927988, 10134264, 10038668, 9953584,
+    5437056, 9371652, 9434832, 9511636, 9431704, 9423424, 9529532, 9550556, 7126596, 1470108,
+    5143692, 5090448, 2631744, 16472412, 16467168, 17560248, 17711388, 17887320, 17887836, 17913132,
+    17938428, 11448000, 5728008, 9904224, 9588828, 5313768, 6993912, 28376688, 29350848, 30113016,
+    30736368, 31212228, 31212228, 31279908, 11409600, 6006228, 10189164, 9873768, 5303280, 8843292,
+    7456668, 29082144, 29844312, 30467664, 30986364, 31380132, 31380132, 11472780, 5998620, 10487352,
+    10171956, 5640732, 9149760, 9058332, 7591056, 29719320, 30342672, 30861372, 31255140, 31648908,
+    11523456, 6050652, 10464976, 10455816, 5686368, 9387360, 9295932, 9257808, 7681656, 29866320,
+    30612396, 31006164, 31399932, 11523456, 6050652, 10464976, 10379892, 5739612, 9578952, 9487524,
+    9449400, 9297768, 7635888, 30596988, 30990756, 31384524, 11629564, 6127620, 10571084, 10486000,
+    5739612, 9730584, 9652540, 9614416, 9534484, 9526204, 7804596, 31327656, 31721424, 11650588,
+    6135228, 10592108, 10507024, 5747220, 9730584, 9774868, 9736744, 9656812, 9648532, 9754640,
+    7804596, 31789104, 11488588, 6142836, 10360844, 10275760, 5754828, 9751608, 9774868, 9859072,
+    9779140, 9770860, 9876968, 9897992, 7804596, 1470108, 5174448, 2993844, 16944840, 17646600,
+    17641344, 18734424, 18910356, 18910872, 18936168, 18961464, 11827956, 11463636, 5726388, 9919860,
+    5468784, 7216824, 29438760, 30304308, 31252908, 31876260, 32352120, 32352120, 32419800, 11789556,
+    11694612, 6004608, 10206996, 5675988, 9187284, 7783944, 30035604, 31009764, 31633116, 32151816,
+    32545584, 32545584, 11791152, 11632316, 6273108, 10481424, 5665500, 9459228, 9367800, 8225268,
+    30513672, 31137024, 31883100, 32276868, 32670636, 11854332, 11695496, 6265500, 10777992, 6002952,
+    9757416, 9674268, 9511140, 8359656, 30944352, 31690428, 32084196, 32477964, 11854332, 11695496,
+    6265500, 10702068, 6056196, 9949008, 9865860, 9702732, 9643584, 8313888, 31675020, 32068788,
+    32462556, 11960440, 11801604, 6342468, 10808176, 6056196, 10100640, 10030876, 9939448, 9880300,
+    9872020, 8482596, 32405688, 32799456, 11981464, 11822628, 6350076, 10829200, 6063804, 10100640,
+    10153204, 10061776, 10002628, 9994348, 10100456, 8482596, 32867136, 11817844, 11601876, 6357684,
+    10597936, 6071412, 10121664, 10153204, 10184104, 10124956, 10116676, 10222784, 10243808, 8482596,
+    1470180, 3356016, 17213388, 18115284, 18817032, 18811272, 19929648, 19930164, 19955460, 19980756,
+    12206364, 11842044, 11477724, 5726028, 5561388, 7422888, 30315936, 31335780, 32000016, 33011112,
+    33486972, 33486972, 33554652, 12167964, 12073020, 11708700, 6004248, 5829888, 9471372, 8006928,
+    31092636, 31756872, 32767968, 33286668, 33680436, 33680436, 12169560, 12010724, 11929164, 6272748,
+    6037092, 9793392, 9710244, 8552616, 31260780, 32297436, 33043512, 33437280, 33831048, 12099456,
+    11940620, 11792296, 6480420, 6026604, 9999924, 9916776, 9753648, 8857572, 30980976, 32479236,
+    32873004, 33266772, 12183660, 12024824, 11876500, 6480420, 6371664, 10317516, 10234368, 10079520,
+    9653568, 8991960, 32748012, 33141780, 33535548, 12289768, 12130932, 11982608, 6557388, 6371664,
+    10469148, 10399384, 10316236, 10132084, 10216288, 9160668, 33478680, 33872448, 12310792, 12151956,
+    12003632, 6564996, 6379272, 10469148, 10521712, 10438564, 10254412, 10338616, 10444724, 9160668,
+    33940128, 12147172, 11931204, 11772368, 6572604, 6386880, 10490172, 10521712, 10560892, 10376740,
+    10460944, 10567052, 10588076, 9160668, 222708, 38576328, 39262908, 39949488, 40595940, 41503320,
+    41504352, 41741736, 41979120, 27887688, 27572508, 27257328, 26942148, 12145860, 10904076, 65196252,
+    65768760, 66218184, 66821904, 68955948, 68955948, 69380244, 27637116, 27619344, 27304164, 26988984,
+    12356568, 20676768, 11152476, 64202868, 64652292, 65256012, 67390056, 68863104, 68863104, 27440904,
+    27347352, 27351000, 27035820, 12567276, 20861808, 20376276, 11400876, 63086400, 63690120, 65824164,
+    67297212, 68770260, 27223260, 27129708, 27057576, 27061236, 12765744, 21008508, 20522976, 20037432,
+    11614140, 61576848, 63763740, 65236788, 66709836, 27173304, 27079752, 27007620, 26935488, 13044132,
+    21197652, 20712120, 20226576, 19572336, 11614140, 63616500, 65089548, 66562596, 27348024, 27254472,
+    27182340, 27110208, 13044132, 21857904, 21372372, 20886840, 20250024, 20200068, 11898036, 65655792,
+    67128840, 27494796, 27401244, 27329112, 27256980, 13116672, 21857904, 21825384, 21339852, 20703036,
+    20653080, 20827800, 11915784, 67553136, 27250776, 27038280, 26944728, 26872596, 13189212, 21987756,
+    21825384, 21792864, 21156048, 21106092, 21280812, 21410664, 11933532, 2238756, 45856716, 48797232,
+    51632592, 53898432, 53899980, 54720660, 54799764, 25652340, 25271712, 24959172, 24296472, 891624,
+    7037400, 43952652, 46788048, 48972588, 48946884, 52576032, 52577580, 52656684, 35032620, 34506324,
+    33382404, 32258484, 14701092, 14230464, 17222400, 81832752, 85005540, 87257196, 90397584, 91913436,
+    91913436, 35071476, 34381596, 34095204, 32971284, 15580632, 15077964, 26097924, 19099152, 84279420,
+    86531076, 89671464, 91327716, 92550996, 35067480, 34377600, 33895296, 33650244, 16428132, 15725400,
+    27090228, 26826960, 20852820, 84771000, 87991020, 90390168, 91613448, 34898736, 34208856, 33726552,
+    33276576, 17101224, 15690408, 27783408, 27520140, 26937252, 21838140, 85216500, 90063216, 91286496,
+    35157948, 34468068, 33985764, 33535788, 17101224, 16816704, 28757688, 28494432, 27937608, 27033168,
+    22257648, 90901404, 92124684, 35496360, 34806480, 34324176, 33874200, 17354100, 16816704, 29234616,
+    29014200, 28686276, 28543092, 28802304, 22806540, 93220920, 35561016, 34695888, 34181256, 33731280,
+    17378388, 16840992, 29234616, 29389248, 29061324, 28918140, 29177352, 29515764, 22806540, 2239884,
+    45843900, 48784380, 51697332, 51699888, 51699888, 52520568, 49156752, 48166344, 47142468, 46130400,
+    35927268, 36291816, 41405136, 87519600, 90361908, 93288024, 96429924, 95672916, 96769152, 25387404,
+    25376652, 25059000, 24391188, 891936, 13305864, 6129480, 43980516, 46165056, 46139388, 49770048,
+    50317284, 50318832, 33849120, 33848604, 33354636, 32230716, 14671644, 27827796, 14205012, 17118216,
+    80063028, 82966032, 86123484, 88025652, 89541504, 33887964, 33887448, 33229896, 32943516, 15551184,
+    28713828, 14852448, 25520328, 18942084, 81948852, 85185936, 87088104, 88744356, 33948120, 33947604,
+    33290052, 32807748, 16422972, 29623944, 14817456, 26422884, 26068896, 20369088, 84859020, 86761188,
+    89160336, 34207836, 34207320, 33549768, 33067464, 16423488, 30598224, 15943752, 27402036, 27074112,
+    26930928, 20790108, 87600888, 90000036, 34197684, 34197168, 33539616, 33057312, 16416576, 30355008,
+    16112772, 27979008, 27651084, 27507900, 27767112, 20638980, 89920404, 34360848, 34360332, 33670452,
+    33188148, 16669452, 30693420, 16112772, 28455936, 28170852, 28256568, 28516284, 28480572, 21187872,
+    2240172, 45830208, 48848280, 48850860, 49487292, 49487292, 49672524, 48681492, 47696268, 46677576,
+    37165608, 36307296, 136934388, 41341656, 87545196, 90577008, 93734496, 93756600, 93756600, 49411620,
+    49544436, 48559212, 47540520, 37996896, 43083684, 35684388, 41537508, 85313088, 88344900, 91502388,
+    94516668, 93759660, 25219188, 25164180, 25153428, 24485616, 892008, 13260444, 13312092, 5221200,
+    43356804, 43331136, 46961832, 47510580, 48057816, 32979852, 32692200, 32691684, 32197728, 14641956,
+    27815508, 27109740, 13979124, 16960788, 77716188, 80953308, 83523852, 85426020, 33082848, 32795196,
+    32794680, 32137128, 15545784, 28759464, 28053696, 13944132, 24757044, 18457992, 81369288, 83939832,
+    85842000, 33342576, 33054924, 33054408, 32396856, 15546312, 29738604, 29032836, 15070440, 25762260,
+    25847976, 18879048, 84779568, 86681736, 33561816, 33274164, 33273648, 32616096, 15734928, 29733792,
+    29966856, 15239460, 26553468, 26639184, 26898900, 19171080, 86603616, 33376416, 33056436, 33055920,
+    32398368, 15728016, 29723640, 29723640, 15408480, 27130440, 27216156, 27475872, 27440160, 19019952,
+    2240208, 45882228, 45884808, 46626384, 47367960, 49618476, 48627444, 47641596, 46693896, 37826532,
+    36384984, 137540772, 139837392, 41262408, 87759972, 90917460, 91080000, 91964844, 49374204, 49507020,
+    48521172, 47541132, 38655264, 43246044, 35720604, 136306188, 41458260, 85512312, 88669800, 91805364,
+    91967904, 49337856, 49203276, 49384116, 48404076, 39486552, 43961316, 42849756, 35105472, 41548992,
+    83280204, 86437692, 89573256, 92693268, 24679740, 24624732, 24576852, 24566112, 892008, 13209876,
+    13261524, 13281120, 4312788, 40443528, 44074224, 44623008, 45171792, 32171280, 31883628, 31595976,
+    31595460, 14633820, 27862548, 27151920, 26446140, 13045908, 16512084, 76443480, 79119756, 81796032,
+    32431008, 32143356, 31855704, 31855188, 14634348, 28841688, 28131060, 27425292, 14172720, 24323652,
+    16933140, 79959492, 82635768, 32693100, 32405448, 32117796, 32117280, 14855016, 28879728, 29103780,
+    28398012, 14341740, 25148700, 25408428, 17295408, 83440980, 32779944, 32459964, 32172312, 32171796,
+    15075684, 29141820, 29141820, 29365872, 14510760, 25973748, 26233476, 26470008, 17657676, 2240160,
+    42829416, 43570992, 44312568, 49132452, 48141420, 47155572, 46174908, 38148132, 35890164, 136700136,
+    138945060, 141257196, 41233608, 87873408, 88141644, 89026488, 48850656, 48983472, 47997624, 47016960,
+    38777448, 42959472, 35184276, 135398268, 137710404, 41429424, 85625712, 88761276, 88923816, 48830940,
+    48696360, 48877200, 47896536, 39606180, 43659036, 42542616, 34538040, 134194752, 41520156, 83378052,
+    86513616, 89649180, 48801276, 48666696, 48580140, 48766176, 40442364, 44381004, 43264584, 42158196,
+    33863832, 40896336, 80283204, 83418768, 86554332, 24025968, 23970960, 23923080, 23737128, 891984,
+    13174848, 13226496, 13246092, 13045872, 3403332, 41811372, 42360156, 42908940, 31436712, 31149060,
+    30861408, 30573756, 13685472, 27862044, 27151416, 26440788, 25469616, 13467768, 14765076, 76594212,
+    79270488, 31698804, 31411152, 31123500, 30835848, 13906140, 27932412, 28124136, 27413508, 26442336,
+    13636788, 24353292, 15127344, 80075700, 31785648, 31465668, 31178016, 30890364, 14126808, 28194504,
+    28162176, 28386228, 27415056, 13805808, 25178340, 25414872, 15489612, 2240112, 42763620, 43505196,
+    49682976, 48691944, 47706096, 46725432, 38746032, 36403992, 138754440, 140221728, 142341768, 144229896,
+    41861424, 88834680, 89719524, 49162788, 49295604, 48309756, 47329092, 39375348, 43611072, 35655120,
+    136673424, 138793464, 140681592, 42055728, 89452800, 89615340, 49100220, 48965640, 49146480, 48165816,
+    40204080, 44072244, 42955824, 34977744, 135262224, 137150352, 42251544, 87205104, 90340668, 49087188,
+    48952608, 48866052, 49018248, 41069760, 44734152, 43617732, 42506484, 34212600, 132602184, 42263148,
+    83954304, 87089868, 49092732, 48958152, 48871596, 48790224, 41950548, 45308016, 44191596, 43080348,
+    41653848, 33900552, 42264660, 83955816, 87091380, 24278808, 24223800, 24175920, 23989968, 891960,
+    13376040, 13427688, 13479336, 13474644, 13467732, 3676632, 43179732, 43728516, 31703688, 31416036,
+    31128384, 30840732, 13657992, 28145388, 28337112, 27626484, 26607612, 26597460, 13889628, 15126624,
+    80074260, 31790532, 31470552, 31182900, 30895248, 13878660, 28407480, 28375152, 28599204, 27580332,
+    27570180, 14058648, 25414896, 15488892, 2240028, 42766776, 49553436, 48562404, 47576556, 46595892,
+    39133596, 35969976, 138582900, 140048676, 142168680, 144056808, 148212108, 41859804, 88623396, 49353228,
+    49486044, 48500196, 47519532, 40002720, 43550592, 35867052, 137727288, 138963996, 140852124, 145007424,
+    42602892, 89509752, 49062780, 48928200, 49109040, 48128376, 40635924, 44011764, 43286712, 35157060,
+    135431244, 137319372, 141474672, 42797196, 90127872, 49006896, 48872316, 48785760, 48937956, 41469552,
+    44673672, 43677888, 42566640, 34371144, 132755616, 137016612, 42808764, 86877036, 49012440, 48877860,
+    48791304, 48709932, 42350340, 45247536, 44251752, 43140504, 41709144, 34048728, 137002572, 42810276,
+    86878548, 49346172, 49211592, 49125036, 49043664, 42346452, 46536504, 45540720, 44429484, 43032468,
+    43017636, 34506684, 43632468, 87976296, 24303060, 24248052, 24200172, 24014220, 891936, 13376004,
+    13596672, 13648320, 13643628, 13636716, 13889592, 3676596, 43806000, 31517316, 31197336, 30909684,
+    30622032, 13651128, 28069608, 28331700, 28523424, 27504552, 27494400, 27832812, 14082900, 14940828,
+    2239992, 49732452, 48715860, 47730012, 46749348, 39754800, 35582616, 138073644, 140609592, 141844752,
+    143732880, 147888180, 147889692, 41938908, 49235964, 49379292, 48393444, 47412780, 40404108, 43395744,
+    35383860, 137475828, 138710988, 140599116, 144754416, 147934728, 42601380, 49265496, 49141428, 49322268,
+    48341604, 41277120, 44176896, 43200924, 35330184, 135521856, 137409984, 141565284, 144745596, 43344468,
+    48938880, 48814812, 48728256, 48880452, 41883168, 44568072, 43592100, 42601488, 34521984, 132844680,
+    137105676, 140285988, 43354488, 48944424, 48820356, 48733800, 48652428, 42763956, 45141936, 44165964,
+    43175352, 41743992, 34189200, 137091636, 140271948, 43356000, 49278156, 49154088, 49067532, 48986160,
+    42760068, 46430904, 45454932, 44464332, 43067316, 43052484, 34647156, 141369696, 44178192, 49538364,
+    49414296, 49327740, 49246368, 42979884, 46430904, 46434876, 45444276, 44047260, 44032428, 44371344,
+    34699788, 44258808, 23643924, 23393892, 23313972, 23128020, 891936, 13400292, 13596672, 13817340,
+    13812648, 13805736, 14058612, 14082900, 3676596, 1470516, 5100012, 5046768, 4993524, 4940280,
+    1991256, 15513564, 15664716, 15815868, 15992304, 16168236, 16168752, 15959556, 5445708, 9905280,
+    9588264, 9271248, 9054320, 5009640, 6180684, 26655036, 27449544, 28279392, 28902744, 29378604,
+    29123280, 5507460, 9906800, 9884256, 9567240, 9350312, 5055276, 8288592, 6292716, 27311100,
+    28140948, 28764300, 29240160, 29378604, 5569212, 9970860, 9875264, 9863232, 9646304, 5100912,
+    8536704, 8491180, 6404748, 27891984, 28515336, 29034036, 29172480, 5628852, 10042560, 9946964,
+    9861880, 9951188, 5154156, 8795328, 8749804, 8669872, 6495348, 28500432, 29246508, 29384952,
+    5628852, 10042560, 9946964, 9861880, 9875264, 5207400, 8986920, 8941396, 8861464, 8853184,
+    6449580, 29231100, 29369544, 5705820, 10148668, 10053072, 9967988, 9981372, 5207400, 9138552,
+    9093028, 9026480, 9089900, 9081620, 6618288, 29706444, 5660184, 9910456, 9814860, 9729776,
+    9982084, 5145648, 9061748, 9138552, 9072004, 9135424, 9127144, 9233252, 6506256, 1470516,
+    5136456, 5083212, 5099328, 2353356, 15598560, 16691640, 16842792, 17019228, 17195160, 17195676,
+    16986480, 11245824, 5729916, 9909864, 9592848, 9375920, 5035596, 6836328, 27724800, 28519308,
+    29349156, 29972508, 30448368, 30193044, 11309004, 5722308, 10208052, 9891036, 9674108, 5373048,
+    8628628, 6970716, 28394316, 29224164, 29847516, 30323376, 30461820, 11373064, 5784060, 10199060,
+    10187028, 9970100, 5418684, 8876740, 8838616, 7082748, 28975200, 29598552, 30117252, 30255696,
+    11444764, 5843700, 10270760, 10185676, 10274984, 5471928, 9135364, 9097240, 9017308, 7173348,
+    29583648, 30329724, 30468168, 11444764, 5843700, 10270760, 10185676, 10199060, 5525172, 9326956,
+    9288832, 9208900, 9200620, 7127580, 30314316, 30452760, 11550872, 5920668, 10376868, 10291784,
+    10305168, 5525172, 9478588, 9440464, 9373916, 9437336, 9429056, 7296288, 30789660, 11264780,
+    5875032, 10137036, 10051952, 10314160, 5463420, 9401784, 9485988, 9419440, 9482860, 9474580,
+    9580688, 7184256, 1470516, 5168868, 5194704, 2715456, 16777992, 16772748, 17865828, 18042264,
+    18218196, 18218712, 18009516, 11625780, 11463192, 5728296, 9926076, 9709148, 5408304, 7163604,
+    28710600, 29684760, 30514608, 31137960, 31613820, 31358496, 11640760, 11424792, 6006516, 10211016,
+    9994088, 5397816, 8948608, 7626360, 29416056, 30245904, 30869256, 31387956, 31526400, 11703940,
+    11487972, 5998908, 10509204, 10292276, 5735268, 9255076, 9163648, 7760748, 30053232, 30676584,
+    31195284, 31333728, 11775640, 11559672, 6058548, 10507852, 10597160, 5788512, 9513700, 9422272,
+    9363124, 7851348, 30661680, 31407756, 31546200, 11775640, 11559672, 6058548, 10507852, 10521236,
+    5841756, 9705292, 9613864, 9554716, 9546436, 7805580, 31392348, 31530792, 11881748, 11665780,
+    6135516, 10613960, 10627344, 5841756, 9856924, 9778880, 9719732, 9783152, 9774872, 7974288,
+    31867692, 11594036, 11378068, 6089880, 10374128, 10636336, 5780004, 9780120, 9824404, 9765256,
+    9828676, 9820396, 9926504, 7862256, 1470516, 5277516, 3077556, 17246532, 17948292, 17943036,
+    19061412, 19237344, 19237860, 19028664, 12004116, 11841528, 11477208, 5726676, 10038560, 5562132,
+    7386516, 29767488, 30633036, 31649316, 32272668, 32748528, 32493204, 12019096, 11803128, 11708184,
+    6004896, 10325696, 5769336, 9290980, 7953636, 30364332, 31406172, 32029524, 32548224, 32686668,
+    12020692, 11804724, 11645888, 6273396, 10600124, 5758848, 9562924, 9471496, 8394960, 30842400,
+    31465752, 32211828, 32350272, 12104896, 11888928, 11730092, 6273396, 10917716, 6103908, 9882136,
+    9798988, 9614836, 8529348, 31734528, 32480604, 32619048, 12104896, 11888928, 11730092, 6273396,
+    10841792, 6157152, 10073728, 9990580, 9806428, 9890632, 8483580, 32465196, 32603640, 12211004,
+    11995036, 11836200, 6350364, 10947900, 6157152, 10225360, 10155596, 10043144, 10127348, 10119068,
+    8652288, 32940540, 11923292, 11707324, 11548488, 6304728, 10956892, 6095400, 10148556, 10201120,
+    10088668, 10172872, 10164592, 10270700, 8540256, 1470552, 3356532, 17284548, 18186444, 18888192,
+    18907728, 20026104, 20026620, 20051916, 12389148, 12216048, 11851728, 11487408, 5733888, 5584152,
+    7423836, 30369672, 31389516, 32121432, 33132528, 33608388, 33608388, 12404128, 12177648, 12082704,
+    11718384, 6012108, 5852652, 9488328, 8007876, 31146372, 31878288, 32889384, 33408084, 33801852,
+    12405724, 12179244, 12020408, 11938848, 6280608, 6059856, 9810348, 9727200, 8553564, 31314516,
+    32351172, 33097248, 33491016, 12356644, 12130164, 11971328, 11823004, 6495888, 6056976, 10037904,
+    9954756, 9770604, 8858520, 31496160, 32994420, 33388188, 12440848, 12214368, 12055532, 11907208,
+    6495888, 6402036, 10355496, 10272348, 10096476, 9813876, 8992908, 33263196, 33656964, 12546956,
+    12320476, 12161640, 12013316, 6572856, 6402036, 10507128, 10437364, 10333192, 10292392, 10376596,
+    9161616, 33993864, 12567980, 12284368, 12115020, 11966696, 6580464, 6409644, 10507128, 10559692,
+    10455520, 10414720, 10498924, 10605032, 9161616, 223104, 38872680, 39559260, 40210920, 41129676,
+    42037056, 42038088, 42038088, 28076784, 27918648, 27603468, 27288288, 27141300, 12239076, 10916784,
+    65632356, 66134664, 67078584, 67682304, 69816348, 69392052, 27880572, 27668076, 27650304, 27335124,
+    27188136, 12449784, 20813892, 11165184, 64568772, 65512692, 66116412, 68250456, 69299208, 27662940,
+    27450444, 27356892, 27360540, 27213552, 12649872, 20977512, 20491980, 11413584, 63452304, 64056024,
+    66190068, 67238820, 27613488, 27400992, 27307440, 27235308, 27407160, 12931500, 21275484, 20789952,
+    20153136, 11644596, 63910296, 66097188, 67145940, 27563532, 27351036, 27257484, 27185352, 27281412,
+    13209888, 21464628, 20979096, 20342280, 20292324, 11644596, 65949948, 66998700, 27738252, 27525756,
+    27432204, 27360072, 27456132, 13209888, 22124880, 21639348, 21002544, 20970012, 20920056, 11928492,
+    67564944, 27317928, 27105432, 27011880, 26939748, 27602904, 13209888, 21995028, 21962508, 21325704,
+    21293172, 21243216, 21417936, 11928492, 2241432, 45921744, 48862260, 51776724, 54042564, 54044112,
+    54785688, 29788320, 29772456, 29386716, 29093976, 28815588, 892728, 7038696, 44155404, 46990800,
+    49254444, 49228740, 52857888, 52780332, 35019888, 35019372, 34493076, 33369156, 32309892, 14722032,
+    14296524, 17225784, 81963936, 85348116, 87599772, 90740160, 92044620, 35058744, 35058228, 34368348,
+    34081956, 33022692, 15601572, 15144024, 26139612, 19102536, 84410604, 86662260, 89802648, 91247508,
+    35119404, 35118888, 34429008, 33946704, 33766308, 16473360, 15815748, 27196572, 26868648, 20856204,
+    86336856, 89556876, 91744632, 34950660, 34950144, 34260264, 33777960, 33392640, 17146452, 15780756,
+    27889752, 27561828, 27418644, 21841524, 86782356, 91417680, 35209872, 35209356, 34519476, 34037172,
+    33651852, 17146452, 16907052, 28864032, 28536120, 28419000, 27514560, 22261032, 92255868, 35122116,
+    35121600, 34431720, 33949416, 33990264, 17375040, 16882764, 29276304, 28991232, 29103012, 28959828,
+    29219040, 22809924, 2241720, 45896424, 48916008, 51828960, 51831516, 51752412, 50405232, 50267832,
+    49282608, 48263916, 47560092, 38099148, 36192132, 41607276, 87650172, 90703872, 93629988, 96771888,
+    95803488, 29762304, 29507160, 29491296, 29193444, 28909944, 892800, 13371564, 6130416, 44182548,
+    46446192, 46420524, 50051184, 50519316, 34150632, 33830652, 33830136, 33336168, 32276904, 14688672,
+    27869124, 14270712, 17121240, 80177940, 83080944, 86238396, 87929172, 34254132, 33934152, 33933636,
+    33276084, 33054360, 15592500, 28819812, 14942436, 25556796, 18945108, 83498436, 86735520, 88426296,
+    34314288, 33994308, 33993792, 33336240, 32918592, 16464288, 29729928, 14907444, 26459352, 26545068,
+    20372112, 86408604, 88099380, 34574004, 34254024, 34253508, 33595956, 33178308, 16464804, 30704208,
+    16033740, 27438504, 27550284, 27407100, 20793132, 88939080, 34137684, 33817704, 33817188, 33159636,
+    33168156, 16433604, 30396336, 16178472, 27950820, 28062600, 27919416, 28178628, 20642004, 2241756,
+    45949920, 48967992, 48970572, 49633044, 50367816, 50230416, 49244568, 48264528, 47554080, 38753844,
+    36228348, 139665276, 41543472, 87871284, 90903096, 94060584, 94011732, 50336652, 49974696, 50112696,
+    49132656, 48422208, 39589020, 43927704, 35613216, 41739324, 85639176, 88670988, 91828476, 94737096,
+    29618892, 29363748, 29303628, 29287764, 29004264, 892800, 13326036, 13377684, 5222028, 43558620,
+    43532952, 47163648, 47633328, 33342564, 33022584, 32734932, 32734416, 32305116, 14680536, 27918036,
+    27212268, 14044716, 16999200, 78678324, 81915444, 84380328, 33445560, 33125580, 32837928, 32837412,
+    32244516, 15584364, 28861992, 28156224, 14009724, 25054584, 18496404, 82471824, 84936708, 33705288,
+    33385308, 33097656, 33097140, 32504244, 15584892, 29841132, 29135364, 15136032, 26059800, 26188356,
+    18917460, 85776444, 33541212, 33221232, 32933580, 32933064, 32766336, 15781272, 29814516, 30038568,
+    15280764, 26820192, 26948748, 27208476, 19279728, 2241708, 45911088, 45913668, 46576140, 49844268,
+    49706868, 48721020, 47740356, 47100900, 38876028, 35692020, 138757356, 141069528, 41543220, 87859008,
+    91016496, 90967644, 49829736, 49467780, 49605780, 48625116, 47953320, 39708648, 43620564, 35045784,
+    137553876, 41739072, 85611348, 88768836, 91693008, 49800084, 49438128, 49308732, 49494756, 48822960,
+    40544832, 44342532, 43236156, 34371612, 41750700, 82516536, 85674024, 88598196, 29241768, 28986624,
+    28926504, 28873512, 29109012, 892776, 13299720, 13351368, 13346676, 4313580, 41271612, 44902308,
+    45371988, 32451264, 32131284, 31843632, 31555980, 31620120, 14635488, 27882348, 27171720, 26200548,
+    13304772, 16328340, 79106544, 81571428, 32710992, 32391012, 32103360, 31815708, 31879848, 14636016,
+    28861488, 28150860, 27179700, 14431584, 25133220, 16749396, 82411164, 32546916, 32226936, 31939284,
+    31651632, 32141940, 14832396, 28834872, 29058924, 28087764, 14576316, 25893612, 26153340, 17111664,
+    2241660, 42846612, 43509084, 49183200, 49045800, 48059952, 47079288, 46406868, 38895948, 35147952,
+    137350656, 139611132, 142178148, 41514420, 87956892, 88013736, 49131144, 48769188, 48907188, 47926524,
+    47254104, 39529152, 43158948, 34470576, 136079892, 138646908, 41710236, 85709196, 88633368, 49118124,
+    48756168, 48626772, 48812796, 48140376, 40362780, 43865208, 42753972, 33775668, 134204472, 41721864,
+    82598832, 85523004, 49158012, 48796056, 48666660, 48585288, 49079568, 41243568, 44656728, 43545492,
+    42153336, 33924132, 41724384, 83485152, 86409324, 28652076, 28396932, 28336812, 28283820, 28376148,
+    892752, 13264692, 13316340, 13311648, 13304736, 3404124, 42639456, 43109136, 31711836, 31391856,
+    31104204, 30816552, 30593556, 13683468, 27876984, 27166356, 26190336, 26452416, 13726632, 14581332,
+    79045884, 31547760, 31227780, 30940128, 30652476, 30855648, 13879848, 27882696, 28074420, 27098400,
+    27360480, 13871364, 25098204, 14943600, 2241612, 42690048, 49625208, 49487808, 48501960, 47521296,
+    46848876, 39335160, 35612532, 139054896, 140397336, 142858656, 144762336, 42142236, 88691220, 49334760,
+    48972804, 49110804, 48130140, 47457720, 39968364, 43702032, 34902540, 136864584, 139325904, 141229584,
+    42336540, 89309340, 49278888, 48916932, 48787536, 48973560, 48301140, 40801992, 44127048, 43015812,
+    34186860, 134867880, 136771560, 42453252, 86198940, 49318776, 48956820, 48827424, 48746052, 49206492,
+    41682780, 44884728, 43773492, 42376476, 34254756, 136759032, 43091196, 86944860, 49329504, 48967548,
+    48838152, 48756780, 48983652, 42567456, 45463776, 44352540, 42955524, 42940692, 34012692, 43092708,
+    86946372, 28904916, 28649772, 28589652, 28536660, 28628988, 892728, 13465884, 13517532, 13544892,
+    13733508, 13726596, 3677424, 43928712, 31547784, 31227804, 30940152, 30652500, 30855672, 13628028,
+    28090812, 28282536, 27306516, 27525756, 27515604, 14124204, 14942880, 2241612, 49733952, 49596552,
+    48610704, 47630040, 46694016, 39769608, 35623836, 139049532, 140390424, 142851744, 144755424, 148926276,
+    42061620, 49763484, 49401528, 49539528, 48558864, 47622840, 40642620, 43694436, 35570160, 137201292,
+    139662612, 141566292, 145737144, 42804708, 49436880, 49074924, 48945528, 49131552, 48195528, 41248668,
+    44119452, 43128852, 34832196, 135203040, 137106720, 141277572, 42919872, 49476768, 49114812, 48985416,
+    48904044, 49100880, 42129456, 44877132, 43886532, 42489516, 34889724, 137094192, 141370740, 43557816,
+    49487496, 49125540, 48996144, 48914772, 48878040, 43014132, 45456180, 44465580, 43068564, 43053732,
+    34647660, 141372252, 43559328, 49826412, 49464456, 49335060, 49253688, 49216956, 43014132, 46750332,
+    45759732, 44362728, 44382240, 44372592, 35196336, 44381520, 28057620, 27802476, 27742356, 27689364,
+    28653276, 892728, 13441596, 13662264, 13689624, 13878240, 13871328, 14124204, 3677424, 1470684,
+    5153424, 5100180, 5046936, 5063052, 5009808, 2074584, 15740472, 15891624, 16068072, 16244508,
+    16420440, 16186464, 5444568, 10003928, 9981384, 9664368, 9432436, 9117040, 5079168, 6349848,
+    26946420, 27808608, 28638456, 29261808, 29482344, 5506320, 10067988, 9972392, 9960360, 9728428,
+    9413032, 5124804, 8380516, 6461880, 27602484, 28432332, 29055684, 29276220, 5575680, 10153072,
+    10057476, 9972392, 10045444, 9730048, 5178048, 8649652, 8583104, 6573912, 28644816, 29268168,
+    29531544, 5635320, 10224772, 10129176, 10044092, 10044092, 10034932, 5231292, 8908276, 8841728,
+    8905148, 6664512, 29253264, 29744016, 5635320, 10224772, 10129176, 10044092, 10044092, 9959008,
+    5284536, 9099868, 9033320, 9096740, 9088460, 6618744, 29728608, 5659044, 10071644, 9976048,
+    9890964, 10141040, 9988312, 5215176, 9174696, 9108148, 9184952, 9248372, 9240092, 6675420,
+    1470684, 5126136, 5072892, 5089008, 5035764, 2074728, 15822552, 15973704, 16150152, 16326588,
+    16502520, 16268544, 10927400, 5444568, 9926892, 9609876, 9391328, 9161016, 5105124, 6350136,
+    26988468, 27850656, 28680504, 29303856, 29524392, 10991460, 5506320, 9928412, 9905868, 9687320,
+    9457008, 5150760, 8393668, 6462168, 27644532, 28474380, 29097732, 29318268, 11076544, 5575680,
+    10013496, 9917900, 10004336, 9774024, 5204004, 8662804, 8596256, 6574200, 28686864, 29310216,
+    29573592, 11148244, 5635320, 10085196, 9989600, 10002984, 10078908, 5257248, 8921428, 8854880,
+    8918300, 6664800, 29295312, 29786064, 11148244, 5635320, 10085196, 9989600, 10002984, 10002984,
+    5310492, 9113020, 9046472, 9109892, 9101612, 6619032, 29770656, 10947236, 5659044, 9930448,
+    9834852, 10097060, 10032288, 5241132, 9187848, 9121300, 9198104, 9261524, 9253244, 6675708,
+    1470684, 5161392, 5187228, 5193624, 2436828, 15903660, 16996740, 17173188, 17349624, 17525556,
+    17291580, 11259156, 11259156, 5728776, 9929856, 9711308, 9480996, 5129892, 7005780, 28053048,
+    28915236, 29745084, 30368436, 30588972, 11322336, 11322336, 5721168, 10228044, 10009496, 9779184,
+    5467344, 8732084, 7140168, 28722564, 29552412, 30175764, 30396300, 11407420, 11407420, 5790528,
+    10240076, 10326512, 10096200, 5520588, 9001220, 8942072, 7252200, 29764896, 30388248, 30651624,
+    11479120, 11479120, 5850168, 10311776, 10325160, 10401084, 5573832, 9259844, 9200696, 9264116,
+    7342800, 30373344, 30864096, 11479120, 11479120, 5850168, 10311776, 10325160, 10325160, 5627076,
+    9451436, 9392288, 9455708, 9447428, 7297032, 30848688, 11276492, 11276492, 5873892, 10157028,
+    10419236, 10354464, 5557716, 9526264, 9467116, 9543920, 9607340, 9599060, 7353708, 1470684,
+    5271696, 5287812, 2798928, 17079204, 17073960, 18192336, 18368772, 18544704, 18310728, 11637492,
+    11637492, 11474904, 5727156, 10042916, 9812604, 5501412, 7333056, 29033664, 30075504, 30905352,
+    31528704, 31749240, 11652472, 11652472, 11436504, 6005376, 10327856, 10097544, 5490924, 9050444,
+    7795812, 29739120, 30568968, 31192320, 31455696, 11736676, 11736676, 11520708, 6005376, 10647068,
+    10416756, 5835984, 9377936, 9265484, 7930200, 30837744, 31461096, 31724472, 11808376, 11808376,
+    11592408, 6065016, 10645716, 10721640, 5889228, 9636560, 9524108, 9608312, 8020800, 31446192,
+    31936944, 11808376, 11808376, 11592408, 6065016, 10645716, 10645716, 5942472, 9828152, 9715700,
+    9799904, 9791624, 7975032, 31921536, 11605748, 11605748, 11389780, 6088740, 10739792, 10675020,
+    5873112, 9902980, 9803912, 9888116, 9951536, 9943256, 8031708, 1470684, 5300076, 3077868,
+    17317284, 18019044, 18039084, 19157460, 19333392, 19333908, 12011976, 12011976, 11849388, 11485068,
+    5733144, 10055312, 5584692, 7387260, 29815632, 30748860, 31765140, 32388492, 32864352, 12026956,
+    12026956, 11810988, 11716044, 6011364, 10342448, 5791896, 9306112, 7954380, 30412476, 31454316,
+    32077668, 32596368, 12049576, 12049576, 11833608, 11674772, 6287472, 10637900, 5789016, 9599080,
+    9486628, 8395704, 31351992, 31975344, 32721420, 12133780, 12133780, 11917812, 11758976, 6287472,
+    10955492, 6134076, 9918292, 9814120, 9773320, 8530092, 32244120, 32990196, 12133780, 12133780,
+    11917812, 11758976, 6287472, 10879568, 6187320, 10109884, 10005712, 9964912, 10049116, 8484324,
+    32974788, 12182756, 12182756, 11956276, 11797440, 6364440, 10985676, 6187320, 10261516, 10170728,
+    10201628, 10285832, 10277552, 8653032, 1470684, 3356808, 17351340, 18253236, 18980280, 18999816,
+    20118192, 20093412, 12384840, 12384840, 12211740, 11847420, 11504124, 5740320, 5605488, 7424544,
+    30412560, 31500084, 32232000, 33243096, 33651276, 12399820, 12399820, 12173340, 12078396, 11735100,
+    6018540, 5873988, 9501804, 8008584, 31189260, 31921176, 32932272, 33383292, 12422440, 12422440,
+    12195960, 12037124, 11976588, 6294648, 6088800, 9844848, 9740676, 8554272, 31818852, 32855508,
+    33533904, 12373360, 12373360, 12146880, 11988044, 11860744, 6509928, 6085920, 10072404, 9968232,
+    9927432, 8859228, 32000496, 33431076, 12457564, 12457564, 12231084, 12072248, 11944948, 6509928,
+    6430980, 10389996, 10285824, 10253304, 9970704, 8993616, 33699852, 12424784, 12424784, 12198304,
+    12039468, 12051056, 6579288, 6423372, 10520604, 10429816, 10468996, 10428196, 10512400, 9162324,
+    223260, 39121416, 39773076, 40697040, 41615796, 42523176, 42286824, 28078800, 28078512, 27920376,
+    27605196, 27458208, 27289800, 12317232, 10928772, 65913876, 66910680, 67854600, 68458320, 70168068,
+    27861168, 27860880, 27648384, 27630612, 27483624, 27315216, 12517320, 20902956, 11177172, 64850292,
+    65794212, 66397932, 68107680, 27811728, 27811440, 27598944, 27505392, 27677232, 27508824, 12800568,
+    21217848, 20581044, 11443320, 65701368, 66305088, 68014836, 27762276, 27761988, 27549492, 27455940,
+    27552000, 27702432, 13082196, 21515820, 20879016, 20846484, 11674332, 66159360, 67921956, 27712320,
+    27712032, 27499536, 27405984, 27502044, 27576684, 13360584, 21704964, 21068160, 21035628, 20985672,
+    11674332, 67774716, 27319944, 27319656, 27107160, 27013608, 27676764, 27604632, 13288044, 22235364,
+    21598560, 21566040, 21533508, 21483552, 11940480, 2242308, 45972828, 48992448, 51906912, 54172752,
+    54095196, 33440100, 33419652, 33398676, 33007824, 32986236, 32776728, 893112, 7039392, 44344812,
+    47259312, 49522956, 49497252, 53047296, 34995840, 34995840, 34995324, 34469028, 33409764, 32350500,
+    14738340, 14358072, 17228088, 82061856, 85446036, 87697692, 90626688, 35099352, 35099352, 35098836,
+    34408956, 34187220, 33127956, 15642168, 15229860, 26170500, 19104840, 85943196, 88194852, 91123848,
+    35160012, 35160012, 35159496, 34469616, 34051968, 33871572, 16513956, 15901584, 27227460, 27339240,
+    20858508, 87869448, 90878076, 34991268, 34991268, 34990752, 34300872, 33883224, 33497904, 17187048,
+    15866592, 27920640, 28032420, 27889236, 21843828, 88103556, 34824312, 34824312, 34823796, 34133916,
+    34142436, 33692460, 17162760, 16968600, 28830264, 28942056, 28824936, 27920496, 22263336, 2242344,
+    46014696, 49034280, 52052352, 51975828, 51009564, 50967588, 50835372, 49855332, 49144884, 48403392,
+    39690552, 36120240, 41796468, 87959268, 91012968, 94044780, 96975324, 33413976, 33393528, 33133272,
+    33112296, 33085596, 32870976, 893112, 13433004, 6131004, 44371740, 46635384, 46609716, 50161308,
+    34187784, 34187784, 33867804, 33867288, 33437976, 32378712, 14726532, 27966072, 14332152, 17158932,
+    81123084, 84131784, 87077880, 34291284, 34291284, 33971304, 33970788, 33377892, 33156168, 15630360,
+    28916760, 15003876, 25848756, 18982800, 84689676, 87715404, 34394280, 34394280, 34074300, 34073784,
+    33480888, 33063240, 16534188, 29860716, 14968884, 26785152, 26913708, 20480004, 88271784, 34227840,
+    34227840, 33907860, 33907344, 33740616, 33258312, 16510428, 30770340, 16070892, 27699648, 27854268,
+    27982824, 20901060, 2242296, 45977340, 48995412, 48918888, 50502648, 50460672, 50328456, 49347792,
+    48675996, 47927880, 39806508, 35552808, 140911524, 41811660, 87953328, 90985140, 93931236, 50478180,
+    50436204, 50079432, 50222616, 49550820, 48802704, 40646580, 44313384, 34878636, 41928408, 84858516,
+    87890328, 90836424, 33319728, 33299280, 33039024, 32973792, 33204168, 32989548, 893088, 13411728,
+    13439088, 5222580, 44374080, 44348412, 47900004, 33296988, 33296988, 32977008, 32689356, 32753496,
+    32324196, 14681484, 27932256, 26961096, 14299428, 16814736, 81324396, 84350124, 33399984, 33399984,
+    33080004, 32792352, 32856492, 32263596, 15585312, 28876212, 27905052, 14264436, 25858572, 18311940,
+    84906504, 33233544, 33233544, 32913564, 32625912, 33116220, 32458668, 15561552, 29790696, 28819536,
+    15366456, 26799132, 26927688, 18732996, 2242248, 45926844, 45850320, 49804056, 49762080, 49629864,
+    48649200, 47976780, 47299656, 39627012, 34977600, 139437540, 142004592, 41811408, 87925500, 90871596,
+    49796220, 49754244, 49397472, 49540656, 48868236, 48158772, 40464528, 43831200, 34282692, 137562156,
+    41928156, 84815136, 87761232, 49836120, 49794144, 49437372, 49313160, 49807428, 49097964, 41345316,
+    44622720, 43230576, 34431192, 42566124, 85701492, 88647588, 33048636, 33028188, 32767932, 32702700,
+    32895948, 33094296, 893064, 13385412, 13412772, 13601388, 4314132, 42087072, 45638664, 32400828,
+    32400828, 32080848, 31793196, 31570200, 31634340, 14632764, 27891708, 26915688, 27177768, 13559484,
+    16143876, 81541224, 32234388, 32234388, 31914408, 31626756, 31829928, 31829412, 14609004, 28806192,
+    27830172, 28092264, 14662008, 25872552, 16564932, 2242200, 42771600, 49034472, 48992496, 48860280,
+    47879616, 47207196, 46497108, 39488244, 34394652, 137575080, 140142132, 142724700, 41782608, 87796440,
+    48989112, 48947136, 48590364, 48733548, 48061128, 47351040, 40094292, 43228728, 33678972, 135684108,
+    138266676, 41899320, 84686040, 49029012, 48987036, 48630264, 48506052, 49000320, 48290232, 40975080,
+    44020248, 42623244, 33817104, 138359880, 42537288, 85572396, 49074084, 49032108, 48675336, 48551124,
+    48777996, 49234608, 41859756, 44816952, 43419948, 43439460, 34035552, 42539808, 86458716, 32555064,
+    32534616, 32274360, 32209128, 32402376, 32489592, 893040, 13350384, 13377744, 13566360, 13559448,
+    3404676, 43375812, 31230372, 31230372, 30910392, 30622740, 30825912, 30538260, 13652784, 27816828,
+    26840808, 27102900, 27364980, 13957056, 14396868, 2242236, 49714764, 49672788, 49540572, 48559908,
+    47623884, 46992000, 39974340, 35314920, 138527460, 141094512, 143571384, 145490616, 42331428, 49388160,
+    49346184, 48989412, 49132596, 48196572, 47564688, 40580388, 43543452, 34576956, 136634940, 139111812,
+    141031044, 42446592, 49428060, 49386084, 49029312, 48905100, 49135764, 48503880, 41461176, 44334972,
+    42937968, 34704720, 139205016, 141124248, 43189680, 49473132, 49431156, 49074384, 48950172, 48913440,
+    49414416, 42345852, 45097836, 43700832, 43720344, 34852968, 141127272, 43827624, 49489044, 49447068,
+    49090296, 48966084, 48929352, 49196760, 43234416, 45682068, 44285064, 44304576, 44294928, 34701624,
+    43829136, 31936356, 31915908, 31655652, 31590420, 32655252, 32523156, 893040, 13527324, 13554684,
+    13775352, 13963968, 13957056, 3678012, 1470720, 5145852, 5145852, 5092608, 5108724, 5055480,
+    5079204, 2074620, 15740544, 15916992, 16093440, 16269876, 16211316, 5449716, 9989612, 9989612,
+    9967068, 9735136, 9418120, 9208832, 5079204, 6350172, 26962620, 27824808, 28654656, 29022684,
+    5519076, 10074696, 10074696, 9979100, 10052152, 9735136, 9525848, 5132448, 8385604, 6462204,
+    28080132, 28909980, 29278008, 5588436, 10159780, 10159780, 10064184, 10064184, 10052152, 9842864,
+    5185692, 8654740, 8731544, 6574236, 29122464, 29490492, 5648076, 10231480, 10231480, 10135884,
+    10135884, 10050800, 10147748, 5238936, 8913364, 8990168, 9053588, 6664836, 29475588, 5594832,
+    9972244, 9972244, 9876648, 10126724, 9973996, 9995020, 5222820, 9028152, 9104956, 9168376,
+    9160096, 6507036, 1470732, 5179428, 5126184, 5152020, 5158416, 5105172, 2157936, 16049220,
+    16225668, 16402116, 16578552, 16519992, 11019204, 5442120, 10023800, 10001256, 9782708, 9537392,
+    9221996, 5174532, 6519180, 27274428, 28136616, 28966464, 29334492, 11104288, 5511480, 10108884,
+    10013288, 10099724, 9854408, 9539012, 5227776, 8483852, 6631212, 28391940, 29221788, 29589816,
+    11189372, 5580840, 10193968, 10098372, 10111756, 10171424, 9856028, 5281020, 8752988, 8829792,
+    6743244, 29434272, 29802300, 11261072, 5640480, 10265668, 10170072, 10183456, 10170072, 10160912,
+    5334264, 9011612, 9088416, 9151836, 6833844, 29787396, 10953956, 5587236, 10004812, 9909216,
+    10171424, 10093268, 10008184, 5318148, 9126400, 9203204, 9266624, 9258344, 6676044, 1470732,
+    5150952, 5176788, 5183184, 5129940, 2158080, 16127412, 16303860, 16480308, 16656744, 16598184,
+    11032356, 10938992, 5442120, 9945144, 9726596, 9494664, 9264352, 5199300, 6519468, 27311292,
+    28173480, 29003328, 29371356, 11117440, 11024076, 5511480, 9967688, 10043612, 9811680, 9581368,
+    5252544, 8495384, 6631500, 28428804, 29258652, 29626680, 11202524, 11109160, 5580840, 10052772,
+    10055644, 10128696, 9898384, 5305788, 8764520, 8841324, 6743532, 29471136, 29839164, 11274224,
+    11180860, 5640480, 10124472, 10127344, 10127344, 10203268, 5359032, 9023144, 9099948, 9163368,
+    6834132, 29824260, 10965488, 10872124, 5587236, 9863616, 10115312, 10050540, 10050540, 5342916,
+    9137932, 9214736, 9278156, 9269876, 6676332, 1470732, 5264100, 5280216, 5286612, 2520180,
+    16204632, 17323008, 17499456, 17675892, 17617332, 11362492, 11269128, 11269128, 5726328, 10044956,
+    9813024, 9582712, 5222880, 7175112, 28370688, 29232876, 30062724, 30430752, 11446696, 11353332,
+    11353332, 5726328, 10364168, 10132236, 9901924, 5567940, 8832180, 7309500, 29501652, 30331500,
+    30699528, 11531780, 11438416, 11438416, 5795688, 10376200, 10449252, 10218940, 5621184, 9101316,
+    9185520, 7421532, 30543984, 30912012, 11603480, 11510116, 11510116, 5855328, 10447900, 10447900,
+    10523824, 5674428, 9359940, 9444144, 9507564, 7512132, 30897108, 11294744, 11201380, 11201380,
+    5802084, 10435868, 10371096, 10371096, 5658312, 9474728, 9558932, 9622352, 9614072, 7354332,
+    1470732, 5294136, 5310252, 2799120, 17149716, 17169768, 18288144, 18464580, 18640512, 11736976,
+    11643612, 11643612, 11481024, 5732316, 10057928, 9827616, 5523852, 7333680, 29076384, 30118224,
+    30948072, 31571424, 11772980, 11679616, 11679616, 11463648, 6018144, 10363892, 10133580, 5520972,
+    9063836, 7796436, 30243288, 31073136, 31696488, 11857184, 11763820, 11763820, 11547852, 6018144,
+    10683104, 10452792, 5866032, 9391328, 9422228, 7930824, 31341912, 31965264, 11928884, 11835520,
+    11835520, 11619552, 6077784, 10681752, 10757676, 5919276, 9649952, 9680852, 9765056, 8021424,
+    31950360, 11871752, 11767876, 11767876, 11551908, 6077784, 10681752, 10681752, 5972520, 9841544,
+    9872444, 9956648, 9948368, 7975656, 1470720, 5321316, 3078048, 17383884, 18110940, 18130980,
+    19249356, 19399992, 12109828, 12005952, 12005952, 11843364, 11500068, 5738292, 10068692, 5605932,
+    7387872, 29853144, 30786372, 31802652, 32358324, 12145832, 12041956, 12041956, 11825988, 11752068,
+    6024120, 10376852, 5820744, 9317872, 7954992, 30911436, 31953276, 32508948, 12168452, 12064576,
+    12064576, 11848608, 11710796, 6300228, 10672304, 5817864, 9610840, 9641740, 8396316, 31850952,
+    32406624, 12252656, 12148780, 12148780, 11932812, 11795000, 6300228, 10989896, 6162924, 9930052,
+    9969232, 9928432, 8530704, 32675400, 12113768, 12009892, 12009892, 11793924, 11795000, 6292620,
+    10892948, 6208560, 10100620, 10139800, 10099000, 10183204, 8484936, 1470708, 3356976, 17414028,
+    18341220, 19068264, 19087800, 20180880, 12377184, 12377184, 12377184, 12204084, 11860788, 11517492,
+    5745456, 5625528, 7425144, 30444864, 31532388, 32264304, 33207720, 12413188, 12413188, 12413188,
+    12186708, 12112788, 11769492, 6031284, 5901636, 9511932, 8009184, 31683012, 32414928, 33358344,
+    12435808, 12435808, 12435808, 12209328, 12071516, 12010980, 6307392, 6116448, 9854976, 9894156,
+    8554872, 32312604, 33281580, 12386728, 12386728, 12386728, 12160248, 12022436, 11895136, 6522672,
+    6113568, 10082532, 10121712, 10080912, 8859828, 32426568, 12332044, 12332044, 12332044, 12105564,
+    12106640, 11958316, 6515064, 6451020, 10379100, 10418280, 10385760, 10103160, 8994216, 223296,
+    39288096, 40212060, 41136024, 42054780, 42724776, 28177296, 28030236, 28029948, 27871812, 27724824,
+    27556416, 27388008, 12369948, 10940400, 66111732, 67108536, 68052456, 68231880, 28127856, 27980796,
+    27980508, 27768012, 27918432, 27750024, 27581616, 12653196, 20965740, 11206548, 67015692, 67959612,
+    68139036, 28078416, 27931356, 27931068, 27718572, 27793212, 27943632, 27775224, 12936444, 21280632,
+    21248112, 11472696, 67866768, 68046192, 28028964, 27881904, 27881616, 27669120, 27743760, 27818400,
+    27968832, 13218072, 21578604, 21546084, 21513552, 11703708, 67900464, 27411912, 27264852, 27264564,
+    27052068, 27693804, 27621672, 27696312, 13423920, 21637896, 21605376, 21572844, 21522888, 11685960,
+    2242452, 46090380, 49110000, 52129584, 55056888, 36563940, 36319068, 36293508, 36267420, 36122808,
+    36088980, 35948352, 893184, 7039860, 44521860, 47436360, 49700004, 49595232, 35092428, 35027772,
+    35027772, 35027256, 34565616, 33506352, 32447088, 14775840, 14415600, 17265420, 82990728, 86480604,
+    89277912, 35195940, 35131284, 35131284, 35130768, 34505544, 34283808, 33224544, 15679668, 15287388,
+    26457240, 19142172, 87118164, 89915472, 35299440, 35234784, 35234784, 35234268, 34609044, 34191396,
+    34002000, 16583496, 15959112, 27548040, 27702660, 20966040, 90473364, 34976268, 34911612, 34911612,
+    34911096, 34712040, 34229736, 33844416, 17459364, 15899832, 28419780, 28574400, 28702956, 22463244,
+    2242404, 46041396, 49060980, 51999948, 51410436, 51108756, 51071964, 50944932, 50273136, 49525020,
+    48788712, 40747752, 35385300, 41973408, 87162336, 90216036, 93036456, 36562068, 36317196, 36291636,
+    36026268, 36251532, 36212592, 36066852, 893160, 13490496, 6131436, 45175056, 47438700, 47333928,
+    34201644, 34136988, 34136988, 33817008, 33881148, 33451836, 32392572, 14727120, 27709680, 14582952,
+    16974108, 83752884, 86550192, 34305144, 34240488, 34240488, 33920508, 33984648, 33391752, 33170028,
+    15630948, 28660368, 15254676, 26647524, 18797976, 87108084, 33981972, 33917316, 33917316, 33597336,
+    34087644, 33430092, 33012444, 16510488, 29539668, 15195396, 27519264, 27647820, 20295180, 2242356,
+    45992376, 48931344, 50728476, 50426796, 50390004, 50262972, 49590552, 48881088, 48138156, 40562028,
+    34789356, 140919084, 41988600, 87140844, 89961264, 50773560, 50471880, 50435088, 50083500, 50534928,
+    49825464, 49082532, 41446704, 44307444, 34937856, 42731688, 88027200, 90847620, 36492732, 36247860,
+    36222300, 35956932, 36137940, 36331164, 36185424, 893136, 13469220, 13689888, 5223012, 45177396,
+    45072624, 33305988, 33241332, 33241332, 32921352, 32698356, 32762496, 32333196, 14678400, 27671004,
+    27933096, 14550228, 16629912, 83742804, 32982816, 32918160, 32918160, 32598180, 32801352, 32800836,
+    32207940, 15557940, 28550304, 28812396, 14490948, 26592684, 18127116, 2242308, 45851112, 49921368,
+    49619688, 49582896, 49455864, 48783444, 48073356, 47369076, 40191792, 34185636, 139041036, 141623640,
+    41988348, 86886072, 49966452, 49664772, 49627980, 49276392, 49727820, 49017732, 48313452, 41076468,
+    43700112, 34323768, 141716844, 42731436, 87772428, 50011536, 49709856, 49673064, 49321476, 49505508,
+    49962108, 49257828, 41961144, 44496816, 44516340, 34542252, 43369404, 88658784, 36295632, 36050760,
+    36025200, 35759832, 35940840, 36096936, 36290172, 893112, 13442904, 13663572, 13852188, 4314564,
+    42811284, 31978800, 31914144, 31914144, 31594164, 31797336, 31509684, 31573824, 14601720, 27560940,
+    27823032, 28085112, 13785996, 15959052, 2242344, 49357728, 49056048, 49019256, 48892224, 47956200,
+    47324316, 46619412, 39872328, 34068708, 137344716, 139927320, 142525440, 41880516, 49397628, 49095948,
+    49059156, 48707568, 48895392, 48263508, 47558604, 40753116, 43150524, 34196472, 140020524, 142618644,
+    42623604, 49442712, 49141032, 49104240, 48752652, 48673080, 49207884, 48502980, 41637792, 43947228,
+    43966752, 34414956, 142727400, 43261572, 49492968, 49191288, 49154496, 48802908, 48723336, 48990744,
+    49452540, 42526356, 44749116, 44768640, 44793336, 34724124, 43264092, 35058672, 34813800, 34788240,
+    34522872, 35575464, 35512248, 35626392, 893112, 13383624, 13604292, 13792908, 13785996, 3405144,
+    1470720, 5145852, 5138244, 5138244, 5154360, 5101116, 5124840, 5079204, 2074620, 15740544,
+    15916992, 16093440, 16035396, 5461248, 10015688, 9994664, 9994664, 10057204, 9740188, 9529280,
+    9234908, 5079204, 6361368, 27249612, 28111800, 28718664, 5530608, 10100772, 10079748, 10079748,
+    10069236, 10057204, 9846296, 9551924, 5132448, 8475256, 6473400, 28367124, 28973988, 5599968,
+    10185856, 10164832, 10164832, 10154320, 10069236, 10163312, 9868940, 5185692, 8744392, 8821196,
+    6585432, 29229312, 5616084, 10011704, 9990680, 9990680, 10230244, 10077516, 10098540, 10107532,
+    5169576, 8936724, 9013528, 9090332, 6585432, 1470732, 5171820, 5171820, 5197656, 5204052,
+    5150808, 5174532, 2157936, 16049220, 16225668, 16402116, 16344072, 11045280, 5453652, 10028852,
+    10028852, 10104776, 9859460, 9542444, 9333156, 5174532, 6530376, 27561420, 28423608, 29030472,
+    11130364, 5523012, 10113936, 10113936, 10116808, 10176476, 9859460, 9650172, 5227776, 8573504,
+    6642408, 28678932, 29285796, 11215448, 5592372, 10199020, 10199020, 10201892, 10188508, 10176476,
+    9967188, 5281020, 8842640, 8919444, 6754440, 29541120, 10993416, 5608488, 10023248, 10023248,
+    10274944, 10196788, 10111704, 10205780, 5264904, 9034972, 9111776, 9188580, 6754440, 1470744,
+    5204208, 5230044, 5246160, 5252556, 5199312, 2241252, 16354008, 16530456, 16706904, 16648860,
+    11143528, 11050164, 5446056, 10061420, 10137344, 9905412, 9660096, 9344700, 5268672, 6699384,
+    27868044, 28730232, 29337096, 11228612, 11135248, 5515416, 10146504, 10149376, 10222428, 9977112,
+    9661716, 5321916, 8670132, 6811416, 28985556, 29592420, 11313696, 11220332, 5584776, 10231588,
+    10234460, 10234460, 10294128, 9978732, 5375160, 8939268, 9016072, 6923448, 29847744, 11090044,
+    10996680, 5600892, 10055816, 10307512, 10242740, 10229356, 10217324, 5359044, 9131600, 9208404,
+    9285208, 6923448, 1470744, 5253624, 5269740, 5276136, 5222892, 2241396, 16428312, 16604760,
+    16781208, 16723164, 11155060, 11061696, 10968332, 5446056, 10079612, 9847680, 9615748, 9385436,
+    5292252, 6699672, 27899724, 28761912, 29368776, 11240144, 11146780, 11053416, 5515416, 10102156,
+    10164696, 9932764, 9702452, 5345496, 8680044, 6811704, 29017236, 29624100, 11325228, 11231864,
+    11138500, 5584776, 10187240, 10176728, 10249780, 10019468, 5398740, 8949180, 9025984, 6923736,
+    29879424, 11101576, 11008212, 10914848, 5600892, 10260292, 10185008, 10185008, 10258060, 5382624,
+    9141512, 9218316, 9295120, 6923736, 1470744, 5286504, 5302620, 5309016, 2520336, 16275072,
+    17393448, 17569896, 17746344, 11481344, 11387980, 11294616, 11294616, 5737872, 10079336, 9847404,
+    9617092, 5245284, 7186608, 28684200, 29546388, 30408576, 11565548, 11472184, 11378820, 11378820,
+    5737872, 10398548, 10166616, 9936304, 5590344, 8930136, 7320996, 29815164, 30677352, 11650632,
+    11557268, 11463904, 11463904, 5807232, 10410580, 10483632, 10253320, 5643588, 9199272, 9283476,
+    7433028, 30932676, 11678584, 11574708, 11481344, 11481344, 5876592, 10495664, 10495664, 10568716,
+    5696832, 9468408, 9552612, 9629416, 7545060, 1470732, 5315340, 5331456, 2799264, 17216244,
+    17236296, 18354672, 18505824, 11854196, 11750320, 11656956, 11656956, 11515392, 5743848, 10090676,
+    9860364, 5545056, 7345164, 29384688, 30426528, 31221036, 11890200, 11786324, 11692960, 11692960,
+    11498016, 6029676, 10396640, 10166328, 5542176, 9160160, 7807920, 30594432, 31388940, 11974404,
+    11870528, 11777164, 11777164, 11582220, 6029676, 10715852, 10485540, 5887236, 9487652, 9531936,
+    7942308, 31657716, 11920600, 11816724, 11723360, 11723360, 11667304, 6091428, 10706860, 10779912,
+    5932872, 9735764, 9780048, 9864252, 8054340, 1470720, 5341332, 3078192, 17446524, 18173580,
+    18193632, 19286712, 12121552, 12121552, 12017676, 12017676, 11876112, 11532816, 5749824, 10099820,
+    5625948, 7399356, 30156264, 31121832, 32070432, 12157556, 12157556, 12053680, 12053680, 11858736,
+    11784816, 6035652, 10407980, 5840760, 9412576, 7966476, 31289736, 32263896, 12193560, 12193560,
+    12089684, 12089684, 11894740, 11756928, 6321480, 10713944, 5837880, 9716056, 9760340, 8429232,
+    32431800, 12138876, 12138876, 12035000, 12035000, 11978944, 11820108, 6313872, 11010512, 6175332,
+    10014244, 10066808, 10111092, 8563620, 1470708, 3357120, 17472780, 18399972, 19127028, 19121784,
+    12408312, 12387288, 12387288, 12387288, 12235212, 11891916, 11548620, 5756988, 5644356, 7436628,
+    30742800, 31862664, 32760552, 12444316, 12423292, 12423292, 12423292, 12217836, 12143916, 11800620,
+    6042816, 5920464, 9605016, 8020668, 32056128, 32954016, 12480320, 12459296, 12459296, 12459296,
+    12253840, 12116028, 12052620, 6328644, 6135276, 9958572, 10011136, 8587788, 33121920, 12377436,
+    12356412, 12356412, 12356412, 12289844, 12131008, 12003708, 6605676, 6124788, 10241028, 10293592,
+    10337876, 9050544, 223296, 39407976, 40331940, 41255904, 41937300, 28442796, 28295736, 28148676,
+    28148388, 28158444, 27990036, 27821628, 27653220, 12408012, 10969668, 68496588, 69493392, 70065900,
+    28393356, 28246296, 28099236, 28098948, 28054644, 28183644, 28015236, 27846828, 12691260, 21698784,
+    11235816, 69400548, 69973056, 28343916, 28196856, 28049796, 28049508, 28005204, 28058424, 28208844,
+    28040436, 12974508, 22013676, 21981156, 11501964, 69880212, 27727380, 27580320, 27433260, 27432972,
+    27955764, 27862212, 27936852, 28087272, 13183596, 22198716, 22166196, 22133676, 11750364, 2242368,
+    46116864, 49136484, 52077000, 39204456, 38954472, 38704488, 38673816, 38893968, 38712204, 38698176,
+    38594388, 893160, 7347480, 45392472, 48412092, 51337200, 35404008, 35339352, 35274696, 35274696,
+    35338836, 34877196, 33817932, 32758668, 14784240, 14695872, 17307072, 86387832, 89745984, 35507520,
+    35442864, 35378208, 35378208, 35442348, 34817124, 34595388, 33536124, 15688068, 15599700, 27502296,
+    19183824, 90383544, 35184864, 35120208, 35055552, 35055552, 35545860, 34855980, 34438332, 34248924,
+    16567608, 16474200, 28554000, 28708632, 21060576, 2242320, 46056216, 48996732, 51982836, 51681156,
+    51384660, 51353052, 51534264, 50824800, 50081868, 49350744, 41536548, 35723844, 42843984, 91177956,
+    94020300, 39202584, 38952600, 38702616, 38671944, 38652816, 38840928, 38821788, 38712888, 893136,
+    13770768, 6439056, 46150788, 49075896, 34508364, 34443708, 34379052, 34379052, 34123728, 34187868,
+    33758556, 32699292, 14731848, 28953528, 14895264, 17015760, 87018264, 34185708, 34121052, 34056396,
+    34056396, 34227240, 34226724, 33633828, 33412092, 15611388, 29839560, 15769764, 27653496, 18892512,
+    2242272, 45916464, 51175728, 50874048, 50577552, 50545944, 50727156, 50017068, 49312788, 48575040,
+    41162640, 35109756, 146015892, 42859176, 90945108, 51225996, 50924316, 50627820, 50596212, 50552868,
+    50966628, 50262348, 49524600, 42051204, 45895476, 35328240, 43602264, 91831464, 39158160, 38908176,
+    38658192, 38627520, 38608392, 38752248, 38940360, 38831460, 893112, 13749492, 13970160, 5530632,
+    46814592, 33181692, 33117036, 33052380, 33052380, 33223224, 32935572, 32999712, 32570400, 14655168,
+    28850196, 29112288, 15065328, 16724448, 2242308, 50606904, 50305224, 50008728, 49977120, 49894728,
+    49262844, 48557940, 47858844, 40839288, 34982460, 144319572, 146917728, 42779964, 50657172, 50355492,
+    50058996, 50027388, 49720440, 50212404, 49507500, 48808404, 41727852, 45345888, 35200944, 147026484,
+    43523052, 50707440, 50405760, 50109264, 50077656, 49770708, 49995276, 50457060, 49757964, 42616416,
+    46147776, 46172484, 35510148, 44266140, 38131476, 37881492, 37631508, 37600836, 38453292, 38377836,
+    38528820, 38716932, 893112, 13698924, 13919592, 14140260, 4622244, 1470708, 5153448, 5145840,
+    5138232, 5207592, 5154348, 5178072, 5132436, 5079192, 2074608, 15941748, 16118196, 16060152,
+    5463972, 10019108, 9998084, 9977060, 10062144, 10039600, 9828692, 9532700, 9151892, 5140044,
+    6304968, 28097940, 28704804, 5533332, 10104192, 10083168, 10062144, 10147228, 10051632, 10145708,
+    9849716, 9468908, 5193288, 8736292, 6417000, 28960128, 5549448, 9930040, 9909016, 9887992,
+    10223152, 10059912, 10080936, 10089928, 9709120, 5177172, 8928624, 9005428, 6417000, 1470720,
+    5179416, 5171808, 5250888, 5257284, 5204040, 5227764, 5174520, 2157924, 16250424, 16426872,
+    16368828, 11048700, 5456376, 10032272, 10011248, 10109716, 10158872, 9841856, 9630948, 9250140,
+    5235372, 6473976, 28409748, 29016612, 11133784, 5525736, 10117356, 10096332, 10194800, 10170904,
+    10158872, 9947964, 9567156, 5288616, 8834540, 6586008, 29271936, 10911752, 5541852, 9941584,
+    9920560, 10267852, 10179184, 10094100, 10188176, 9807368, 5272500, 9026872, 9103676, 6586008,
+    1470732, 5204196, 5283276, 5299392, 5305788, 5252544, 5268660, 2241240, 16555212, 16731660,
+    16673616, 11146948, 11053584, 5448780, 10043816, 10142284, 10204824, 9959508, 9642492, 9346768,
+    5329512, 6642984, 28716372, 29323236, 11232032, 11138668, 5518140, 10128900, 10227368, 10216856,
+    10276524, 9959508, 9663784, 5382756, 8931168, 6755016, 29578560, 11008380, 10915016, 5534256,
+    9953128, 10300420, 10225136, 10211752, 10199720, 9903996, 5366640, 9123500, 9200304, 6755016,
+    1470744, 5314476, 5330592, 5346708, 5353104, 5292252, 2324556, 16856112, 17032560, 16974516,
+    11243576, 11150212, 11056848, 5441184, 10173232, 10235772, 10003840, 9758524, 9356692, 5422464,
+    6811992, 29017812, 29624676, 11328660, 11235296, 11141932, 5510544, 10258316, 10247804, 10320856,
+    10075540, 9673708, 5475708, 9026176, 6924024, 29880000, 11105008, 11011644, 10918280, 5526660,
+    10331368, 10256084, 10256084, 10315752, 9913920, 5459592, 9218508, 9295312, 6924024, 1470744,
+    5283624, 5299740, 5306136, 5245284, 2241540, 16699956, 16876404, 17052852, 11251256, 11157892,
+    11064528, 10971164, 5448792, 10091336, 9859404, 9627472, 9310724, 5375496, 6643572, 28774572,
+    29636760, 11336340, 11242976, 11149612, 11056248, 5518152, 10113880, 10176420, 9944488, 9627740,
+    5428740, 8949384, 6755604, 29892084, 11364292, 11260416, 11167052, 11073688, 5587512, 10198964,
+    10188452, 10261504, 9944756, 5481984, 9218520, 9295324, 6867636, 1470732, 5315304, 5331420,
+    5330208, 2520468, 16542804, 17661180, 17812332, 11575908, 11472032, 11378668, 11285304, 11306328,
+    5740596, 10089428, 9857496, 9540748, 5327328, 7130496, 29553840, 30348348, 11660112, 11556236,
+    11462872, 11369508, 11390532, 5740596, 10408640, 10176708, 9859960, 5672388, 9197844, 7264884,
+    30617124, 11606308, 11502432, 11409068, 11315704, 11475616, 5802348, 10399648, 10472700, 10155952,
+    5718024, 9445956, 9530160, 7376916, 1470720, 5342952, 5351460, 2799396, 17480088, 17500140,
+    18593220, 11843264, 11843264, 11739388, 11646024, 11667048, 11525484, 5746572, 10099148, 9782400,
+    5625912, 7289052, 30249144, 31223304, 11879268, 11879268, 11775392, 11682028, 11703052, 11508108,
+    6032400, 10405112, 10088364, 5623032, 9426248, 7751808, 31391208, 11824584, 11824584, 11720708,
+    11627344, 11787256, 11571288, 6024792, 10703300, 10386552, 5960484, 9732716, 9777000, 7886196,
+    1470708, 5360148, 3078324, 17706480, 18433536, 18428292, 12130024, 12109000, 12109000, 12005124,
+    12026148, 11884584, 11541288, 5752548, 10020236, 5705616, 7343244, 31015536, 31913424, 12166028,
+    12145004, 12145004, 12041128, 12062152, 11867208, 11793288, 6038376, 10328396, 5920428, 9677044,
+    7910364, 32081328, 12063144, 12042120, 12042120, 11938244, 12098156, 11882188, 11744376, 6316596,
+    10613336, 5909940, 9959500, 10003784, 8373120, 1470696, 3451032, 17745216, 18704448, 19633272,
+    12509880, 12488856, 12467832, 12467832, 12488856, 12336780, 11993484, 11650188, 5759712, 5730444,
+    7450296, 31837032, 32914776, 12545884, 12524860, 12503836, 12503836, 12524860, 12319404, 12245484,
+    11902188, 6045540, 6016272, 9946020, 8034336, 33108240, 12443000, 12421976, 12400952, 12400952,
+    12560864, 12334384, 12196572, 12133164, 6323760, 6292836, 10286832, 10339396, 8618376, 223284,
+    40660836, 41584800, 42271380, 28428156, 28281096, 28134036, 27986976, 28154880, 28143516, 27975108,
+    27806700, 27551592, 12793020, 10981152, 69358932, 69931440, 28378716, 28231656, 28084596, 27937536,
+    28105440, 28039716, 28168716, 28000308, 27745200, 13076268, 21968508, 11247300, 69838596, 27762180,
+    27615120, 27468060, 27321000, 28056000, 27843504, 27896724, 28047144, 27792036, 13286976, 22153548,
+    22121028, 11495700, 2242236, 46135212, 49075728, 40646412, 40391316, 40136220, 39881124, 40096692,
+    40279692, 40092816, 40098588, 39953556, 893112, 6166140, 45518712, 48459228, 34240008, 34175352,
+    34110696, 34046040, 34110696, 34174836, 33713196, 32653932, 31303404, 14756100, 14703012, 16467696,
+    86133528, 33917352, 33852696, 33788040, 33723384, 34214208, 34213692, 33588468, 33366732, 32016204,
+    15635640, 15582552, 27380280, 18344448, 2242188, 45995460, 51147828, 50846148, 50549652, 50258340,
+    50534976, 50678520, 49974240, 49236492, 48244848, 42270984, 34833024, 42970188, 90946728, 40644540,
+    40389444, 40134348, 39879252, 40094820, 40038540, 40221540, 40222200, 40072056, 893088, 13777908,
+    5257716, 46197924, 32913336, 32848680, 32784024, 32719368, 33210192, 32890212, 32954352, 32525040,
+    31174512, 14679420, 28839072, 14878116, 16176384, 2242224, 50579004, 50277324, 49980828, 49689516,
+    49702548, 49924296, 49219392, 48520296, 47522028, 41947632, 34705728, 146778948, 42906384, 50629272,
+    50327592, 50031096, 49739784, 49752816, 49750008, 50168952, 49469856, 48471588, 42836196, 46094316,
+    35014932, 43649472, 39753480, 39498384, 39243288, 38988192, 40075344, 39799752, 39938496, 40121496,
+    39971352, 893088, 13732380, 13953048, 4349328, 1470696, 5161044, 5153436, 5145828, 5207580,
+    5207580, 5231304, 5185668, 5132424, 5140032, 2074596, 16142952, 16084908, 5465508, 10020908,
+    9999884, 9978860, 10042920, 10042920, 10126484, 9830492, 9448064, 9469088, 5200884, 6248568,
+    28690944, 5481624, 9846756, 9825732, 9804708, 10118844, 10051200, 10061712, 10070704, 9688276,
+    9709300, 5184768, 8920524, 6248568, 1470708, 5187012, 5179404, 5250876, 5310516, 5257272,
+    5280996, 5227752, 5235360, 2157912, 16451628, 16393584, 11050500, 5457912, 10034072, 10013048,
+    10090492, 10162192, 10139648, 9928740, 9546312, 9567336, 5296212, 6417576, 29002752, 10828468,
+    5474028, 9858300, 9837276, 10163544, 10170472, 10074876, 10168952, 9786524, 9807548, 5280096,
+    9018772, 6417576, 1470720, 5211792, 5283264, 5352624, 5359020, 5305776, 5321892, 5329500,
+    2241228, 16756416, 16698372, 11148748, 11055384, 5450316, 10045616, 10123060, 10208144, 10257300,
+    9940284, 9642940, 9663964, 5390352, 6586584, 29309376, 10925096, 10831732, 5466432, 9869844,
+    10196112, 10216424, 10192528, 10180496, 9883152, 9904176, 5374236, 9115400, 6586584, 1470732,
+    5314464, 5383824, 5399940, 5406336, 5345484, 5422452, 2324544, 17057316, 16999272, 11245376,
+    11152012, 11058648, 5442720, 10154008, 10239092, 10301632, 10056316, 9652864, 9758972, 5483304,
+    6755592, 29610816, 11021724, 10928360, 10834996, 5458836, 10227060, 10247372, 10236860, 10296528,
+    9893076, 9999184, 5467188, 9210408, 6755592, 1470744, 5344476, 5360592, 5376708, 5375496,
+    5375496, 2324700, 17127756, 17304204, 11338152, 11244788, 11151424, 11058060, 5442732, 10183336,
+    10245876, 10013944, 9682192, 9682192, 5505708, 6755892, 29892660, 11366104, 11262228, 11168864,
+    11075500, 5512092, 10268420, 10257908, 10330960, 9999208, 9999208, 5558952, 9295516, 6867924,
+    1470732, 5312424, 5328540, 5327328, 5327328, 2241672, 16967688, 17118840, 11344200, 11240324,
+    11146960, 11053596, 10981256, 5450328, 10099808, 9867876, 9549508, 9634592, 5457540, 6587460,
+    29576532, 11290396, 11186520, 11093156, 10999792, 11066340, 5512080, 10101328, 10163868, 9845500,
+    9930584, 5503176, 9196068, 6699492, 1470720, 5342916, 5351424, 5411064, 2520600, 16806648,
+    17899728, 11563356, 11563356, 11459480, 11366116, 11293776, 11314800, 5742132, 10096280, 9777912,
+    9862996, 5408184, 7074384, 30350616, 11508672, 11508672, 11404796, 11311432, 11377980, 11377980,
+    5734524, 10394468, 10076100, 10161184, 5745636, 9442908, 7208772, 1470708, 5361768, 5431128,
+    2799528, 17740044, 17734800, 11850116, 11829092, 11829092, 11725216, 11652876, 11673900, 11532336,
+    5748108, 10017944, 10103028, 5705580, 7232940, 31040736, 11747232, 11726208, 11726208, 11622332,
+    11688880, 11688880, 11493936, 6026328, 10302884, 10387968, 5695092, 9669692, 7695696, 1470696,
+    5446236, 3172236, 18010956, 18939780, 12229972, 12208948, 12187924, 12187924, 12105072, 12126096,
+    11984532, 11641236, 5754084, 10425680, 5801424, 7356912, 32067648, 12127088, 12106064, 12085040,
+    12085040, 12141076, 12141076, 11946132, 11872212, 6032304, 10712816, 6077988, 10005304, 7940952,
+    1470684, 3089208, 17821224, 18755160, 12146688, 12125664, 12104640, 12083616, 12104640, 12125664,
+    11973588, 11630292, 11192280, 5761680, 5744004, 7188480, 31798464, 12043804, 12022780, 12001756,
+    11980732, 12140644, 12140644, 11935188, 11861268, 11423256, 6039900, 6022224, 9920400, 7772520,
+    223272, 41877408, 42563988, 28385004, 28237944, 28090884, 27943824, 27964956, 28111440, 28100076,
+    27931668, 27676560, 27823044, 13166688, 10992636, 69714036, 27768468, 27621408, 27474348, 27327288,
+    27915516, 27915228, 27849504, 27978504, 27723396, 27869880, 13377396, 22082460, 11241036, 2242104,
+    46074456, 41790432, 41530224, 41270016, 41009808, 41000952, 41179368, 41357256, 41165268, 41154708,
+    41338236, 893064, 4984800, 45581256, 32640120, 32575464, 32510808, 32446152, 32872320, 32872320,
+    32936460, 32474820, 31124292, 31188948, 14703672, 14690904, 15628320, 2242140, 50551104, 50249424,
+    49952928, 49661616, 49414944, 49732116, 49880844, 49181748, 48183480, 48443688, 43055976, 34519716,
+    43032804, 40917012, 40656804, 40396596, 40136388, 40999116, 40958220, 40896828, 41074716, 41059044,
+    41237460, 893064, 13765836, 4076412, 1470684, 5168640, 5161032, 5153424, 5215176, 5207568,
+    5284536, 5238900, 5185656, 5193264, 5200872, 2074584, 16109664, 5412612, 9761852, 9740828,
+    9719804, 10033940, 9945272, 10051380, 10049860, 9667432, 9688456, 9709480, 5192364, 6080136,
+    1470696, 5194608, 5187000, 5258472, 5310504, 5310504, 5334228, 5280984, 5288592, 5296200,
+    2157900, 16418340, 10743564, 5405016, 9773396, 9752372, 10078640, 10064544, 10064544, 10148108,
+    9765680, 9786704, 9807728, 5287692, 6249144, 1470708, 5219388, 5290860, 5352612, 5412252,
+    5359008, 5375124, 5382732, 5390340, 2241216, 16723128, 10840192, 10746828, 5397420, 9784940,
+    10111208, 10110496, 10182196, 10159652, 9862308, 9883332, 9904356, 5381832, 6418152, 1470720,
+    5322060, 5383812, 5453172, 5459568, 5398716, 5475684, 5483292, 2324532, 17024028, 10936820,
+    10843456, 10750092, 5389824, 10142156, 10141444, 10226528, 10275684, 9872232, 9978340, 9999364,
+    5474784, 6587160, 1470732, 5344464, 5413824, 5429940, 5428728, 5428728, 5505696, 2324688,
+    17328960, 11281200, 11177324, 11083960, 10990596, 5443080, 10162492, 10247576, 10310116, 9978364,
+    9978364, 10084472, 5566548, 6699492, 1470732, 5373276, 5389392, 5397900, 5457540, 5457540,
+    2324832, 17370192, 11290588, 11186712, 11093348, 10999984, 11066532, 5435472, 10169164, 10231704,
+    9913336, 9985036, 9985036, 5580144, 6699780, 1470720, 5340036, 5348544, 5408184, 5408184,
+    2241804, 17206236, 11191140, 11191140, 11087264, 10993900, 11060448, 10967084, 5443068, 10084016,
+    9765648, 9850732, 9935816, 5530788, 6531348, 1470708, 5361732, 5431092, 5490732, 2520732,
+    17041308, 11429700, 11408676, 11408676, 11304800, 11371348, 11277984, 11299008, 5734872, 9992432,
+    10077516, 10162600, 5480244, 7018272, 1470696, 5447856, 5517216, 2893440, 18246288, 11809556,
+    11788532, 11767508, 11767508, 11823544, 11730180, 11751204, 11609640, 5740848, 10402364, 10487448,
+    5863140, 7263528, 1470684, 5459796, 2810412, 18061668, 11726272, 11705248, 11684224, 11663200,
+    11823112, 11719236, 11740260, 11598696, 11160684, 5748444, 10402544, 5807376, 7095096, 1470672,
+    2727384, 17877048, 11641368, 11620344, 11599320, 11578296, 11717184, 11717184, 11738208, 11586132,
+    11148120, 11169144, 5756040, 5751612, 6926664, 223260, 42815124, 27746244, 27599184, 27452124,
+    27305064, 27893292, 27746232, 27892716, 27881352, 27626244, 27772728, 27919212, 13454856, 10986372,
+    2242056, 41597160, 41331840, 41066520, 40801200, 41658816, 41393496, 41566800, 41739576, 41499216,
+    41677632, 41856048, 893040, 3803496, 1470672, 5179116, 5171508, 5163900, 5437620, 5430012,
+    5499372, 5506980, 5453736, 5461344, 5468952, 5476560, 2353368, 1470684, 5202240, 5194632,
+    5540556, 5532948, 5525340, 5602308, 5549064, 5556672, 5564280, 5571888, 2436684, 1470696,
+    5225364, 5582664, 5575056, 5627088, 5627088, 5643204, 5650812, 5658420, 5666028, 2520000,
+    1470708, 5613864, 5606256, 5668008, 5727648, 5666796, 5743764, 5751372, 5758980, 2603316,
+    1470720, 5352060, 5413812, 5483172, 5481960, 5481960, 5558928, 5566536, 2324676, 1470732,
+    5365668, 5435028, 5443536, 5503176, 5503176, 5580144, 2324832, 1470732, 5393292, 5401800,
+    5471160, 5530800, 5530800, 2324976, 1470720, 5351256, 5420616, 5480256, 5480256, 2241948,
+    1470708, 5440224, 5509584, 5578944, 2614656, 1470696, 5453820, 5523180, 2531628, 1470684,
+    5467416, 2448600, 1470672, 2365572, 223260,
+};
+
+inline constexpr std::uint32_t preflop_ties[14365] = {
+    9845808, 3767652, 3487800, 3214860, 2720172, 2518836, 2523504, 2268804, 2018100, 1779984,
+    1545756, 1315416, 1018044, 1191144, 3066444, 5006088, 4543416, 4072248, 3638196, 3183336,
+    2750184, 2342376, 1959768, 1584936, 1217880, 852084, 1103652, 1592088, 2324124, 4483512,
+    4022712, 3599028, 3154536, 2734272, 2309112, 1926504, 1551672, 1184616, 818820, 1017960,
+    1447068, 1432968, 1727820, 3968856, 3555540, 3121416, 2711520, 2299248, 1899288, 1524456,
+    1157400, 791604, 861324, 1298928, 1288308, 1274304, 1250928, 3478932, 3055176, 2655648,
+    2253744, 1866672, 1474488, 1107432, 748116, 794700, 1162860, 1155480, 1144860, 1122288,
+    903204, 3016620, 2627460, 2235924, 1859220, 1479924, 1095516, 727488, 794148, 1020252,
+    1016112, 1008732, 989472, 977868, 641520, 2564280, 2183112, 1816776, 1447848, 1076328,
+    690948, 714108, 884904, 884616, 880476, 864456, 856116, 836256, 475704, 2155392,
+    1799424, 1440864, 1079712, 707220, 635400, 756744, 751932, 751644, 738864, 733764,
+    717144, 707808, 372312, 1771920, 1423728, 1072944, 710820, 560244, 635700, 630888,
+    626076, 617148, 615288, 601908, 595812, 586476, 333000, 1440288, 1089504, 727380,
+    486384, 517248, 512436, 507624, 494172, 496164, 486024, 483168, 477072, 481308,
+    324792, 1106064, 743940, 413820, 401388, 396576, 391764, 378312, 375780, 369492,
+    369876, 367020, 371256, 375492, 332136, 760500, 323928, 286176, 281364, 276552,
+    265044, 260232, 249420, 253656, 254040, 258276, 262512, 266748, 330732, 139498944,
+    90002820, 65491632, 46992372, 34021080, 25035660, 18048264, 12970416, 9537972, 7065720, 5099484,
+    2985756, 37299984, 4017168, 88960440, 66675924, 48679752, 35626092, 25875660, 19569228, 14352708,
+    10781592, 8170668, 6065760, 3813360, 28037904, 27756060, 4612104, 50683608, 32945832, 20636280,
+    12867840, 8183916, 5298012, 3749724, 2767500, 2135340, 1568556, 20522628, 20920104, 15681756,
+    3421512, 31104072, 20324088, 12801600, 8138412, 5278284, 3695292, 2713068, 2080908, 1514124,
+    14809224, 15364320, 10232172, 9672228, 2467512, 18992592, 12470472, 7999236, 5159844, 3602628,
+    2585700, 1953540, 1422108, 10775820, 11303664, 6445836, 6355140, 5947836, 1776312, 11687544,
+    7827876, 5126436, 3589956, 2598804, 1931940, 1380852, 7965240, 8246496, 4050888, 4036128,
+    3936144, 3695568, 1268136, 7330860, 4992588, 3540060, 2569644, 1928556, 1342764, 5766264,
+    6254496, 2602728, 2594448, 2553768, 2501472, 2347560, 921132, 4658760, 3461400, 2520936,
+    1900584, 1340568, 4158912, 4601784, 1708656, 1708080, 1673880, 1664256, 1622472, 1517964,
+    716364, 3108744, 2477448, 1887048, 1347768, 3064212, 3461724, 1224264, 1214640, 1188144,
+    1185000, 1169256, 1143612, 1032996, 639756, 2510568, 1920168, 1380888, 2271408, 2623560,
+    915240, 905616, 870072, 874632, 865368, 849132, 834012, 842484, 625356, 1953288,
+    1414008, 1637508, 1944300, 715056, 705432, 669888, 665400, 663840, 654084, 648372,
+    656844, 665316, 642060, 1447128, 964608, 1226040, 536160, 526536, 501864, 492240,
+    481632, 479580, 480348, 488820, 497292, 505764, 639036, 139463832, 65544876, 46952064,
+    33980772, 24995352, 18027468, 12923580, 9491136, 7018884, 5052648, 2938920, 28026600, 5003784,
+    92095968, 53264700, 33273756, 20664252, 12875076, 8191440, 5305500, 3757212, 2774988, 2142828,
+    1576044, 37290960, 28768020, 3758700, 64983900, 48675264, 36138996, 26444868, 19531608, 15108684,
+    11537568, 8926644, 6821736, 4569336, 20539872, 16463400, 20409288, 3405276, 31388328, 20308392,
+    12765168, 8121636, 5235408, 3652416, 2670192, 2038032, 1471248, 14796972, 10323120, 15370356,
+    9756804, 2451276, 18976896, 12434040, 7982460, 5116968, 3559752, 2542824, 1910664, 1379232,
+    10763568, 6444216, 11473104, 6347148, 5939844, 1760076, 11651112, 7811100, 5083560, 3547080,
+    2555928, 1889064, 1337976, 7952988, 4042788, 8434044, 4021656, 3921672, 3681096, 1251900,
+    7314084, 4949712, 3497184, 2526768, 1885680, 1299888, 5760168, 2595204, 6246972, 2586348,
+    2545668, 2493372, 2339460, 913608, 4641948, 3444588, 2504124, 1883772, 1323756, 4145052,
+    1699656, 4838832, 1691700, 1657500, 1647876, 1606092, 1509864, 691452, 3057192, 2425896,
+    1835496, 1296216, 3050352, 1215264, 3698772, 1198260, 1171764, 1168620, 1152876, 1135512,
+    1014372, 614844, 2459016, 1868616, 1329336, 2257548, 906240, 2860608, 889236, 853692,
+    858252, 848988, 841032, 815388, 823860, 600444, 1901736, 1362456, 1623648, 706056,
+    2181348, 689052, 653508, 649020, 647460, 645984, 629748, 638220, 646692, 617148,
+    1395576, 950748, 527160, 1463088, 510156, 485484, 475860, 465252, 471480, 461724,
+    470196, 478668, 487140, 614124, 139442832, 47012364, 33947520, 24962100, 17994216, 12909840,
+    9451356, 6979104, 5012868, 2899140, 20511828, 4530744, 53249148, 92227176, 33286464, 20622960,
+    12833784, 8150148, 5290272, 3707244, 2725020, 2092860, 1526076, 20531088, 16444824, 3720060,
+    89355828, 33242796, 20579292, 12790116, 8125848, 5239908, 3656880, 2674656, 2042496, 1475712,
+    37284960, 28809144, 27927924, 3549480, 47540232, 36243180, 26972892, 20115936, 15086184, 12308664,
+    9697740, 7592832, 5340432, 14816232, 10326396, 10320024, 15028236, 2438064, 19213200, 12424392,
+    7952076, 5106240, 3522924, 2505996, 1873836, 1342404, 10753332, 6430860, 6424488, 11511660,
+    6010812, 1746864, 11641464, 7780716, 5072832, 3510252, 2519100, 1852236, 1301148, 7942752,
+    4029432, 4023060, 8606508, 3916704, 3676128, 1238688, 7283700, 4938984, 3460356, 2489940,
+    1848852, 1263060, 5749932, 2581848, 2581272, 6437544, 2534220, 2481924, 2328012, 900396,
+    4631220, 3407760, 2467296, 1846944, 1286928, 4140972, 1694580, 1687200, 4834332, 1652424,
+    1642800, 1601016, 1504788, 686952, 3046428, 2415132, 1824732, 1285452, 3038508, 1199664,
+    1192284, 3938844, 1158408, 1155264, 1139520, 1122156, 1009296, 592956, 2413512, 1823112,
+    1283832, 2245704, 890640, 883260, 3100680, 840336, 844896, 835632, 827676, 810312,
+    808260, 578556, 1856232, 1316952, 1611804, 690456, 683076, 2421420, 640152, 635664,
+    634104, 632628, 624672, 622620, 631092, 595260, 1350072, 938904, 511560, 504180,
+    1703160, 472128, 462504, 451896, 458124, 456648, 454596, 463068, 471540, 592236,
+    139431240, 33382896, 24303924, 17336040, 12251664, 8812692, 6314400, 4348164, 2340168, 14799144,
+    4049208, 33273756, 33286464, 91931544, 20581452, 12738276, 8054640, 5194764, 3637800, 2620836,
+    1988676, 1436508, 14788908, 10310484, 3321468, 33227244, 89017716, 20537784, 12694608, 8030340,
+    5144400, 3587436, 2570472, 1938312, 1386144, 14809176, 10315812, 10304220, 2685744, 79385616,
+    20503188, 12660012, 7995744, 5129172, 3546144, 2529180, 1897020, 1344852, 37281648, 28712700,
+    27817800, 24845436, 3158832, 34925352, 26551080, 20024412, 15050964, 11666616, 9849288, 7744380,
+    5597712, 10579596, 6416712, 6410340, 6403968, 11110812, 1695708, 11768616, 7715916, 4987296,
+    3444372, 2427120, 1760256, 1208088, 7739520, 3998652, 3992280, 3985908, 8482236, 3714408,
+    1187532, 7218900, 4853448, 3394476, 2397960, 1756872, 1170000, 5546700, 2551068, 2550492,
+    2544120, 6417684, 2460900, 2306988, 849240, 4545684, 3341880, 2375316, 1754964, 1193868,
+    3937740, 1663800, 1656420, 1655844, 4832580, 1615296, 1573512, 1477284, 635796, 2980548,
+    2323152, 1732752, 1192392, 2841432, 1177164, 1169784, 1162404, 3742020, 1134132, 1118388,
+    1101024, 988164, 550512, 2347596, 1757196, 1216836, 2040864, 857616, 850236, 842856,
+    3148428, 815484, 806220, 798264, 780900, 787128, 518724, 1755576, 1215216, 1406964,
+    657432, 650052, 642672, 2469168, 606252, 604692, 603216, 595260, 601488, 599436,
+    535428, 1248336, 759480, 482928, 475548, 468168, 1776324, 431724, 421116, 427344,
+    425868, 432096, 430044, 438516, 552060, 139425624, 24584760, 17523324, 12438948, 8999976,
+    6521196, 4528920, 2308080, 10774188, 3604788, 20664252, 20622960, 20581452, 91703208, 12780288,
+    8042652, 5182776, 3625812, 2634912, 1968012, 1396440, 10763952, 6432696, 2959992, 20579292,
+    20537784, 88746900, 12736620, 8018352, 5132412, 3575448, 2584548, 1917648, 1346076, 10754724,
+    6421392, 6414660, 2396844, 20487636, 79083984, 12702024, 7983756, 5117184, 3534156, 2543256,
+    1876356, 1304784, 10574076, 6408432, 6402060, 6390612, 1885536, 65832564, 12593844, 7875576,
+    5009004, 3445344, 2428380, 1761480, 1209276, 37280040, 28637952, 27729012, 24746712, 20649372,
+    2848848, 25594164, 19725432, 14988720, 11660676, 9236520, 7925208, 5758992, 7825188, 4011360,
+    4004988, 3998616, 3966684, 8190408, 1190556, 7379676, 4876272, 3396564, 2419704, 1752516,
+    1139544, 5602872, 2547144, 2546568, 2540196, 2508264, 6330408, 2355792, 852264, 4568508,
+    3343968, 2397060, 1750608, 1163412, 3993912, 1659876, 1652496, 1651920, 1619988, 4820220,
+    1579644, 1483416, 638820, 2982636, 2344896, 1728396, 1161936, 2897604, 1173240, 1165860,
+    1158480, 1132344, 3747768, 1118040, 1100676, 987816, 553536, 2369340, 1752840, 1186380,
+    2103192, 861972, 854592, 847212, 814272, 2959104, 812244, 804288, 786924, 793152,
+    530460, 1777284, 1210824, 1461528, 651264, 643884, 636504, 603564, 2524416, 602436,
+    600960, 593004, 599232, 605460, 529776, 1209204, 757764, 470964, 463584, 456204,
+    429060, 1826400, 412080, 418308, 416832, 423060, 429288, 427236, 520308, 139423368,
+    18412668, 13234740, 9795768, 7316988, 5344224, 3097344, 7971840, 3163104, 12875076, 12833784,
+    12738276, 12780288, 94233972, 8067456, 5153580, 3596616, 2605716, 1964880, 1358568, 7961604,
+    4032060, 2601252, 12790116, 12694608, 12736620, 91277664, 8043156, 5103216, 3546252, 2555352,
+    1914516, 1308204, 7952376, 4020756, 4014024, 2110680, 12660012, 12702024, 79199772, 8008560,
+    5087988, 3504960, 2514060, 1873224, 1266912, 7742232, 3991164, 3984792, 3978204, 1661580,
+    12578292, 65408208, 7900380, 4979808, 3416148, 2399184, 1758348, 1171404, 7820964, 4005024,
+    3998652, 3992280, 3955380, 1331424, 51771408, 7901784, 4981212, 3417552, 2419956, 1753056,
+    1140048, 37279392, 29410404, 28501464, 24775788, 20511444, 16285944, 2520660, 18785808, 14574072,
+    11389212, 9021360, 7103220, 5730600, 5877180, 2554452, 2553876, 2547504, 2515572, 2516004,
+    6044544, 843120, 4650948, 3342456, 2374812, 1748016, 1134720, 4238724, 1650552, 1643172,
+    1642596, 1610664, 1611096, 4698960, 1508532, 629676, 2981124, 2322648, 1725804, 1133244,
+    3142416, 1163916, 1156536, 1149156, 1123020, 1123452, 3671928, 1099752, 986892, 544392,
+    2347092, 1750248, 1157688, 2348004, 852648, 845268, 837888, 804948, 811176, 2901372,
+    796884, 779520, 785748, 521316, 1774692, 1182132, 1712496, 650220, 642840, 635460,
+    602520, 601944, 2271612, 599928, 591972, 598200, 604428, 529344, 1206576, 1000968,
+    459396, 452016, 444636, 417492, 410112, 1818168, 408996, 407520, 413748, 419976,
+    426204, 502488, 139422864, 13331328, 9798804, 7320024, 5347260, 3119892, 5774952, 2712564,
+    8191692, 8150400, 8054892, 8042904, 8067420, 93571848, 5179464, 3568500, 2577600, 1936764,
+    1356516, 5769864, 2585196, 2259720, 8126100, 8030592, 8018604, 8043120, 93089592, 5155164,
+    3544200, 2553300, 1912464, 1332216, 5760636, 2573892, 2572956, 1841724, 7995996, 7984008,
+    8008524, 81011700, 5139936, 3502908, 2512008, 1871172, 1290924, 5550492, 2544300, 2543724,
+    2537136, 1454832, 7875828, 7900344, 65464776, 5031756, 3414096, 2397132, 1756296, 1195416,
+    5599728, 2541528, 2540952, 2534580, 2502540, 1176516, 7886196, 51368760, 5033160, 3415500,
+    2417904, 1751004, 1164060, 5874012, 2549736, 2549160, 2542788, 2510856, 2506392, 943488,
+    39302784, 5010660, 3393000, 2395404, 1747872, 1134864, 37279248, 29208384, 29053728, 25328052,
+    20522484, 16154820, 12406248, 2252784, 13783692, 11095968, 8777748, 6915912, 4936464, 4268676,
+    1659732, 1659120, 1658544, 1626612, 1627044, 1619196, 4458588, 638244, 3044988, 2356560,
+    1738980, 1166076, 3142872, 1156464, 1155852, 1148472, 1122336, 1122768, 1114920, 3588288,
+    1006248, 552960, 2381004, 1763424, 1190520, 2348460, 845196, 844584, 837204, 804264,
+    810492, 802644, 2833656, 789468, 795696, 529884, 1787868, 1214964, 1712952, 642768,
+    642156, 634776, 601836, 601260, 599208, 2222004, 595440, 601668, 607896, 537912,
+    1239408, 1007580, 460224, 459612, 452232, 425088, 417708, 408852, 1573488, 417360,
+    423588, 429816, 436044, 519768, 139422864, 9895644, 7323312, 5350548, 3123180, 4168464,
+    2304756, 5305752, 5290524, 5195016, 5183028, 5153544, 5179464, 93571848, 3629448, 2584548,
+    1943712, 1363464, 4156620, 1692456, 1900116, 5240412, 5144904, 5132916, 5103432, 5155128,
+    92428116, 3570408, 2525508, 1884672, 1304424, 4152540, 1687920, 1679280, 1580760, 5129676,
+    5117688, 5088204, 5139900, 82824276, 3555180, 2510280, 1869444, 1289196, 3942396, 1658328,
+    1650048, 1649256, 1256076, 5009508, 4980024, 5031720, 66722856, 3466368, 2395404, 1754568,
+    1193688, 3991632, 1655556, 1647276, 1646700, 1614660, 1029600, 4981428, 5033124, 51345048,
+    3467772, 2416176, 1749276, 1162332, 4236420, 1647132, 1638852, 1638276, 1606344, 1606740,
+    838044, 4995072, 38900784, 3445272, 2393676, 1746144, 1133136, 4266372, 1656276, 1655700,
+    1655124, 1623192, 1623624, 1610916, 706428, 29295984, 3458592, 2406996, 1759464, 1165824,
+    37279248, 29208384, 28851924, 25880532, 20904852, 16141164, 12275304, 9281616, 2070696, 10291680,
+    8564148, 6751944, 4828800, 3172896, 1174764, 1165140, 1164528, 1138392, 1138824, 1130976,
+    1133652, 3343824, 561636, 2445084, 1797552, 1203912, 2348988, 846864, 837240, 836628,
+    803688, 809916, 802068, 804744, 2775420, 815160, 538560, 1821996, 1228356, 1713480,
+    644436, 634812, 634200, 601260, 600684, 598632, 601308, 2179692, 611724, 617952,
+    546588, 1252800, 1008108, 461892, 452268, 451656, 424512, 417132, 408276, 416748,
+    1549284, 427164, 433392, 439620, 528444, 139423032, 7346196, 5373432, 3146064, 3075420,
+    1922148, 3757464, 3707496, 3638052, 3626064, 3596580, 3568500, 3629448, 93413856, 2617668,
+    1976832, 1396584, 3063576, 1210548, 1600452, 3657384, 3587940, 3575952, 3546468, 3544164,
+    3570408, 92270124, 2558628, 1917792, 1337544, 3052740, 1197000, 1188360, 1318932, 3546900,
+    3534912, 3505428, 3503124, 3555144, 82004808, 2508660, 1867824, 1287576, 2847744, 1174176,
+    1165896, 1157400, 1082520, 3446100, 3416616, 3414312, 3466332, 68272320, 2419848, 1779012,
+    1218132, 2896980, 1171404, 1163124, 1154844, 1128600, 907884, 3418020, 3415716, 3467736,
+    51995760, 2440620, 1773720, 1186776, 3141768, 1162980, 1154700, 1146420, 1120284, 1120680,
+    757800, 3393216, 3445236, 38638152, 2418120, 1770588, 1157580, 3142224, 1155492, 1154916,
+    1146636, 1120500, 1120932, 1113084, 657288, 3443004, 28735992, 2431440, 1783908, 1190268,
+    3172248, 1173792, 1164168, 1163592, 1137456, 1137888, 1130040, 1127856, 588204, 20854800,
+    2445084, 1797552, 1203912, 37279296, 29158872, 28802412, 25629216, 21375780, 16335948, 12187224,
+    9101160, 6641496, 1640700, 7770732, 5958528, 4035384, 2355696, 856848, 847224, 837600,
+    811428, 817656, 809808, 812484, 815160, 2530884, 555984, 1855116, 1261476, 1720188,
+    654420, 644796, 635172, 609000, 608424, 606372, 609048, 611724, 1935156, 627936,
+    564012, 1285920, 1014816, 471876, 462252, 452628, 432252, 424872, 416016, 424488,
+    427164, 1304748, 443376, 449604, 545868, 139423200, 5396316, 3168948, 2284056, 1547316,
+    2775240, 2725272, 2621088, 2635164, 2605680, 2577600, 2584548, 2617668, 93255864, 2009952,
+    1429704, 2272212, 903684, 1308564, 2675160, 2570976, 2585052, 2555568, 2553264, 2525508,
+    2558628, 92112132, 1950912, 1370664, 2261376, 890136, 881496, 1099620, 2529936, 2544012,
+    2514528, 2512224, 2510244, 2508660, 81846816, 1900944, 1320696, 2049624, 858300, 850020,
+    841524, 890676, 2429388, 2399904, 2397600, 2395620, 2419812, 67452852, 1777392, 1216512,
+    2104008, 862296, 854016, 845736, 811788, 793944, 2420676, 2418372, 2416392, 2440584,
+    53334984, 1798164, 1211220, 2348796, 853872, 845592, 837312, 803472, 809664, 685332,
+    2395872, 2393892, 2418084, 38944608, 1795032, 1182024, 2349252, 846384, 845808, 837528,
+    803688, 809916, 802068, 615924, 2407212, 2431404, 28392432, 1808352, 1214712, 2349780,
+    848052, 838428, 837852, 804012, 810240, 802392, 805068, 567576, 2429496, 20294808,
+    1821996, 1228356, 2355480, 856524, 846900, 837276, 811140, 817368, 809520, 812196,
+    810012, 566136, 15622764, 1855116, 1261476, 37279344, 29109360, 28752900, 25579704, 21124464,
+    16742796, 12275976, 8988168, 6461040, 4989972, 1261248, 5165112, 3241968, 1726896, 664404,
+    654780, 645156, 609972, 616164, 614112, 616788, 619464, 627936, 1690620, 581436,
+    1319040, 1021524, 481860, 472236, 462612, 433224, 432612, 423756, 432228, 434904,
+    443376, 1060212, 459588, 563292, 139423368, 3191832, 1651380, 1180260, 2143080, 2093112,
+    1988928, 1968264, 1964844, 1936764, 1943712, 1976832, 2009952, 93097872, 1462824, 1639536,
+    705336, 1024452, 2043000, 1938816, 1918152, 1914732, 1912428, 1884672, 1917792, 1950912,
+    91954140, 1403784, 1628700, 691788, 683148, 888084, 1897776, 1877112, 1873692, 1871388,
+    1869408, 1867824, 1900944, 81688824, 1353816, 1416948, 659952, 651672, 643176, 741348,
+    1762488, 1759068, 1756764, 1754784, 1778976, 1777392, 67294860, 1249632, 1464576, 654936,
+    646656, 638376, 604428, 661716, 1754028, 1751724, 1749744, 1773936, 1798128, 52515516,
+    1209600, 1714512, 653280, 645000, 636720, 602880, 601368, 620640, 1748592, 1746612,
+    1770804, 1794996, 39968472, 1206468, 1714968, 645792, 645216, 636936, 603096, 601620,
+    599568, 582336, 1759932, 1784124, 1808316, 28459752, 1239156, 1715496, 647460, 637836,
+    637260, 603420, 601944, 599892, 602568, 554724, 1797768, 1821960, 19870320, 1252800,
+    1721196, 655932, 646308, 636684, 610548, 609072, 607020, 609696, 612372, 563652,
+    1855080, 15062772, 1285920, 1726896, 664404, 654780, 645156, 609972, 616200, 614148,
+    616824, 619500, 627972, 582948, 11365608, 1319040, 37279392, 29059848, 28703388, 25530192,
+    21074952, 16491480, 12586704, 9002928, 6323136, 4809516, 3636600, 932340, 2448552, 1028232,
+    491844, 482220, 472596, 443208, 433584, 431496, 439968, 442644, 451116, 459588,
+    815676, 580716, 139423440, 971544, 814464, 1576296, 1526328, 1436760, 1396692, 1358532,
+    1356516, 1363464, 1396584, 1429704, 1462824, 93319080, 959700, 527592, 741600, 1476216,
+    1386648, 1346580, 1308420, 1332180, 1304424, 1337544, 1370664, 1403784, 92217828, 948864,
+    514044, 505404, 677808, 1345608, 1305540, 1267380, 1291140, 1289160, 1287576, 1320696,
+    1353816, 81983328, 770448, 486924, 478644, 470148, 599760, 1210284, 1172124, 1195884,
+    1193904, 1218096, 1216512, 1249632, 67090068, 753876, 475788, 467508, 459228, 431400,
+    559044, 1141272, 1165032, 1163052, 1187244, 1211436, 1209852, 52917516, 997056, 465120,
+    456840, 448560, 420840, 411540, 524700, 1136088, 1134108, 1158300, 1182492, 1206684,
+    39708996, 1002660, 464400, 463824, 455544, 427824, 418560, 408804, 543564, 1166796,
+    1190988, 1215180, 1239372, 29623128, 1003188, 466068, 456444, 455868, 428148, 418884,
+    409128, 417600, 536688, 1204632, 1228824, 1253016, 20363616, 1008888, 474540, 464916,
+    455292, 435276, 426012, 416256, 424728, 427404, 555984, 1261944, 1286136, 15117348,
+    1014588, 483012, 473388, 463764, 434700, 433140, 423384, 431856, 434532, 443004,
+    575280, 1319256, 11365608, 1020288, 491484, 481860, 472236, 443172, 432564, 430512,
+    438984, 441660, 450132, 458604, 594576, 9189324, 37279416, 29132220, 28789800, 25626756,
+    21010824, 16615488, 12508908, 9359016, 6469464, 4820220, 3629664, 2922708, 855288, 17616096,
+    1266708, 27735840, 20899344, 15343776, 11290920, 8249256, 6257712, 4605216, 3466164, 2628792,
+    1950108, 1224264, 8710632, 8633832, 1451976, 15644520, 10195536, 6410316, 4016484, 2570052,
+    1675812, 1193904, 887040, 688692, 510948, 6417144, 6546324, 4934992, 1079496, 9629808,
+    6313548, 3995652, 2555700, 1669236, 1176816, 869952, 671604, 493860, 4659636, 4838208,
+    3226500, 3050988, 780768, 5902680, 3891960, 2511312, 1631328, 1146684, 829308, 630960,
+    464412, 3410508, 3580008, 2038800, 2010236, 1882148, 564864, 3651000, 2458584, 1621272,
+    1143108, 833508, 624648, 451728, 2533728, 2627472, 1286660, 1281968, 1250200, 1174692,
+    406296, 2305524, 1580340, 1128216, 825096, 624012, 440580, 1842456, 1998252, 831444,
+    828804, 815688, 799268, 750908, 298392, 1478592, 1105332, 811620, 617016, 441360,
+    1333776, 1474668, 549680, 549488, 538424, 535436, 522328, 489844, 234024, 996108,
+    797892, 612696, 443520, 985032, 1111020, 396724, 393648, 385032, 384096, 379200,
+    371528, 336696, 209376, 807876, 622680, 453504, 731172, 842256, 298948, 295872,
+    284372, 285884, 283040, 278360, 273560, 276252, 204168, 632664, 463488, 527124,
+    623304, 235472, 232396, 220896, 219524, 219128, 216500, 214692, 217384, 220076,
+    208680, 473472, 310908, 392184, 178756, 175680, 167672, 164596, 161316, 161136,
+    161380, 164072, 166764, 169456, 206784, 9838080, 3186372, 2954904, 2501688, 2352192,
+    2202120, 2257692, 2053644, 1862184, 1674612, 1490928, 1240212, 1583268, 1011300, 2303820,
+    3699360, 3311136, 2960028, 2618136, 2254716, 1912500, 1612836, 1320948, 1036836, 753984,
+    1434648, 938748, 1183020, 1707516, 3257280, 2916540, 2585016, 2231964, 1902636, 1585620,
+    1293732, 1009620, 726768, 1283268, 795072, 1061040, 1047036, 1230624, 2839932, 2518776,
+    2176092, 1857132, 1553004, 1243764, 959652, 683280, 1143960, 744648, 950892, 940272,
+    917700, 882900, 2480220, 2147904, 1839312, 1545552, 1249200, 947736, 662652, 1005780,
+    694140, 843816, 836436, 817176, 805572, 629928, 2110788, 1812564, 1529172, 1243188,
+    954612, 652176, 864432, 709584, 729960, 725820, 709800, 701460, 689880, 446724,
+    1750104, 1477080, 1201464, 923256, 633708, 736272, 645456, 623196, 622908, 610128,
+    605028, 596688, 576828, 343332, 1449576, 1184328, 916488, 637308, 615228, 584880,
+    528072, 523260, 514332, 512472, 507372, 490752, 481416, 304020, 1200888, 933048,
+    653868, 496776, 525600, 435540, 430728, 417276, 419268, 417408, 404028, 397932,
+    402168, 295812, 949608, 670428, 380916, 467616, 345600, 340788, 327336, 324804,
+    326796, 316656, 313800, 318036, 322272, 303156, 686988, 265704, 392304, 256308,
+    251496, 239988, 235176, 232644, 226356, 226740, 230976, 235212, 239448, 301752,
+    139432920, 65951148, 47370000, 34398708, 24948984, 18587892, 13484004, 10051560, 7579308, 5613072,
+    3499344, 28752912, 37282872, 3668376, 65320080, 48412164, 35850408, 26333724, 19223028, 14815512,
+    11259804, 8664288, 6574788, 4337796, 16446300, 20674176, 20510796, 3387204, 31348800, 20268864,
+    12740256, 8077320, 5191092, 3608100, 2625876, 1993716, 1426932, 10311204, 14935164, 15282852,
+    9739920, 2433204, 18937368, 12409128, 7938144, 5072652, 3515436, 2498508, 1866348, 1334916,
+    6432300, 10901760, 11377572, 6330264, 5922960, 1742004, 11626200, 7766784, 5039244, 3502764,
+    2511612, 1844748, 1293660, 4031196, 7941396, 8394996, 4009488, 3909504, 3668928, 1240308,
+    7289136, 4924764, 3472236, 2501820, 1860732, 1274940, 2582628, 5936712, 6148764, 2568060,
+    2527380, 2475084, 2327292, 889092, 4591188, 3393828, 2453364, 1833012, 1272996, 1687080,
+    4321596, 4745664, 1673412, 1639212, 1629588, 1593924, 1489908, 666936, 3006432, 2375136,
+    1784736, 1245456, 1202688, 3226896, 3610644, 1179972, 1153476, 1150332, 1140708, 1115556,
+    994416, 590328, 2408256, 1817856, 1278576, 893664, 2434092, 2777520, 870948, 835404,
+    839964, 836820, 821076, 795432, 803904, 575928, 1850976, 1311696, 693480, 1800192,
+    2103300, 670764, 635220, 630732, 635292, 626028, 609792, 618264, 626736, 592632,
+    1344816, 514584, 1127292, 1390080, 491868, 467196, 457572, 453084, 451524, 441768,
+    450240, 458712, 467184, 589608, 139411920, 47430300, 34365456, 24915732, 18554640, 13470264,
+    10011780, 7539528, 5573292, 3459564, 16438308, 20665248, 3701988, 91902408, 33203268, 20539764,
+    12765204, 8081532, 5195592, 3612564, 2630340, 1998180, 1431396, 28793496, 37277232, 28703892,
+    3469524, 47277132, 35954592, 26861748, 19807356, 14793012, 12030900, 9435384, 7345884, 5108892,
+    10314480, 14954424, 10303140, 14940732, 2419992, 19173672, 12399480, 7907760, 5061924, 3478608,
+    2461680, 1829520, 1298088, 6418944, 10891524, 6407604, 11416128, 5993928, 1728792, 11616552,
+    7736400, 5028516, 3465936, 2474784, 1807920, 1256832, 4017840, 7931160, 4010892, 8567460,
+    3904536, 3663960, 1227096, 7258752, 4914036, 3435408, 2464992, 1823904, 1238112, 2569272,
+    5926476, 2562984, 6339336, 2515932, 2463636, 2315844, 875880, 4580460, 3357000, 2416536,
+    1796184, 1236168, 1682004, 4317516, 1668912, 4741164, 1634136, 1624512, 1588848, 1484832,
+    662436, 2995668, 2364372, 1773972, 1234692, 1187088, 3215052, 1173996, 3850716, 1140120,
+    1136976, 1127352, 1102200, 989340, 568440, 2362752, 1772352, 1233072, 878064, 2422248,
+    864972, 3017592, 822048, 826608, 823464, 807720, 790356, 788304, 554040, 1805472,
+    1266192, 677880, 1788348, 664788, 2343372, 621864, 617376, 621936, 612672, 604716,
+    602664, 611136, 570744, 1299312, 498984, 1115448, 485892, 1630152, 453840, 444216,
+    439728, 438168, 436692, 434640, 443112, 451584, 567720, 139400328, 33800832, 24257556,
+    17896464, 12812088, 9373116, 6874824, 4908588, 2900592, 10299108, 14926740, 3303396, 33187716,
+    91537224, 20498256, 12669696, 7986024, 5100084, 3543120, 2526156, 1893996, 1341828, 10303896,
+    14947368, 10287336, 2667672, 79532628, 20463660, 12635100, 7951428, 5084856, 3501828, 2484864,
+    1852704, 1300536, 28697052, 37273920, 28585056, 24883356, 3084060, 34636764, 26439936, 19715832,
+    14757792, 11388852, 9586932, 7497432, 5366172, 6404796, 10717788, 6393456, 6387084, 11015280,
+    1677636, 11743704, 7671600, 4942980, 3400056, 2382804, 1715940, 1163772, 3987060, 7727928,
+    3980112, 3973740, 8443188, 3702240, 1175940, 7193952, 4828500, 3369528, 2373012, 1731924,
+    1145052, 2538492, 5723244, 2532204, 2525832, 6319476, 2442612, 2294820, 824724, 4494924,
+    3291120, 2324556, 1704204, 1143108, 1651224, 4114284, 1638132, 1637556, 4739412, 1597008,
+    1561344, 1457328, 611280, 2929788, 2272392, 1681992, 1141632, 1164588, 3017976, 1151496,
+    1144116, 3653892, 1115844, 1106220, 1081068, 968208, 525996, 2296836, 1706436, 1166076,
+    845040, 2217408, 831948, 824568, 3065340, 797196, 794052, 778308, 760944, 767172,
+    494208, 1704816, 1164456, 644856, 1583508, 631764, 624384, 2391120, 587964, 592524,
+    583260, 575304, 581532, 579480, 510912, 1197576, 470352, 936024, 457260, 449880,
+    1703316, 413436, 408948, 407388, 405912, 412140, 410088, 418560, 527544, 139394712,
+    24538392, 18083748, 12999372, 9560400, 7081620, 5089344, 2868504, 6421320, 10901784, 2941920,
+    20539764, 20498256, 91239336, 12711708, 7974036, 5088096, 3531132, 2540232, 1873332, 1301760,
+    6409476, 10892916, 6397776, 2378772, 20448108, 79219332, 12677112, 7939440, 5072868, 3489840,
+    2498940, 1832040, 1260468, 6396516, 10712268, 6385176, 6373728, 1867464, 65473992, 12568932,
+    7831260, 4964688, 3401028, 2384064, 1717164, 1164960, 28622304, 37272312, 28487556, 24780960,
+    20531700, 2774076, 25483020, 19416852, 14695548, 11382912, 8974164, 7678260, 5527452, 3999768,
+    7813596, 3992820, 3986448, 3954516, 8151360, 1178964, 7354728, 4851324, 3371616, 2394756,
+    1727568, 1114596, 2534568, 5779416, 2528280, 2521908, 2489976, 6232200, 2343624, 827748,
+    4517748, 3293208, 2346300, 1699848, 1112652, 1647300, 4170456, 1634208, 1633632, 1601700,
+    4727052, 1567476, 1463460, 614304, 2931876, 2294136, 1677636, 1111176, 1160664, 3074148,
+    1147572, 1140192, 1114056, 3659640, 1105872, 1080720, 967860, 529020, 2318580, 1702080,
+    1135620, 849396, 2279736, 836304, 828924, 795984, 2876016, 800076, 784332, 766968,
+    773196, 505944, 1726524, 1160064, 638688, 1638072, 625596, 618216, 585276, 2446368,
+    590268, 581004, 573048, 579276, 585504, 505260, 1158444, 458388, 934308, 445296,
+    437916, 410772, 1753392, 399912, 398352, 396876, 403104, 409332, 407280, 495792,
+    139392456, 18366264, 13188336, 9749364, 7270584, 5297820, 3050940, 4021008, 7949652, 2589660,
+    12765204, 12669696, 12711708, 91015320, 8018208, 5078268, 3521304, 2530404, 1889568, 1283256,
+    4009164, 7940784, 4001856, 2099088, 12635100, 12677112, 78952836, 7983612, 5063040, 3480012,
+    2489112, 1848276, 1241964, 3979572, 7730640, 3972624, 3966036, 1649988, 12553380, 65176680,
+    7875432, 4954860, 3391200, 2374236, 1733400, 1146456, 3993432, 7809372, 3986484, 3980112,
+    3943212, 1319832, 51555288, 7876836, 4956264, 3392604, 2395008, 1728108, 1115100, 29402676,
+    37271664, 28414248, 24693612, 20434308, 16213848, 2516796, 18690048, 14493720, 11324268, 8971824,
+    7069092, 5711880, 2542884, 5865564, 2541708, 2535336, 2503404, 2503836, 6010536, 831492,
+    4625964, 3317472, 2349828, 1723032, 1109736, 1638984, 4227108, 1631004, 1630428, 1598496,
+    1598928, 4669992, 1496352, 618048, 2956140, 2297664, 1700820, 1108260, 1152348, 3130800,
+    1144368, 1136988, 1110852, 1111284, 3648000, 1087572, 974712, 532764, 2322108, 1725264,
+    1132704, 841080, 2336388, 833100, 825720, 792780, 799008, 2882484, 784704, 767340,
+    773568, 509688, 1749708, 1157148, 638652, 1700880, 630672, 623292, 590352, 589776,
+    2257764, 587748, 579792, 586020, 592248, 517716, 1181592, 447828, 989352, 439848,
+    432468, 405324, 397944, 1809360, 396816, 395340, 401568, 407796, 414024, 490860,
+    139391880, 14078520, 10545996, 8067216, 6094452, 3867084, 2573568, 5952984, 2239416, 8081532,
+    7986024, 7974036, 8018208, 93548244, 5104152, 3493188, 2502288, 1861452, 1281204, 2561724,
+    5944116, 2554416, 1821420, 7951428, 7939440, 7983612, 80826144, 5088924, 3451896, 2460996,
+    1820160, 1239912, 2532132, 5733972, 2525184, 2518596, 1434528, 7831260, 7875432, 65213700,
+    4980744, 3363084, 2346120, 1705284, 1144404, 2529360, 5783208, 2522412, 2516040, 2484000,
+    1156212, 7861284, 51133092, 4982148, 3364488, 2366892, 1699992, 1113048, 2538144, 5862420,
+    2536992, 2530620, 2498688, 2494224, 931896, 39102036, 4985712, 3368052, 2370456, 1722924,
+    1109916, 29199672, 37271496, 29187420, 25264632, 20439192, 16076568, 12339192, 2240232, 13677288,
+    11004972, 8702160, 6855732, 4891692, 1646664, 4501656, 1638672, 1638096, 1606164, 1606596,
+    1607028, 4421856, 609264, 2985300, 2296872, 1679292, 1106388, 1143396, 3375852, 1135404,
+    1128024, 1101888, 1102320, 1102752, 3556596, 983556, 523980, 2321316, 1703736, 1130832,
+    832128, 2581440, 824136, 816756, 783816, 790044, 790476, 2807004, 766776, 773004,
+    500904, 1728180, 1155276, 629700, 1945932, 621708, 614328, 581388, 580812, 587040,
+    2200392, 572748, 578976, 585204, 508932, 1179720, 447156, 1240560, 439164, 431784,
+    404640, 397260, 396684, 1556916, 394668, 400896, 407124, 413352, 490788, 139391880,
+    10642836, 8070504, 6097740, 3870372, 1680828, 4339740, 1879812, 5195844, 5100336, 5088348,
+    5078520, 5104116, 92886768, 3519396, 2474496, 1833660, 1253412, 1675752, 4336020, 1660740,
+    1560456, 5085108, 5073120, 5063292, 5088888, 82638720, 3504168, 2459268, 1818432, 1238184,
+    1646160, 4125876, 1631508, 1630716, 1235772, 4964940, 4955112, 4980708, 66471780, 3415356,
+    2344392, 1703556, 1142676, 1643388, 4175112, 1628736, 1628160, 1596120, 1009296, 4956516,
+    4982112, 51109380, 3416760, 2365164, 1698264, 1111320, 1635540, 4224828, 1626684, 1626108,
+    1594176, 1594572, 826452, 4970124, 38700036, 3420324, 2368728, 1721196, 1108188, 1643208,
+    4499352, 1635252, 1634676, 1602744, 1603176, 1598748, 677448, 29084604, 3398904, 2347308,
+    1699776, 1106136, 29199672, 37271496, 28985616, 25817112, 20821560, 16062912, 12208248, 9211836,
+    2058144, 10200684, 8488560, 6691764, 4784028, 1161696, 3405876, 1144692, 1144080, 1117944,
+    1118376, 1118808, 1110960, 3312132, 532656, 2385396, 1737864, 1144224, 833796, 2581968,
+    816792, 816180, 783240, 789468, 789900, 782052, 2748768, 792468, 509580, 1762308,
+    1168668, 631368, 1946460, 614364, 613752, 580812, 580236, 586464, 578616, 2158080,
+    589032, 595260, 517608, 1193112, 448824, 1241088, 431820, 431208, 404064, 396684,
+    396108, 394056, 1532712, 404472, 410700, 416928, 499464, 139392048, 8093388, 6120624,
+    3893256, 1198920, 3246696, 1580148, 3612816, 3543372, 3531384, 3521556, 3493152, 3519396,
+    92728776, 2507616, 1866780, 1286532, 1184832, 3236220, 1169820, 1298628, 3502332, 3490344,
+    3480516, 3452112, 3504132, 81819252, 2457648, 1816812, 1236564, 1162008, 3031224, 1147356,
+    1138860, 1062216, 3401532, 3391704, 3363300, 3415320, 68021244, 2368836, 1728000, 1167120,
+    1159236, 3080460, 1144584, 1136304, 1110060, 887580, 3393108, 3364704, 3416724, 51760092,
+    2389608, 1722708, 1135764, 1151388, 3130176, 1142532, 1134252, 1108116, 1108512, 746208,
+    3368268, 3420288, 38437404, 2393172, 1745640, 1132632, 1142424, 3375204, 1134468, 1126188,
+    1100052, 1100484, 1100916, 628308, 3383316, 28524612, 2371752, 1724220, 1130580, 1160724,
+    3405228, 1143720, 1143144, 1117008, 1117440, 1117872, 1105164, 559224, 20658828, 2385396,
+    1737864, 1144224, 29150160, 37271544, 28936104, 25565796, 21292488, 16257696, 12120168, 9031380,
+    6576756, 1628148, 7695144, 5898348, 3990612, 843780, 2588676, 826776, 817152, 790980,
+    797208, 797640, 789792, 792468, 2504232, 527004, 1795428, 1201788, 641352, 1953168,
+    624348, 614724, 588552, 587976, 594204, 586356, 589032, 1913544, 605244, 535032,
+    1226232, 458808, 1247796, 441804, 432180, 411804, 404424, 403848, 401796, 404472,
+    1288176, 420684, 426912, 516888, 139392216, 6143508, 3916140, 892056, 2455332, 1288260,
+    2630592, 2526408, 2540484, 2530656, 2502252, 2474496, 2507616, 92570784, 1899900, 1319652,
+    877968, 2444856, 862956, 1079316, 2485368, 2499444, 2489616, 2461212, 2459232, 2457648,
+    81661260, 1849932, 1269684, 846132, 2233104, 831480, 822984, 870372, 2384820, 2374992,
+    2346588, 2344608, 2368800, 67201776, 1726380, 1165500, 850128, 2287488, 835476, 827196,
+    793248, 773640, 2395764, 2367360, 2365380, 2389572, 53099316, 1747152, 1160208, 842280,
+    2337204, 833424, 825144, 791304, 797496, 673740, 2370924, 2368944, 2393136, 38743860,
+    1770084, 1157076, 833316, 2582232, 825360, 817080, 783240, 789468, 789900, 586944,
+    2347524, 2371716, 28181052, 1748664, 1155024, 834984, 2582760, 817980, 817404, 783564,
+    789792, 790224, 782376, 538596, 2369808, 20098836, 1762308, 1168668, 843456, 2588460,
+    826452, 816828, 790692, 796920, 797352, 789504, 787320, 537156, 15442200, 1795428,
+    1201788, 29100648, 37271592, 28886592, 25516284, 21041172, 16664544, 12208920, 8918388, 6396300,
+    4930272, 1248696, 5104932, 3197196, 651336, 1959876, 634332, 624708, 589524, 595716,
+    601944, 594096, 596772, 605244, 1669008, 552456, 1259352, 468792, 1254504, 451788,
+    442164, 412776, 412164, 411588, 409536, 412212, 420684, 1043640, 436896, 534312,
+    139392384, 3939024, 693708, 1822656, 1004148, 1998432, 1894248, 1873584, 1889820, 1861416,
+    1833660, 1866780, 1899900, 92412792, 1352772, 679620, 1812180, 664608, 867780, 1853208,
+    1832544, 1848780, 1820376, 1818396, 1816812, 1849932, 81503268, 1302804, 647784, 1600428,
+    633132, 624636, 721044, 1717920, 1734156, 1705752, 1703772, 1727964, 1726380, 67043784,
+    1198620, 642768, 1648056, 628116, 619836, 585888, 641412, 1729116, 1700712, 1698732,
+    1722924, 1747116, 52279848, 1158588, 641688, 1702920, 632832, 624552, 590712, 589200,
+    609048, 1723644, 1721664, 1745856, 1770048, 39767724, 1181520, 632724, 1947948, 624768,
+    616488, 582648, 581172, 587400, 553356, 1700244, 1724436, 1748628, 28248372, 1179468,
+    634392, 1948476, 617388, 616812, 582972, 581496, 587724, 579876, 525744, 1738080,
+    1762272, 19674348, 1193112, 642864, 1954176, 625860, 616236, 590100, 588624, 594852,
+    587004, 589680, 534672, 1795392, 14882208, 1226232, 651336, 1959876, 634332, 624708,
+    589524, 595752, 601980, 594132, 596808, 605280, 553968, 11200452, 1259352, 29051136,
+    37271640, 28837080, 25466772, 20991660, 16413228, 12519648, 8933148, 6258396, 4749816, 3581940,
+    919788, 2403780, 478776, 1261212, 461772, 452148, 422760, 413136, 419328, 417276,
+    419952, 428424, 436896, 799104, 551736, 139392456, 515964, 1142820, 721296, 1431648,
+    1342080, 1302012, 1283508, 1281168, 1253412, 1286532, 1319652, 1352772, 92703552, 501876,
+    1132344, 486864, 657504, 1301040, 1260972, 1242468, 1240128, 1238148, 1236564, 1269684,
+    1302804, 81809436, 474756, 953928, 460104, 451608, 579456, 1165716, 1147212, 1144872,
+    1142892, 1167084, 1165500, 1198620, 66838992, 463620, 937356, 448968, 440688, 412860,
+    538740, 1116360, 1114020, 1112040, 1136232, 1160424, 1158840, 52681848, 453528, 985464,
+    444672, 436392, 408672, 399372, 513108, 1111140, 1109160, 1133352, 1157544, 1181736,
+    39508248, 451332, 1235640, 443376, 435096, 407376, 398112, 396636, 514584, 1107108,
+    1131300, 1155492, 1179684, 29411748, 453000, 1236168, 435996, 435420, 407700, 398436,
+    396960, 394908, 507708, 1144944, 1169136, 1193328, 20167644, 461472, 1241868, 444468,
+    434844, 414828, 405564, 404088, 402036, 404712, 527004, 1202256, 1226448, 14936784,
+    469944, 1247568, 452940, 443316, 414252, 412692, 411216, 409164, 411840, 420312,
+    546300, 1259568, 11200452, 478416, 1253268, 461412, 451788, 422724, 412116, 418344,
+    416292, 418968, 427440, 435912, 565596, 9039576, 29123508, 37271664, 28932204, 25567008,
+    20927532, 16537236, 12441852, 9289236, 6404724, 4760520, 3575004, 2873088, 842736, 17612088,
+    8959164, 1183380, 20377968, 15338892, 11449440, 8425884, 6246180, 4838280, 3699228, 2861856,
+    2183172, 1457328, 6422508, 5180540, 6388620, 1075224, 9719160, 6310332, 3985956, 2551116,
+    1657872, 1165452, 858588, 660240, 482496, 4655688, 3255856, 4837968, 3078244, 776496,
+    5899464, 3882264, 2506728, 1619964, 1135320, 817944, 619596, 453048, 3406560, 2039064,
+    3631440, 2008400, 1880312, 560592, 3641304, 2454000, 1609908, 1131744, 822144, 613284,
+    440364, 2529780, 1284872, 2684736, 1278080, 1246312, 1170804, 402024, 2300940, 1568976,
+    1116852, 813732, 612648, 429216, 1840092, 829440, 1996248, 826608, 813492, 797072,
+    748712, 296388, 1473996, 1100736, 807024, 612420, 436764, 1329300, 547688, 1547508,
+    545060, 533996, 531008, 517900, 487648, 227508, 982500, 784284, 599088, 429912,
+    980556, 394732, 1183860, 389220, 380604, 379668, 374772, 369332, 331628, 202860,
+    794268, 609072, 439896, 726696, 296956, 915096, 291444, 279944, 281456, 278612,
+    276164, 268492, 271184, 197652, 619056, 449880, 522648, 233480, 696144, 227968,
+    216468, 215096, 214700, 214304, 209624, 212316, 215008, 202164, 459864, 306432,
+    176764, 465024, 171252, 163244, 160168, 156888, 158940, 156312, 159004, 161696,
+    164388, 200268, 17611728, 1159716, 20494332, 15266028, 11368692, 8393772, 6162900, 4760112,
+    3626172, 2793912, 2120340, 1399608, 5178740, 6468564, 6425376, 1073100, 9713832, 6305004,
+    3985020, 2544384, 1651140, 1158720, 851856, 653508, 475764, 3255676, 4702932, 4814928,
+    3076432, 774372, 5894136, 3881328, 2499996, 1613232, 1128588, 811212, 612864, 446316,
+    2038884, 3453804, 3605880, 2006588, 1878500, 558468, 3640368, 2447268, 1603176, 1125012,
+    815412, 606552, 433632, 1284692, 2529600, 2674260, 1277708, 1245940, 1170432, 401844,
+    2300004, 1568040, 1115916, 812796, 611712, 428280, 829056, 1899168, 1969728, 824328,
+    811212, 794792, 748340, 292356, 1465356, 1092096, 798384, 603780, 428124, 547304,
+    1388376, 1522644, 542780, 531716, 528728, 517528, 484828, 223476, 973860, 775644,
+    590448, 421272, 394348, 1039632, 1160652, 386940, 378324, 377388, 374400, 366512,
+    328808, 198828, 785628, 600432, 431256, 296572, 785772, 893544, 289164, 277664,
+    279176, 278240, 273344, 265672, 268364, 193620, 610416, 441240, 233096, 581724,
+    676248, 225688, 214188, 212816, 214328, 211484, 206804, 209496, 212188, 198132,
+    451224, 176380, 365508, 446784, 168972, 160964, 157888, 156516, 156120, 153492,
+    156184, 158876, 161568, 196236, 9833064, 2745912, 2334168, 2226144, 2122728, 2018376,
+    2119416, 1969428, 1823328, 1681116, 1471872, 1180380, 1178436, 875088, 1691280, 2647152,
+    2368620, 2099304, 1838484, 1555632, 1311192, 1091880, 880344, 670068, 1054920, 1052976,
+    744492, 852996, 1214388, 2292012, 2033064, 1782612, 1510128, 1278576, 1041912, 830376,
+    626580, 941532, 939588, 707028, 765672, 743100, 866664, 1994508, 1754424, 1492308,
+    1271124, 1047348, 818460, 605952, 829272, 829272, 671100, 681276, 662016, 650412,
+    613692, 1717308, 1465560, 1254744, 1041336, 825336, 595476, 722124, 719844, 634968,
+    599712, 583692, 575352, 563772, 439200, 1429164, 1228716, 1025676, 820044, 603072,
+    609360, 607080, 664704, 511200, 498420, 493320, 484980, 473400, 318420, 1166472,
+    973800, 778536, 571932, 514236, 511956, 617088, 434232, 425304, 423444, 418344,
+    410004, 390144, 279108, 990360, 795096, 588492, 421704, 419424, 570768, 364380,
+    350928, 352920, 351060, 345960, 329340, 333576, 270900, 811656, 605052, 331764,
+    329484, 525744, 297120, 283668, 281136, 283128, 281268, 267888, 272124, 276360,
+    278244, 621612, 242472, 240192, 463392, 230508, 219000, 214188, 211656, 213648,
+    203508, 207744, 211980, 216216, 276840, 139391856, 47852844, 34799664, 25349940, 18524544,
+    14046960, 10588476, 8116224, 6149988, 4036260, 27901212, 28690812, 37271976, 3380556, 47525184,
+    35712324, 26593992, 19717044, 14505264, 11758560, 9178452, 7104360, 4882776, 10295076, 10290108,
+    15092796, 15015456, 2405988, 19142280, 12368088, 7890984, 5025744, 3442428, 2425500, 1793340,
+    1261908, 6404724, 6399756, 11033784, 11336376, 5981112, 1714788, 11585160, 7719624, 4992336,
+    3429756, 2438604, 1771740, 1220652, 4003620, 4003044, 8073420, 8479680, 3891720, 3651144,
+    1213092, 7241976, 4877856, 3399228, 2428812, 1787724, 1201932, 2561172, 2555460, 5918952,
+    6308040, 2507832, 2455536, 2307744, 868356, 4563648, 3340188, 2399724, 1779372, 1219356,
+    1666116, 1660404, 4498128, 4650708, 1619916, 1610292, 1574628, 1476732, 641988, 2953044,
+    2321748, 1731348, 1192068, 1171200, 1165488, 3395664, 3765300, 1125900, 1122756, 1113132,
+    1094100, 973452, 547992, 2320128, 1729728, 1190448, 862176, 856464, 2602860, 2937216,
+    807828, 812388, 809244, 799620, 774468, 772416, 533592, 1762848, 1223568, 661992,
+    656280, 1968960, 2268036, 607644, 603156, 607716, 604572, 588828, 586776, 595248,
+    550296, 1256688, 483096, 477384, 1296060, 1559856, 439620, 429996, 425508, 430068,
+    420804, 418752, 427224, 435696, 547272, 139380264, 34235040, 24691764, 17866368, 13388784,
+    9949812, 7451520, 5485284, 3477288, 10289676, 10284708, 15085716, 2653668, 81425016, 20432268,
+    12603708, 7934652, 5048676, 3465648, 2448684, 1816524, 1264356, 27790944, 28571544, 37268904,
+    25459884, 3005460, 34394496, 26172180, 19625520, 14470044, 11116512, 9330000, 7255908, 5140056,
+    6390576, 6385608, 10860048, 6374268, 10935528, 1663632, 11712312, 7654824, 4906800, 3363876,
+    2346624, 1679760, 1127592, 3972840, 3972264, 7870188, 3960924, 8355408, 3689424, 1161936,
+    7177176, 4792320, 3333348, 2336832, 1695744, 1108872, 2530392, 2524680, 5715720, 2517732,
+    6288180, 2434512, 2286720, 817200, 4478112, 3274308, 2307744, 1687392, 1126296, 1635336,
+    1629624, 4294896, 1623336, 4648956, 1582788, 1547124, 1449228, 590832, 2887164, 2229768,
+    1639368, 1099008, 1148700, 1142988, 3198588, 1129896, 3568476, 1101624, 1092000, 1072968,
+    952320, 505548, 2254212, 1663812, 1123452, 829152, 823440, 2398020, 810348, 2984964,
+    782976, 779832, 770208, 745056, 751284, 473760, 1662192, 1121832, 628968, 623256,
+    1764120, 610164, 2315784, 573744, 578304, 575160, 559416, 565644, 563592, 490464,
+    1154952, 454464, 448752, 1116636, 435660, 1633020, 399216, 394728, 399288, 390024,
+    396252, 394200, 402672, 507096, 139374648, 24972600, 18053652, 13576068, 10137096, 7658316,
+    5666040, 3445200, 6395256, 6390288, 11034936, 2364768, 20416716, 81111720, 12645720, 7922664,
+    5036688, 3453660, 2462760, 1795860, 1224288, 6382296, 6377328, 10854528, 6360912, 1853460,
+    65572572, 12537540, 7814484, 4928508, 3364848, 2347884, 1680984, 1128780, 27702372, 28473972,
+    37267296, 25357488, 20556132, 2700660, 25215264, 19326540, 14407800, 11110572, 8717232, 7436736,
+    5301336, 3985548, 3984972, 7955856, 3973632, 3941700, 8063580, 1164960, 7337952, 4815144,
+    3335436, 2358576, 1691388, 1078416, 2526468, 2520756, 5771892, 2513808, 2481876, 6200904,
+    2335524, 820224, 4500936, 3276396, 2329488, 1683036, 1095840, 1631412, 1625700, 4351068,
+    1619412, 1587480, 4636596, 1553256, 1455360, 593856, 2889252, 2251512, 1635012, 1068552,
+    1144776, 1139064, 3254760, 1125972, 1099836, 3574224, 1091652, 1072620, 951972, 508572,
+    2275956, 1659456, 1092996, 833508, 827796, 2460348, 814704, 781764, 2795640, 785856,
+    776232, 751080, 757308, 485496, 1683900, 1117440, 622800, 617088, 1818684, 603996,
+    571056, 2371032, 576048, 572904, 557160, 563388, 569616, 484812, 1115820, 442500,
+    436788, 1114920, 423696, 396552, 1683096, 385692, 390252, 380988, 387216, 393444,
+    391392, 475344, 139372392, 18336168, 13765032, 10326060, 7847280, 5874516, 3627636, 3994944,
+    3994368, 8082804, 2085084, 12603708, 12645720, 80818152, 7966836, 5026860, 3443832, 2452932,
+    1812096, 1205784, 3965352, 3964776, 7872900, 3953220, 1635984, 12521988, 65263596, 7858656,
+    4918680, 3355020, 2338056, 1697220, 1110276, 3979212, 3978636, 7951632, 3967296, 3930396,
+    1305828, 51229212, 7860060, 4920084, 3356424, 2358828, 1691928, 1078920, 28482744, 28400664,
+    37266648, 25261428, 20455068, 16107600, 2443380, 18599736, 14205972, 11051928, 8714892, 6827568,
+    5485764, 2534784, 2534184, 5858040, 2527236, 2495304, 2495736, 5979240, 823968, 4609152,
+    3300660, 2333016, 1706220, 1092924, 1623096, 1622496, 4407720, 1616208, 1584276, 1584708,
+    4579536, 1488252, 597600, 2913516, 2255040, 1658196, 1065636, 1136460, 1135860, 3311412,
+    1122768, 1096632, 1097064, 3562584, 1079472, 958824, 512316, 2279484, 1682640, 1090080,
+    825192, 824592, 2517000, 811500, 778560, 784788, 2802108, 776604, 751452, 757680,
+    489240, 1707084, 1114524, 622764, 622164, 1881492, 609072, 576132, 575556, 2182428,
+    579648, 563904, 570132, 576360, 497268, 1138968, 431940, 431340, 1169964, 418248,
+    391104, 383724, 1739064, 388716, 379452, 385680, 391908, 398136, 470412, 139371816,
+    14048388, 10515864, 8037084, 6064320, 3836952, 2553624, 2547252, 5936352, 1813896, 7934652,
+    7922664, 7966836, 80596296, 5072112, 3435084, 2444184, 1803348, 1223100, 2524032, 2517660,
+    5726448, 2510496, 1427004, 7814484, 7858656, 64999260, 4963932, 3346272, 2329308, 1688472,
+    1127592, 2521260, 2514888, 5775684, 2507940, 2475900, 1148688, 7844508, 50934060, 4965336,
+    3347676, 2350080, 1683180, 1096236, 2530044, 2529468, 5854896, 2522520, 2490588, 2486124,
+    924372, 38918412, 4968900, 3351240, 2353644, 1706112, 1093104, 29041944, 29181756, 37266480,
+    25188840, 20368440, 16010856, 12278520, 2237724, 13602360, 10945452, 8658048, 6827028, 4878396,
+    1638552, 1631172, 4494108, 1629996, 1598064, 1598496, 1598928, 4395600, 601704, 2968452,
+    2280024, 1662444, 1089540, 1135284, 1127904, 3368304, 1119924, 1093788, 1094220, 1094652,
+    3535380, 975444, 516420, 2304468, 1686888, 1113984, 824016, 816636, 2573892, 808656,
+    775716, 781944, 782376, 2790828, 758664, 764892, 493344, 1711332, 1138428, 621588,
+    614208, 1938384, 606228, 573288, 572712, 578940, 2189256, 564636, 570864, 577092,
+    501372, 1162872, 439044, 431664, 1233012, 423684, 396540, 389160, 388584, 1550820,
+    386556, 392784, 399012, 405240, 483228, 139371744, 11406300, 8833968, 6861204, 4633836,
+    1659372, 1653000, 4523328, 1544220, 5048676, 5036688, 5026860, 5072112, 83024748, 3461292,
+    2416392, 1775556, 1195308, 1629780, 1623408, 4313424, 1616244, 1219536, 4928508, 4918680,
+    4963932, 66318720, 3372480, 2301516, 1660680, 1099800, 1627008, 1620636, 4362660, 1613688,
+    1581648, 993060, 4920084, 4965336, 50890800, 3373884, 2322288, 1655388, 1068444, 1619160,
+    1618584, 4412376, 1611636, 1579704, 1580100, 810216, 4953348, 38496864, 3377448, 2325852,
+    1678320, 1065312, 1635108, 1627728, 4491828, 1626576, 1594644, 1595076, 1590648, 669924,
+    28916352, 3382092, 2330496, 1682964, 1089324, 28839156, 28978968, 37266456, 25930188, 20769564,
+    15991044, 12141420, 9156204, 2046948, 10115112, 8418396, 6637008, 4744680, 1143072, 1135692,
+    3642924, 1127700, 1101564, 1101996, 1102428, 1102860, 3283152, 507744, 2333844, 1686312,
+    1092672, 815172, 807792, 2819016, 799800, 766860, 773088, 773520, 773952, 2724828,
+    773844, 484668, 1710756, 1117116, 612744, 605364, 2183508, 597372, 564432, 563856,
+    570084, 570516, 2139180, 570408, 576636, 492696, 1141560, 430200, 422820, 1478136,
+    414828, 387684, 380304, 379728, 385956, 1518852, 385848, 392076, 398304, 474552,
+    139371912, 8856852, 6884088, 4656720, 1168452, 1162080, 3423528, 1282392, 3465900, 3453912,
+    3444084, 3435336, 3461256, 82205280, 2414772, 1773936, 1193688, 1145628, 1139256, 3218772,
+    1124388, 1045980, 3365100, 3355272, 3346524, 3372444, 67868184, 2325960, 1685124, 1124244,
+    1142856, 1136484, 3268008, 1121832, 1095588, 871344, 3356676, 3347928, 3373848, 51541512,
+    2346732, 1679832, 1092888, 1135008, 1134432, 3317724, 1119780, 1093644, 1094040, 729972,
+    3351492, 3377412, 38234232, 2350296, 1702764, 1089756, 1134324, 1126944, 3367680, 1118088,
+    1091952, 1092384, 1092816, 620784, 3366504, 28356360, 2354940, 1707408, 1113768, 1142100,
+    1134720, 3642276, 1126764, 1100628, 1101060, 1101492, 1097064, 534312, 20479944, 2333844,
+    1686312, 1092672, 28789644, 28929456, 37266504, 25678872, 21240492, 16185828, 12053340, 8975748,
+    6518400, 1616952, 7624980, 5843592, 3951264, 825156, 817776, 2825724, 800772, 774600,
+    780828, 781260, 781692, 773844, 2480292, 502092, 1743876, 1150236, 622728, 615348,
+    2190216, 598344, 572172, 571596, 577824, 578256, 570408, 1894644, 586620, 510120,
+    1174680, 440184, 432804, 1484844, 415800, 395424, 388044, 387468, 393696, 385848,
+    1274316, 402060, 408288, 491976, 139372080, 6906972, 4679604, 861588, 855216, 2632164,
+    1063080, 2448936, 2463012, 2453184, 2444436, 2416356, 2414772, 82047288, 1807056, 1226808,
+    829752, 823380, 2420652, 808512, 854136, 2348388, 2338560, 2329812, 2301732, 2325924,
+    67048716, 1683504, 1122624, 833748, 827376, 2475036, 812724, 778776, 757404, 2359332,
+    2350584, 2322504, 2346696, 52880736, 1704276, 1117332, 825900, 825324, 2524752, 810672,
+    776832, 783024, 657504, 2354148, 2326068, 2350260, 38540688, 1727208, 1114200, 825216,
+    817836, 2574708, 808980, 775140, 781368, 781800, 579420, 2330712, 2354904, 28012800,
+    1731852, 1138212, 816360, 808980, 2819808, 801024, 767184, 773412, 773844, 774276,
+    513684, 2318256, 19919952, 1710756, 1117116, 824832, 817452, 2825508, 800448, 774312,
+    780540, 780972, 781404, 768696, 512244, 15278724, 1743876, 1150236, 28740132, 28879944,
+    37266552, 25629360, 20989176, 16592676, 12142092, 8862756, 6337944, 4876956, 1237500, 5050176,
+    3157848, 632712, 625332, 2196924, 608328, 573144, 579336, 585564, 585996, 578148,
+    586620, 1650108, 527544, 1207800, 450168, 442788, 1491552, 425784, 396396, 395784,
+    395208, 401436, 393588, 402060, 1029780, 418272, 509400, 139372248, 4702488, 663240,
+    656868, 1999488, 851544, 1816776, 1796112, 1812348, 1803600, 1775520, 1773936, 1807056,
+    81889296, 1259928, 631404, 625032, 1787976, 610164, 704808, 1681488, 1697724, 1688976,
+    1660896, 1685088, 1683504, 66890724, 1155744, 626388, 620016, 1835604, 605364, 571416,
+    625176, 1692684, 1683936, 1655856, 1680048, 1704240, 52061268, 1115712, 625308, 624732,
+    1890468, 610080, 576240, 574728, 592812, 1706868, 1678788, 1702980, 1727172, 39564552,
+    1138644, 624624, 617244, 1940424, 608388, 574548, 573072, 579300, 545832, 1683432,
+    1707624, 1731816, 28080120, 1162656, 615768, 608388, 2185524, 600432, 566592, 565116,
+    571344, 571776, 500832, 1686528, 1710720, 19495464, 1141560, 624240, 616860, 2191224,
+    599856, 573720, 572244, 578472, 578904, 571056, 509760, 1743840, 14718732, 1174680,
+    632712, 625332, 2196924, 608328, 573144, 579372, 585600, 586032, 578184, 586656,
+    529056, 11052384, 1207800, 28690620, 28830432, 37266600, 25579848, 20939664, 16341360, 12452820,
+    8877516, 6200040, 4696500, 3533664, 908592, 2364432, 460152, 452772, 1498260, 435768,
+    406380, 396756, 402948, 409176, 401328, 409800, 418272, 785244, 526824, 139372320,
+    485496, 479124, 1319652, 641268, 1264608, 1224540, 1206036, 1223352, 1195272, 1193688,
+    1226808, 1259928, 82195464, 458376, 452004, 1141476, 437136, 563220, 1129284, 1110780,
+    1128096, 1100016, 1124208, 1122624, 1155744, 66685932, 447240, 440868, 1124904, 426216,
+    398388, 522504, 1079928, 1097244, 1069164, 1093356, 1117548, 1115964, 52463268, 437148,
+    436572, 1173012, 421920, 394200, 384900, 496872, 1094364, 1066284, 1090476, 1114668,
+    1138860, 39305076, 443232, 435852, 1228116, 426996, 399276, 390012, 388536, 507060,
+    1090296, 1114488, 1138680, 1162872, 29243496, 434376, 426996, 1473216, 419040, 391320,
+    382056, 380580, 386808, 482796, 1093392, 1117584, 1141776, 19988760, 442848, 435468,
+    1478916, 418464, 398448, 389184, 387708, 393936, 386088, 502092, 1150704, 1174896,
+    14773308, 451320, 443940, 1484616, 426936, 397872, 396312, 394836, 401064, 393216,
+    401688, 521388, 1208016, 11052384, 459792, 452412, 1490316, 435408, 406344, 395736,
+    401964, 408192, 400344, 408816, 417288, 540684, 8906916, 28776816, 28925628, 37266624,
+    25680084, 20875536, 16465368, 12375024, 9233604, 6346368, 4707204, 3526728, 2829852, 831540,
+    17609088, 8971560, 8697960, 1115208, 14987076, 11478084, 8588436, 6426840, 4830780, 3936324,
+    3098952, 2420268, 1694424, 4661556, 3257152, 3255052, 4731144, 772728, 5973192, 3880056,
+    2498040, 1616388, 1124964, 807588, 609240, 442692, 3403116, 2035140, 2033040, 3641016,
+    1902852, 556824, 3639096, 2445312, 1606332, 1121388, 811788, 602928, 430008, 2526336,
+    1280948, 1278848, 2736672, 1244980, 1169472, 398256, 2292252, 1565400, 1106496, 803376,
+    602292, 418860, 1836648, 825516, 825324, 2054016, 810108, 793688, 745328, 292620,
+    1470420, 1090380, 796668, 602064, 426408, 1327440, 545996, 543560, 1546008, 532304,
+    529316, 516208, 485956, 226008, 978912, 780696, 595500, 426324, 976584, 390168,
+    387732, 1257204, 376680, 375744, 370848, 365408, 329936, 196848, 781668, 596472,
+    427296, 722724, 292392, 289956, 988440, 276020, 277532, 274688, 272240, 266800,
+    266620, 191640, 606456, 437280, 518676, 228916, 226480, 769488, 212544, 211172,
+    210776, 210380, 207932, 207752, 210444, 196152, 447264, 302460, 172200, 169764,
+    538368, 159320, 156244, 152964, 155016, 154620, 154440, 157132, 159824, 194256,
+    17609088, 8939472, 1094964, 14914572, 11397696, 8556684, 6343920, 4752972, 3863628, 3031368,
+    2357796, 1637064, 3257152, 4708980, 3253420, 4708284, 770784, 5968224, 3879480, 2491668,
+    1610016, 1118592, 801216, 602868, 436320, 2035140, 3450540, 2031408, 3615636, 1901220,
+    554880, 3638520, 2438940, 1599960, 1115016, 805416, 596556, 423636, 1280948, 2526336,
+    1278656, 2726376, 1244788, 1169280, 398256, 2291676, 1564824, 1105920, 802800, 601716,
+    418284, 825312, 1895904, 823224, 2027676, 808008, 791588, 745136, 288768, 1462140,
+    1082100, 788388, 593784, 418128, 545792, 1386696, 541460, 1521324, 530204, 527216,
+    516016, 483316, 222156, 970632, 772416, 587220, 418044, 389964, 1035840, 385632,
+    1234176, 374580, 373644, 370656, 362768, 327296, 192996, 773388, 588192, 419016,
+    292188, 781980, 287856, 967068, 273920, 275432, 274496, 269600, 264160, 263980,
+    187788, 598176, 429000, 228712, 577932, 224380, 749772, 210444, 209072, 210584,
+    207740, 205292, 205112, 207804, 192300, 438984, 171996, 361716, 167664, 520308,
+    157220, 154144, 152772, 152376, 151980, 151800, 154492, 157184, 190404, 17608848,
+    1071360, 15001560, 11330064, 8481168, 6317040, 4674924, 3790692, 2963544, 2295084, 1579464,
+    3253312, 3251680, 4755096, 4735788, 768720, 5963016, 3874272, 2490852, 1603404, 1111980,
+    794604, 596256, 429708, 2032920, 2031288, 3497844, 3594312, 1899468, 552816, 3633312,
+    2438124, 1593348, 1108404, 798804, 589944, 417024, 1278728, 1278536, 2573640, 2702532,
+    1243036, 1167528, 396192, 2290860, 1558212, 1099308, 796188, 595104, 411672, 825000,
+    823104, 1895784, 2018916, 807696, 791276, 744824, 288648, 1461324, 1081284, 787572,
+    592968, 417312, 543032, 541136, 1445832, 1496520, 527984, 524996, 513796, 483004,
+    218184, 962112, 763896, 578700, 409524, 387204, 385308, 1094976, 1211028, 372360,
+    371424, 368436, 362456, 324536, 189024, 764868, 579672, 410496, 289428, 287532,
+    841116, 945576, 271700, 273212, 272276, 269288, 261400, 261220, 183816, 589656,
+    420480, 225952, 224056, 637068, 729936, 208224, 206852, 208364, 207428, 202532,
+    202352, 205044, 188328, 430464, 169236, 167340, 420852, 502128, 155000, 151924,
+    150552, 152064, 149220, 149040, 151732, 154424, 186432, 9830064, 2215176, 2143440,
+    2076312, 2013432, 1949364, 2099280, 1989468, 1883544, 1710588, 855516, 853572, 851628,
+    708816, 1201176, 1833084, 1625976, 1427364, 1236744, 1041300, 866844, 717516, 575928,
+    764808, 762864, 760920, 682764, 597444, 853452, 1587420, 1399176, 1218924, 1033848,
+    872280, 705600, 555300, 675228, 675228, 673284, 658176, 532560, 520956, 600480,
+    1362060, 1192176, 1017468, 866268, 712476, 544824, 590760, 588480, 588480, 635004,
+    470436, 462096, 450516, 425988, 1155780, 991440, 850608, 707184, 552420, 508956,
+    506676, 504396, 611544, 410976, 405876, 397536, 385956, 313920, 955260, 824796,
+    691740, 547344, 425988, 423708, 421428, 656172, 349020, 347160, 342060, 333720,
+    322140, 257220, 806616, 673560, 529164, 356136, 353856, 351576, 621192, 294084,
+    296076, 294216, 289116, 280776, 274488, 249012, 690120, 545724, 288876, 286596,
+    284316, 587508, 246264, 243732, 245724, 243864, 238764, 232476, 236712, 256356,
+    562284, 222264, 219984, 217704, 536496, 201036, 196224, 193692, 195684, 193824,
+    187536, 191772, 196008, 254952, 139368264, 34669680, 25138068, 18312672, 13370784, 10538604,
+    8040312, 6074076, 4066080, 24809604, 24860652, 25448100, 37265760, 2917500, 34568436, 25949352,
+    19377204, 14399172, 10848204, 9077100, 7018416, 4917972, 6374196, 6369228, 6364260, 11001444,
+    10987812, 1652652, 11686968, 7629480, 4896072, 3333744, 2316492, 1649628, 1097460, 3961644,
+    3961068, 3956100, 8015472, 8282712, 3679632, 1150956, 7151832, 4781592, 3303216, 2306700,
+    1665612, 1078740, 2519196, 2513484, 2512908, 5861004, 6207456, 2424720, 2276928, 806220,
+    4467384, 3244176, 2277612, 1657260, 1096164, 1630260, 1624548, 1618836, 4290396, 4624716,
+    1577712, 1542048, 1444152, 586332, 2876400, 2219004, 1628604, 1088244, 1135836, 1130124,
+    1124412, 3382224, 3485076, 1090428, 1080804, 1061772, 947244, 488124, 2217636, 1627236,
+    1086876, 816288, 810576, 804864, 2581656, 2906604, 771780, 768636, 759012, 739980,
+    738420, 456336, 1625616, 1085256, 616104, 610392, 604680, 1947756, 2242464, 562548,
+    567108, 563964, 554340, 552780, 550728, 473040, 1118376, 441600, 435888, 430176,
+    1300272, 1564740, 388020, 383532, 388092, 384948, 383388, 381336, 389808, 489672,
+    139362648, 25418904, 18499956, 13558068, 10725888, 8247108, 6254832, 4033992, 6371100, 6366132,
+    6361164, 10995996, 1842480, 66941568, 12512196, 7789140, 4917780, 3334716, 2317752, 1650852,
+    1098648, 24710880, 24758040, 25345488, 37264296, 20973276, 2623068, 24992436, 19078224, 14336928,
+    10842264, 8464332, 7199244, 5079252, 3974352, 3973776, 3968808, 8101140, 3931908, 7990884,
+    1153980, 7312608, 4804416, 3305304, 2328444, 1661256, 1048284, 2515272, 2509560, 2508984,
+    5917176, 2472084, 6120180, 2325732, 809244, 4490208, 3246264, 2299356, 1652904, 1065708,
+    1626336, 1620624, 1614912, 4346568, 1582404, 4612356, 1548180, 1450284, 589356, 2878488,
+    2240748, 1624248, 1057788, 1131912, 1126200, 1120488, 3438396, 1088640, 3490824, 1080456,
+    1061424, 946896, 491148, 2239380, 1622880, 1056420, 820644, 814932, 809220, 2643984,
+    770568, 2717280, 774660, 765036, 746004, 744444, 468072, 1647324, 1080864, 609936,
+    604224, 598512, 2002320, 559860, 2297712, 564852, 561708, 552084, 550524, 556752,
+    467388, 1079244, 429636, 423924, 418212, 1298556, 385356, 1614816, 374496, 379056,
+    375912, 374352, 380580, 378528, 457920, 139360392, 18782472, 13747032, 10914852, 8436072,
+    6463308, 4216428, 3954156, 3953580, 3948612, 8018040, 1625004, 12496644, 66632592, 7833312,
+    4907952, 3324888, 2307924, 1667088, 1080144, 3968016, 3967440, 3962472, 8096916, 3920604,
+    1294848, 51277968, 7834716, 4909356, 3326292, 2328696, 1661796, 1048788, 24747876, 24670908,
+    25249356, 37263648, 20872212, 16117848, 2370972, 18351420, 14135100, 10783620, 8461992, 6590076,
+    5263680, 2523588, 2522988, 2522412, 6003324, 2485512, 2485944, 5898516, 812988, 4598424,
+    3270528, 2302884, 1676088, 1062792, 1618020, 1617420, 1611708, 4403220, 1579200, 1579632,
+    4555296, 1483176, 593100, 2902752, 2244276, 1647432, 1054872, 1123596, 1122996, 1117284,
+    3495048, 1085436, 1085868, 3479184, 1068276, 953748, 494892, 2242908, 1646064, 1053504,
+    812328, 811728, 806016, 2700636, 767364, 773592, 2723748, 765408, 746376, 744816,
+    471816, 1670508, 1077948, 609900, 609300, 603588, 2065128, 564936, 564360, 2109108,
+    568452, 558828, 557268, 563496, 479844, 1102392, 419076, 418476, 412764, 1353600,
+    379908, 372528, 1670784, 377520, 374376, 372816, 379044, 385272, 452988, 139359816,
+    14030388, 11104656, 8625876, 6653112, 4425744, 2512836, 2506464, 2505888, 5871588, 1416024,
+    7789140, 7833312, 66341184, 4953204, 3316140, 2299176, 1658340, 1097460, 2510064, 2503692,
+    2503116, 5920968, 2466108, 1137708, 7819164, 50971152, 4954608, 3317544, 2319948, 1653048,
+    1066104, 2518848, 2518272, 2517696, 6000180, 2480796, 2476332, 913392, 38623440, 4958172,
+    3321108, 2323512, 1675980, 1062972, 25307076, 25249848, 25176768, 37263480, 20776872, 16017432,
+    12183000, 2165316, 13531488, 10677144, 8405148, 6589536, 4656312, 1633476, 1626096, 1625496,
+    4489608, 1592988, 1593420, 1593852, 4371360, 597204, 2957688, 2269260, 1651680, 1078776,
+    1122420, 1115040, 1114440, 3551940, 1082592, 1083024, 1083456, 3451980, 970368, 498996,
+    2267892, 1650312, 1077408, 811152, 803772, 803172, 2757528, 764520, 770748, 771180,
+    2712468, 753588, 752028, 475920, 1674756, 1101852, 608724, 601344, 600744, 2122020,
+    562092, 561516, 567744, 2115936, 559560, 558000, 564228, 483948, 1126296, 426180,
+    418800, 418200, 1416648, 385344, 377964, 377388, 1482540, 381480, 379920, 386148,
+    392376, 465804, 139359744, 11388264, 8815932, 6843168, 4615800, 1624704, 1618332, 1611960,
+    4308780, 1215036, 4917780, 4907952, 4953204, 66119976, 3361716, 2290752, 1649916, 1089036,
+    1621932, 1615560, 1609188, 4358160, 1576572, 988560, 4909356, 4954608, 50707464, 3363120,
+    2311524, 1644624, 1057680, 1614084, 1613508, 1607136, 4407876, 1574628, 1575024, 805716,
+    4942620, 38328936, 3366684, 2315088, 1667556, 1054548, 1630032, 1622652, 1622076, 4487328,
+    1589568, 1590000, 1585572, 665424, 28763832, 3371328, 2319732, 1672200, 1078560, 25866492,
+    25809264, 25926036, 37263456, 20704500, 15931020, 12086436, 9106260, 2045448, 10059624, 8378316,
+    6612336, 4735416, 1137984, 1130604, 1123224, 3638400, 1096488, 1096920, 1097352, 1097784,
+    3263952, 503208, 2323044, 1675512, 1081872, 810084, 802704, 795324, 2814492, 761784,
+    768012, 768444, 768876, 2710668, 768756, 480132, 1699956, 1106316, 607656, 600276,
+    592896, 2178984, 559356, 558780, 565008, 565440, 2130060, 565320, 571548, 488160,
+    1130760, 425112, 417732, 410352, 1473612, 382608, 375228, 374652, 380880, 1514772,
+    380760, 386988, 393216, 470016, 139359840, 9632412, 7659648, 5432280, 1132272, 1125900,
+    1119528, 3409200, 1032768, 3334716, 3324888, 3316140, 3361716, 68180196, 2289132, 1648296,
+    1087416, 1129500, 1123128, 1116756, 3458580, 1084140, 858132, 3326292, 3317544, 3363120,
+    51419556, 2309904, 1643004, 1056060, 1121652, 1121076, 1114704, 3508296, 1082196, 1082592,
+    716760, 3321108, 3366684, 38046756, 2313468, 1665936, 1052928, 1120968, 1113588, 1113012,
+    3558252, 1080504, 1080936, 1081368, 607572, 3355776, 28184292, 2318112, 1670580, 1076940,
+    1137024, 1129644, 1122264, 3637776, 1095552, 1095984, 1096416, 1091988, 529812, 20342796,
+    2323080, 1675548, 1081908, 25614192, 25556964, 25673736, 37263480, 21332256, 16144560, 11992200,
+    8919648, 6473496, 1606764, 7558848, 5792868, 3915948, 809556, 802176, 794796, 3065796,
+    761244, 767472, 767904, 768336, 768768, 2458368, 480204, 1698372, 1104732, 607128,
+    599748, 592368, 2430288, 558816, 558240, 564468, 564900, 565332, 1877760, 571020,
+    488232, 1129176, 424584, 417204, 409824, 1724916, 382068, 374688, 374112, 380340,
+    380772, 1262472, 386460, 392688, 470088, 139360008, 7682532, 5455164, 816396, 810024,
+    803652, 2611080, 840924, 2318004, 2308176, 2299428, 2291004, 2289096, 67360728, 1646676,
+    1085796, 820392, 814020, 807648, 2665608, 767328, 744192, 2328948, 2320200, 2311776,
+    2309868, 52758780, 1667448, 1080504, 812544, 811968, 805596, 2715324, 765384, 771576,
+    644292, 2323764, 2315340, 2313432, 38353212, 1690380, 1077372, 811860, 804480, 803904,
+    2765280, 763692, 769920, 770352, 566208, 2319984, 2318076, 27840732, 1695024, 1101384,
+    811284, 803904, 796524, 2815308, 762108, 768336, 768768, 769200, 509184, 2307492,
+    19782804, 1699992, 1106352, 809232, 801852, 794472, 3065580, 760956, 767184, 767616,
+    768048, 763620, 490356, 15130944, 1698372, 1104732, 25564680, 25507452, 25624224, 37263528,
+    21080940, 16551408, 12080952, 8806656, 6293040, 4829328, 1227312, 4999452, 3122532, 617112,
+    609732, 602352, 2436996, 559788, 565980, 572208, 572640, 573072, 571020, 1633224,
+    505656, 1162296, 434568, 427188, 419808, 1731624, 383040, 382428, 381852, 388080,
+    388512, 386460, 1017936, 402672, 487512, 139360176, 5478048, 618048, 611676, 605304,
+    1978404, 691596, 1651104, 1667340, 1658592, 1650168, 1648260, 1646676, 67202736, 1118916,
+    613032, 606660, 600288, 2026176, 559968, 611964, 1662300, 1653552, 1645128, 1643220,
+    1667412, 51939312, 1078884, 611952, 611376, 605004, 2081040, 564792, 563280, 579600,
+    1676484, 1668060, 1666152, 1690344, 39377076, 1101816, 611268, 603888, 603312, 2130996,
+    563100, 561624, 567852, 532620, 1672704, 1670796, 1694988, 27908052, 1125828, 610692,
+    603312, 595932, 2181024, 561516, 560040, 566268, 566700, 496332, 1675764, 1699956,
+    19358316, 1130796, 608640, 601260, 593880, 2431296, 560364, 558888, 565116, 565548,
+    565980, 487872, 1698336, 14570952, 1129176, 617112, 609732, 602352, 2436996, 559788,
+    566016, 572244, 572676, 573108, 571056, 507168, 10920012, 1162296, 25515168, 25457940,
+    25574712, 37263576, 21031428, 16300092, 12391680, 8821416, 6155136, 4648872, 3491076, 898404,
+    2329116, 444552, 437172, 429792, 1738332, 393024, 383400, 389592, 395820, 396252,
+    394200, 402672, 773400, 504936, 139360248, 445020, 438648, 432276, 1331904, 550008,
+    1098900, 1080396, 1097712, 1089288, 1087380, 1085796, 1118916, 66997944, 433884, 427512,
+    421140, 1315476, 386940, 509292, 1049544, 1066860, 1058436, 1056528, 1080720, 1079136,
+    52341312, 423792, 423216, 416844, 1363584, 382752, 373452, 483660, 1063980, 1055556,
+    1053648, 1077840, 1102032, 39117600, 429876, 422496, 421920, 1418688, 387828, 378564,
+    377088, 493848, 1079568, 1077660, 1101852, 1126044, 29071428, 429300, 421920, 414540,
+    1468716, 386244, 376980, 375504, 381732, 478296, 1082628, 1106820, 1131012, 19851612,
+    427248, 419868, 412488, 1718988, 385092, 375828, 374352, 380580, 381012, 480204,
+    1105200, 1129392, 14625528, 435720, 428340, 420960, 1724688, 384516, 382956, 381480,
+    387708, 388140, 386088, 499500, 1162512, 10920012, 444192, 436812, 429432, 1730388,
+    392988, 382380, 388608, 394836, 395268, 393216, 401688, 518796, 8789952, 25611516,
+    25558176, 25674948, 37263600, 20967300, 16424100, 12313884, 9177504, 6301464, 4659576, 3484140,
+    2792304, 821352, 17607432, 8940672, 8662692, 7744416, 988776, 11060856, 8447676, 6390492,
+    4812540, 3729924, 3137148, 2458464, 1765956, 3348612, 2030736, 2028636, 2026536, 3514464,
+    540660, 3677880, 2424792, 1579332, 1099500, 783120, 574260, 401232, 2462520, 1271324,
+    1269224, 1267124, 2695188, 1181452, 382092, 2271732, 1538400, 1084608, 774708, 573624,
+    390084, 1772832, 815892, 815700, 813600, 2045580, 787016, 738656, 276456, 1443420,
+    1068492, 768000, 573396, 397632, 1263624, 536372, 533936, 533744, 1543404, 520592,
+    507484, 477232, 209844, 957024, 752028, 566832, 397548, 914352, 382776, 380340,
+    377904, 1195332, 368712, 363816, 358376, 322904, 182952, 759768, 574572, 405288,
+    658380, 282128, 279692, 277256, 1001412, 268268, 265424, 262976, 257536, 259588,
+    173232, 575544, 406260, 454332, 218652, 216216, 213780, 782460, 201908, 201512,
+    201116, 198668, 200720, 200540, 177744, 416244, 245712, 163376, 160940, 158504,
+    558936, 146620, 143340, 145392, 144996, 147048, 146868, 149560, 182220, 17607432,
+    8901360, 7759416, 970152, 10980468, 8415924, 6307572, 4734732, 3657228, 3069564, 2395992,
+    1708596, 2030736, 3396036, 2027004, 2024904, 3489084, 538716, 3677304, 2418420, 1572960,
+    1093128, 776748, 567888, 394860, 1271324, 2462520, 1269032, 1266932, 2684892, 1181260,
+    382092, 2271156, 1537824, 1084032, 774132, 573048, 389508, 815688, 1832088, 813600,
+    811500, 2019240, 784916, 738464, 272604, 1435140, 1060212, 759720, 565116, 389352,
+    536168, 1322880, 531836, 531644, 1518720, 518492, 507292, 474592, 205992, 948744,
+    743748, 558552, 389268, 382572, 973608, 378240, 375804, 1172304, 366612, 363624,
+    355736, 320264, 179100, 751488, 566292, 397008, 281924, 717636, 277592, 275156,
+    980040, 266168, 265232, 260336, 254896, 256948, 169380, 567264, 397980, 218448,
+    513588, 214116, 211680, 762744, 199808, 201320, 198476, 196028, 198080, 197900,
+    173892, 407964, 163172, 304968, 158840, 156404, 540876, 144520, 143148, 142752,
+    142356, 144408, 144228, 146920, 178368, 17607432, 7939200, 949908, 10913076, 8340648,
+    6280932, 4656924, 3584532, 3001980, 2333520, 1651236, 2028636, 2027004, 3443460, 2023272,
+    3467880, 536772, 3672336, 2417844, 1566588, 1086756, 770376, 561516, 388488, 1269224,
+    1269032, 2509944, 1265300, 2661168, 1179628, 380148, 2270580, 1531452, 1077660, 767760,
+    566676, 383136, 815496, 813600, 1832088, 811308, 2010600, 784724, 738272, 272604,
+    1434564, 1059636, 759144, 564540, 388776, 533528, 531632, 1382136, 529544, 1494036,
+    516392, 505192, 474400, 202140, 940464, 735468, 550272, 380988, 379932, 378036,
+    1032864, 373704, 1149276, 364512, 361524, 355544, 317624, 175248, 743208, 558012,
+    388728, 279284, 277388, 776892, 273056, 958668, 264068, 263132, 260144, 252256,
+    254308, 165528, 558984, 389700, 215808, 213912, 572844, 209580, 743028, 197708,
+    199220, 198284, 193388, 195440, 195260, 170040, 399684, 160532, 158636, 364224,
+    154304, 522816, 142420, 141048, 142560, 139716, 141768, 141588, 144280, 174516,
+    17607288, 926352, 10975776, 8278224, 6210624, 4635252, 3511692, 2934252, 2270904, 1593732,
+    2024844, 2023212, 2021580, 3489624, 3487776, 534756, 3667224, 2412732, 1565868, 1080240,
+    763860, 555000, 381972, 1267052, 1266860, 1265228, 2557296, 2641548, 1177924, 378132,
+    2265468, 1530732, 1071144, 761244, 560160, 376620, 813324, 811428, 811236, 1879440,
+    1988460, 783020, 736568, 270588, 1433844, 1053120, 752628, 558024, 382260, 533264,
+    531368, 529472, 1382064, 1486980, 516128, 504928, 474136, 202068, 939744, 734748,
+    549552, 380268, 377220, 375324, 373428, 1092048, 1126176, 362340, 359352, 353372,
+    317360, 171324, 734784, 549588, 380304, 276572, 274676, 272780, 836076, 937224,
+    261896, 260960, 257972, 251992, 251596, 161604, 550560, 381276, 213096, 211200,
+    209304, 632028, 723240, 195536, 197048, 196112, 193124, 192728, 192548, 166116,
+    391260, 157820, 155924, 154028, 423408, 504684, 140248, 138876, 140388, 139452,
+    139056, 138876, 141568, 170592, 9828408, 1803168, 1767144, 1735368, 1707588, 1687212,
+    1872120, 1797300, 1726356, 604140, 602196, 600252, 598308, 579612, 824508, 1221444,
+    1074672, 935892, 822312, 686484, 571644, 481896, 534000, 534000, 532056, 530112,
+    564780, 405288, 571536, 1037556, 909144, 805932, 680472, 578520, 471420, 468972,
+    466692, 466692, 464748, 551328, 359388, 347808, 397044, 872748, 779904, 664812,
+    573228, 479016, 406608, 404328, 402048, 402048, 539208, 316128, 307788, 296208,
+    284976, 743724, 639000, 557784, 473940, 351360, 349080, 346800, 344520, 529020,
+    279984, 274884, 266544, 254964, 236988, 646884, 565668, 481824, 290424, 288144,
+    285864, 283584, 584664, 236820, 234960, 229860, 221520, 223512, 211392, 547488,
+    463644, 242604, 240324, 238044, 235764, 560700, 200676, 202668, 200808, 195708,
+    197700, 191412, 218736, 480204, 197376, 195096, 192816, 190536, 538032, 171636,
+    169104, 171096, 169236, 171228, 164940, 169176, 226044, 139356024, 24962856, 18055572,
+    13113684, 9817200, 7945212, 5952936, 3944916, 20605584, 20500896, 20536032, 20962368, 37262568,
+    2509524, 25011816, 18794388, 14027604, 10710384, 8135016, 6885336, 4800264, 3934428, 3933852,
+    3928884, 3923916, 7967904, 7995768, 1092168, 7185600, 4677408, 3192912, 2196648, 1529460,
+    942552, 2480532, 2474820, 2474244, 2469276, 5787828, 6029580, 2285628, 747432, 4363200,
+    3133872, 2167560, 1521108, 959976, 1591596, 1585884, 1580172, 1579596, 4217220, 4513728,
+    1508076, 1410180, 527544, 2766096, 2108952, 1492452, 952056, 1103292, 1097580, 1091868,
+    1086156, 3159264, 3448680, 1045068, 1026036, 911508, 435816, 2126952, 1510452, 970056,
+    784236, 778524, 772812, 767100, 2552988, 2615976, 733152, 723528, 704496, 709056,
+    399816, 1509084, 968688, 573528, 567816, 562104, 556392, 1911324, 2201448, 523344,
+    520200, 510576, 515136, 513576, 399132, 967068, 399024, 393312, 387600, 381888,
+    1263840, 1528740, 339756, 344316, 341172, 345732, 344172, 342120, 415728, 139353768,
+    18338088, 13302648, 10006164, 8134176, 6161412, 4127352, 3933276, 3932700, 3927732, 3922764,
+    7963824, 1233036, 52148244, 7707708, 4782348, 3213900, 2196900, 1530000, 943056, 20475468,
+    20403612, 20434860, 20861196, 37261992, 16382688, 2267796, 18067584, 13825776, 10651740, 8132676,
+    6276168, 4984692, 2488848, 2488248, 2487672, 2482704, 5873976, 2445840, 5807916, 751176,
+    4471416, 3158136, 2171088, 1544292, 957060, 1583280, 1582680, 1576968, 1576392, 4273872,
+    1539528, 4456668, 1443072, 531288, 2790360, 2112480, 1515636, 949140, 1094976, 1094376,
+    1088664, 1082952, 3215916, 1050480, 3437040, 1032888, 918360, 439560, 2130480, 1533636,
+    967140, 775920, 775320, 769608, 763896, 2609640, 732084, 2622444, 723900, 704868,
+    709428, 403560, 1532268, 965772, 573492, 572892, 567180, 561468, 1974132, 522852,
+    2012844, 526944, 517320, 521880, 520320, 411588, 990216, 388464, 387864, 382152,
+    376440, 1318884, 337788, 1584708, 342780, 339636, 344196, 342636, 348864, 410796,
+    139353192, 13586004, 10195968, 8323980, 6351216, 4336668, 2475324, 2468952, 2468376, 2463408,
+    5791548, 1075896, 7692156, 51841428, 4827600, 3205152, 2188152, 1521252, 960372, 2484108,
+    2483532, 2482956, 2477988, 5870832, 2436228, 851580, 38541924, 4831164, 3208716, 2191716,
+    1544184, 957240, 20493444, 20416416, 20348448, 20765784, 37261824, 16282272, 12154104, 2067324,
+    13222164, 10545264, 8075832, 6275628, 4377324, 1598736, 1591356, 1590756, 1590180, 4360260,
+    1553316, 1553748, 4272732, 535392, 2845296, 2137464, 1519884, 973044, 1093800, 1086420,
+    1085820, 1080108, 3272808, 1047636, 1048068, 3409836, 934980, 443664, 2155464, 1537884,
+    991044, 774744, 767364, 766764, 761052, 2666532, 729240, 729672, 2611164, 712080,
+    716640, 407664, 1536516, 989676, 572316, 564936, 564336, 558624, 2031024, 520008,
+    526236, 2019672, 518052, 522612, 521052, 415692, 1014120, 395568, 388188, 387588,
+    381876, 1381932, 343224, 342648, 1396464, 346740, 351300, 349740, 355968, 423612,
+    139353120, 10479576, 8514036, 6541272, 4526724, 1587192, 1580820, 1574448, 1573872, 4228740,
+    926748, 4782348, 4827600, 51550668, 3250728, 2179728, 1512828, 951948, 1579344, 1578768,
+    1572396, 1571820, 4278528, 1534920, 743904, 4815612, 38235756, 3254292, 2183292, 1535760,
+    948816, 1595292, 1587912, 1587336, 1586760, 4357980, 1549896, 1545468, 603612, 28419516,
+    3258936, 2187936, 1540404, 972828, 20882748, 20805720, 20757492, 20693412, 37261800, 16187148,
+    12053868, 8996508, 1947456, 9927744, 8049000, 6298428, 4456428, 1109364, 1101984, 1094604,
+    1094004, 3359268, 1061532, 1061964, 1062396, 3221808, 447876, 2210616, 1563084, 995508,
+    773676, 766296, 758916, 758316, 2723496, 726504, 726936, 727368, 2609364, 733368,
+    411876, 1561716, 994140, 571248, 563868, 556488, 555888, 2087988, 517272, 523500,
+    523932, 2033796, 529932, 528372, 419904, 1018584, 394500, 387120, 379740, 379140,
+    1438896, 340488, 339912, 346140, 1428696, 352140, 350580, 356808, 427824, 139353216,
+    8723688, 6750924, 4736376, 1100880, 1094508, 1088136, 1081764, 3179376, 802800, 3213900,
+    3205152, 3250728, 51171468, 2197476, 1530576, 969696, 1093032, 1092456, 1086084, 1079712,
+    3229164, 1047204, 661428, 3208716, 3254292, 37814076, 2201040, 1553508, 966564, 1092348,
+    1084968, 1084392, 1078020, 3279120, 1045548, 1045980, 552240, 3243384, 27967020, 2205684,
+    1558152, 990576, 1108404, 1101024, 1093644, 1093068, 3358644, 1060596, 1061028, 1056600,
+    474480, 20140932, 2210652, 1563120, 995544, 21360612, 21283584, 21235356, 21329088, 37261824,
+    16065264, 11917944, 8850432, 6409320, 1579680, 7442352, 5691780, 3849780, 780924, 773544,
+    766164, 758784, 2786640, 732084, 732516, 732948, 733380, 2421264, 424836, 1585908,
+    1018332, 578496, 571116, 563736, 556356, 2151132, 522852, 529080, 529512, 529944,
+    1845696, 535620, 432864, 1042776, 401748, 394368, 386988, 379608, 1502040, 346068,
+    345492, 351720, 352152, 1240596, 357828, 364056, 440784, 139353312, 7567404, 5552856,
+    783492, 777120, 770748, 764376, 2581476, 680148, 2196900, 2188152, 2179728, 2197476,
+    52916328, 1528956, 968076, 775644, 775068, 768696, 762324, 2631264, 729816, 580248,
+    2191716, 2183292, 2201040, 38181912, 1551888, 964944, 774960, 767580, 767004, 760632,
+    2681220, 728160, 728592, 502164, 2187936, 2205684, 27603912, 1556532, 988956, 774384,
+    767004, 759624, 759048, 2731248, 726576, 727008, 727440, 445140, 2195100, 19561392,
+    1561500, 993924, 780612, 773232, 765852, 758472, 2786448, 731796, 732228, 732660,
+    728232, 435024, 14944452, 1585944, 1018368, 21108312, 21031284, 20983056, 21076788, 37261848,
+    16596900, 12025452, 8731284, 6222708, 4770192, 1191540, 4872312, 3030312, 577968, 570588,
+    563208, 555828, 2402436, 522312, 528540, 528972, 529404, 535632, 1593396, 432936,
+    1041192, 401220, 393840, 386460, 379080, 1753344, 345528, 344952, 351180, 351612,
+    357840, 988296, 363528, 440856, 139353480, 5575740, 576132, 569760, 563388, 557016,
+    1942044, 547920, 1530252, 1521504, 1513080, 1530828, 1528920, 52096860, 966456, 575052,
+    574476, 568104, 561732, 1996980, 521520, 515556, 1544436, 1536012, 1553760, 1551852,
+    39205776, 989388, 574368, 566988, 566412, 560040, 2046936, 519864, 526092, 468576,
+    1540656, 1558404, 1556496, 27671232, 1013400, 573792, 566412, 559032, 558456, 2096964,
+    518280, 524508, 524940, 432288, 1563372, 1561464, 19136904, 1018368, 580020, 572640,
+    565260, 557880, 2152164, 523500, 529728, 530160, 530592, 432540, 1585908, 14384460,
+    1042812, 577968, 570588, 563208, 555828, 2402436, 522348, 528576, 529008, 529440,
+    535668, 434448, 10722888, 1041192, 21058800, 20981772, 20933544, 21027276, 37261896, 16345584,
+    12336180, 8746044, 6084804, 4589736, 3429216, 862632, 2236896, 411204, 403824, 396444,
+    389064, 1760052, 346500, 352692, 358920, 359352, 365580, 363528, 743760, 458280,
+    139353552, 403104, 396732, 390360, 383988, 1295544, 458136, 943272, 960588, 952164,
+    969912, 968004, 966420, 51938688, 393012, 392436, 386064, 379692, 1343724, 339468,
+    432504, 957708, 949284, 967032, 965124, 989316, 38386128, 399096, 391716, 391140,
+    384768, 1398828, 344580, 343104, 442692, 973296, 991044, 989136, 1013328, 28274436,
+    398520, 391140, 383760, 383184, 1448856, 342996, 341520, 347748, 427140, 996012,
+    994104, 1018296, 19070028, 404748, 397368, 389988, 382608, 1504056, 348216, 346740,
+    352968, 353400, 437760, 1018548, 1042740, 13878864, 402696, 395316, 387936, 380556,
+    1754328, 347064, 345588, 351816, 352248, 358476, 439668, 1041120, 10162716, 411168,
+    403788, 396408, 389028, 1760028, 346488, 352716, 358944, 359376, 365604, 363552,
+    458964, 8048064, 20994672, 20917644, 20869416, 20963148, 37261920, 16296012, 12084804, 8928552,
+    6057552, 4426860, 3248700, 2561904, 584184, 17606616, 8916648, 8634168, 7712652, 6445656,
+    887880, 8141220, 6288552, 4785516, 3721008, 2940072, 2505984, 1807320, 2487180, 1275620,
+    1273520, 1271420, 1261040, 2601756, 383268, 2322084, 1546080, 1085808, 781020, 573156,
+    381336, 1788180, 814968, 814776, 812676, 802296, 2015616, 754296, 277632, 1451100,
+    1069692, 774312, 572928, 388884, 1278972, 535448, 533012, 532820, 522440, 1537176,
+    509692, 479440, 211020, 958224, 758340, 566364, 388800, 929700, 381852, 379416,
+    376980, 368508, 1194936, 363972, 358532, 323060, 184128, 766080, 574104, 396540,
+    675312, 283436, 281000, 278564, 267848, 941748, 267272, 264824, 259384, 261436,
+    176676, 581844, 404280, 469152, 217088, 214652, 212216, 201500, 797640, 201128,
+    200732, 198284, 200336, 202388, 176676, 405252, 242832, 159904, 157468, 155032,
+    146224, 572520, 140724, 142776, 142380, 144432, 146484, 146304, 172872, 17606616,
+    8869992, 7726464, 6412932, 869256, 8109468, 6205632, 4707708, 3648312, 2872488, 2443512,
+    1749960, 1275620, 2487180, 1273328, 1271228, 1260848, 2591460, 383268, 2321508, 1545504,
+    1085232, 780444, 572580, 380760, 814764, 1847436, 812676, 810576, 800196, 1989276,
+    754104, 273780, 1442820, 1061412, 766032, 564648, 380604, 535244, 1338228, 530912,
+    530720, 520340, 1512492, 509500, 476800, 207168, 949944, 750060, 558084, 380520,
+    381648, 988956, 377316, 374880, 366408, 1171908, 363780, 355892, 320420, 180276,
+    757800, 565824, 388260, 283232, 734568, 278900, 276464, 265748, 920376, 267080,
+    262184, 256744, 258796, 172824, 573564, 396000, 216884, 528408, 212552, 210116,
+    199400, 777924, 200936, 198092, 195644, 197696, 199748, 172824, 396972, 159700,
+    302088, 155368, 152932, 144124, 554460, 140532, 140136, 139740, 141792, 143844,
+    143664, 169020, 17606616, 7906248, 6423144, 850632, 8034192, 6178992, 4629900, 3575616,
+    2804904, 2381040, 1692600, 1273520, 1273328, 2534604, 1269596, 1259216, 2567736, 381324,
+    2320932, 1539132, 1078860, 774072, 566208, 374388, 814572, 812676, 1847436, 810384,
+    800004, 1980636, 753912, 273780, 1442244, 1060836, 765456, 564072, 380028, 532604,
+    530708, 1397484, 528620, 518240, 1487808, 507400, 476608, 203316, 941664, 741780,
+    549804, 372240, 379008, 377112, 1048212, 372780, 364308, 1148880, 361680, 355700,
+    317780, 176424, 749520, 557544, 379980, 280592, 278696, 793824, 274364, 263648,
+    899004, 264980, 261992, 254104, 256156, 168972, 565284, 387720, 214244, 212348,
+    587664, 208016, 197300, 758208, 198836, 197900, 193004, 195056, 197108, 168972,
+    388692, 157060, 155164, 361344, 150832, 142024, 536400, 138432, 139944, 137100,
+    139152, 141204, 141024, 165168, 17606616, 6553764, 830388, 7971912, 6108828, 4608372,
+    3502920, 2737320, 2318568, 1635240, 1271420, 1271228, 1269596, 2582028, 1257584, 2548188,
+    379380, 2315964, 1538556, 1072488, 767700, 559836, 368016, 812472, 810576, 810384,
+    1894860, 798372, 1958568, 752280, 271836, 1441668, 1054464, 759084, 557700, 373656,
+    532412, 530516, 528620, 1397484, 518048, 1480824, 507208, 476416, 203316, 941088,
+    741204, 549228, 371664, 376368, 374472, 372576, 1107468, 362208, 1125852, 359580,
+    353600, 317588, 172572, 741240, 549264, 371700, 277952, 276056, 274160, 853080,
+    261548, 877632, 262880, 259892, 253912, 253516, 165120, 557004, 379440, 211604,
+    209708, 207812, 646920, 195200, 738492, 196736, 195800, 192812, 192416, 194468,
+    165120, 380412, 154420, 152524, 150628, 420600, 139924, 518340, 136332, 137844,
+    136908, 136512, 138564, 138384, 161316, 17606544, 798492, 7985004, 6026292, 4517952,
+    3461136, 2644368, 2230728, 1558668, 1259384, 1259192, 1257560, 1255928, 2543652, 2552856,
+    360480, 2277084, 1499676, 1038000, 727416, 519552, 336012, 802056, 800160, 799968,
+    798336, 1857672, 1933032, 740100, 252936, 1402788, 1019976, 718800, 517416, 341652,
+    521996, 520100, 518204, 518012, 1360296, 1452768, 495028, 464236, 184416, 906600,
+    700920, 508944, 339660, 367860, 365964, 364068, 362172, 1022856, 1112880, 348840,
+    342860, 306848, 155616, 706752, 514776, 345492, 266996, 265100, 263204, 261308,
+    827724, 848616, 250232, 247244, 241264, 242776, 144312, 514812, 345528, 200648,
+    198752, 196856, 194960, 621564, 711132, 184088, 183152, 180164, 181676, 181280,
+    144312, 346500, 145372, 143476, 141580, 139684, 412944, 494220, 125916, 127428,
+    126492, 128004, 127608, 127428, 148788, 9827616, 1527048, 1521192, 1519332, 1530060,
+    1539492, 1754208, 1700496, 430428, 430428, 428484, 426540, 407676, 492588, 579024,
+    848124, 750816, 678708, 614376, 527796, 444780, 381600, 379320, 379320, 377376,
+    358512, 487248, 287268, 404532, 714420, 652680, 598716, 522504, 452376, 335436,
+    333156, 330876, 330876, 312012, 483228, 256968, 245388, 292464, 616500, 572904,
+    507060, 447300, 296388, 294108, 291828, 289548, 272628, 482760, 233784, 225444,
+    213864, 244476, 580788, 514944, 455184, 259932, 257652, 255372, 253092, 233892,
+    481968, 213192, 208092, 199752, 201744, 227592, 522828, 463068, 217788, 215508,
+    213228, 210948, 191748, 547008, 185580, 183720, 178620, 180612, 182604, 217548,
+    444888, 184908, 182628, 180348, 178068, 162720, 530184, 160464, 162456, 160596,
+    162588, 164580, 158292, 207468, 139350672, 17992416, 12968640, 9672156, 7335864, 5969892,
+    3909780, 16243572, 16176828, 16081140, 16100364, 16372332, 37261200, 2189628, 18115728, 13664256,
+    10464732, 8123112, 6069168, 4767060, 2484060, 2483460, 2482884, 2477916, 2439108, 5774112,
+    5821260, 760896, 4487472, 3174192, 2201760, 1555560, 933588, 1583676, 1583076, 1577364,
+    1576788, 1537980, 4177896, 4404024, 1447116, 541008, 2806416, 2143152, 1526904, 925668,
+    1095372, 1094772, 1089060, 1083348, 1048932, 3119940, 3376368, 1036932, 922404, 449280,
+    2161152, 1544904, 943668, 782436, 781836, 776124, 770412, 730860, 2363880, 2618256,
+    732660, 713628, 718188, 419760, 1562904, 961668, 572220, 571620, 565908, 560196,
+    520644, 1916508, 1949496, 529584, 519960, 524520, 529080, 414864, 960300, 379488,
+    378888, 373176, 367464, 335616, 1254480, 1519644, 336408, 333264, 337824, 342384,
+    340824, 379332, 139350096, 13251996, 9861960, 7525668, 6159696, 4119096, 2484504, 2483928,
+    2483352, 2478384, 2439576, 5771160, 861300, 39201924, 4847220, 3224772, 2222388, 1555452,
+    933768, 16119348, 16047432, 15984576, 15999912, 16271880, 37261056, 12354540, 1999524, 13060644,
+    10358256, 8066268, 6068628, 4159692, 1599132, 1591752, 1591152, 1590576, 1551768, 4264284,
+    1557792, 4220088, 545112, 2861352, 2168136, 1531152, 949572, 1094196, 1086816, 1086216,
+    1080504, 1046088, 3176832, 1052112, 3349164, 939024, 453384, 2186136, 1549152, 967572,
+    781260, 773880, 773280, 767568, 728016, 2420772, 738432, 2606976, 720840, 725400,
+    423864, 1567152, 985572, 571044, 563664, 563064, 557352, 517800, 1973400, 528876,
+    1956324, 520692, 525252, 529812, 418968, 984204, 386592, 379212, 378612, 372900,
+    341052, 1317528, 336276, 1331400, 340368, 344928, 349488, 347928, 392148, 139350024,
+    10145568, 7715724, 6349752, 4309152, 1579740, 1579164, 1572792, 1572216, 1533408, 4182528,
+    753624, 4831668, 38895756, 3270348, 2213964, 1547028, 925344, 1595688, 1588308, 1587732,
+    1587156, 1548348, 4262004, 1549512, 613332, 28391052, 3274992, 2218608, 1551672, 949356,
+    16112628, 16040712, 15972684, 15913716, 16176684, 37261032, 12254304, 8984328, 1884840, 9740736,
+    8039436, 6091428, 4238796, 1109760, 1102380, 1095000, 1094400, 1059984, 3263292, 1066008,
+    1066440, 3161136, 457596, 2241288, 1574352, 972036, 780192, 772812, 765432, 764832,
+    725280, 2477736, 735696, 736128, 2605176, 742128, 428076, 1592352, 990036, 569976,
+    562596, 555216, 554616, 515064, 2030364, 526140, 526572, 1970448, 532572, 537132,
+    423180, 988668, 385524, 378144, 370764, 370164, 338316, 1374492, 333540, 339768,
+    1363632, 345768, 350328, 348768, 396360, 139350120, 7925376, 6559404, 4518804, 1093428,
+    1092852, 1086480, 1080108, 1045692, 3133164, 671148, 3224772, 3270348, 38447004, 2231712,
+    1564776, 943092, 1092744, 1085364, 1084788, 1078416, 1044000, 3183144, 1050024, 561960,
+    3259440, 27926892, 2236356, 1569420, 967104, 1108800, 1101420, 1094040, 1093464, 1059048,
+    3262668, 1065072, 1060644, 484200, 19930596, 2241324, 1574388, 972072, 16314348, 16242432,
+    16174404, 16135176, 16054800, 37261056, 12109668, 8834580, 6341196, 1517064, 7432788, 5484780,
+    3632148, 787440, 780060, 772680, 765300, 730860, 2540880, 741276, 741708, 742140,
+    2417076, 441036, 1616544, 1014228, 577224, 569844, 562464, 555084, 520644, 2093508,
+    531720, 532152, 532584, 1782348, 544380, 436140, 1012860, 392772, 385392, 378012,
+    370632, 343896, 1437636, 339120, 345348, 345780, 1175532, 357576, 356016, 409320,
+    139350216, 6769056, 4728456, 782160, 781584, 775212, 768840, 728628, 2385480, 596448,
+    2222388, 2213964, 2231712, 38067804, 1582524, 960840, 781476, 774096, 773520, 767148,
+    726936, 2435460, 737352, 518364, 2218608, 2236356, 27505212, 1587168, 984852, 780900,
+    773520, 766140, 765564, 725352, 2485488, 735768, 736200, 461340, 2225772, 19478100,
+    1592136, 989820, 787128, 779748, 772368, 764988, 730572, 2540688, 740988, 741420,
+    736992, 451224, 14876568, 1616580, 1014264, 16728132, 16656216, 16588188, 16548960, 16594356,
+    37261080, 11987784, 8698656, 6195120, 4747644, 1199832, 4878132, 3025500, 584472, 577092,
+    569712, 562332, 521112, 2156652, 537300, 537732, 538164, 544392, 1594248, 449100,
+    1037052, 400020, 392640, 385260, 377880, 344364, 1500780, 344700, 350928, 351360,
+    357588, 987432, 363264, 422280, 139350312, 5544936, 573288, 572712, 566340, 559968,
+    519756, 1946268, 523044, 1555452, 1547028, 1564776, 1582524, 39392184, 959220, 572604,
+    565224, 564648, 558276, 518064, 1996248, 528480, 476064, 1551672, 1569420, 1587168,
+    27633912, 983232, 572028, 564648, 557268, 556692, 516480, 2046276, 526896, 527328,
+    439776, 1574388, 1592136, 19034064, 988200, 578256, 570876, 563496, 556116, 521700,
+    2101476, 532116, 532548, 532980, 440028, 1616580, 14297028, 1012644, 584484, 577104,
+    569724, 562344, 521124, 2156676, 537336, 537768, 538200, 544428, 450648, 10670376,
+    1037088, 16475832, 16403916, 16335888, 16296660, 16342056, 37261104, 12391260, 8732172, 6051060,
+    4561032, 3411708, 862236, 2206032, 399492, 392112, 384732, 377352, 343836, 1752084,
+    344160, 350388, 350820, 357048, 363276, 735132, 422352, 139350312, 382968, 382392,
+    376020, 369648, 337716, 1285248, 422640, 934020, 925596, 943344, 961092, 959184,
+    39366132, 389052, 381672, 381096, 374724, 342792, 1340376, 334980, 432828, 949608,
+    967356, 985104, 983196, 29030712, 388476, 381096, 373716, 373140, 341208, 1390404,
+    333396, 339624, 417276, 972324, 990072, 988164, 19760784, 394704, 387324, 379944,
+    372564, 346428, 1445604, 338616, 344844, 345276, 427896, 1014516, 1012608, 14585028,
+    400932, 393552, 386172, 378792, 345852, 1500804, 343836, 350064, 350496, 356724,
+    438516, 1037052, 10903800, 398880, 391500, 384120, 376740, 343800, 1751076, 342684,
+    348912, 349344, 355572, 361800, 440424, 8778516, 16606776, 16534860, 16466832, 16427604,
+    16292508, 37261104, 12384480, 9159276, 6268404, 4642752, 3475788, 2786268, 847404, 17606280,
+    9154884, 8872404, 7722720, 6404256, 5094996, 784956, 5996424, 4657992, 3638904, 2876076,
+    2253828, 1799760, 1872348, 817596, 817404, 815304, 804924, 805068, 1925904, 275196,
+    1477596, 1070148, 768288, 572016, 381192, 1353828, 532856, 530420, 530228, 519848,
+    519992, 1499064, 487652, 208584, 958680, 752316, 565452, 381108, 1004556, 379260,
+    376824, 374388, 365916, 366060, 1171248, 358532, 323060, 181692, 760056, 573192,
+    388848, 750168, 280844, 278408, 275972, 265256, 267308, 923892, 262772, 257332,
+    259384, 174240, 580932, 396588, 545592, 216728, 214292, 211856, 201140, 200948,
+    720516, 200372, 197924, 199976, 202028, 176508, 404328, 317160, 156672, 154236,
+    151800, 142992, 140556, 570240, 140184, 139788, 141840, 143892, 145944, 168192,
+    17606280, 8846448, 7698420, 6381612, 5074008, 784956, 5969784, 4636464, 3622488, 2864772,
+    2247636, 1798680, 817608, 1872336, 817212, 815112, 804732, 804876, 1917264, 275196,
+    1477020, 1069572, 767712, 571440, 380616, 532868, 1353816, 530228, 530036, 519656,
+    519800, 1492080, 487460, 208584, 958104, 751740, 564876, 380532, 379272, 1004544,
+    376632, 374196, 365724, 365868, 1165920, 358340, 322868, 181692, 759480, 572616,
+    388272, 280856, 750156, 278216, 275780, 265064, 267116, 920220, 262580, 257140,
+    259192, 174240, 580356, 396012, 216740, 545580, 214100, 211664, 200948, 200756,
+    718500, 200180, 197732, 199784, 201836, 176508, 403752, 156684, 317148, 154044,
+    151608, 142800, 140364, 569880, 139992, 139596, 141648, 143700, 145752, 168192,
+    17606280, 7875360, 6390636, 5044128, 766332, 5943144, 4558656, 3549792, 2797188, 2185164,
+    1741320, 817416, 817212, 1872336, 814920, 804540, 804684, 1908624, 275196, 1476444,
+    1068996, 767136, 570864, 380040, 530228, 530024, 1413072, 527936, 517556, 517700,
+    1467396, 487268, 204732, 949824, 743460, 556596, 372252, 376632, 376428, 1063800,
+    372096, 363624, 363768, 1142892, 358148, 320228, 177840, 751200, 564336, 379992,
+    278216, 278012, 809412, 273680, 262964, 265016, 898848, 262388, 254500, 256552,
+    170388, 572076, 387732, 214100, 213896, 604836, 209564, 198848, 198656, 698784,
+    199988, 195092, 197144, 199196, 172656, 395472, 154044, 153840, 376404, 149508,
+    140700, 138264, 551820, 139800, 136956, 139008, 141060, 143112, 164340, 17606280,
+    6521256, 5049552, 747708, 5872980, 4537128, 3477096, 2729604, 2122692, 1683960, 815316,
+    815112, 814920, 1919760, 802908, 803052, 1886556, 273252, 1475868, 1062624, 760764,
+    564492, 373668, 530036, 529832, 527936, 1413072, 517364, 517508, 1460412, 487076,
+    204732, 949248, 742884, 556020, 371676, 373992, 373788, 371892, 1123056, 361524,
+    361668, 1119864, 356048, 320036, 173988, 742920, 556056, 371712, 275576, 275372,
+    273476, 868668, 260864, 262916, 877476, 260288, 254308, 253912, 166536, 563796,
+    379452, 211460, 211256, 209360, 664092, 196748, 196556, 679068, 197888, 194900,
+    194504, 196556, 168804, 387192, 151404, 151200, 149304, 435660, 138600, 136164,
+    533760, 137700, 136764, 136368, 138420, 140472, 160488, 17606280, 5133120, 719088,
+    5790516, 4446780, 3435384, 2636724, 2034924, 1607460, 804936, 804732, 804540, 802908,
+    1882608, 790908, 1861056, 254388, 1437060, 1028208, 720552, 524280, 341736, 519656,
+    519452, 517556, 517364, 1375920, 505364, 1432392, 474932, 185868, 914832, 702672,
+    515808, 339744, 365520, 365316, 363420, 361524, 1038480, 350964, 1106928, 345344,
+    309332, 157068, 708504, 521640, 345576, 264656, 264452, 262556, 260660, 843348,
+    250304, 848496, 247676, 241696, 243208, 145764, 521676, 345612, 200540, 200336,
+    198440, 196544, 638772, 183944, 651744, 185276, 182288, 183800, 183404, 148032,
+    353352, 142392, 142188, 140292, 138396, 428040, 125784, 509676, 127320, 126384,
+    127896, 127500, 129552, 147996, 17606280, 697848, 5811348, 4401480, 3382200, 2632176,
+    1979208, 1549092, 803448, 803244, 803052, 801420, 789276, 1854000, 1867824, 256956,
+    1441116, 1032264, 729000, 526932, 333864, 519788, 519584, 517688, 517496, 505352,
+    1348500, 1418268, 476172, 188436, 918888, 711120, 518460, 331872, 365652, 365448,
+    363552, 361656, 350952, 1011060, 1090284, 346584, 310572, 159636, 716952, 524292,
+    337704, 266696, 266492, 264596, 262700, 250292, 768504, 846936, 250356, 244376,
+    245888, 150276, 530124, 343536, 200132, 199928, 198032, 196136, 183728, 623184,
+    634140, 186048, 183060, 184572, 186084, 148692, 343572, 139536, 139332, 137436,
+    135540, 125580, 410328, 491616, 125220, 124284, 125796, 127308, 126912, 138132,
+    9827304, 1334616, 1353492, 1384956, 1420308, 1454364, 1685004, 308880, 308868, 308868,
+    306924, 288060, 290640, 431748, 412740, 609372, 568368, 535140, 509688, 444564,
+    275676, 275664, 273384, 273384, 254520, 257100, 434208, 211488, 300672, 532188,
+    509328, 494244, 439488, 249588, 249576, 247296, 245016, 228096, 230676, 440220,
+    198024, 186444, 252684, 517212, 502128, 447372, 226092, 226080, 223800, 221520,
+    202320, 206844, 447528, 187152, 178812, 180804, 235800, 510012, 455256, 205188,
+    205176, 202896, 200616, 181416, 183660, 454512, 178872, 173772, 175764, 177756,
+    234468, 463140, 174744, 174732, 172452, 170172, 154824, 152544, 525072, 159048,
+    157188, 159180, 161172, 163164, 207000, 139348920, 12909204, 9530832, 7194540, 5364264,
+    3930456, 12365616, 12303960, 12246216, 12159528, 12137544, 12344556, 37260768, 1921596, 13031604,
+    10213104, 7895628, 6075432, 3969060, 1588296, 1587684, 1587084, 1586508, 1547700, 1551780,
+    4165140, 4209456, 555552, 2878848, 2185632, 1563264, 962280, 1088544, 1087932, 1087332,
+    1081620, 1047204, 1051284, 3081576, 3302040, 943788, 463824, 2203632, 1581264, 980280,
+    775608, 774996, 774396, 768684, 729132, 737604, 2325516, 2551824, 725604, 730164,
+    434304, 1599264, 998280, 571512, 570900, 570300, 564588, 525036, 528372, 1728360,
+    1957656, 530172, 534732, 539292, 435888, 1016280, 379272, 378660, 378060, 372348,
+    340500, 334788, 1260624, 1273572, 343728, 348288, 352848, 357408, 396144, 139348848,
+    9814440, 7384596, 5554320, 4120512, 1590036, 1589424, 1588848, 1588272, 1549464, 1553544,
+    4163076, 623772, 28839948, 3292488, 2236104, 1583784, 962064, 12241608, 12179952, 12117036,
+    12063180, 12037308, 12244320, 37260744, 9119964, 1817280, 9595584, 7868796, 6098232, 4048164,
+    1104108, 1103496, 1096116, 1095516, 1061100, 1065180, 3168036, 1071204, 3114012, 468036,
+    2258784, 1606464, 984744, 774540, 773928, 766548, 765948, 726396, 734868, 2382480,
+    740892, 2550024, 746892, 438516, 1624464, 1002744, 570444, 569832, 562452, 561852,
+    522300, 525636, 1785324, 536052, 1971780, 542052, 546612, 440100, 1020744, 378204,
+    377592, 370212, 369612, 337764, 332052, 1317588, 343128, 1305804, 349128, 353688,
+    358248, 400356, 139348944, 7594248, 5763972, 4330164, 1087092, 1086480, 1085904, 1079532,
+    1045116, 1049196, 3087888, 572400, 3276936, 28375788, 2253852, 1601532, 979812, 1103148,
+    1102536, 1095156, 1094580, 1060164, 1064244, 3167412, 1065408, 494640, 19849236, 2258820,
+    1606500, 984780, 12160464, 12098808, 12035892, 11976864, 11901600, 12099612, 37260768, 8970216,
+    6313296, 1454688, 7262148, 5491584, 3441516, 781788, 781176, 773796, 766416, 731976,
+    740448, 2445624, 746472, 746904, 2361924, 451476, 1648656, 1026936, 577692, 577080,
+    569700, 562320, 527880, 531216, 1848468, 541632, 542064, 1783680, 553860, 453060,
+    1044936, 385452, 384840, 377460, 370080, 343344, 337632, 1380732, 348708, 349140,
+    1117704, 360936, 365496, 413316, 139349040, 5973624, 4539816, 775824, 775212, 774636,
+    768264, 728052, 736524, 2340204, 528804, 2236104, 2253852, 27927036, 1619280, 997560,
+    775248, 774636, 767256, 766680, 726468, 734940, 2390232, 740964, 471780, 2243268,
+    19385076, 1624248, 1002528, 781476, 780864, 773484, 766104, 731688, 740160, 2445432,
+    746184, 741756, 461664, 14694264, 1648692, 1026972, 12256152, 12194496, 12131580, 12072552,
+    12017028, 11977728, 37260792, 8825580, 6163548, 4688712, 1137456, 4884936, 2834868, 584940,
+    584328, 576948, 569568, 528348, 536796, 1911612, 547212, 547644, 553872, 1595580,
+    466020, 1069128, 392700, 392088, 384708, 377328, 343812, 343212, 1443876, 354288,
+    354720, 360948, 929604, 372744, 426276, 139349136, 4749468, 573072, 572460, 571884,
+    565512, 525300, 527976, 1751208, 492984, 1583784, 1601532, 1619280, 27547836, 1015308,
+    572496, 571884, 564504, 563928, 523716, 526392, 1801236, 536808, 456696, 1606500,
+    1624248, 18963396, 1020276, 578724, 578112, 570732, 563352, 528936, 531612, 1856436,
+    542028, 542460, 456948, 1648692, 14241768, 1044720, 584952, 584340, 576960, 569580,
+    528360, 536832, 1911636, 547248, 547680, 553908, 467568, 10630524, 1069164, 12573816,
+    12512160, 12449244, 12390216, 12334692, 12389124, 37260816, 8703696, 6027624, 4542636, 3398352,
+    870768, 2228220, 399948, 399336, 391956, 384576, 351060, 343680, 1507020, 359868,
+    360300, 366528, 372756, 741504, 439236, 139349064, 381240, 380628, 380052, 373680,
+    341748, 333900, 1290408, 441036, 962064, 979812, 997560, 1015308, 29140032, 380664,
+    380052, 372672, 372096, 340164, 332316, 1340436, 342732, 425484, 984780, 1002528,
+    1020276, 19751496, 386892, 386280, 378900, 371520, 345384, 337536, 1395636, 347952,
+    348384, 436104, 1026972, 1044720, 14510220, 393120, 392508, 385128, 377748, 344808,
+    342756, 1450836, 353172, 353604, 359832, 446724, 1069164, 10844400, 399348, 398736,
+    391356, 383976, 351036, 342180, 1506036, 358392, 358824, 365052, 371280, 457344,
+    8754036, 12501972, 12440316, 12377400, 12318372, 12082356, 12381360, 37260792, 9191508, 6263724,
+    4618200, 3456276, 2777952, 847248, 17606208, 9093048, 9043116, 7893432, 6408528, 5055408,
+    3890748, 700524, 4410612, 3548256, 2801352, 2197212, 1554984, 1363272, 535616, 535412,
+    535220, 524840, 524984, 522896, 1423044, 210792, 977832, 762060, 568716, 389484,
+    1004688, 376800, 376596, 374160, 365688, 365832, 363744, 1144692, 329056, 183900,
+    769800, 576456, 397224, 750300, 278384, 278180, 275744, 265028, 267080, 264992,
+    902448, 260336, 262388, 176448, 584196, 404964, 545724, 214268, 214064, 211628,
+    200912, 200720, 200540, 704904, 198876, 200928, 202980, 178716, 412704, 318876,
+    156444, 156240, 153804, 144996, 142560, 140136, 495360, 142432, 144484, 146536,
+    148588, 172668, 17606184, 9084924, 7875168, 6384288, 5032824, 3871404, 698268, 4382304,
+    3525060, 2783268, 2184240, 1547124, 535616, 1438104, 532976, 532784, 522404, 522548,
+    522692, 1413936, 206268, 968208, 752436, 559092, 379860, 376800, 1079520, 374160,
+    371724, 363252, 363396, 363540, 1137240, 325980, 179376, 760176, 566832, 387600,
+    278384, 825132, 275744, 273308, 262592, 264644, 264788, 896652, 257260, 259312,
+    171924, 574572, 395340, 214268, 620556, 211628, 209192, 198476, 198284, 200336,
+    700764, 195800, 197852, 199904, 174192, 403080, 156444, 393708, 153804, 151368,
+    142560, 140124, 139932, 492876, 139356, 141408, 143460, 145512, 168144, 17606184,
+    7852056, 6362832, 5013024, 3853260, 698268, 4360776, 3508644, 2771964, 2178048, 1546044,
+    535424, 532988, 1438092, 532592, 522212, 522356, 522500, 1406952, 206268, 967632,
+    751860, 558516, 379284, 376608, 374172, 1079508, 371532, 363060, 363204, 363348,
+    1131912, 325788, 179376, 759600, 566256, 387024, 278192, 275756, 825120, 273116,
+    262400, 264452, 264596, 892980, 257068, 259120, 171924, 573996, 394764, 214076,
+    211640, 620544, 209000, 198284, 198092, 200144, 698748, 195608, 197660, 199712,
+    174192, 402504, 156252, 153816, 393696, 151176, 142368, 139932, 139740, 492516,
+    139164, 141216, 143268, 145320, 168144, 17606184, 6490608, 5017260, 3826224, 679644,
+    4339248, 3435948, 2704380, 2115576, 1488684, 535232, 532796, 532592, 1438092, 522020,
+    522164, 522308, 1399968, 206268, 967056, 751284, 557940, 378708, 373968, 371532,
+    371328, 1138764, 360960, 361104, 361248, 1108884, 325596, 175524, 751320, 557976,
+    378744, 275552, 273116, 272912, 884376, 260300, 262352, 262496, 871608, 256876,
+    256480, 168072, 565716, 386484, 211436, 209000, 208796, 679800, 196184, 195992,
+    198044, 679032, 195416, 195020, 197072, 170340, 394224, 153612, 151176, 150972,
+    452952, 140268, 137832, 137640, 474456, 138972, 138576, 140628, 142680, 164292,
+    17606184, 5100828, 3819252, 652644, 4248900, 3394236, 2611500, 2027808, 1412184, 524852,
+    522416, 522212, 522020, 1400940, 510020, 510164, 1371948, 187404, 932640, 711072,
+    517728, 346776, 365496, 363060, 362856, 360960, 1054188, 350400, 350544, 1095948,
+    314892, 158604, 716904, 523560, 352608, 264632, 262196, 261992, 260096, 859056,
+    249740, 249884, 842628, 244264, 245776, 147300, 523596, 352644, 200516, 198080,
+    197876, 195980, 654480, 183380, 185432, 651708, 182804, 184316, 183920, 149568,
+    360384, 144600, 142164, 141960, 140064, 445332, 127452, 127260, 450372, 128592,
+    130104, 129708, 131760, 151800, 17606208, 3882828, 634656, 4203624, 3341076, 2606976,
+    1972116, 1353840, 524996, 522560, 522356, 522164, 510020, 1373532, 511416, 1357836,
+    189984, 936720, 719544, 520404, 338928, 365640, 363204, 363000, 361104, 350400,
+    1026780, 351796, 1079316, 316144, 161184, 725376, 526236, 344760, 266684, 264248,
+    264044, 262148, 249740, 784224, 252576, 841080, 246956, 248468, 151824, 532068,
+    350592, 200120, 197684, 197480, 195584, 183176, 638904, 186216, 634116, 183588,
+    185100, 186612, 150240, 350628, 141756, 139320, 139116, 137220, 127260, 427632,
+    125172, 432324, 126504, 128016, 129528, 129132, 141948, 17606232, 613428, 4200096,
+    3300912, 2558928, 1972704, 1303260, 521288, 521084, 520880, 520688, 508544, 509796,
+    1344936, 1356960, 192564, 940800, 723624, 528876, 341604, 363552, 363348, 363144,
+    361248, 350544, 351796, 999372, 1066860, 317396, 163764, 729456, 534708, 347436,
+    264596, 264392, 264188, 262292, 249884, 252576, 756816, 826104, 248208, 249720,
+    154404, 540540, 353268, 199940, 199736, 199532, 197636, 185228, 186216, 564072,
+    634224, 186280, 187792, 189304, 154764, 359100, 139128, 138924, 138720, 136824,
+    126864, 124968, 412056, 416388, 127288, 128800, 130312, 131824, 142620, 9827232,
+    1209228, 1256244, 1307148, 1361940, 1406736, 233748, 229224, 229212, 229212, 210348,
+    212928, 215508, 391908, 309240, 490068, 477576, 472860, 458496, 217380, 212856,
+    212844, 210564, 193644, 196224, 198804, 402780, 172344, 261252, 485460, 480744,
+    466380, 203604, 199080, 199068, 196788, 177588, 182112, 184692, 414948, 167952,
+    169944, 244368, 488628, 474264, 192420, 187896, 187884, 185604, 166404, 168648,
+    173172, 428412, 166152, 168144, 170136, 243036, 482148, 179976, 175452, 175440,
+    173160, 157812, 155532, 157776, 439296, 162420, 164412, 166404, 168396, 224280,
+    139348632, 9473088, 7054908, 5224632, 3326520, 9241776, 9178476, 9125820, 9077076, 8974092,
+    8968272, 9110292, 37260696, 1739472, 9488880, 7739532, 5943480, 4070856, 1102644, 1093020,
+    1092408, 1091808, 1057392, 1061472, 1065552, 3069252, 3079164, 478836, 2277000, 1624680,
+    1017576, 778260, 768636, 768024, 767424, 727872, 736344, 740424, 2287584, 2508180,
+    752016, 449316, 1642680, 1035576, 574164, 564540, 563928, 563328, 523776, 527112,
+    535584, 1690428, 1921908, 547176, 551736, 450900, 1053576, 388044, 378420, 377808,
+    377208, 345360, 339648, 342984, 1072908, 1312416, 358968, 363528, 368088, 417636,
+    139348728, 7264560, 5434284, 3536172, 1106868, 1097244, 1096632, 1096056, 1061640, 1065720,
+    1069800, 3068844, 505440, 20191668, 2277036, 1624716, 1017612, 9068256, 9004956, 8952300,
+    8898384, 8828232, 8818524, 8960544, 37260720, 6415932, 1387248, 7132884, 5336832, 3464208,
+    785508, 775884, 775272, 767892, 733452, 741924, 746004, 2350728, 752028, 2320080,
+    462276, 1666872, 1059768, 581412, 571788, 571176, 563796, 529356, 532692, 541164,
+    1753572, 547188, 1733808, 558984, 463860, 1077768, 395292, 385668, 385056, 377676,
+    350940, 345228, 348564, 1136052, 358980, 1124316, 370776, 375336, 430596, 139348824,
+    5643936, 3745824, 778968, 769344, 768732, 768156, 727944, 736416, 740496, 2295336,
+    482580, 2261484, 19727508, 1642464, 1035360, 785196, 775572, 774960, 767580, 733164,
+    741636, 745716, 2350536, 746880, 472464, 14559528, 1666908, 1059804, 8962200, 8898900,
+    8846244, 8792328, 8717004, 8682816, 8815836, 37260744, 6266184, 4644852, 1075200, 4730184,
+    2857560, 588660, 579036, 578424, 571044, 529824, 538272, 546744, 1816716, 552768,
+    558996, 1545708, 476820, 1101960, 402540, 392916, 392304, 384924, 351408, 350808,
+    354144, 1199196, 364560, 370788, 936216, 382584, 443556, 139348920, 3955476, 576216,
+    566592, 565980, 565404, 525192, 527868, 536340, 1706340, 467496, 1624716, 1642464,
+    19278756, 1053108, 582444, 572820, 572208, 564828, 530412, 533088, 541560, 1761540,
+    547584, 467748, 1666908, 14095368, 1077552, 588672, 579048, 578436, 571056, 529836,
+    538308, 546780, 1816740, 552804, 559032, 478368, 10475772, 1101996, 8983896, 8920596,
+    8867940, 8814024, 8738700, 8724252, 8693952, 37260768, 6121548, 4495104, 3348372, 808512,
+    2250912, 409788, 400164, 399552, 392172, 358656, 351276, 359724, 1262340, 370140,
+    376368, 382596, 748116, 456516, 139348848, 390504, 380880, 380268, 379692, 347760,
+    339912, 342588, 1095756, 442764, 1017612, 1035360, 1053108, 19692972, 396732, 387108,
+    386496, 379116, 352980, 345132, 347808, 1150956, 358224, 453384, 1059804, 1077552,
+    14467104, 402960, 393336, 392724, 385344, 352404, 350352, 353028, 1206156, 363444,
+    369672, 464004, 1101996, 10816692, 409188, 399564, 398952, 391572, 358632, 349776,
+    358248, 1261356, 368664, 374892, 381120, 474624, 8741736, 9353856, 9290556, 9237900,
+    9183984, 8928168, 9158292, 9189684, 37260744, 6244200, 4603716, 3446832, 2773548, 855900,
+    17606208, 9093048, 8981352, 8064216, 6527304, 5052120, 3851220, 2917236, 642696, 3295848,
+    2735172, 2146956, 1522836, 1014168, 382468, 379392, 379188, 370716, 370860, 368772,
+    369556, 1067004, 186144, 789024, 586272, 400560, 750468, 278832, 275756, 275552,
+    264836, 266888, 264800, 265584, 883536, 268420, 178692, 594012, 408300, 545892,
+    214716, 211640, 211436, 200720, 200528, 200348, 201132, 691104, 203968, 206020,
+    180960, 416040, 319044, 156892, 153816, 153612, 144804, 142368, 139944, 142636,
+    487392, 145472, 147524, 149576, 174912, 17606184, 9023160, 8045952, 6503064, 5029536,
+    3831876, 2897436, 640440, 3272652, 2717088, 2133984, 1514976, 382468, 1089000, 376956,
+    376752, 368280, 368424, 368568, 366480, 1059552, 181620, 779400, 576648, 390936,
+    278832, 825300, 273320, 273116, 262400, 264452, 264596, 262508, 877740, 265344,
+    174168, 584388, 398676, 214716, 620724, 209204, 209000, 198284, 198092, 200144,
+    198056, 686964, 200892, 202944, 176436, 406416, 156892, 393876, 151380, 151176,
+    142368, 139932, 139740, 139560, 484908, 142396, 144448, 146500, 170388, 17606160,
+    8080884, 6487644, 5008140, 3812136, 2880936, 638184, 3249456, 2699004, 2121012, 1507116,
+    379392, 376956, 1163832, 374316, 365844, 365988, 366132, 366276, 1052100, 177096,
+    769776, 567024, 381312, 275756, 273320, 900132, 270680, 259964, 262016, 262160,
+    262304, 871944, 262268, 169644, 574764, 389052, 211640, 209204, 695556, 206564,
+    195848, 195656, 197708, 197852, 682824, 197816, 199868, 171912, 396792, 153816,
+    151380, 468708, 148740, 139932, 137496, 137304, 139356, 482424, 139320, 141372,
+    143424, 165864, 17606160, 6467376, 4989528, 3795180, 2865636, 638184, 3233040, 2687700,
+    2114820, 1506036, 379200, 376764, 374328, 1163820, 365652, 365796, 365940, 366084,
+    1046772, 177096, 769200, 566448, 380736, 275564, 273128, 270692, 900120, 259772,
+    261824, 261968, 262112, 868272, 262076, 169644, 574188, 388476, 211448, 209012,
+    206576, 695544, 195656, 195464, 197516, 197660, 680808, 197624, 199676, 171912,
+    396216, 153624, 151188, 148752, 468696, 139740, 137304, 137112, 139164, 482064,
+    139128, 141180, 143232, 165864, 17606160, 5070252, 3787020, 2833836, 611184, 3191328,
+    2594820, 2027052, 1429536, 370728, 368292, 365856, 365652, 1079244, 355092, 355236,
+    355380, 1033836, 160176, 734784, 532032, 354600, 264644, 262208, 259772, 259568,
+    874800, 249212, 249356, 249500, 839292, 251372, 148872, 532068, 354636, 200528,
+    198092, 195656, 195452, 670224, 182852, 184904, 185048, 653484, 186920, 186524,
+    151140, 362376, 144612, 142176, 139740, 139536, 461076, 126924, 126732, 128784,
+    457980, 130656, 130260, 132312, 153372, 17606184, 3850596, 2831808, 594816, 3138168,
+    2590296, 1971360, 1371192, 370872, 368436, 366000, 365796, 355092, 1051836, 356488,
+    356632, 1017204, 162756, 743256, 534708, 346752, 266696, 264260, 261824, 261620,
+    249212, 799968, 252048, 252192, 837744, 254064, 153396, 540540, 352584, 200132,
+    197696, 195260, 195056, 182648, 654648, 185688, 185832, 635892, 187704, 189216,
+    151812, 352620, 141768, 139332, 136896, 136692, 126732, 443376, 124644, 126696,
+    439932, 128568, 130080, 129684, 143520, 17606208, 2875380, 576828, 3098004, 2542248,
+    1971948, 1320612, 368784, 368580, 366144, 365940, 355236, 356488, 1024428, 357884,
+    1004748, 165336, 747336, 543180, 349428, 264608, 264404, 261968, 261764, 249356,
+    252048, 772560, 253444, 822768, 255316, 155976, 549012, 355260, 199952, 199748,
+    197312, 197108, 184700, 185688, 579816, 188524, 636000, 190396, 191908, 156336,
+    361092, 139140, 138936, 136500, 136296, 126336, 124440, 427800, 127480, 423996,
+    129352, 130864, 132376, 144192, 17606232, 555600, 3070092, 2507196, 1929012, 1326312,
+    367948, 364872, 364668, 364464, 353760, 355012, 356264, 995832, 996216, 167916,
+    751416, 547260, 357900, 265392, 262316, 262112, 261908, 249500, 252192, 253444,
+    745152, 811968, 256568, 158556, 553092, 363732, 200736, 197660, 197456, 197252,
+    184844, 185832, 188524, 552408, 622680, 191648, 193160, 158916, 369564, 141832,
+    138756, 138552, 138348, 128388, 126492, 127480, 352968, 425760, 132044, 133556,
+    135068, 148716, 9827232, 1169592, 1230864, 1296024, 1356372, 195000, 190476, 185952,
+    185940, 169020, 171600, 174180, 176760, 378648, 269928, 485028, 480312, 465948,
+    187704, 183180, 178656, 178644, 159444, 163968, 166548, 169128, 394056, 168912,
+    253044, 488196, 473832, 183000, 178476, 173952, 173940, 154740, 156984, 161508,
+    164088, 410760, 167112, 169104, 251712, 481716, 177036, 172512, 167988, 167976,
+    152628, 150348, 152592, 157116, 426504, 163380, 165372, 167364, 232956, 139348800,
+    6983232, 5164620, 3266508, 6601296, 6543108, 6488808, 6445152, 6380112, 6318204, 6296472,
+    6405540, 37260744, 1300812, 7022220, 5203608, 3305496, 784152, 774528, 764904, 764292,
+    729852, 738324, 742404, 746484, 2271192, 2284188, 473184, 1685304, 1078200, 585240,
+    575616, 565992, 565380, 530940, 534276, 542748, 546828, 1677924, 1690920, 564216,
+    474768, 1096200, 399120, 389496, 379872, 379260, 352524, 346812, 350148, 358620,
+    1060404, 1073400, 376008, 380568, 441504, 139348896, 5374272, 3476160, 789024, 779400,
+    769776, 769164, 734748, 743220, 747300, 751380, 2271216, 483372, 14990592, 1685340,
+    1078236, 6427776, 6369588, 6315288, 6271632, 6201420, 6172344, 6146724, 6255792, 37260768,
+    4775028, 999132, 4596960, 2698848, 592488, 582864, 573240, 572628, 531408, 539856,
+    548328, 552408, 1741068, 564228, 1502820, 487728, 1120392, 406368, 396744, 387120,
+    386508, 352992, 352392, 355728, 364200, 1123548, 376020, 885300, 387816, 454464,
+    139348992, 3685812, 586272, 576648, 567024, 566412, 531996, 534672, 543144, 547224,
+    1685892, 478656, 1685340, 14526432, 1095984, 592500, 582876, 573252, 572640, 531420,
+    539892, 548364, 552444, 1741092, 564264, 489276, 10348740, 1120428, 6296808, 6238620,
+    6184320, 6140664, 6070452, 6036204, 6011016, 6111084, 37260792, 4625280, 3307140, 737628,
+    2092200, 413616, 403992, 394368, 393756, 360240, 352860, 361308, 369780, 1186692,
+    381600, 387828, 697200, 467424, 139348920, 400560, 390936, 381312, 380700, 354564,
+    346716, 349392, 357864, 1075308, 464292, 1078236, 1095984, 14871096, 406788, 397164,
+    387540, 386928, 353988, 351936, 354612, 363084, 1130508, 374904, 474912, 1120428,
+    10677996, 413016, 403392, 393768, 393156, 360216, 351360, 359832, 368304, 1185708,
+    380124, 386352, 485532, 8594688, 6457008, 6398820, 6344520, 6300864, 6050160, 6260484,
+    6255036, 6233736, 37260768, 4725180, 3401928, 2726196, 785016, 17606232, 9077856, 8966160,
+    7987260, 6673176, 5113416, 3825108, 2862516, 2093208, 509244, 2490636, 1902420, 1278300,
+    752232, 281524, 278448, 275372, 266888, 268940, 266852, 267636, 268420, 808704,
+    183216, 602484, 416772, 547656, 217408, 214332, 211256, 202772, 202580, 202400,
+    203184, 203968, 616272, 208712, 185484, 424512, 320808, 159584, 156508, 153432,
+    146856, 144420, 141996, 144688, 145472, 412560, 150216, 152268, 179436, 17606208,
+    9007968, 7968996, 6648936, 5090832, 3805764, 2842716, 2075064, 506988, 2472552, 1889448,
+    1270440, 281524, 827064, 276012, 272936, 264452, 266504, 266648, 264560, 265344,
+    802908, 178692, 592860, 407148, 217408, 622488, 211896, 208820, 200336, 200144,
+    202196, 200108, 200892, 612132, 205636, 180960, 414888, 159584, 395640, 154072,
+    150996, 144420, 141984, 141792, 141612, 142396, 410076, 147140, 149192, 174912,
+    17606184, 8003928, 6633516, 5069436, 3786024, 2826216, 2058108, 504732, 2454468, 1876476,
+    1262580, 278448, 276012, 901896, 270500, 262016, 264068, 264212, 264356, 262268,
+    797112, 174168, 583236, 397524, 214332, 211896, 697320, 206384, 197900, 197708,
+    199760, 199904, 197816, 607992, 202560, 176436, 405264, 156508, 154072, 470472,
+    148560, 141984, 139548, 139356, 141408, 139320, 407592, 144064, 146116, 170388,
+    17606160, 6661572, 5056860, 3767472, 2809320, 2044452, 502476, 2436384, 1863504, 1254720,
+    275372, 272936, 270500, 976728, 259580, 261632, 261776, 261920, 262064, 791316,
+    169644, 573612, 387900, 211256, 208820, 206384, 772152, 195464, 195272, 197324,
+    197468, 197612, 603852, 199484, 171912, 395640, 153432, 150996, 148560, 545304,
+    139548, 137112, 136920, 138972, 139116, 405108, 140988, 143040, 165864, 17606160,
+    5031828, 3744096, 2787600, 2024388, 494100, 2399784, 1832016, 1234500, 266900, 264464,
+    262028, 259592, 892140, 250928, 251072, 251216, 251360, 780036, 152724, 539196,
+    361764, 202784, 200348, 197912, 195476, 687564, 184568, 186620, 186764, 186908,
+    594228, 188780, 154992, 369504, 146868, 144432, 141996, 139560, 478416, 128640,
+    128448, 130500, 130644, 398724, 132516, 134568, 157224, 17606184, 3804828, 2784384,
+    2005164, 477732, 2395260, 1776324, 1176156, 268952, 266516, 264080, 261644, 250928,
+    817308, 253764, 253908, 254052, 778488, 157248, 547668, 359712, 202388, 199952,
+    197516, 195080, 184364, 671988, 187404, 187548, 187692, 576636, 191472, 155664,
+    359748, 144024, 141588, 139152, 136716, 128448, 460716, 126360, 128412, 128556,
+    380676, 132336, 131940, 147372, 17606208, 2827956, 1998348, 461364, 2347212, 1776912,
+    1125576, 266864, 266660, 264224, 261788, 251072, 253764, 789900, 255160, 255304,
+    763512, 159828, 556140, 362388, 202208, 202004, 199568, 197132, 186416, 187404,
+    597156, 190240, 190384, 576744, 194164, 160188, 368220, 141396, 141192, 138756,
+    136320, 128052, 126156, 445140, 129196, 129340, 364740, 133120, 134632, 148044,
+    17606232, 2031636, 443376, 2312160, 1733976, 1131276, 267648, 264572, 264368, 261932,
+    251216, 253908, 255160, 762492, 256556, 752712, 162408, 560220, 370860, 202992,
+    199916, 199712, 197276, 186560, 187548, 190240, 569748, 191636, 563424, 195416,
+    162768, 376692, 144088, 141012, 140808, 138372, 130104, 128208, 129196, 370308,
+    132032, 366504, 135812, 137324, 152568, 17606256, 419904, 2284212, 1698888, 1088304,
+    266812, 263736, 260660, 260456, 249740, 252432, 253684, 254936, 739920, 744252,
+    164988, 564300, 374940, 203776, 200700, 197624, 197420, 186704, 187692, 190384,
+    191636, 548364, 552696, 196668, 165348, 380772, 144872, 141796, 138720, 138516,
+    130248, 128352, 129340, 132032, 348924, 353256, 137064, 138576, 155148, 9827256,
+    952932, 1018092, 1078440, 186600, 182076, 177552, 173028, 156096, 160620, 163200,
+    165780, 168360, 308376, 270468, 507492, 493128, 185136, 180612, 176088, 171564,
+    154632, 156876, 161400, 163980, 166560, 325080, 174480, 269136, 501012, 182412,
+    177888, 173364, 168840, 155760, 153480, 155724, 160248, 162828, 340824, 170748,
+    172740, 250380, 139349064, 4580856, 2682744, 4958148, 4905072, 4855884, 4810584, 4750632,
+    4726668, 4673760, 4636116, 4773948, 37260816, 1007832, 4619844, 2721732, 602472, 592848,
+    583224, 573600, 539148, 547596, 556068, 560148, 564228, 1496532, 1509528, 505152,
+    1153512, 416352, 406728, 397104, 387480, 360732, 360132, 363468, 371940, 376020,
+    879012, 892008, 397800, 471888, 139349160, 2892396, 602484, 592860, 583236, 573612,
+    539160, 547632, 556104, 560184, 564264, 1496556, 506700, 10371624, 1153548, 4784628,
+    4731552, 4682364, 4637064, 4577112, 4547976, 4527900, 4486368, 4624200, 37260840, 3313848,
+    746328, 2115084, 423600, 413976, 404352, 394728, 367980, 360600, 369048, 377520,
+    381600, 942156, 397812, 703908, 484848, 139349088, 416772, 407148, 397524, 387900,
+    361728, 359676, 362352, 370824, 374904, 885972, 492336, 1153548, 10700880, 423000,
+    413376, 403752, 394128, 367956, 359100, 367572, 376044, 380124, 941172, 396336,
+    502956, 8617572, 4809204, 4756128, 4706940, 4661640, 4421196, 4636632, 4611384, 4595196,
+    4724028, 37260816, 3408636, 2732904, 793716, 17606256, 9062664, 8950968, 7972068, 6596220,
+    5239848, 3853836, 2828772, 2038488, 1576884, 391668, 1657884, 1033764, 549420, 220100,
+    217024, 213948, 202592, 204632, 204452, 205236, 206020, 208712, 541440, 190008,
+    432984, 322572, 162276, 159200, 156124, 146676, 146472, 144048, 146740, 147524,
+    150216, 337728, 154960, 183960, 17606232, 8992776, 7953804, 6571980, 5217264, 3834492,
+    2808972, 2020344, 1560396, 389412, 1644912, 1025904, 220100, 624252, 214588, 211512,
+    200156, 202196, 204248, 202160, 202944, 205636, 537300, 185484, 423360, 162276,
+    397404, 156764, 153688, 144240, 144036, 143844, 143664, 144448, 147140, 335244,
+    151884, 179436, 17606208, 7988736, 6556560, 5195868, 3814752, 2792472, 2003388, 1545096,
+    387156, 1631940, 1018044, 217024, 214588, 699084, 209076, 197720, 199760, 201812,
+    201956, 199868, 202560, 533160, 180960, 413736, 159200, 156764, 472236, 151252,
+    141804, 141600, 141408, 143460, 141372, 144064, 332760, 148808, 174912, 17606184,
+    6584616, 5183292, 3796200, 2775576, 1989732, 1530984, 384900, 1618968, 1010184, 213948,
+    211512, 209076, 773916, 195284, 197324, 199376, 199520, 199664, 199484, 529020,
+    176436, 404112, 156124, 153688, 151252, 547068, 139368, 139164, 138972, 141024,
+    141168, 140988, 330276, 145732, 170388, 17606160, 5196864, 3778860, 2752260, 1968072,
+    1512564, 374268, 1580700, 983184, 202592, 200156, 197720, 195284, 764172, 184376,
+    186428, 186572, 186716, 188768, 517272, 154992, 368928, 146676, 144240, 141804,
+    139368, 555024, 128448, 128256, 130308, 130452, 132504, 321768, 134376, 157224,
+    17606184, 3766404, 2741460, 1958928, 1505076, 376524, 1581288, 981120, 204644, 202208,
+    199772, 197336, 184388, 689328, 189120, 189264, 189408, 191460, 517380, 159516,
+    366876, 146280, 143844, 141408, 138972, 128472, 478056, 128076, 130128, 130272,
+    132324, 321420, 134196, 151224, 17606208, 2782188, 1950924, 1488696, 360156, 1581876,
+    930540, 204464, 204260, 201824, 199388, 186440, 189120, 614496, 191956, 192100,
+    194152, 517488, 164040, 375348, 143652, 143448, 141012, 138576, 128076, 127872,
+    462480, 130912, 131056, 133108, 305484, 136888, 151896, 17606232, 1984212, 1477092,
+    343788, 1538940, 936240, 205248, 202172, 201968, 199532, 186584, 189264, 191956,
+    587088, 193352, 195404, 504168, 166620, 383820, 146344, 143268, 143064, 140628,
+    130128, 129924, 130912, 387648, 133748, 135800, 307248, 139580, 156420, 17606256,
+    1519272, 323556, 1503852, 893268, 206032, 202956, 199880, 199676, 186728, 189408,
+    192100, 193352, 565704, 196656, 493440, 169200, 387900, 147128, 144052, 140976,
+    140772, 130272, 130068, 131056, 133748, 366264, 137052, 294000, 140832, 159000,
+    17606280, 325812, 1509552, 898968, 208724, 205648, 202572, 199496, 188780, 191460,
+    194152, 195404, 196656, 490872, 495204, 173724, 396372, 149820, 146744, 143668,
+    140592, 132324, 132120, 133108, 135800, 137052, 291432, 295764, 143524, 163524,
+    9827280, 740160, 800508, 190512, 185988, 181464, 176940, 155496, 160008, 164532,
+    167112, 169692, 174216, 239400, 286560, 520308, 187788, 183264, 178740, 174216,
+    156624, 156612, 158856, 163380, 165960, 170484, 255144, 178116, 267804, 139349328,
+    2098980, 3612936, 3564972, 3520896, 3480708, 3419112, 3400236, 3385272, 3341364, 3307572,
+    3313272, 37260888, 755028, 2137968, 433584, 423960, 414336, 404712, 368952, 368340,
+    376788, 385260, 389340, 397812, 697620, 710616, 502272, 139349256, 432984, 423360,
+    413736, 404112, 368928, 366840, 375312, 383784, 387864, 396336, 696636, 520380,
+    8640456, 3619872, 3571908, 3527832, 3487644, 3245556, 3471252, 3451116, 3440040, 3402360,
+    3408060, 37260864, 2739612, 802416, 17606280, 9047472, 8935776, 7956876, 6581028, 5162892,
+    3951108, 2834652, 1997112, 1522164, 1151076, 289968, 789228, 324336, 164968, 161892,
+    158816, 149368, 146292, 146100, 148792, 149576, 152268, 154960, 262896, 188484,
+    17606256, 8977584, 7938612, 6556788, 5140308, 3931764, 2814852, 1978968, 1505676, 1136244,
+    287712, 781368, 164968, 399168, 159456, 156380, 146932, 143856, 145896, 145716,
+    146500, 149192, 151884, 260412, 183960, 17606232, 7973544, 6541368, 5118912, 3912024,
+    2798352, 1962012, 1490376, 1122600, 285456, 773508, 161892, 159456, 474000, 153944,
+    144496, 141420, 143460, 145512, 143424, 146116, 148808, 257928, 179436, 17606208,
+    6569424, 5106336, 3893472, 2781456, 1948356, 1476264, 1110144, 283200, 765648, 158816,
+    156380, 153944, 548832, 142060, 138984, 141024, 143076, 143220, 143040, 145732,
+    255444, 174912, 17606184, 5119908, 3876132, 2758140, 1926696, 1457844, 1091268, 272568,
+    738648, 149368, 146932, 144496, 142060, 556788, 128268, 130308, 132360, 132504,
+    134556, 134376, 246936, 161748, 17606184, 3892560, 2753376, 1915956, 1448760, 1085424,
+    272568, 729804, 146088, 143652, 141216, 138780, 128280, 554664, 127884, 129936,
+    130080, 132132, 134184, 244464, 151224, 17606208, 2743764, 1908000, 1442460, 1080780,
+    274824, 735504, 145908, 145704, 143268, 140832, 130332, 127896, 479820, 132628,
+    132772, 134824, 136876, 246228, 155748, 17606232, 1938444, 1429668, 1067244, 258456,
+    741204, 148600, 145524, 145320, 142884, 132384, 129948, 132628, 404988, 135464,
+    137516, 139568, 247992, 160272, 17606256, 1471848, 1056900, 239844, 698232, 149384,
+    146308, 143232, 143028, 132528, 130092, 132772, 135464, 383604, 138768, 140820,
+    234744, 162852, 17606280, 1058664, 242100, 703932, 152076, 149000, 145924, 142848,
+    134580, 132144, 134824, 137516, 138768, 308772, 143512, 236508, 167376, 17606304,
+    244356, 709632, 154768, 151692, 148616, 145540, 134400, 134196, 136876, 139568,
+    140820, 143512, 233940, 238272, 171900, 9827304, 522576, 193164, 188640, 184116,
+    179592, 162000, 157476, 161988, 166512, 169092, 173616, 178140, 169464, 285228,
+    139349424, 2913924, 2871072, 2832108, 2797032, 2560056, 2784108, 2774232, 2768268, 2728212,
+    2733912, 2739612, 37260912, 811116, 17606304, 9070704, 8963508, 7987920, 6561300, 5202420,
+    3928872, 2947764, 2044584, 1527876, 1151076, 921816, 268656, 17606280, 9008160, 7970844,
+    6537060, 5179836, 3909528, 2927964, 2026440, 1511388, 1136244, 908640, 266400, 17606256,
+    8005776, 6521640, 5158440, 3889788, 2911464, 2009484, 1496088, 1122600, 896652, 264144,
+    17606232, 6549696, 5145864, 3871236, 2894568, 1995828, 1481976, 1110144, 885852, 261888,
+    17606208, 5104704, 3799164, 2816520, 1919436, 1408824, 1036536, 813900, 186720, 17606184,
+    3890436, 2886600, 1983540, 1474584, 1105536, 882444, 267624, 17606184, 2896152, 1981620,
+    1466688, 1099296, 879444, 267624, 17606208, 1974852, 1461576, 1095840, 877644, 269880,
+    17606232, 1500912, 1084308, 865368, 251268, 17606256, 1086072, 867132, 253524, 17606280,
+    868896, 255780, 17606304, 258036, 9827304,
+};
+
+} // namespace poker::detail
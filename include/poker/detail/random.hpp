@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace poker::detail {
+
+// A uniformly random number in [0, bound), for the small bounds of shuffles.
+//
+// Generators that produce uniform 32- or 64-bit words use Lemire's
+// multiply-and-reject method, which needs one random number and one
+// multiplication almost every time, and rejects a handful of words out of
+// every 2^32 to stay exactly uniform. Other generators go through the
+// standard distribution.
+// EXPECTS: 0 < bound <= 2^32 - 1
+template<class URBG>
+auto uniform_index(URBG& g, std::uint32_t bound) -> std::uint32_t {
+    using result_type = typename URBG::result_type;
+    constexpr auto full_words = URBG::min() == 0
+        && (URBG::max() == std::numeric_limits<std::uint32_t>::max() || URBG::max() == std::numeric_limits<std::uint64_t>::max());
+
+    if constexpr (full_words && sizeof(result_type) >= sizeof(std::uint32_t)) {
+        auto m = std::uint64_t{static_cast<std::uint32_t>(g())} * bound;
+        auto low = static_cast<std::uint32_t>(m);
+        if (low < bound) {
+            const auto threshold = static_cast<std::uint32_t>(-bound) % bound;
+            while (low < threshold) {
+                m = std::uint64_t{static_cast<std::uint32_t>(g())} * bound;
+                low = static_cast<std::uint32_t>(m);
+            }
+        }
+        return static_cast<std::uint32_t>(m >> 32);
+    } else {
+        return std::uniform_int_distribution<std::uint32_t>{0, bound - 1}(g);
+    }
+}
+
+} // namespace poker::detail
@@ -1,20 +1,17 @@
 #pragma once
 
-#include <algorithm>
 #include <cassert>
+#include <cstdint>
 
 #include <poker/seat_index.hpp>
+#include <poker/seat_set.hpp>
 #include "poker/detail/utility.hpp"
 
 namespace poker::detail {
 
-class round {
+// What does not depend on the number of seats, shared by every basic_round.
+class round_base {
 public:
-    //
-    // Constants
-    //
-    static constexpr auto num_seats = std::size_t{9};
-
     //
     // Types
     //
@@ -24,80 +21,126 @@ public:
         aggressive = 1 << 2
     };
     POKER_DETAIL_DEFINE_FRIEND_FLAG_OPERATIONS(action)
+};
+
+template<std::size_t N>
+class basic_round : public round_base {
+public:
+    //
+    // Constants
+    //
+    static constexpr auto num_seats = N;
+
+    //
+    // Types
+    //
+
+    // What an action changes, to take it back.
+    struct undo_type {
+        std::uint8_t player_to_act         = 0;
+        std::uint8_t last_aggressive_actor = 0;
+        bool         contested             = false;
+        bool         first_action          = true;
+    };
 
     //
     // Constructors
     //
-    round() = default;
-    round(const std::array<bool, num_seats>& active_players, seat_index first_to_act) noexcept;
+    basic_round() = default;
+    basic_round(seat_set active_players, seat_index first_to_act) noexcept;
 
     //
     // Observers
     //
-    auto active_players()        const noexcept -> const std::array<bool,num_seats>&;
+    auto active_players()        const noexcept -> seat_set;
     auto player_to_act()         const noexcept -> seat_index;
     auto last_aggressive_actor() const noexcept -> seat_index;
     auto num_active_players()    const noexcept -> std::size_t;
     auto in_progress()           const noexcept -> bool;
+    auto undo_state()            const noexcept -> undo_type;
 
     //
     // Modifiers
     //
     void action_taken(action) noexcept;
+    // Takes back the actions since 'undo_state()' returned 'u'.
+    void undo(const undo_type& u) noexcept;
 
     // Used for testing betting_round.
-    friend auto operator==(const round&, const round&) noexcept -> bool;
+    friend auto operator==(const basic_round& x, const basic_round& y) noexcept -> bool {
+        return x._active_players        == y._active_players
+            && x._player_to_act         == y._player_to_act
+            && x._last_aggressive_actor == y._last_aggressive_actor
+            && x._contested             == y._contested;
+    }
 
 private:
     void increment_player() noexcept;
 
 private:
-    std::array<bool,num_seats> _active_players     = {};
-    seat_index                   _player_to_act;
-    seat_index                   _last_aggressive_actor;
+    seat_set                     _active_players;
+    seat_index                   _player_to_act      = 0;
+    seat_index                   _last_aggressive_actor = 0;
     bool                         _contested          = false;      // passive or aggressive action was taken this round
     bool                         _first_action       = true;
-    std::size_t                  _num_active_players = 0;
 };
 
-inline auto operator==(const round& x, const round& y) noexcept -> bool {
-    return x._active_players        == y._active_players
-        && x._player_to_act         == y._player_to_act
-        && x._last_aggressive_actor == y._last_aggressive_actor
-        && x._contested             == y._contested
-        && x._num_active_players    == y._num_active_players;
-}
-
-inline round::round(const std::array<bool, num_seats>& active_players, seat_index first_to_act) noexcept
+template<std::size_t N>
+inline basic_round<N>::basic_round(seat_set active_players, seat_index first_to_act) noexcept
     : _active_players{active_players}
     , _player_to_act{first_to_act}
     , _last_aggressive_actor{first_to_act}
-    , _num_active_players{static_cast<std::size_t>(std::count(std::cbegin(active_players), std::cend(active_players), true))}
 {
     assert(first_to_act < num_seats);
 }
 
-inline auto round::active_players() const noexcept -> const std::array<bool,num_seats>& {
+template<std::size_t N>
+inline auto basic_round<N>::active_players() const noexcept -> seat_set {
     return _active_players;
 }
 
-inline auto round::player_to_act() const noexcept -> seat_index {
+template<std::size_t N>
+inline auto basic_round<N>::player_to_act() const noexcept -> seat_index {
     return _player_to_act;
 }
 
-inline auto round::last_aggressive_actor() const noexcept -> seat_index {
+template<std::size_t N>
+inline auto basic_round<N>::last_aggressive_actor() const noexcept -> seat_index {
     return _last_aggressive_actor;
 }
 
-inline auto round::num_active_players() const noexcept -> std::size_t {
-    return _num_active_players;
+template<std::size_t N>
+inline auto basic_round<N>::num_active_players() const noexcept -> std::size_t {
+    return _active_players.size();
+}
+
+template<std::size_t N>
+inline auto basic_round<N>::in_progress() const noexcept -> bool {
+    return (_contested || num_active_players() > 1) && (_first_action || _player_to_act != _last_aggressive_actor);
 }
 
-inline auto round::in_progress() const noexcept -> bool {
-    return (_contested || _num_active_players > 1) && (_first_action || _player_to_act != _last_aggressive_actor);
+template<std::size_t N>
+inline auto basic_round<N>::undo_state() const noexcept -> undo_type {
+    auto u = undo_type{};
+    u.player_to_act = static_cast<std::uint8_t>(_player_to_act);
+    u.last_aggressive_actor = static_cast<std::uint8_t>(_last_aggressive_actor);
+    u.contested = _contested;
+    u.first_action = _first_action;
+    return u;
 }
 
-inline void round::action_taken(action a) noexcept {
+template<std::size_t N>
+inline void basic_round<N>::undo(const undo_type& u) noexcept {
+    // Only the player to act can have left.
+    _active_players.insert(u.player_to_act);
+    _player_to_act = u.player_to_act;
+    _last_aggressive_actor = u.last_aggressive_actor;
+    _contested = u.contested;
+    _first_action = u.first_action;
+}
+
+template<std::size_t N>
+inline void basic_round<N>::action_taken(action a) noexcept {
     assert(in_progress());
     assert(!(static_cast<bool>(a & action::passive) && static_cast<bool>(a & action::aggressive)));
     if (_first_action) _first_action = false;
@@ -109,18 +152,20 @@ inline void round::action_taken(action a) noexcept {
         _contested = true;
     }
     if (static_cast<bool>(a & action::leave)) {
-        _active_players[_player_to_act] = false;
-        --_num_active_players;
+        _active_players.erase(_player_to_act);
     }
     increment_player();
 }
 
-inline void round::increment_player() noexcept {
-    do {
-        ++_player_to_act;
-        if (_player_to_act == num_seats) _player_to_act = 0;
-        if (_player_to_act == _last_aggressive_actor) break;
-    } while (!_active_players[_player_to_act]);
+template<std::size_t N>
+inline void basic_round<N>::increment_player() noexcept {
+    // The round ends when it gets back to the last aggressive actor, even if
+    // that player has left since.
+    auto stops = _active_players;
+    stops.insert(_last_aggressive_actor);
+    _player_to_act = stops.next_or_wrap(_player_to_act);
 }
 
+using round = basic_round<9>;
+
 } // namespace poker::detail
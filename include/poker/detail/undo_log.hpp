@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "poker/detail/error.hpp"
+
+namespace poker::detail {
+
+// The last 'depth()' records pushed, up to 'Capacity', in place. Pushing onto
+// a full log forgets its oldest record. A depth of 0 records nothing.
+template<class T, std::size_t Capacity>
+class undo_log {
+public:
+    static constexpr auto capacity = Capacity;
+
+    auto depth() const noexcept -> std::size_t { return _depth; }
+    auto size()  const noexcept -> std::size_t { return _size; }
+    auto empty() const noexcept -> bool        { return _size == 0; }
+
+    // Forgets every record.
+    void set_depth(std::size_t depth) POKER_NOEXCEPT {
+        POKER_DETAIL_ASSERT(depth <= Capacity, "Undo depth must not exceed the capacity");
+        _depth = depth;
+        clear();
+    }
+
+    void clear() noexcept {
+        _size = 0;
+        _next = 0;
+    }
+
+    void push(const T& record) noexcept {
+        if (_depth == 0) return;
+        _records[_next] = record;
+        _next = _next + 1 == _depth ? 0 : _next + 1;
+        if (_size < _depth) ++_size;
+    }
+
+    auto top() const POKER_NOEXCEPT -> const T& {
+        POKER_DETAIL_ASSERT(!empty(), "Undo log must not be empty");
+        return _records[_next == 0 ? _depth - 1 : _next - 1];
+    }
+
+    auto pop() POKER_NOEXCEPT -> T {
+        POKER_DETAIL_ASSERT(!empty(), "Undo log must not be empty");
+        _next = _next == 0 ? _depth - 1 : _next - 1;
+        --_size;
+        return _records[_next];
+    }
+
+private:
+    std::array<T, Capacity> _records = {};
+    std::size_t _depth = 0;
+    std::size_t _size = 0;
+    std::size_t _next = 0; // Where the next record goes.
+};
+
+} // namespace poker::detail
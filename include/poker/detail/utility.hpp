@@ -55,4 +55,15 @@ struct range_value<T[N]> {
 template<typename R>
 using range_value_t = typename range_value<R>::type;
 
+template<typename T>
+using remove_cvref_t = std::remove_cv_t<std::remove_reference_t<T>>;
+
+// Keeps overloads taking a random number generator from also matching
+// things that cannot generate numbers, such as seat indices, and the
+// generators given in 'Excluded'.
+template<typename URBG, typename... Excluded>
+using enable_if_urbg_t = std::enable_if_t<
+    std::is_invocable_v<remove_cvref_t<URBG>&> && (!std::is_same_v<remove_cvref_t<URBG>, Excluded> && ...)
+>;
+
 } // namespace poker::detail
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <vector>
+
+#include <poker/table.hpp>
+#include <poker/xoshiro256.hpp>
+#include "poker/detail/error.hpp"
+#include "poker/detail/parallel.hpp"
+#include "poker/detail/span.hpp"
+
+namespace poker {
+
+// seating[i] is the seat of player i.
+using seating = std::vector<seat_index>;
+
+// The cyclic rotations of 'num_players' players over seats [0, num_players),
+// so that every player gets every seat once.
+inline auto rotations(std::size_t num_players) -> std::vector<seating> {
+    auto result = std::vector<seating>(num_players, seating(num_players));
+    for (auto r = std::size_t{0}; r < num_players; ++r) {
+        for (auto i = std::size_t{0}; i < num_players; ++i) {
+            result[r][i] = static_cast<seat_index>((i + r) % num_players);
+        }
+    }
+    return result;
+}
+
+struct duplicate_options {
+    poker::forced_bets forced_bets = {};
+    chips starting_stack = 0;
+    seat_index button = 0;
+    poker::all_in_settlement all_in_settlement = poker::all_in_settlement::runout;
+    std::uint64_t seed = 0;
+    unsigned num_threads = 0; // 0 means all cores
+};
+
+// Winnings per player, summed over the seatings of every deal.
+class duplicate_results {
+public:
+    duplicate_results(std::size_t num_deals, std::size_t num_players)
+        : _num_players{num_players}
+        , _winnings(num_deals * num_players, 0.0)
+    {
+    }
+
+    auto num_deals()   const noexcept -> std::size_t { return _winnings.size() / _num_players; }
+    auto num_players() const noexcept -> std::size_t { return _num_players; }
+
+    auto deal(std::size_t d) const noexcept -> span<const double> {
+        return span<const double>(_winnings).subspan(d * _num_players, _num_players);
+    }
+
+    auto deal(std::size_t d) noexcept -> span<double> {
+        return span<double>(_winnings).subspan(d * _num_players, _num_players);
+    }
+
+    auto total(std::size_t player) const noexcept -> double {
+        auto sum = 0.0;
+        for (auto d = std::size_t{0}; d < num_deals(); ++d) sum += deal(d)[player];
+        return sum;
+    }
+
+private:
+    std::size_t _num_players;
+    std::vector<double> _winnings;
+};
+
+// Duplicate poker: every deal is shuffled once and then played once per
+// seating, with the same cards falling on the same seats, so the players
+// swap the cards they were dealt and most of the luck cancels out. The
+// (deal, seating) pairs are played in parallel, each worker thread reseating
+// one basic_table<N, EventSink> of its own for every pair, by
+// 'play_hand(table&, deal, seating_index)', which must take the hand to its
+// end. Winnings include the fractional chips of all-in equity settlement.
+// What 'play_hand' throws is rethrown to the caller.
+template<std::size_t N = 9, class EventSink = null_event_sink, class PlayHand>
+auto play_duplicate(std::size_t num_deals, span<const seating> seatings, PlayHand&& play_hand, const duplicate_options& options)
+    -> duplicate_results
+{
+    using table_type = basic_table<N, EventSink>;
+
+    POKER_DETAIL_ASSERT(!seatings.empty(), "There must be at least one seating");
+    const auto num_players = seatings[0].size();
+    const auto num_seatings = static_cast<std::size_t>(seatings.size());
+    POKER_DETAIL_ASSERT(num_players >= 2, "There must be at least 2 players");
+    POKER_DETAIL_ASSERT(std::all_of(seatings.begin(), seatings.end(), [&] (const seating& seats) {
+        return seats.size() == num_players;
+    }), "Every seating must seat every player");
+    POKER_DETAIL_ASSERT(std::all_of(seatings.begin(), seatings.end(), [] (const seating& seats) {
+        return std::all_of(seats.begin(), seats.end(), [] (seat_index s) { return s < N; });
+    }), "Seats must be valid");
+
+    auto results = duplicate_results{num_deals, num_players};
+    // Decks are shuffled a batch at a time, each from its own stream, so that
+    // the deals do not depend on the number of threads.
+    constexpr auto batch_size = std::size_t{256};
+    auto decks = std::vector<deck>(batch_size);
+    auto winnings = std::vector<double>(batch_size * num_seatings * num_players);
+    const auto threads = detail::num_threads(options.num_threads);
+    // One table per worker, kept across batches along with its equity cache.
+    auto tables = std::vector<std::optional<table_type>>(threads);
+    auto errors = std::vector<std::exception_ptr>(threads);
+    for (auto first_deal = std::size_t{0}; first_deal < num_deals; first_deal += batch_size) {
+        const auto batch = std::min(batch_size, num_deals - first_deal);
+        for (auto i = std::size_t{0}; i < batch; ++i) {
+            decks[i] = deck{xoshiro256{options.seed, first_deal + i}};
+        }
+        detail::parallel_for(batch * num_seatings, threads, [&] (std::size_t chunk, std::size_t first, std::size_t last) {
+            try {
+                auto& t = tables[chunk];
+                if (!t) {
+                    t.emplace(options.forced_bets);
+                    t->set_all_in_settlement(options.all_in_settlement);
+                }
+                for (auto task = first; task < last; ++task) {
+                    const auto i = task / num_seatings;
+                    const auto& seats = seatings[task % num_seatings];
+                    for (auto s = seat_index{0}; s < N; ++s) {
+                        if (t->seats().occupancy()[s]) t->stand_up(s);
+                    }
+                    for (auto s : seats) t->sit_down(s, options.starting_stack);
+                    t->start_hand(decks[i], options.button);
+                    play_hand(*t, first_deal + i, task % num_seatings);
+                    POKER_DETAIL_ASSERT(!t->hand_in_progress(), "The hand must be played to its end");
+                    for (auto player = std::size_t{0}; player < num_players; ++player) {
+                        const auto s = seats[player];
+                        const auto stack = t->seats().occupancy()[s] ? t->seats()[s].total_chips() : chips{0};
+                        winnings[task * num_players + player] = stack - options.starting_stack + t->fractional_chips()[s];
+                    }
+                }
+            } catch (...) {
+                // Rethrown on the calling thread: escaping a worker would terminate.
+                errors[chunk] = std::current_exception();
+            }
+        });
+        for (const auto& e : errors) {
+            if (e) std::rethrow_exception(e);
+        }
+        // Summed in seating order for reproducible results.
+        for (auto i = std::size_t{0}; i < batch; ++i) {
+            auto deal = results.deal(first_deal + i);
+            for (auto seating_index = std::size_t{0}; seating_index < num_seatings; ++seating_index) {
+                for (auto player = std::size_t{0}; player < num_players; ++player) {
+                    deal[player] += winnings[(i * num_seatings + seating_index) * num_players + player];
+                }
+            }
+        }
+    }
+    return results;
+}
+
+} // namespace poker
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <poker/card.hpp>
+#include <poker/player.hpp>
+#include <poker/seat_index.hpp>
+#include "poker/detail/error.hpp"
+#include "poker/detail/span.hpp"
+
+namespace poker {
+
+enum class hand_event_type : unsigned char {
+    hand_started,          // seat: the button
+    ante_posted,           // seat, amount
+    small_blind_posted,    // seat, amount
+    big_blind_posted,      // seat, amount
+    hole_cards_dealt,      // seat, cards
+    fold,                  // seat
+    check,                 // seat
+    call,                  // seat, amount: the bet after calling
+    bet,                   // seat, amount: the bet
+    raise,                 // seat, amount: the bet raised to
+    action_undone,         // seat: who acts again
+    community_cards_dealt, // cards
+    pot_collected,         // pot, amount: the size of the pot, players: who can win it
+    pot_awarded,           // pot, seat, amount
+    hand_ended,
+    player_sat_down,       // seat, amount: the buy-in
+    player_stood_up        // seat
+};
+
+// What happened at a table, in the order it happened, in 16 bytes. Which
+// fields are set depends on the type; the others are zero.
+struct hand_event {
+    hand_event_type type = hand_event_type::hand_started;
+    std::uint8_t seat = 0;
+    std::uint8_t pot = 0;            // Index of the pot, the main pot being 0.
+    std::uint8_t num_cards = 0;
+    std::array<card, 3> cards = {};  // The first 'num_cards'.
+    std::uint16_t players = 0;       // Seat mask.
+    chips amount = 0;
+
+    auto dealt_cards() const noexcept -> span<const card> {
+        return span<const card>(cards).first(num_cards);
+    }
+};
+
+static_assert(sizeof(hand_event) == 16);
+
+// The default sink of dealer and table, which drops every event. Dealers
+// and tables with it emit no code for events at all.
+struct null_event_sink {
+    constexpr void operator()(const hand_event&) const noexcept {}
+};
+
+// A sink keeping the events in place, to be drained between calls to the
+// table; a hand emits a few dozen.
+template<std::size_t Capacity = 256>
+class hand_event_log {
+public:
+    //
+    // Constants
+    //
+    static constexpr auto capacity = Capacity;
+
+    //
+    // Observers
+    //
+    auto events() const noexcept -> span<const hand_event> {
+        return span<const hand_event>(_events).first(_size);
+    }
+
+    auto size() const noexcept -> std::size_t {
+        return _size;
+    }
+
+    //
+    // Modifiers
+    //
+    void operator()(const hand_event& e) POKER_NOEXCEPT {
+        POKER_DETAIL_ASSERT(_size < Capacity, "Event log must not overflow");
+        _events[_size++] = e;
+    }
+
+    void clear() noexcept {
+        _size = 0;
+    }
+
+private:
+    std::array<hand_event, Capacity> _events;
+    std::size_t _size = 0;
+};
+
+} // namespace poker
@@ -0,0 +1,334 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <poker/card_set.hpp>
+#include <poker/community_cards.hpp>
+#include <poker/hole_cards.hpp>
+#include "poker/detail/bits.hpp"
+#include "poker/detail/error.hpp"
+#include "poker/detail/span.hpp"
+
+namespace poker::detail {
+
+constexpr auto binomial(std::uint64_t n, std::uint64_t k) noexcept -> std::uint64_t {
+    if (k > n) return 0;
+    if (k > n - k) k = n - k;
+    auto result = std::uint64_t{1};
+    for (auto i = std::uint64_t{1}; i <= k; ++i) {
+        result = result * (n - k + i) / i;
+    }
+    return result;
+}
+
+// Colexicographic rank of a set of 'k' positions given as a bit mask.
+inline auto colex_rank(std::uint32_t positions) noexcept -> std::uint64_t {
+    auto rank = std::uint64_t{0};
+    for (auto i = std::uint64_t{1}; positions != 0; ++i, positions &= positions - 1) {
+        rank += binomial(static_cast<std::uint64_t>(countr_zero(positions)), i);
+    }
+    return rank;
+}
+
+inline auto colex_unrank(std::uint64_t rank, int k) noexcept -> std::uint32_t {
+    auto positions = std::uint32_t{0};
+    for (; k > 0; --k) {
+        auto p = k - 1;
+        while (binomial(static_cast<std::uint64_t>(p + 1), static_cast<std::uint64_t>(k)) <= rank) ++p;
+        rank -= binomial(static_cast<std::uint64_t>(p), static_cast<std::uint64_t>(k));
+        positions |= std::uint32_t{1} << p;
+    }
+    return positions;
+}
+
+} // namespace poker::detail
+
+namespace poker {
+
+// A canonical representative of a class of suit-isomorphic situations.
+struct situation {
+    poker::hole_cards hole_cards;
+    poker::community_cards community_cards;
+};
+
+// Maps (hole_cards, community_cards) to a dense index of its suit isomorphism
+// class on the current street, and back. The hole cards and the flop, turn and
+// river are treated as separate rounds, so only the order between rounds
+// matters. Every suit is encoded as a tuple of rank sets (one per round)
+// ranked combinatorially; suits are then sorted, and suits with identical
+// per-round card counts are ranked as a multiset.
+class hand_indexer {
+public:
+    //
+    // Constants
+    //
+    static constexpr auto num_rounds = std::size_t{4};
+    static constexpr std::array<int, num_rounds> cards_per_round = {2, 3, 1, 1};
+
+    //
+    // Constructors
+    //
+    hand_indexer();
+
+    //
+    // Observers
+    //
+    auto size(round_of_betting) const noexcept -> std::uint64_t;
+
+    auto index(const poker::hole_cards&, span<const card> board) const POKER_NOEXCEPT -> std::uint64_t;
+    auto index(const poker::hole_cards&, const community_cards&) const POKER_NOEXCEPT -> std::uint64_t;
+    auto unindex(round_of_betting, std::uint64_t index) const POKER_NOEXCEPT -> situation;
+
+    auto operator()(const poker::hole_cards& hc, const community_cards& cc) const POKER_NOEXCEPT -> std::uint64_t {
+        return index(hc, cc);
+    }
+
+private:
+    // Per-round card counts of a single suit, two bits per round with the
+    // first round in the most significant position, so that comparing keys
+    // compares the tuples lexicographically.
+    using suit_key = std::uint8_t;
+
+    struct configuration {
+        std::uint32_t key;                       // the four sorted suit keys
+        std::array<std::uint64_t, 4> suit_space; // number of distinct rank-set tuples per suit
+        std::uint64_t offset;
+    };
+
+    static constexpr auto round_count(suit_key key, std::size_t round) noexcept -> int {
+        return (key >> (2 * (num_rounds - 1 - round))) & 3;
+    }
+
+    static auto street(round_of_betting) noexcept -> std::size_t;
+
+    void enumerate_configurations(std::size_t street, std::size_t round, std::size_t suit,
+                                  int remaining, std::array<suit_key, 4> keys);
+
+private:
+    std::array<std::vector<configuration>, num_rounds> _configurations;
+    std::array<std::uint64_t, num_rounds> _sizes = {};
+};
+
+inline hand_indexer::hand_indexer() {
+    for (auto s = std::size_t{0}; s < num_rounds; ++s) {
+        enumerate_configurations(s, 0, 0, cards_per_round[0], {});
+        auto& configurations = _configurations[s];
+        std::sort(configurations.begin(), configurations.end(), [] (const auto& x, const auto& y) { return x.key < y.key; });
+        configurations.erase(std::unique(configurations.begin(), configurations.end(), [] (const auto& x, const auto& y) {
+            return x.key == y.key;
+        }), configurations.end());
+        auto offset = std::uint64_t{0};
+        for (auto& c : configurations) {
+            c.offset = offset;
+            auto size = std::uint64_t{1};
+            for (auto first = std::size_t{0}; first < 4;) {
+                const auto key = (c.key >> (8 * (3 - first))) & 0xff;
+                auto last = first + 1;
+                while (last < 4 && ((c.key >> (8 * (3 - last))) & 0xff) == key) ++last;
+                const auto g = static_cast<std::uint64_t>(last - first);
+                size *= detail::binomial(c.suit_space[first] + g - 1, g);
+                first = last;
+            }
+            offset += size;
+        }
+        _sizes[s] = offset;
+    }
+}
+
+// Distributes the cards of every round over the four suits in every possible
+// way, recording each distribution once its suits are sorted.
+inline void hand_indexer::enumerate_configurations(std::size_t street, std::size_t round, std::size_t suit,
+                                                   int remaining, std::array<suit_key, 4> keys) {
+    if (suit == 4) {
+        if (remaining != 0) return;
+        if (round == street) {
+            std::sort(keys.begin(), keys.end(), std::greater<>{});
+            auto c = configuration{};
+            c.key = 0;
+            for (auto s = std::size_t{0}; s < 4; ++s) {
+                c.key = (c.key << 8) | keys[s];
+                auto used = 0;
+                auto space = std::uint64_t{1};
+                for (auto r = std::size_t{0}; r <= street; ++r) {
+                    const auto n = round_count(keys[s], r);
+                    space *= detail::binomial(static_cast<std::uint64_t>(13 - used), static_cast<std::uint64_t>(n));
+                    used += n;
+                }
+                c.suit_space[s] = space;
+            }
+            _configurations[street].push_back(c);
+        } else {
+            enumerate_configurations(street, round + 1, 0, cards_per_round[round + 1], keys);
+        }
+        return;
+    }
+    for (auto n = 0; n <= remaining; ++n) {
+        auto next = keys;
+        next[suit] = static_cast<suit_key>(next[suit] | (n << (2 * (num_rounds - 1 - round))));
+        enumerate_configurations(street, round, suit + 1, remaining - n, next);
+    }
+}
+
+inline auto hand_indexer::street(round_of_betting rob) noexcept -> std::size_t {
+    switch (rob) {
+    case round_of_betting::preflop: return 0;
+    case round_of_betting::flop:    return 1;
+    case round_of_betting::turn:    return 2;
+    default:                        return 3;
+    }
+}
+
+inline auto hand_indexer::size(round_of_betting rob) const noexcept -> std::uint64_t {
+    return _sizes[street(rob)];
+}
+
+inline auto hand_indexer::index(const poker::hole_cards& hc, const community_cards& cc) const POKER_NOEXCEPT -> std::uint64_t {
+    return index(hc, cc.cards());
+}
+
+inline auto hand_indexer::index(const poker::hole_cards& hc, span<const card> board) const POKER_NOEXCEPT -> std::uint64_t {
+    POKER_DETAIL_ASSERT(board.size() == 0 || (board.size() >= 3 && board.size() <= 5), "Board must be a valid street");
+
+    const auto s = street(static_cast<round_of_betting>(board.size()));
+
+    // Rank sets of every suit in every round.
+    auto rounds = std::array<card_set, num_rounds>{};
+    rounds[0] = card_set{hc};
+    for (auto i = std::size_t{0}; i < static_cast<std::size_t>(board.size()); ++i) {
+        rounds[i < 3 ? 1 : i - 1].insert(board[i]);
+    }
+    POKER_DETAIL_ASSERT(
+        (rounds[0] | rounds[1] | rounds[2] | rounds[3]).size() == 2 + static_cast<std::size_t>(board.size()),
+        "All cards must be distinct"
+        );
+
+    struct suit_code {
+        suit_key key;
+        std::uint64_t index;
+    };
+    auto suits = std::array<suit_code, 4>{};
+    for (auto suit = std::size_t{0}; suit < 4; ++suit) {
+        auto used = std::uint32_t{0};
+        auto key = suit_key{0};
+        auto index = std::uint64_t{0};
+        auto radix = std::uint64_t{1};
+        for (auto r = std::size_t{0}; r <= s; ++r) {
+            const auto ranks = std::uint32_t{rounds[r].ranks(static_cast<card_suit>(suit))};
+            // Positions of the ranks among the ranks not used in earlier rounds.
+            auto positions = std::uint32_t{0};
+            for (auto bits = ranks; bits != 0; bits &= bits - 1) {
+                const auto rank = detail::countr_zero(bits);
+                const auto below = used & ((std::uint32_t{1} << rank) - 1);
+                positions |= std::uint32_t{1} << (rank - detail::popcount(below));
+            }
+            const auto n = detail::popcount(ranks);
+            index += detail::colex_rank(positions) * radix;
+            radix *= detail::binomial(static_cast<std::uint64_t>(13 - detail::popcount(used)), static_cast<std::uint64_t>(n));
+            key = static_cast<suit_key>(key | (n << (2 * (num_rounds - 1 - r))));
+            used |= ranks;
+        }
+        suits[suit] = {key, index};
+    }
+    std::sort(suits.begin(), suits.end(), [] (const suit_code& x, const suit_code& y) {
+        return x.key != y.key ? x.key > y.key : x.index > y.index;
+    });
+
+    auto config_key = std::uint32_t{0};
+    for (const auto& code : suits) config_key = (config_key << 8) | code.key;
+    const auto& configurations = _configurations[s];
+    const auto config = std::lower_bound(configurations.begin(), configurations.end(), config_key, [] (const auto& c, std::uint32_t key) {
+        return c.key < key;
+    });
+    POKER_DETAIL_ASSERT(config != configurations.end() && config->key == config_key, "Suit configuration must be known");
+
+    auto index = config->offset;
+    auto multiplier = std::uint64_t{1};
+    for (auto first = std::size_t{0}; first < 4;) {
+        auto last = first + 1;
+        while (last < 4 && suits[last].key == suits[first].key) ++last;
+        const auto g = static_cast<std::uint64_t>(last - first);
+        // Rank the (descending) group of suit indices as a multiset.
+        auto rank = std::uint64_t{0};
+        for (auto t = std::uint64_t{0}; t < g; ++t) {
+            rank += detail::binomial(suits[first + t].index + g - 1 - t, g - t);
+        }
+        index += rank * multiplier;
+        multiplier *= detail::binomial(config->suit_space[first] + g - 1, g);
+        first = last;
+    }
+    return index;
+}
+
+inline auto hand_indexer::unindex(round_of_betting rob, std::uint64_t index) const POKER_NOEXCEPT -> situation {
+    const auto s = street(rob);
+    POKER_DETAIL_ASSERT(index < _sizes[s], "Index must be in the valid range");
+
+    const auto& configurations = _configurations[s];
+    const auto config = std::upper_bound(configurations.begin(), configurations.end(), index, [] (std::uint64_t i, const auto& c) {
+        return i < c.offset;
+    }) - 1;
+
+    auto suit_indices = std::array<std::uint64_t, 4>{};
+    auto within = index - config->offset;
+    for (auto first = std::size_t{0}; first < 4;) {
+        const auto key = (config->key >> (8 * (3 - first))) & 0xff;
+        auto last = first + 1;
+        while (last < 4 && ((config->key >> (8 * (3 - last))) & 0xff) == key) ++last;
+        const auto g = static_cast<std::uint64_t>(last - first);
+        const auto space = config->suit_space[first];
+        const auto group_size = detail::binomial(space + g - 1, g);
+        auto rank = within % group_size;
+        within /= group_size;
+        for (auto t = std::uint64_t{0}; t < g; ++t) {
+            const auto k = g - t;
+            // Largest v with C(v, k) <= rank.
+            auto lo = k - 1;
+            auto hi = space + g - 1 - t - 1;
+            while (lo < hi) {
+                const auto mid = lo + (hi - lo + 1) / 2;
+                if (detail::binomial(mid, k) <= rank) lo = mid; else hi = mid - 1;
+            }
+            rank -= detail::binomial(lo, k);
+            suit_indices[first + t] = lo - (g - 1 - t);
+        }
+        first = last;
+    }
+
+    auto rounds = std::array<card_set, num_rounds>{};
+    for (auto suit = std::size_t{0}; suit < 4; ++suit) {
+        const auto key = static_cast<suit_key>((config->key >> (8 * (3 - suit))) & 0xff);
+        auto suit_index = suit_indices[suit];
+        auto used = std::uint32_t{0};
+        for (auto r = std::size_t{0}; r <= s; ++r) {
+            const auto n = round_count(key, r);
+            const auto radix = detail::binomial(static_cast<std::uint64_t>(13 - detail::popcount(used)), static_cast<std::uint64_t>(n));
+            auto positions = detail::colex_unrank(suit_index % radix, n);
+            suit_index /= radix;
+            const auto unused = ~used & 0x1fff;
+            for (; positions != 0; positions &= positions - 1) {
+                const auto rank = detail::nth_set_bit(unused, detail::countr_zero(positions));
+                rounds[r].insert(card{static_cast<card_rank>(rank), static_cast<card_suit>(suit)});
+                used |= std::uint32_t{1} << rank;
+            }
+        }
+    }
+
+    auto result = situation{};
+    auto hole = std::array<card, 2>{};
+    auto i = std::size_t{0};
+    rounds[0].for_each([&] (card c) { hole[i++] = c; });
+    result.hole_cards = {hole[0], hole[1]};
+    for (auto r = std::size_t{1}; r <= s; ++r) {
+        auto board = std::array<card, 3>{};
+        auto n = std::size_t{0};
+        rounds[r].for_each([&] (card c) { board[n++] = c; });
+        result.community_cards.deal(span<const card>(board).first(n));
+    }
+    return result;
+}
+
+} // namespace poker
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <poker/player.hpp>
+#include <poker/seat_array.hpp>
+#include <poker/xoshiro256.hpp>
+#include "poker/detail/bits.hpp"
+#include "poker/detail/error.hpp"
+#include "poker/detail/parallel.hpp"
+#include "poker/detail/span.hpp"
+
+namespace poker {
+
+struct icm_options {
+    // Up to this many players, equities are computed exactly.
+    std::size_t exact_player_limit = 10;
+    // Otherwise they are estimated from this many simulated finishing orders.
+    std::size_t num_samples = 1 << 20;
+    std::uint64_t seed = 0;
+    unsigned num_threads = 0; // 0 means all cores
+};
+
+struct icm_result {
+    std::vector<double> equities;
+    std::vector<double> standard_errors; // all zero when the result is exact
+    bool exact = true;
+};
+
+} // namespace poker
+
+namespace poker::detail {
+
+// Malmuth-Harville: the probability that a player finishes next among the
+// players remaining is proportional to their stack. Instead of recursing over
+// every finishing order, walk the subsets of players already placed; the
+// probability of reaching a subset does not depend on the order in which its
+// players were placed.
+inline void icm_exact(span<const chips> stacks, span<const double> payouts, icm_result& result) {
+    const auto n = static_cast<std::size_t>(stacks.size());
+    const auto places = std::min(n, static_cast<std::size_t>(payouts.size()));
+    const auto total = std::accumulate(stacks.begin(), stacks.end(), 0.0);
+    const auto num_subsets = std::size_t{1} << n;
+
+    auto probability = std::vector<double>(num_subsets, 0.0);
+    auto placed_chips = std::vector<double>(num_subsets, 0.0);
+    probability[0] = 1;
+    // Subsets in increasing order visit every subset after all of its subsets.
+    for (auto placed = std::size_t{0}; placed < num_subsets; ++placed) {
+        const auto p = probability[placed];
+        if (p == 0) continue;
+        const auto place = static_cast<std::size_t>(popcount(placed));
+        if (place >= places) continue;
+        const auto remaining_chips = total - placed_chips[placed];
+        for (auto i = std::size_t{0}; i < n; ++i) {
+            const auto bit = std::size_t{1} << i;
+            if (placed & bit) continue;
+            const auto q = p * stacks[i] / remaining_chips;
+            result.equities[i] += q * payouts[place];
+            if (place + 1 < places) {
+                probability[placed | bit] += q;
+                placed_chips[placed | bit] = placed_chips[placed] + stacks[i];
+            }
+        }
+    }
+}
+
+// Under the Harville model, the finishing order is distributed like the
+// ascending order of independent exponential variables with rates equal to
+// the stacks, so every sample costs O(n) random numbers and a partial sort.
+// Samples are drawn in fixed-size blocks with their own seeds, so the result
+// does not depend on the number of threads.
+inline void icm_monte_carlo(span<const chips> stacks, span<const double> payouts, const icm_options& options, icm_result& result) {
+    constexpr auto block_size = std::size_t{4096};
+    const auto n = static_cast<std::size_t>(stacks.size());
+    const auto places = std::min(n, static_cast<std::size_t>(payouts.size()));
+    const auto num_blocks = std::max<std::size_t>(1, (options.num_samples + block_size - 1) / block_size);
+    const auto num_samples = num_blocks * block_size;
+
+    // Per-block moments, reduced in block order below, so that the sums do
+    // not depend on how the blocks were split between threads either.
+    auto sums = std::vector<double>(num_blocks * n, 0.0);
+    auto sums_of_squares = std::vector<double>(num_blocks * n, 0.0);
+
+    parallel_for(num_blocks, num_threads(options.num_threads), [&] (std::size_t, std::size_t first, std::size_t last) {
+        auto keys = std::vector<std::pair<double, std::size_t>>(n);
+        for (auto block = first; block < last; ++block) {
+            auto rng = xoshiro256{options.seed, block};
+            auto exponential = std::exponential_distribution<double>{};
+            const auto sum = sums.data() + block * n;
+            const auto sum_of_squares = sums_of_squares.data() + block * n;
+            for (auto sample = std::size_t{0}; sample < block_size; ++sample) {
+                for (auto i = std::size_t{0}; i < n; ++i) {
+                    keys[i] = {exponential(rng) / stacks[i], i};
+                }
+                std::partial_sort(keys.begin(), keys.begin() + static_cast<std::ptrdiff_t>(places), keys.end());
+                for (auto place = std::size_t{0}; place < places; ++place) {
+                    const auto i = keys[place].second;
+                    sum[i] += payouts[place];
+                    sum_of_squares[i] += payouts[place] * payouts[place];
+                }
+            }
+        }
+    });
+
+    for (auto i = std::size_t{0}; i < n; ++i) {
+        auto sum = 0.0;
+        auto sum_of_squares = 0.0;
+        for (auto block = std::size_t{0}; block < num_blocks; ++block) {
+            sum += sums[block * n + i];
+            sum_of_squares += sums_of_squares[block * n + i];
+        }
+        const auto count = static_cast<double>(num_samples);
+        const auto mean = sum / count;
+        const auto variance = std::max(0.0, sum_of_squares / count - mean * mean);
+        result.equities[i] = mean;
+        result.standard_errors[i] = std::sqrt(variance / count);
+    }
+}
+
+} // namespace poker::detail
+
+namespace poker {
+
+// Independent Chip Model equities of the given stacks, where payouts[k] is
+// the prize for finishing in place k (0 being first).
+inline auto icm_equities(span<const chips> stacks, span<const double> payouts, const icm_options& options = {}) POKER_NOEXCEPT -> icm_result {
+    POKER_DETAIL_ASSERT(!stacks.empty(), "There must be at least one player");
+    POKER_DETAIL_ASSERT(std::all_of(stacks.begin(), stacks.end(), [] (chips c) { return c > 0; }), "All stacks must be positive");
+
+    const auto n = static_cast<std::size_t>(stacks.size());
+    auto result = icm_result{std::vector<double>(n, 0.0), std::vector<double>(n, 0.0), true};
+    if (n <= options.exact_player_limit && n < 8 * sizeof(std::size_t)) {
+        detail::icm_exact(stacks, payouts, result);
+    } else {
+        result.exact = false;
+        detail::icm_monte_carlo(stacks, payouts, options, result);
+    }
+    return result;
+}
+
+// ICM equities of the players seated in 'players', indexed by seat. Empty
+// seats get no equity.
+template<std::size_t N>
+auto icm_equities(const basic_seat_array<N>& players, span<const double> payouts, const icm_options& options = {}) POKER_NOEXCEPT
+    -> std::array<double, N>
+{
+    auto stacks = std::vector<chips>{};
+    auto seats = std::vector<seat_index>{};
+    for (auto s = seat_index{0}; s < N; ++s) {
+        if (players.occupancy()[s]) {
+            stacks.push_back(players[s].total_chips());
+            seats.push_back(s);
+        }
+    }
+    const auto result = icm_equities(stacks, payouts, options);
+    auto equities = std::array<double, N>{};
+    for (auto i = std::size_t{0}; i < seats.size(); ++i) {
+        equities[seats[i]] = result.equities[i];
+    }
+    return equities;
+}
+
+} // namespace poker
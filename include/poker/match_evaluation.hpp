@@ -0,0 +1,264 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <poker/card_set.hpp>
+#include <poker/table.hpp>
+#include "poker/detail/error.hpp"
+#include "poker/detail/parallel.hpp"
+#include "poker/detail/span.hpp"
+
+namespace poker {
+
+// Everything that happened in a hand so far, as seen by the evaluator, at a
+// table with 'N' seats; 'hand_history' has 9.
+template<std::size_t N>
+struct basic_hand_history {
+    static constexpr auto num_seats = N;
+
+    struct action_record {
+        seat_index seat;
+        poker::action action;
+        chips bet;
+    };
+
+    std::array<std::optional<poker::hole_cards>, num_seats> hole_cards = {};
+    std::array<card, 5> board = {};
+    std::size_t board_size = 0;
+    std::vector<action_record> actions;
+
+    auto community_cards() const noexcept -> span<const card> {
+        return span<const card>(board).first(board_size);
+    }
+
+    auto dealt_cards() const noexcept -> card_set {
+        auto dealt = card_set{community_cards()};
+        for (const auto& hc : hole_cards) {
+            if (hc) dealt |= card_set{*hc};
+        }
+        return dealt;
+    }
+};
+
+using hand_history = basic_hand_history<9>;
+
+// An action a player with a known strategy could have taken, and how likely
+// they were to take it.
+struct weighted_action {
+    poker::action action;
+    chips bet;
+    double probability;
+};
+
+// AIVAT-style control variates for one player's winnings. A value function
+// 'v(const hand_history&) -> double' estimates what the player expects to
+// win from any point of the hand. Every chance event, and every decision of
+// a player whose strategy is known, contributes
+//
+//     v(after what happened) - E[v(after every possible outcome)]
+//
+// to the correction. Each term has zero mean whatever 'v' is, so the
+// corrected winnings are unbiased; the better 'v', the smaller their
+// variance. Chance events are expanded card by card, so a flop costs three
+// expectations over ~50 cards rather than one over ~20000 boards. 'v' is
+// called with the basic_hand_history<N> of a table with 'N' seats; 'aivat'
+// has 9.
+template<std::size_t N>
+class basic_aivat {
+public:
+    //
+    // Types
+    //
+    using hand_history = basic_hand_history<N>;
+
+    //
+    // Observers
+    //
+    auto history()    const noexcept -> const hand_history& { return _history; }
+    auto correction() const noexcept -> double              { return _correction; }
+
+    // The winnings of the hand with the luck that 'v' can explain removed.
+    auto corrected(double winnings) const noexcept -> double { return winnings - _correction; }
+
+    //
+    // Modifiers
+    //
+    void start_hand() noexcept;
+
+    template<class Value> void hole_cards_dealt(seat_index, const hole_cards&, Value&& v);
+    template<class Value> void community_card_dealt(card, Value&& v);
+    template<class Value> void community_cards_dealt(span<const card>, Value&& v);
+
+    // 'policy' is the strategy of the acting player at this point, or empty
+    // when it is unknown, in which case the action is recorded without
+    // correction.
+    template<class Value>
+    void action_taken(seat_index, action, chips bet, span<const weighted_action> policy, Value&& v);
+
+    // Records what the table dealt that was not recorded yet: the hole cards
+    // at the start of a hand, then the community cards.
+    template<class EventSink, class Value> void cards_dealt(const basic_table<N, EventSink>&, Value&& v);
+
+private:
+    hand_history _history;
+    double _correction = 0;
+};
+
+using aivat = basic_aivat<9>;
+
+template<std::size_t N>
+inline void basic_aivat<N>::start_hand() noexcept {
+    _history.hole_cards = {};
+    _history.board_size = 0;
+    _history.actions.clear();
+    _correction = 0;
+}
+
+template<std::size_t N>
+template<class Value>
+void basic_aivat<N>::hole_cards_dealt(seat_index s, const hole_cards& hc, Value&& v) {
+    POKER_DETAIL_ASSERT(s < hand_history::num_seats, "Invalid seat");
+    POKER_DETAIL_ASSERT(!_history.hole_cards[s], "Hole cards must not have been dealt yet");
+
+    const auto live = card_set::full_deck() - _history.dealt_cards();
+    auto total = 0.0;
+    auto count = 0;
+    live.for_each([&] (card first) {
+        live.for_each([&] (card second) {
+            if (card_index(second) <= card_index(first)) return;
+            _history.hole_cards[s] = poker::hole_cards{first, second};
+            total += v(static_cast<const hand_history&>(_history));
+            ++count;
+        });
+    });
+    _history.hole_cards[s] = hc;
+    _correction += v(static_cast<const hand_history&>(_history)) - total / count;
+}
+
+template<std::size_t N>
+template<class Value>
+void basic_aivat<N>::community_card_dealt(card c, Value&& v) {
+    POKER_DETAIL_ASSERT(_history.board_size < 5, "Cannot deal more than five community cards");
+
+    const auto live = card_set::full_deck() - _history.dealt_cards();
+    auto total = 0.0;
+    auto count = 0;
+    ++_history.board_size;
+    live.for_each([&] (card outcome) {
+        _history.board[_history.board_size - 1] = outcome;
+        total += v(static_cast<const hand_history&>(_history));
+        ++count;
+    });
+    _history.board[_history.board_size - 1] = c;
+    _correction += v(static_cast<const hand_history&>(_history)) - total / count;
+}
+
+template<std::size_t N>
+template<class Value>
+void basic_aivat<N>::community_cards_dealt(span<const card> cards, Value&& v) {
+    for (auto c : cards) community_card_dealt(c, v);
+}
+
+template<std::size_t N>
+template<class Value>
+void basic_aivat<N>::action_taken(seat_index s, action a, chips bet, span<const weighted_action> policy, Value&& v) {
+    auto expected = 0.0;
+    for (const auto& alternative : policy) {
+        if (alternative.probability == 0) continue;
+        _history.actions.push_back({s, alternative.action, alternative.bet});
+        expected += alternative.probability * v(static_cast<const hand_history&>(_history));
+        _history.actions.pop_back();
+    }
+    _history.actions.push_back({s, a, bet});
+    if (!policy.empty()) {
+        _correction += v(static_cast<const hand_history&>(_history)) - expected;
+    }
+}
+
+template<std::size_t N>
+template<class EventSink, class Value>
+void basic_aivat<N>::cards_dealt(const basic_table<N, EventSink>& t, Value&& v) {
+    POKER_DETAIL_ASSERT(t.hand_in_progress(), "Hand must be in progress");
+
+    const auto hole_cards = t.hole_cards();
+    const auto seated = hole_cards.filter();
+    for (auto s = seat_index{0}; s < hand_history::num_seats; ++s) {
+        if (seated[s] && !_history.hole_cards[s]) hole_cards_dealt(s, hole_cards[s], v);
+    }
+    const auto board = t.community_cards().cards();
+    for (auto i = _history.board_size; i < static_cast<std::size_t>(board.size()); ++i) {
+        community_card_dealt(board[i], v);
+    }
+}
+
+struct match_statistics {
+    std::size_t num_hands = 0;
+    double mean = 0;
+    double standard_error = 0;
+};
+
+struct match_result {
+    match_statistics raw;       // plain winnings
+    match_statistics corrected; // winnings with the control variates applied
+};
+
+// Running sums of per-hand winnings, raw and corrected.
+class match_accumulator {
+public:
+    void add(double raw, double corrected) noexcept {
+        ++_num_hands;
+        _raw += raw;
+        _raw_squares += raw * raw;
+        _corrected += corrected;
+        _corrected_squares += corrected * corrected;
+    }
+
+    void merge(const match_accumulator& other) noexcept {
+        _num_hands += other._num_hands;
+        _raw += other._raw;
+        _raw_squares += other._raw_squares;
+        _corrected += other._corrected;
+        _corrected_squares += other._corrected_squares;
+    }
+
+    auto result() const noexcept -> match_result {
+        return {statistics(_raw, _raw_squares), statistics(_corrected, _corrected_squares)};
+    }
+
+private:
+    auto statistics(double sum, double sum_of_squares) const noexcept -> match_statistics {
+        if (_num_hands == 0) return {};
+        const auto n = static_cast<double>(_num_hands);
+        const auto mean = sum / n;
+        const auto variance = _num_hands > 1 ? std::max(0.0, (sum_of_squares - n * mean * mean) / (n - 1)) : 0.0;
+        return {_num_hands, mean, std::sqrt(variance / n)};
+    }
+
+private:
+    std::size_t _num_hands = 0;
+    double _raw = 0;
+    double _raw_squares = 0;
+    double _corrected = 0;
+    double _corrected_squares = 0;
+};
+
+// Plays 'num_shards' independent parts of a match in parallel, calling
+// 'play_shard(shard_index, match_accumulator&)' for each. Shards are merged
+// in order, so the result only depends on what every shard played.
+template<class PlayShard>
+auto evaluate_match(std::size_t num_shards, PlayShard&& play_shard, unsigned num_threads = 0) -> match_result {
+    auto shards = std::vector<match_accumulator>(num_shards);
+    detail::parallel_for(num_shards, detail::num_threads(num_threads), [&] (std::size_t, std::size_t first, std::size_t last) {
+        for (auto shard = first; shard < last; ++shard) play_shard(shard, shards[shard]);
+    });
+    auto total = match_accumulator{};
+    for (const auto& shard : shards) total.merge(shard);
+    return total.result();
+}
+
+} // namespace poker
@@ -1,24 +1,32 @@
 #pragma once
 
-#include <vector>
+#include <cstdint>
 
 #include <poker/player.hpp>
 #include <poker/seat_array.hpp>
+#include <poker/seat_set.hpp>
 
 namespace poker {
 
+// A pot by value: its size and the seats that can win it.
 class pot {
-    std::vector<seat_index> _eligible_players;
+    seat_set _eligible_players;
     chips _size;
 
 public:
-    pot() noexcept : _size{0} {}
+    constexpr pot() noexcept : _size{0} {}
+
+    constexpr pot(seat_set eligible_players, chips size) noexcept
+        : _eligible_players{eligible_players}
+        , _size{size}
+    {
+    }
 
     auto size() const noexcept -> chips {
         return _size;
     }
 
-    auto eligible_players() const noexcept -> span<const seat_index> {
+    auto eligible_players() const noexcept -> seat_set {
         return _eligible_players;
     }
 
@@ -27,17 +35,20 @@ public:
         _size += amount;
     }
 
-    auto collect_bets_from(seat_array_view players) noexcept -> chips {
+    template<std::size_t N>
+    auto collect_bets_from(basic_seat_array<N>& players) noexcept -> chips {
+        return collect_bets_from(basic_seat_array_view<N>{players});
+    }
+
+    template<std::size_t N>
+    auto collect_bets_from(basic_seat_array_view<N> players) noexcept -> chips {
         // Find the first player who has placed a bet.
         auto it = std::find_if(players.begin(), players.end(), [] (const auto& p) { return p.bet_size() != 0; });
         if (it == players.end()) {
             // If no players have bet, just make all the players who are still in the pot eligible.
             // It is possible that some player has folded even if nobody has bet.
             // We would not want to keep him as an eligible player.
-            _eligible_players.clear();
-            for (auto iter = players.begin(); iter != players.end(); ++iter) {
-                _eligible_players.push_back(iter.index());
-            }
+            _eligible_players = players.filter();
             return 0;
         } else {
             // Find the smallest player bet on the table.
@@ -53,7 +64,7 @@ public:
                 if ((*iter).bet_size() != 0) {
                     (*iter).take_from_bet(min_bet);
                     _size += min_bet;
-                    _eligible_players.push_back(iter.index());
+                    _eligible_players.insert(iter.index());
                 }
             }
             return min_bet;
@@ -61,4 +72,15 @@ public:
     }
 };
 
+// Chips moved into a pot when the bets of a betting round are collected.
+// The bets of players who folded were pooled when they folded, and come from
+// no seat.
+struct pot_transaction {
+    static constexpr auto folded_bets = std::uint8_t{0xff};
+
+    std::uint8_t seat = 0; // Or 'folded_bets'.
+    std::uint8_t pot = 0;  // Index of the pot, the main pot being 0.
+    chips amount = 0;
+};
+
 } // namespace poker
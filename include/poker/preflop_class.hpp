@@ -0,0 +1,47 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <poker/hole_cards.hpp>
+
+namespace poker {
+
+// The 169 preflop classes laid out as the usual 13x13 chart: pairs on the
+// diagonal, suited hands at [high][low] and offsuit hands at [low][high].
+static constexpr auto num_preflop_classes = std::size_t{169};
+
+constexpr auto preflop_class(const hole_cards& hc) noexcept -> std::size_t {
+    const auto r1 = static_cast<std::size_t>(hc.first.rank);
+    const auto r2 = static_cast<std::size_t>(hc.second.rank);
+    const auto high = r1 > r2 ? r1 : r2;
+    const auto low = r1 > r2 ? r2 : r1;
+    return hc.first.suit == hc.second.suit ? high * 13 + low : low * 13 + high;
+}
+
+constexpr auto is_pair_class(std::size_t c) noexcept -> bool    { return c / 13 == c % 13; }
+constexpr auto is_suited_class(std::size_t c) noexcept -> bool  { return c / 13 > c % 13; }
+constexpr auto is_offsuit_class(std::size_t c) noexcept -> bool { return c / 13 < c % 13; }
+
+// Number of card combinations in a preflop class.
+constexpr auto num_combos(std::size_t c) noexcept -> int {
+    return is_pair_class(c) ? 6 : is_suited_class(c) ? 4 : 12;
+}
+
+// All hole card combinations of a preflop class.
+inline auto combos(std::size_t c) -> std::vector<hole_cards> {
+    auto result = std::vector<hole_cards>{};
+    const auto high = static_cast<card_rank>(std::max(c / 13, c % 13));
+    const auto low = static_cast<card_rank>(std::min(c / 13, c % 13));
+    for (auto s1 = 0; s1 < 4; ++s1) {
+        for (auto s2 = 0; s2 < 4; ++s2) {
+            const auto suited = s1 == s2;
+            if (is_pair_class(c) ? s2 <= s1 : suited != is_suited_class(c)) continue;
+            result.push_back({{high, static_cast<card_suit>(s1)}, {low, static_cast<card_suit>(s2)}});
+        }
+    }
+    return result;
+}
+
+} // namespace poker
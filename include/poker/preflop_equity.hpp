@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <poker/card_set.hpp>
+#include <poker/preflop_class.hpp>
+#include "poker/detail/preflop_equity_table.hpp"
+
+namespace poker {
+
+// Heads-up all-in equities between preflop classes, looked up in O(1). Each
+// matchup averages over every pair of non-conflicting combinations and every
+// board, as enumerated exactly by tools/preflop_equity_table.cpp; weight() is
+// the number of such pairs, which accounts for card removal when weighting an
+// opponent's range.
+class preflop_equity {
+public:
+    //
+    // Constructors
+    //
+    preflop_equity();
+
+    //
+    // Observers
+    //
+    auto win(std::size_t hero, std::size_t villain) const noexcept -> double {
+        return _win[hero * num_preflop_classes + villain];
+    }
+
+    auto tie(std::size_t hero, std::size_t villain) const noexcept -> double {
+        return _tie[hero * num_preflop_classes + villain];
+    }
+
+    auto equity(std::size_t hero, std::size_t villain) const noexcept -> double {
+        return win(hero, villain) + tie(hero, villain) / 2;
+    }
+
+    auto weight(std::size_t hero, std::size_t villain) const noexcept -> int {
+        return _weight[hero * num_preflop_classes + villain];
+    }
+
+private:
+    std::vector<double> _win;
+    std::vector<double> _tie;
+    std::vector<int> _weight;
+};
+
+inline preflop_equity::preflop_equity()
+    : _win(num_preflop_classes * num_preflop_classes)
+    , _tie(num_preflop_classes * num_preflop_classes)
+    , _weight(num_preflop_classes * num_preflop_classes)
+{
+    constexpr auto boards = 1'712'304.0; // 48 choose 5
+
+    auto class_combos = std::vector<std::vector<hole_cards>>(num_preflop_classes);
+    for (auto c = std::size_t{0}; c < num_preflop_classes; ++c) class_combos[c] = combos(c);
+
+    // The table holds the matchups 'hero <= villain' row by row.
+    auto matchup = std::size_t{0};
+    for (auto hero = std::size_t{0}; hero < num_preflop_classes; ++hero) {
+        for (auto villain = hero; villain < num_preflop_classes; ++villain, ++matchup) {
+            auto weight = 0;
+            for (const auto& x : class_combos[hero]) {
+                for (const auto& y : class_combos[villain]) weight += (card_set{x} & card_set{y}).empty();
+            }
+            _weight[hero * num_preflop_classes + villain] = weight;
+            _weight[villain * num_preflop_classes + hero] = weight;
+            if (weight == 0) continue;
+
+            const auto count = weight * boards;
+            const auto win = detail::preflop_wins[matchup] / count;
+            const auto tie = detail::preflop_ties[matchup] / count;
+            _win[hero * num_preflop_classes + villain] = win;
+            _tie[hero * num_preflop_classes + villain] = tie;
+            _win[villain * num_preflop_classes + hero] = hero == villain ? win : 1 - win - tie;
+            _tie[villain * num_preflop_classes + hero] = tie;
+        }
+    }
+}
+
+} // namespace poker
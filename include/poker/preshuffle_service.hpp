@@ -0,0 +1,155 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <poker/deck.hpp>
+#include "poker/detail/error.hpp"
+#include "poker/detail/mpmc_ring.hpp"
+
+namespace poker {
+
+struct preshuffle_options {
+    std::size_t capacity = 1024; // Decks kept ready; a power of 2.
+    unsigned num_producers = 1;
+};
+
+struct preshuffle_statistics {
+    std::size_t capacity = 0;
+    std::size_t ready = 0;           // Decks in the ring right now.
+    std::uint64_t produced = 0;
+    std::uint64_t taken = 0;         // Decks handed out from the ring.
+    std::uint64_t stalls = 0;        // Decks shuffled inline because the ring was empty.
+    std::uint64_t producer_waits = 0; // Times a producer found the ring full.
+};
+
+// Shuffles decks ahead of time on background threads, so that starting a
+// hand only copies a ready deck:
+//
+//     auto decks = preshuffle_service{[] (unsigned) { return chacha20{}; }};
+//     ...
+//     t.start_hand(decks.take(fallback_generator));
+//
+// Each producer draws from its own generator, 'make_generator(producer)',
+// and the ready decks wait in a lock-free ring. When the ring runs dry, take()
+// shuffles inline from the caller's generator instead of waiting, and counts
+// a stall.
+class preshuffle_service {
+public:
+    //
+    // Special functions
+    //
+    preshuffle_service(const preshuffle_service&) = delete;
+    preshuffle_service(preshuffle_service&&)      = delete;
+    auto operator=(const preshuffle_service&) -> preshuffle_service& = delete;
+    auto operator=(preshuffle_service&&)      -> preshuffle_service& = delete;
+    ~preshuffle_service();
+
+    //
+    // Constructors
+    //
+    template<class MakeGenerator>
+    explicit preshuffle_service(MakeGenerator&& make_generator, const preshuffle_options& options = {}) POKER_NOEXCEPT;
+
+    //
+    // Observers
+    //
+    auto statistics() const noexcept -> preshuffle_statistics;
+
+    //
+    // Modifiers
+    //
+
+    // A ready deck, if any.
+    auto try_take(deck&) noexcept -> bool;
+
+    // A ready deck, or one shuffled from 'fallback' if there is none.
+    template<class URBG>
+    auto take(URBG& fallback) noexcept -> deck;
+
+private:
+    template<class URBG>
+    void produce(URBG& g) noexcept;
+
+private:
+    detail::mpmc_ring<deck> _ring;
+    std::atomic<bool> _stopping = false;
+    std::atomic<std::uint64_t> _produced = 0;
+    std::atomic<std::uint64_t> _taken = 0;
+    std::atomic<std::uint64_t> _stalls = 0;
+    std::atomic<std::uint64_t> _producer_waits = 0;
+    std::vector<std::thread> _producers;
+};
+
+template<class MakeGenerator>
+preshuffle_service::preshuffle_service(MakeGenerator&& make_generator, const preshuffle_options& options) POKER_NOEXCEPT
+    : _ring{options.capacity}
+{
+    POKER_DETAIL_ASSERT(options.num_producers >= 1, "There must be at least one producer");
+
+    _producers.reserve(options.num_producers);
+    for (auto producer = 0u; producer < options.num_producers; ++producer) {
+        _producers.emplace_back([this, g = make_generator(producer)] () mutable { produce(g); });
+    }
+}
+
+inline preshuffle_service::~preshuffle_service() {
+    _stopping.store(true, std::memory_order_relaxed);
+    for (auto& p : _producers) p.join();
+}
+
+template<class URBG>
+void preshuffle_service::produce(URBG& g) noexcept {
+    using namespace std::chrono_literals;
+
+    auto d = deck{};
+    auto ready = false;
+    while (!_stopping.load(std::memory_order_relaxed)) {
+        if (!ready) {
+            d.fill_and_shuffle(g);
+            d.finish_shuffle();
+            ready = true;
+        }
+        if (_ring.try_push(std::move(d))) {
+            _produced.fetch_add(1, std::memory_order_relaxed);
+            ready = false;
+        } else {
+            _producer_waits.fetch_add(1, std::memory_order_relaxed);
+            std::this_thread::sleep_for(100us);
+        }
+    }
+}
+
+inline auto preshuffle_service::statistics() const noexcept -> preshuffle_statistics {
+    auto s = preshuffle_statistics{};
+    s.capacity = _ring.capacity();
+    s.ready = _ring.size();
+    s.produced = _produced.load(std::memory_order_relaxed);
+    s.taken = _taken.load(std::memory_order_relaxed);
+    s.stalls = _stalls.load(std::memory_order_relaxed);
+    s.producer_waits = _producer_waits.load(std::memory_order_relaxed);
+    return s;
+}
+
+inline auto preshuffle_service::try_take(deck& d) noexcept -> bool {
+    if (!_ring.try_pop(d)) return false;
+    _taken.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+template<class URBG>
+auto preshuffle_service::take(URBG& fallback) noexcept -> deck {
+    auto d = deck{};
+    if (!try_take(d)) {
+        _stalls.fetch_add(1, std::memory_order_relaxed);
+        d.fill_and_shuffle(fallback);
+        // Like the decks from the ring, it must not need a generator anymore.
+        d.finish_shuffle();
+    }
+    return d;
+}
+
+} // namespace poker
@@ -0,0 +1,279 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include <poker/dealer.hpp>
+#include <poker/icm.hpp>
+#include <poker/preflop_equity.hpp>
+#include "poker/detail/error.hpp"
+#include "poker/detail/parallel.hpp"
+#include "poker/detail/span.hpp"
+
+namespace poker {
+
+// Heads-up push/fold: the small blind either folds or moves all-in, and the
+// big blind either folds or calls. Utilities are given as {small blind, big
+// blind} for every way the hand can end.
+struct push_fold_utilities {
+    std::array<double, 2> fold;  // small blind folds
+    std::array<double, 2> steal; // big blind folds
+    std::array<double, 2> win;   // small blind wins the all-in
+    std::array<double, 2> lose;  // small blind loses the all-in
+    std::array<double, 2> tie;
+};
+
+struct push_fold_outcome {
+    chips small_blind;
+    chips big_blind;
+};
+
+// Stacks of both players after each way the hand can end.
+struct push_fold_outcomes {
+    push_fold_outcome fold;
+    push_fold_outcome steal;
+    push_fold_outcome win;
+    push_fold_outcome lose;
+    push_fold_outcome tie;
+};
+
+inline auto make_push_fold_outcomes(chips small_blind_stack, chips big_blind_stack, const forced_bets& fb) POKER_NOEXCEPT -> push_fold_outcomes {
+    const auto ante = fb.ante;
+    POKER_DETAIL_ASSERT(small_blind_stack > fb.blinds.small + ante, "Small blind must cover their forced bets");
+    POKER_DETAIL_ASSERT(big_blind_stack > fb.blinds.big + ante, "Big blind must cover their forced bets");
+
+    const auto effective = std::min(small_blind_stack, big_blind_stack);
+    auto o = push_fold_outcomes{};
+    o.fold  = {small_blind_stack - fb.blinds.small - ante, big_blind_stack + fb.blinds.small + ante};
+    o.steal = {small_blind_stack + fb.blinds.big + ante,   big_blind_stack - fb.blinds.big - ante};
+    o.win   = {small_blind_stack + effective,              big_blind_stack - effective};
+    o.lose  = {small_blind_stack - effective,              big_blind_stack + effective};
+    o.tie   = {small_blind_stack,                          big_blind_stack};
+    return o;
+}
+
+// Applies 'utility(small_blind_stack, big_blind_stack) -> std::array<double, 2>'
+// to every outcome.
+template<class Utility>
+auto make_push_fold_utilities(const push_fold_outcomes& o, Utility&& utility) -> push_fold_utilities {
+    return {
+        utility(o.fold.small_blind, o.fold.big_blind),
+        utility(o.steal.small_blind, o.steal.big_blind),
+        utility(o.win.small_blind, o.win.big_blind),
+        utility(o.lose.small_blind, o.lose.big_blind),
+        utility(o.tie.small_blind, o.tie.big_blind)
+    };
+}
+
+// Utilities in chips won or lost.
+inline auto chip_ev_utilities(chips small_blind_stack, chips big_blind_stack, const forced_bets& fb) POKER_NOEXCEPT -> push_fold_utilities {
+    return make_push_fold_utilities(make_push_fold_outcomes(small_blind_stack, big_blind_stack, fb), [&] (chips sb, chips bb) {
+        return std::array<double, 2>{static_cast<double>(sb - small_blind_stack), static_cast<double>(bb - big_blind_stack)};
+    });
+}
+
+// Utilities in tournament equity, with the rest of the field sitting out the
+// hand. A player who busts gets the prize for the last paid place they reach.
+inline auto icm_utilities(chips small_blind_stack, chips big_blind_stack, const forced_bets& fb,
+                          span<const chips> other_stacks, span<const double> payouts) -> push_fold_utilities
+{
+    const auto remaining = static_cast<std::size_t>(other_stacks.size()) + 2;
+    return make_push_fold_utilities(make_push_fold_outcomes(small_blind_stack, big_blind_stack, fb), [&] (chips sb, chips bb) {
+        auto stacks = std::vector<chips>(other_stacks.begin(), other_stacks.end());
+        auto busted = std::array<double, 2>{};
+        auto seats = std::array<std::ptrdiff_t, 2>{-1, -1};
+        const auto bust_prize = remaining - 1 < static_cast<std::size_t>(payouts.size()) ? payouts[remaining - 1] : 0.0;
+        for (auto i = 0; i < 2; ++i) {
+            const auto stack = i == 0 ? sb : bb;
+            if (stack > 0) {
+                seats[i] = static_cast<std::ptrdiff_t>(stacks.size());
+                stacks.push_back(stack);
+            } else {
+                busted[i] = bust_prize;
+            }
+        }
+        const auto result = icm_equities(stacks, payouts.first(std::min<std::size_t>(payouts.size(), stacks.size())));
+        for (auto i = 0; i < 2; ++i) {
+            if (seats[i] >= 0) busted[i] = result.equities[static_cast<std::size_t>(seats[i])];
+        }
+        return busted;
+    });
+}
+
+struct push_fold_options {
+    std::size_t iterations = 2000;
+    unsigned num_threads = 0; // 0 means all cores
+};
+
+struct push_fold_chart {
+    std::array<double, num_preflop_classes> push = {}; // small blind pushing frequency per class
+    std::array<double, num_preflop_classes> call = {}; // big blind calling frequency per class
+    // How much both players together could gain by deviating, in utility
+    // units per hand; zero at an equilibrium.
+    double exploitability = 0;
+};
+
+} // namespace poker
+
+namespace poker::detail {
+
+class push_fold_solver {
+public:
+    push_fold_solver(const preflop_equity& equity, const push_fold_utilities& u);
+
+    auto solve(std::size_t iterations) -> push_fold_chart;
+
+private:
+    static constexpr auto n = num_preflop_classes;
+
+    void push_best_response(const std::array<double, n>& call, std::array<double, n>& push, double& value) const noexcept;
+    void call_best_response(const std::array<double, n>& push, std::array<double, n>& call, double& value) const noexcept;
+    auto value(const std::array<double, n>& push, const std::array<double, n>& call) const noexcept -> std::array<double, 2>;
+
+private:
+    push_fold_utilities _u;
+    // [small blind class * n + big blind class], already weighted by the
+    // number of non-conflicting combinations.
+    std::vector<double> _weight;
+    std::vector<double> _showdown_sb; // small blind utility when called
+    std::vector<double> _showdown_bb; // big blind utility when calling
+    double _total_weight = 0;
+};
+
+inline push_fold_solver::push_fold_solver(const preflop_equity& equity, const push_fold_utilities& u)
+    : _u{u}
+    , _weight(n * n)
+    , _showdown_sb(n * n)
+    , _showdown_bb(n * n)
+{
+    for (auto i = std::size_t{0}; i < n; ++i) {
+        for (auto j = std::size_t{0}; j < n; ++j) {
+            const auto w = static_cast<double>(equity.weight(i, j));
+            const auto win = equity.win(i, j);
+            const auto tie = equity.tie(i, j);
+            const auto lose = 1 - win - tie;
+            _weight[i * n + j] = w;
+            _showdown_sb[i * n + j] = w * (win * u.win[0] + tie * u.tie[0] + lose * u.lose[0]);
+            _showdown_bb[i * n + j] = w * (win * u.win[1] + tie * u.tie[1] + lose * u.lose[1]);
+            _total_weight += w;
+        }
+    }
+}
+
+inline void push_fold_solver::push_best_response(const std::array<double, n>& call, std::array<double, n>& push, double& value) const noexcept {
+    value = 0;
+    for (auto i = std::size_t{0}; i < n; ++i) {
+        auto weight = 0.0;
+        auto shove = 0.0;
+        for (auto j = std::size_t{0}; j < n; ++j) {
+            const auto w = _weight[i * n + j];
+            weight += w;
+            shove += (w - w * call[j]) * _u.steal[0] + call[j] * _showdown_sb[i * n + j];
+        }
+        const auto fold = weight * _u.fold[0];
+        push[i] = shove > fold ? 1 : 0;
+        value += std::max(shove, fold);
+    }
+    value /= _total_weight;
+}
+
+inline void push_fold_solver::call_best_response(const std::array<double, n>& push, std::array<double, n>& call, double& value) const noexcept {
+    value = 0;
+    for (auto j = std::size_t{0}; j < n; ++j) {
+        auto folded_to = 0.0;
+        auto facing_push = 0.0;
+        auto called = 0.0;
+        for (auto i = std::size_t{0}; i < n; ++i) {
+            const auto w = _weight[i * n + j];
+            folded_to += w - w * push[i];
+            facing_push += w * push[i];
+            called += push[i] * _showdown_bb[i * n + j];
+        }
+        const auto fold = facing_push * _u.steal[1];
+        call[j] = called > fold ? 1 : 0;
+        value += folded_to * _u.fold[1] + std::max(called, fold);
+    }
+    value /= _total_weight;
+}
+
+inline auto push_fold_solver::value(const std::array<double, n>& push, const std::array<double, n>& call) const noexcept -> std::array<double, 2> {
+    auto result = std::array<double, 2>{};
+    for (auto i = std::size_t{0}; i < n; ++i) {
+        for (auto j = std::size_t{0}; j < n; ++j) {
+            const auto w = _weight[i * n + j];
+            const auto p = push[i];
+            const auto c = call[j];
+            result[0] += (1 - p) * w * _u.fold[0] + p * ((1 - c) * w * _u.steal[0] + c * _showdown_sb[i * n + j]);
+            result[1] += (1 - p) * w * _u.fold[1] + p * ((1 - c) * w * _u.steal[1] + c * _showdown_bb[i * n + j]);
+        }
+    }
+    result[0] /= _total_weight;
+    result[1] /= _total_weight;
+    return result;
+}
+
+// Fictitious play: both players repeatedly best-respond to the average of
+// their opponent's past strategies, and the averages converge to an
+// equilibrium.
+inline auto push_fold_solver::solve(std::size_t iterations) -> push_fold_chart {
+    auto chart = push_fold_chart{};
+    chart.push.fill(1);
+    auto push = std::array<double, n>{};
+    auto call = std::array<double, n>{};
+    auto ignored = 0.0;
+    call_best_response(chart.push, chart.call, ignored);
+    for (auto t = std::size_t{1}; t <= iterations; ++t) {
+        push_best_response(chart.call, push, ignored);
+        call_best_response(chart.push, call, ignored);
+        const auto step = 1.0 / static_cast<double>(t + 1);
+        for (auto c = std::size_t{0}; c < n; ++c) {
+            chart.push[c] += (push[c] - chart.push[c]) * step;
+            chart.call[c] += (call[c] - chart.call[c]) * step;
+        }
+    }
+    auto push_value = 0.0;
+    auto call_value = 0.0;
+    push_best_response(chart.call, push, push_value);
+    call_best_response(chart.push, call, call_value);
+    const auto v = value(chart.push, chart.call);
+    chart.exploitability = (push_value - v[0]) + (call_value - v[1]);
+    return chart;
+}
+
+} // namespace poker::detail
+
+namespace poker {
+
+// Solves a single push/fold spot.
+inline auto solve_push_fold(const preflop_equity& equity, const push_fold_utilities& utilities, const push_fold_options& options = {})
+    -> push_fold_chart
+{
+    return detail::push_fold_solver{equity, utilities}.solve(options.iterations);
+}
+
+// Solves a grid of spots in parallel, where 'make_utilities(stack)' gives the
+// utilities of the spot with the given effective stack.
+template<class MakeUtilities>
+auto solve_push_fold(const preflop_equity& equity, span<const chips> effective_stacks, MakeUtilities&& make_utilities,
+                     const push_fold_options& options = {}) -> std::vector<push_fold_chart>
+{
+    const auto n = static_cast<std::size_t>(effective_stacks.size());
+    auto utilities = std::vector<push_fold_utilities>{};
+    utilities.reserve(n);
+    for (auto stack : effective_stacks) utilities.push_back(make_utilities(stack));
+    auto charts = std::vector<push_fold_chart>(n);
+    detail::parallel_for(n, detail::num_threads(options.num_threads), [&] (std::size_t, std::size_t first, std::size_t last) {
+        for (auto i = first; i < last; ++i) charts[i] = solve_push_fold(equity, utilities[i], options);
+    });
+    return charts;
+}
+
+// Solves a grid of effective stacks in chip EV.
+inline auto solve_push_fold(const preflop_equity& equity, span<const chips> effective_stacks, const forced_bets& fb,
+                            const push_fold_options& options = {}) -> std::vector<push_fold_chart>
+{
+    return solve_push_fold(equity, effective_stacks, [&] (chips stack) { return chip_ev_utilities(stack, stack, fb); }, options);
+}
+
+} // namespace poker
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#include <poker/card_set.hpp>
+#include <poker/seat_set.hpp>
+#include <poker/table.hpp>
+#include "poker/detail/error.hpp"
+#include "poker/detail/span.hpp"
+
+namespace poker {
+
+static constexpr auto num_hole_cards_combos = std::size_t{1326};
+
+// Dense index of a pair of hole cards in [0, 1326), independent of their
+// order: the colex rank of the pair of card indices.
+constexpr auto hole_cards_index(const hole_cards& hc) noexcept -> std::size_t {
+    const auto a = card_index(hc.first);
+    const auto b = card_index(hc.second);
+    const auto low = a < b ? a : b;
+    const auto high = a < b ? b : a;
+    return high * (high - 1) / 2 + low;
+}
+
+constexpr auto hole_cards_from_index(std::size_t index) noexcept -> hole_cards {
+    auto high = std::size_t{1};
+    while ((high + 1) * high / 2 <= index) ++high;
+    return {card_from_index(high), card_from_index(index - high * (high - 1) / 2)};
+}
+
+// A probability distribution over the 1326 hole card combinations of every
+// seat, refined by Bayes' rule as the hand plays out. An action model gives,
+// for every combination, the likelihood that a player holding it would have
+// taken the observed action; the posterior is the prior times the likelihood,
+// renormalized. Combinations that conflict with known cards have probability
+// zero. Tracks the seats of a table with 'N' seats; 'range_tracker' has 9.
+template<std::size_t N>
+class basic_range_tracker {
+public:
+    //
+    // Constants
+    //
+    static constexpr auto num_seats = N;
+
+    //
+    // Types
+    //
+    using range = std::array<float, num_hole_cards_combos>;
+
+    //
+    // Observers
+    //
+    auto tracked(seat_index s) const noexcept -> bool { return _tracked[s]; }
+    auto dead_cards() const noexcept -> card_set      { return _dead; }
+
+    auto posterior(seat_index s) const POKER_NOEXCEPT -> span<const float, num_hole_cards_combos>;
+    auto probability(seat_index s, const hole_cards& hc) const POKER_NOEXCEPT -> float;
+
+    //
+    // Modifiers
+    //
+
+    // Tracks the given seats with uniform ranges over the combinations that
+    // do not contain any of the 'dead' cards (e.g. our own hole cards).
+    void start_hand(seat_set seats, card_set dead = {}) noexcept;
+    template<class EventSink>
+    void start_hand(const basic_table<N, EventSink>& t, card_set dead = {}) POKER_NOEXCEPT;
+
+    // Multiplies the range of 's' by 'likelihood' and renormalizes. A
+    // likelihood that rules out the whole range leaves it unchanged.
+    void action_taken(seat_index s, span<const float, num_hole_cards_combos> likelihood) POKER_NOEXCEPT;
+
+    // Updates the range of the player to act, given that they are about to take
+    // 'a' at 't'. Call it before 't.action_taken(a, bet)'. The model is called
+    // as 'model(t, seat, a, bet, likelihood)' and fills 'likelihood', a
+    // span<float, 1326>.
+    template<class EventSink, class ActionModel>
+    void action_taken(const basic_table<N, EventSink>& t, action a, chips bet, ActionModel&& model) POKER_NOEXCEPT;
+
+    // Removes the cards of 'cc' that were not seen yet from every range.
+    void deal(const community_cards& cc) noexcept;
+    void remove(card_set cards) noexcept;
+
+    void stop_tracking(seat_index s) noexcept { _tracked.erase(s); }
+
+private:
+    static void normalize(range& r) noexcept;
+
+private:
+    alignas(64) std::array<range, num_seats> _ranges = {};
+    alignas(64) range _likelihood = {};
+    seat_set _tracked;
+    card_set _dead;
+};
+
+using range_tracker = basic_range_tracker<9>;
+
+template<std::size_t N>
+inline auto basic_range_tracker<N>::posterior(seat_index s) const POKER_NOEXCEPT -> span<const float, num_hole_cards_combos> {
+    POKER_DETAIL_ASSERT(s < num_seats, "Invalid seat");
+    POKER_DETAIL_ASSERT(_tracked[s], "Seat must be tracked");
+
+    return _ranges[s];
+}
+
+template<std::size_t N>
+inline auto basic_range_tracker<N>::probability(seat_index s, const hole_cards& hc) const POKER_NOEXCEPT -> float {
+    return posterior(s)[hole_cards_index(hc)];
+}
+
+template<std::size_t N>
+inline void basic_range_tracker<N>::normalize(range& r) noexcept {
+    auto total = 0.0f;
+    for (auto p : r) total += p;
+    if (total <= 0) return;
+    const auto scale = 1 / total;
+    for (auto& p : r) p *= scale;
+}
+
+template<std::size_t N>
+inline void basic_range_tracker<N>::start_hand(seat_set seats, card_set dead) noexcept {
+    _tracked = seats;
+    _dead = dead;
+    auto prior = range{};
+    for (auto i = std::size_t{0}; i < num_hole_cards_combos; ++i) {
+        prior[i] = (card_set{hole_cards_from_index(i)} & dead).empty() ? 1.0f : 0.0f;
+    }
+    normalize(prior);
+    for (auto s : _tracked) _ranges[s] = prior;
+}
+
+template<std::size_t N>
+template<class EventSink>
+inline void basic_range_tracker<N>::start_hand(const basic_table<N, EventSink>& t, card_set dead) POKER_NOEXCEPT {
+    POKER_DETAIL_ASSERT(t.hand_in_progress(), "Hand must be in progress");
+
+    start_hand(t.hand_players().filter(), dead | card_set{t.community_cards().cards()});
+}
+
+template<std::size_t N>
+inline void basic_range_tracker<N>::action_taken(seat_index s, span<const float, num_hole_cards_combos> likelihood) POKER_NOEXCEPT {
+    POKER_DETAIL_ASSERT(s < num_seats, "Invalid seat");
+    POKER_DETAIL_ASSERT(_tracked[s], "Seat must be tracked");
+
+    auto& r = _ranges[s];
+    auto posterior = range{};
+    auto total = 0.0f;
+    // Straight-line loops over contiguous floats, so that they vectorize.
+    for (auto i = std::size_t{0}; i < num_hole_cards_combos; ++i) posterior[i] = r[i] * likelihood[i];
+    for (auto p : posterior) total += p;
+    if (total <= 0) return;
+    const auto scale = 1 / total;
+    for (auto i = std::size_t{0}; i < num_hole_cards_combos; ++i) r[i] = posterior[i] * scale;
+}
+
+template<std::size_t N>
+template<class EventSink, class ActionModel>
+void basic_range_tracker<N>::action_taken(const basic_table<N, EventSink>& t, action a, chips bet, ActionModel&& model) POKER_NOEXCEPT {
+    POKER_DETAIL_ASSERT(t.betting_round_in_progress(), "Betting round must be in progress");
+
+    const auto seat = t.player_to_act();
+    model(t, seat, a, bet, span<float, num_hole_cards_combos>{_likelihood});
+    action_taken(seat, _likelihood);
+    if (a == action::fold) stop_tracking(seat);
+}
+
+template<std::size_t N>
+inline void basic_range_tracker<N>::remove(card_set cards) noexcept {
+    const auto unseen = cards - _dead;
+    if (unseen.empty()) return;
+    _dead |= unseen;
+    for (auto s : _tracked) {
+        auto& r = _ranges[s];
+        // Every card takes part in 51 combinations.
+        unseen.for_each([&] (card c) {
+            const auto i = card_index(c);
+            for (auto j = std::size_t{0}; j < 52; ++j) {
+                if (j != i) r[j < i ? i * (i - 1) / 2 + j : j * (j - 1) / 2 + i] = 0;
+            }
+        });
+        normalize(r);
+    }
+}
+
+template<std::size_t N>
+inline void basic_range_tracker<N>::deal(const community_cards& cc) noexcept {
+    remove(card_set{cc.cards()});
+}
+
+} // namespace poker
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <poker/card_set.hpp>
+#include "poker/detail/error.hpp"
+#include "poker/detail/random.hpp"
+
+namespace poker {
+
+// The cards that are not dead, for Monte Carlo simulations: every draw takes
+// a uniformly random card among those not drawn yet, in O(1), and reset()
+// puts the drawn cards back, also in O(1), so rollouts from the same
+// situation only pay for the cards they draw.
+//
+// Draws swap the card they take to the end of the live cards, so the cards
+// are in no particular order after a reset, which does not matter since
+// every draw samples uniformly from all of them.
+class sampling_deck {
+public:
+    //
+    // Constructors
+    //
+    sampling_deck() noexcept : sampling_deck{card_set{}} {}
+
+    explicit sampling_deck(card_set dead) noexcept {
+        reset(dead);
+    }
+
+    //
+    // Observers
+    //
+    auto dead() const noexcept -> card_set { return _dead; }
+
+    // The number of cards left to draw.
+    auto size() const noexcept -> std::size_t { return _size; }
+
+    // The number of cards left after a reset.
+    auto num_live() const noexcept -> std::size_t { return _num_live; }
+
+    //
+    // Modifiers
+    //
+
+    // Puts back every card drawn since the last reset.
+    void reset() noexcept { _size = _num_live; }
+
+    // Starts over with different dead cards.
+    void reset(card_set dead) noexcept;
+
+    template<class URBG>
+    [[nodiscard]]
+    auto draw(URBG& g) POKER_NOEXCEPT -> card;
+
+    // Draws 'n' cards at once, e.g. a runout of the board.
+    template<class URBG>
+    [[nodiscard]]
+    auto draw(std::size_t n, URBG& g) POKER_NOEXCEPT -> card_set;
+
+private:
+    std::array<card, 52> _cards = {};
+    std::size_t _num_live = 0;
+    std::size_t _size = 0;
+    card_set _dead;
+};
+
+inline void sampling_deck::reset(card_set dead) noexcept {
+    _dead = dead;
+    _num_live = 0;
+    (card_set::full_deck() - dead).for_each([&] (card c) { _cards[_num_live++] = c; });
+    _size = _num_live;
+}
+
+template<class URBG>
+auto sampling_deck::draw(URBG& g) POKER_NOEXCEPT -> card {
+    POKER_DETAIL_ASSERT(_size > 0, "Cannot draw from an empty deck");
+    const auto i = std::size_t{detail::uniform_index(g, static_cast<std::uint32_t>(_size))};
+    --_size;
+    std::swap(_cards[i], _cards[_size]);
+    return _cards[_size];
+}
+
+template<class URBG>
+auto sampling_deck::draw(std::size_t n, URBG& g) POKER_NOEXCEPT -> card_set {
+    POKER_DETAIL_ASSERT(n <= _size, "Cannot draw more cards than are left");
+    auto cards = card_set{};
+    for (auto i = std::size_t{0}; i < n; ++i) cards.insert(draw(g));
+    return cards;
+}
+
+} // namespace poker
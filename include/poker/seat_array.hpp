@@ -4,14 +4,21 @@
 
 #include <poker/player.hpp>
 #include <poker/seat_index.hpp>
+#include <poker/seat_set.hpp>
 
 namespace poker {
 
-class seat_array {
+// The players of a table with 'N' seats. Everything from the seats up to the
+// table takes the number of seats as a template parameter, so that a
+// heads-up or 6-max table only stores and loops over the seats it has.
+template<std::size_t N>
+class basic_seat_array {
 public:
-    static constexpr auto num_seats = std::size_t{9};
+    static_assert(N >= 2 && N <= seat_set::max_seats, "A table must have between 2 and 16 seats");
 
-    constexpr auto occupancy() const noexcept -> const std::array<bool, num_seats>& {
+    static constexpr auto num_seats = N;
+
+    constexpr auto occupancy() const noexcept -> seat_set {
         return _occupancy;
     }
 
@@ -28,12 +35,12 @@ public:
     constexpr void add_player(seat_index seat, player p) POKER_NOEXCEPT {
         POKER_DETAIL_ASSERT(!occupancy()[seat], "Given seat must not be occupied");
         _players[seat] = p;
-        _occupancy[seat] = true;
+        _occupancy.insert(seat);
     }
 
     constexpr void remove_player(seat_index seat) POKER_NOEXCEPT {
         POKER_DETAIL_ASSERT(occupancy()[seat], "Given seat must be occupied");
-        _occupancy[seat] = false;
+        _occupancy.erase(seat);
     }
 
     class iterator {
@@ -42,95 +49,81 @@ public:
         using value_type = player;
         using pointer = value_type*;
         using reference = value_type&;
-        using iterator_category = std::bidirectional_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
 
-        constexpr iterator(seat_array& players, std::size_t index) noexcept
+        constexpr iterator(basic_seat_array& players, seat_set::iterator seat) noexcept
             : _players{&players}
-            , _index{index}
+            , _seat{seat}
         {
         }
 
-        constexpr auto operator*() noexcept -> player& {
-            return (*_players)[_index];
-        }
-
-        constexpr auto operator*() const noexcept -> player& {
-            return (*_players)[_index];
+        auto operator*() const noexcept -> player& {
+            return (*_players)[*_seat];
         }
 
         constexpr void operator++() noexcept {
-            do {
-                ++_index;
-            } while (_index < num_seats && !_players->occupancy()[_index]);
+            ++_seat;
         }
 
         constexpr auto operator==(const iterator& other) const noexcept -> bool {
-            return _index == other._index;
+            return _seat == other._seat;
         }
 
         constexpr auto operator!=(const iterator& other) const noexcept -> bool {
-            return _index != other._index;
+            return _seat != other._seat;
         }
 
-        constexpr auto index() const noexcept -> std::size_t {
-            return _index;
+        auto index() const noexcept -> std::size_t {
+            return *_seat;
         }
 
     private:
-        seat_array* _players = nullptr;
-        std::size_t _index = 0;
+        basic_seat_array* _players = nullptr;
+        seat_set::iterator _seat;
     };
 
     constexpr auto begin() noexcept -> iterator {
-        auto i = std::size_t{0};
-        for (; i < num_seats; ++i) {
-            if (_occupancy[i]) {
-                break;
-            }
-        }
-        return {*this, i};
+        return {*this, _occupancy.begin()};
     }
 
     constexpr auto end() noexcept -> iterator {
-        return {*this, num_seats};
+        return {*this, _occupancy.end()};
     }
 
 private:
     std::array<player, num_seats> _players = {};
-    std::array<bool, num_seats> _occupancy = {};
+    seat_set _occupancy;
 };
 
-class seat_array_view {
+template<std::size_t N>
+class basic_seat_array_view {
 public:
-    static constexpr auto num_seats = seat_array::num_seats;
+    static constexpr auto num_seats = N;
 
-    seat_array_view() = default;
+    basic_seat_array_view() = default;
 
-    seat_array_view(seat_array& players)
+    basic_seat_array_view(basic_seat_array<N>& players)
         : _players{&players}
         , _filter{players.occupancy()}
     {
     }
 
-    seat_array_view(seat_array& players, const std::array<bool, num_seats>& filter)
+    basic_seat_array_view(basic_seat_array<N>& players, seat_set filter) POKER_NOEXCEPT
         : _players{&players}
         , _filter{filter}
     {
-        // CONTRACT CHECK
-        for (auto i = 0; i < num_seats; ++i) {
-            if (filter[i]) POKER_DETAIL_ASSERT(players.occupancy()[i], "All filtered seats must be occupied");
-        }
+        POKER_DETAIL_ASSERT((filter - players.occupancy()).empty(), "All filtered seats must be occupied");
     }
 
-    constexpr auto underlying() const noexcept -> const seat_array& {
+    constexpr auto underlying() const noexcept -> const basic_seat_array<N>& {
         return *_players;
     }
 
-    constexpr auto underlying() noexcept -> seat_array& {
+    constexpr auto underlying() noexcept -> basic_seat_array<N>& {
         return *_players;
     }
 
-    constexpr auto filter() const noexcept -> const std::array<bool, num_seats>& {
+    constexpr auto filter() const noexcept -> seat_set {
         return _filter;
     }
 
@@ -146,7 +139,13 @@ public:
 
     constexpr void exclude_player(seat_index seat) POKER_NOEXCEPT {
         POKER_DETAIL_ASSERT(filter()[seat], "Given seat must be in the filter");
-        _filter[seat] = false;
+        _filter.erase(seat);
+    }
+
+    constexpr void include_player(seat_index seat) POKER_NOEXCEPT {
+        POKER_DETAIL_ASSERT(!filter()[seat], "Given seat must not be in the filter");
+        POKER_DETAIL_ASSERT(_players->occupancy()[seat], "Given seat must be occupied");
+        _filter.insert(seat);
     }
 
     class iterator {
@@ -155,62 +154,53 @@ public:
         using value_type = player;
         using pointer = value_type*;
         using reference = value_type&;
-        using iterator_category = std::bidirectional_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
 
-        constexpr iterator(seat_array_view& players, std::size_t index) noexcept
+        constexpr iterator(basic_seat_array_view& players, seat_set::iterator seat) noexcept
             : _players{&players}
-            , _index{index}
+            , _seat{seat}
         {
         }
 
-        constexpr auto operator*() noexcept -> player& {
-            return (*_players)[_index];
-        }
-
-        constexpr auto operator*() const noexcept -> player& {
-            return (*_players)[_index];
+        auto operator*() const noexcept -> player& {
+            return (*_players)[*_seat];
         }
 
         constexpr void operator++() noexcept {
-            do {
-                ++_index;
-            } while (_index < num_seats && !_players->filter()[_index]);
+            ++_seat;
         }
 
         constexpr auto operator==(const iterator& other) const noexcept -> bool {
-            return _index == other._index;
+            return _seat == other._seat;
         }
 
         constexpr auto operator!=(const iterator& other) const noexcept -> bool {
-            return _index != other._index;
+            return _seat != other._seat;
         }
 
-        constexpr auto index() const noexcept -> std::size_t {
-            return _index;
+        auto index() const noexcept -> std::size_t {
+            return *_seat;
         }
 
     private:
-        seat_array_view* _players = nullptr;
-        std::size_t _index = 0;
+        basic_seat_array_view* _players = nullptr;
+        seat_set::iterator _seat;
     };
 
     constexpr auto begin() noexcept -> iterator {
-        auto i = std::size_t{0};
-        for (; i < num_seats; ++i) {
-            if (_filter[i]) {
-                break;
-            }
-        }
-        return {*this, i};
+        return {*this, _filter.begin()};
     }
 
     constexpr auto end() noexcept -> iterator {
-        return {*this, num_seats};
+        return {*this, _filter.end()};
     }
 
 private:
-    seat_array* _players = nullptr;
-    std::array<bool, num_seats> _filter = {};
+    basic_seat_array<N>* _players = nullptr;
+    seat_set _filter;
 };
 
+using seat_array = basic_seat_array<9>;
+using seat_array_view = basic_seat_array_view<9>;
+
 } // namespace poker
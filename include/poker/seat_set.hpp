@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+
+#include <poker/seat_index.hpp>
+#include "poker/detail/bits.hpp"
+
+namespace poker {
+
+// A set of seats as a 16-bit mask, bit 's' standing for seat 's'. Tables have
+// at most 16 seats.
+class seat_set {
+public:
+    static constexpr auto max_seats = std::size_t{16};
+
+    // The seats of a set in increasing order.
+    class iterator {
+    public:
+        using difference_type = std::ptrdiff_t;
+        using value_type = seat_index;
+        using pointer = const seat_index*;
+        using reference = seat_index;
+        using iterator_category = std::forward_iterator_tag;
+
+        constexpr iterator() noexcept = default;
+        constexpr explicit iterator(std::uint16_t bits) noexcept : _bits{bits} {}
+
+        auto operator*() const noexcept -> seat_index {
+            return static_cast<seat_index>(detail::countr_zero(_bits));
+        }
+
+        constexpr auto operator++() noexcept -> iterator& {
+            _bits &= static_cast<std::uint16_t>(_bits - 1);
+            return *this;
+        }
+
+        constexpr auto operator++(int) noexcept -> iterator {
+            auto it = *this;
+            ++*this;
+            return it;
+        }
+
+        friend constexpr auto operator==(iterator x, iterator y) noexcept -> bool { return x._bits == y._bits; }
+        friend constexpr auto operator!=(iterator x, iterator y) noexcept -> bool { return x._bits != y._bits; }
+
+    private:
+        std::uint16_t _bits = 0;
+    };
+
+    //
+    // Constructors
+    //
+    constexpr seat_set() noexcept = default;
+
+    constexpr explicit seat_set(std::uint16_t bits) noexcept
+        : _bits{bits}
+    {
+    }
+
+    static constexpr auto bit(seat_index s) noexcept -> std::uint16_t {
+        return static_cast<std::uint16_t>(1u << s);
+    }
+
+    // Seats [0, n).
+    static constexpr auto first(std::size_t n) noexcept -> seat_set {
+        return seat_set{static_cast<std::uint16_t>((1u << n) - 1)};
+    }
+
+    //
+    // Observers
+    //
+    constexpr auto bits() const noexcept -> std::uint16_t         { return _bits; }
+    constexpr auto empty() const noexcept -> bool                 { return _bits == 0; }
+    constexpr auto contains(seat_index s) const noexcept -> bool  { return (_bits & bit(s)) != 0; }
+    constexpr auto operator[](seat_index s) const noexcept -> bool { return contains(s); }
+
+    auto size() const noexcept -> std::size_t {
+        return static_cast<std::size_t>(detail::popcount(_bits));
+    }
+
+    // EXPECTS: !empty()
+    auto front() const noexcept -> seat_index {
+        return static_cast<seat_index>(detail::countr_zero(_bits));
+    }
+
+    // The first seat of the set after 's', wrapping around past the last seat.
+    // It is 's' itself if that is the only one.
+    // EXPECTS: !empty()
+    auto next_or_wrap(seat_index s) const noexcept -> seat_index {
+        const auto after = static_cast<std::uint16_t>(_bits & ~((2u << s) - 1));
+        return static_cast<seat_index>(detail::countr_zero(after != 0 ? after : _bits));
+    }
+
+    //
+    // Modifiers
+    //
+    constexpr void insert(seat_index s) noexcept { _bits |= bit(s); }
+    constexpr void erase(seat_index s) noexcept  { _bits &= static_cast<std::uint16_t>(~bit(s)); }
+    constexpr void clear() noexcept              { _bits = 0; }
+
+    //
+    // Iteration
+    //
+    constexpr auto begin() const noexcept -> iterator { return iterator{_bits}; }
+    constexpr auto end()   const noexcept -> iterator { return iterator{}; }
+
+    //
+    // Set operations
+    //
+    friend constexpr auto operator|(seat_set x, seat_set y) noexcept -> seat_set { return seat_set{static_cast<std::uint16_t>(x._bits | y._bits)}; }
+    friend constexpr auto operator&(seat_set x, seat_set y) noexcept -> seat_set { return seat_set{static_cast<std::uint16_t>(x._bits & y._bits)}; }
+    friend constexpr auto operator-(seat_set x, seat_set y) noexcept -> seat_set { return seat_set{static_cast<std::uint16_t>(x._bits & ~y._bits)}; }
+    friend constexpr auto operator|=(seat_set& x, seat_set y) noexcept -> seat_set& { return x = x | y; }
+    friend constexpr auto operator&=(seat_set& x, seat_set y) noexcept -> seat_set& { return x = x & y; }
+    friend constexpr auto operator-=(seat_set& x, seat_set y) noexcept -> seat_set& { return x = x - y; }
+    friend constexpr auto operator==(seat_set x, seat_set y) noexcept -> bool { return x._bits == y._bits; }
+    friend constexpr auto operator!=(seat_set x, seat_set y) noexcept -> bool { return x._bits != y._bits; }
+
+private:
+    std::uint16_t _bits = 0;
+};
+
+} // namespace poker
@@ -0,0 +1,229 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <poker/card_set.hpp>
+#include <poker/deck.hpp>
+#include "poker/detail/parallel.hpp"
+
+namespace poker::detail {
+
+// Q(a, x), the regularized upper incomplete gamma function: a series for
+// small x and Lentz's continued fraction otherwise, as in Numerical Recipes.
+inline auto regularized_gamma_q(double a, double x) noexcept -> double {
+    if (x <= 0) return 1;
+    constexpr auto epsilon = 1e-15;
+    constexpr auto tiny = 1e-300;
+    constexpr auto max_iterations = 100000;
+    const auto log_prefix = a * std::log(x) - x - std::lgamma(a);
+    if (x < a + 1) {
+        auto ap = a;
+        auto term = 1 / a;
+        auto sum = term;
+        for (auto i = 0; i < max_iterations && std::abs(term) > std::abs(sum) * epsilon; ++i) {
+            ap += 1;
+            term *= x / ap;
+            sum += term;
+        }
+        return std::max(0.0, 1 - sum * std::exp(log_prefix));
+    }
+    auto b = x + 1 - a;
+    auto c = 1 / tiny;
+    auto d = 1 / b;
+    auto h = d;
+    for (auto i = 1; i < max_iterations; ++i) {
+        const auto an = -i * (i - a);
+        b += 2;
+        d = an * d + b;
+        if (std::abs(d) < tiny) d = tiny;
+        c = b + an / c;
+        if (std::abs(c) < tiny) c = tiny;
+        d = 1 / d;
+        const auto delta = d * c;
+        h *= delta;
+        if (std::abs(delta - 1) < epsilon) break;
+    }
+    return std::exp(log_prefix) * h;
+}
+
+} // namespace poker::detail
+
+namespace poker {
+
+// The probability of a chi-square statistic at least this large.
+inline auto chi_square_p_value(double statistic, std::size_t degrees_of_freedom) noexcept -> double {
+    return detail::regularized_gamma_q(static_cast<double>(degrees_of_freedom) / 2, statistic / 2);
+}
+
+struct chi_square_result {
+    double statistic = 0;
+    std::size_t degrees_of_freedom = 0;
+    double p_value = 1;
+};
+
+// Goodness of fit of the uniform distribution to 'counts'.
+inline auto chi_square_uniform(const std::uint64_t* counts, std::size_t n, std::size_t degrees_of_freedom) noexcept -> chi_square_result {
+    auto total = 0.0;
+    for (auto i = std::size_t{0}; i < n; ++i) total += static_cast<double>(counts[i]);
+    const auto expected = total / static_cast<double>(n);
+    auto statistic = 0.0;
+    for (auto i = std::size_t{0}; i < n; ++i) {
+        const auto difference = static_cast<double>(counts[i]) - expected;
+        statistic += difference * difference / expected;
+    }
+    return {statistic, degrees_of_freedom, chi_square_p_value(statistic, degrees_of_freedom)};
+}
+
+struct shuffle_test_report {
+    std::uint64_t num_shuffles = 0;
+    chi_square_result positions;    // Which card ends up at which position.
+    chi_square_result adjacency;    // Which ordered pair of cards is dealt in a row.
+    chi_square_result permutations; // The relative order of five cards dealt in a row.
+};
+
+// Counts of what a series of shuffles dealt. Every shuffle contributes to
+// the position table, and one window of its cards, chosen by its index, to
+// the adjacency and permutation tables, which makes each of these a sample
+// of a uniform multinomial under the null hypothesis. The position table is
+// a sum of permutation matrices, whose rows and columns all add up to the
+// number of shuffles: its Pearson statistic has the expected value 52 * 51
+// rather than the (52 - 1)^2 of its degrees of freedom, so it is scaled by
+// 51 / 52 before it is compared with the chi-square distribution.
+class shuffle_histograms {
+public:
+    //
+    // Constants
+    //
+    static constexpr auto num_cards = std::size_t{52};
+    static constexpr auto permutation_length = std::size_t{5};
+    static constexpr auto num_permutations = std::size_t{120};
+
+    //
+    // Observers
+    //
+    auto num_shuffles() const noexcept -> std::uint64_t { return _num_shuffles; }
+
+    auto report() const noexcept -> shuffle_test_report;
+
+    //
+    // Modifiers
+    //
+
+    // 'order' holds the card indices in the order they were dealt.
+    void add(const std::array<std::uint8_t, num_cards>& order, std::uint64_t shuffle_index) noexcept;
+
+    void merge(const shuffle_histograms& other) noexcept;
+
+private:
+    std::uint64_t _num_shuffles = 0;
+    std::array<std::uint64_t, num_cards * num_cards> _positions = {};         // [card][position]
+    std::array<std::uint64_t, num_cards * num_cards> _adjacency = {};         // [first][second], off the diagonal
+    std::array<std::uint64_t, num_permutations> _permutations = {};           // by Lehmer code
+};
+
+inline void shuffle_histograms::add(const std::array<std::uint8_t, num_cards>& order, std::uint64_t shuffle_index) noexcept {
+    ++_num_shuffles;
+    for (auto position = std::size_t{0}; position < num_cards; ++position) {
+        ++_positions[order[position] * num_cards + position];
+    }
+
+    const auto pair = static_cast<std::size_t>(shuffle_index % (num_cards - 1));
+    ++_adjacency[order[pair] * num_cards + order[pair + 1]];
+
+    const auto window = static_cast<std::size_t>(shuffle_index % (num_cards - permutation_length + 1));
+    auto code = std::size_t{0};
+    for (auto i = std::size_t{0}; i < permutation_length; ++i) {
+        auto smaller_after = std::size_t{0};
+        for (auto j = i + 1; j < permutation_length; ++j) smaller_after += order[window + j] < order[window + i];
+        code = code * (permutation_length - i) + smaller_after;
+    }
+    ++_permutations[code];
+}
+
+inline void shuffle_histograms::merge(const shuffle_histograms& other) noexcept {
+    _num_shuffles += other._num_shuffles;
+    for (auto i = std::size_t{0}; i < _positions.size(); ++i) _positions[i] += other._positions[i];
+    for (auto i = std::size_t{0}; i < _adjacency.size(); ++i) _adjacency[i] += other._adjacency[i];
+    for (auto i = std::size_t{0}; i < _permutations.size(); ++i) _permutations[i] += other._permutations[i];
+}
+
+inline auto shuffle_histograms::report() const noexcept -> shuffle_test_report {
+    auto result = shuffle_test_report{};
+    result.num_shuffles = _num_shuffles;
+    if (_num_shuffles == 0) return result;
+
+    constexpr auto positions_degrees_of_freedom = (num_cards - 1) * (num_cards - 1);
+    result.positions = chi_square_uniform(_positions.data(), _positions.size(), positions_degrees_of_freedom);
+    result.positions.statistic *= static_cast<double>(num_cards - 1) / num_cards;
+    result.positions.p_value = chi_square_p_value(result.positions.statistic, positions_degrees_of_freedom);
+
+    auto pairs = std::vector<std::uint64_t>{};
+    pairs.reserve(num_cards * (num_cards - 1));
+    for (auto first = std::size_t{0}; first < num_cards; ++first) {
+        for (auto second = std::size_t{0}; second < num_cards; ++second) {
+            if (first != second) pairs.push_back(_adjacency[first * num_cards + second]);
+        }
+    }
+    result.adjacency = chi_square_uniform(pairs.data(), pairs.size(), pairs.size() - 1);
+
+    result.permutations = chi_square_uniform(_permutations.data(), _permutations.size(), num_permutations - 1);
+    return result;
+}
+
+struct shuffle_test_options {
+    std::uint64_t num_shuffles = 1'000'000;
+    std::uint64_t block_size = 1 << 16; // Shuffles per call of the factory.
+    unsigned num_threads = 0;           // 0 means all cores
+};
+
+// Runs the shuffles of 'make_shuffler(block)(order)' through the statistical
+// tests, block by block, in parallel. Each thread counts into its own
+// histograms, merged at the end. 'make_shuffler' gets the index of a block
+// of 'block_size' shuffles and returns a callable filling a
+// std::array<std::uint8_t, 52> with the card indices of one shuffle in the
+// order they are dealt; seeding it from the block index keeps the results
+// independent of the number of threads.
+template<class MakeShuffler>
+auto test_shuffles(const shuffle_test_options& options, MakeShuffler&& make_shuffler) -> shuffle_test_report {
+    const auto block_size = std::max<std::uint64_t>(options.block_size, 1);
+    const auto num_blocks = static_cast<std::size_t>((options.num_shuffles + block_size - 1) / block_size);
+    const auto threads = detail::num_threads(options.num_threads);
+    auto histograms = std::vector<shuffle_histograms>(std::min<std::size_t>(std::max(threads, 1u), std::max<std::size_t>(num_blocks, 1)));
+
+    detail::parallel_for(num_blocks, threads, [&] (std::size_t chunk, std::size_t first, std::size_t last) {
+        auto& h = histograms[chunk];
+        auto order = std::array<std::uint8_t, shuffle_histograms::num_cards>{};
+        for (auto block = first; block < last; ++block) {
+            auto shuffle = make_shuffler(block);
+            const auto first_shuffle = block * block_size;
+            const auto last_shuffle = std::min<std::uint64_t>(options.num_shuffles, first_shuffle + block_size);
+            for (auto i = first_shuffle; i < last_shuffle; ++i) {
+                shuffle(order);
+                h.add(order, i);
+            }
+        }
+    });
+
+    auto total = shuffle_histograms{};
+    for (const auto& h : histograms) total.merge(h);
+    return total.report();
+}
+
+// Runs shuffles of a deck through the statistical tests, each block of
+// shuffles drawing from the generator 'make_generator(block)'.
+template<class MakeGenerator>
+auto test_deck_shuffles(const shuffle_test_options& options, MakeGenerator&& make_generator) -> shuffle_test_report {
+    return test_shuffles(options, [&] (std::size_t block) {
+        return [g = make_generator(block), d = deck{}] (std::array<std::uint8_t, shuffle_histograms::num_cards>& order) mutable {
+            d.fill_and_shuffle(g);
+            for (auto& c : order) c = static_cast<std::uint8_t>(card_index(d.draw()));
+        };
+    });
+}
+
+} // namespace poker
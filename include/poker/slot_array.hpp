@@ -4,6 +4,7 @@
 #include <array>
 #include <cassert>
 
+#include <poker/seat_set.hpp>
 #include "poker/detail/span.hpp"
 
 namespace poker {
@@ -11,9 +12,12 @@ namespace poker {
 template<typename T, std::size_t N>
 class slot_view;
 
+// Items in up to N slots, one per seat.
 template<typename T, std::size_t N>
 class slot_array {
 public:
+    static_assert(N <= seat_set::max_seats, "There must be at most one slot per seat");
+
     friend class slot_view<T, N>;
 
     using value_type      = T;
@@ -60,17 +64,17 @@ public:
         assert(!_occupancy[index]);
 
         _items[index] = value;
-        _occupancy[index] = true;
+        _occupancy.insert(index);
     }
 
     constexpr void remove(std::size_t index) noexcept {
         assert(index < N);
         assert(_occupancy[index]);
 
-        _occupancy[index] = false;
+        _occupancy.erase(index);
     }
 
-    constexpr auto occupancy() const noexcept -> std::array<bool, N> {
+    constexpr auto occupancy() const noexcept -> seat_set {
         return _occupancy;
     }
 
@@ -90,7 +94,7 @@ public:
 
 private:
     std::array<T, N> _items = {};
-    std::array<bool, N> _occupancy = {};
+    seat_set _occupancy;
 };
 
 template<typename T, std::size_t N>
@@ -107,7 +111,7 @@ public:
     constexpr iterator() = default;
 
     constexpr auto operator*() const noexcept -> reference {
-        return (*_container)[_index];
+        return (*_container)[*_slot];
     }
 
     constexpr auto operator->() const noexcept -> pointer {
@@ -115,9 +119,7 @@ public:
     }
 
     constexpr auto operator++() noexcept -> iterator& {
-        if (_index != N) {
-            while (++_index != N && !_container->occupancy()[_index]);
-        }
+        ++_slot;
         return *this;
     }
 
@@ -128,7 +130,7 @@ public:
     }
 
     constexpr friend auto operator==(const iterator& x, const iterator& y) noexcept -> bool {
-        return x._container == y._container && x._index == y._index;
+        return x._container == y._container && x._slot == y._slot;
     }
 
     constexpr friend auto operator!=(const iterator& x, const iterator& y) noexcept -> bool {
@@ -138,20 +140,17 @@ public:
 private:
     constexpr iterator(slot_array<T, N>* container) noexcept
         : _container{container}
-    {
-        const auto occupancy = container->occupancy();
-        const auto first = std::find(occupancy.cbegin(), occupancy.cend(), true);
-        _index = static_cast<std::size_t>(std::distance(occupancy.cbegin(), first));
-    }
+        , _slot{container->occupancy().begin()}
+    {}
 
-    constexpr iterator(slot_array<T, N>* container, std::size_t index) noexcept
+    constexpr iterator(slot_array<T, N>* container, seat_set::iterator slot) noexcept
         : _container{container}
-        , _index{index}
+        , _slot{slot}
     {}
 
 private:
     slot_array<T, N>* _container = nullptr;
-    std::size_t _index = 0;
+    seat_set::iterator _slot;
 };
 
 template<typename T, std::size_t N>
@@ -169,11 +168,11 @@ public:
 
     constexpr const_iterator(iterator i) noexcept
         : _container{i._container}
-        , _index{i._index}
+        , _slot{i._slot}
     {}
 
     constexpr auto operator*() const noexcept -> reference {
-        return (*_container)[_index];
+        return (*_container)[*_slot];
     }
 
     constexpr auto operator->() const noexcept -> pointer {
@@ -181,9 +180,7 @@ public:
     }
 
     constexpr auto operator++() noexcept -> const_iterator& {
-        if (_index != N) {
-            while (++_index != N && !_container->occupancy()[_index]);
-        }
+        ++_slot;
         return *this;
     }
 
@@ -194,7 +191,7 @@ public:
     }
 
     friend constexpr auto operator==(const const_iterator& x, const const_iterator& y) noexcept -> bool {
-        return x._container == y._container && x._index == y._index;
+        return x._container == y._container && x._slot == y._slot;
     }
 
     friend constexpr auto operator!=(const const_iterator& x, const const_iterator& y) noexcept -> bool {
@@ -204,20 +201,17 @@ public:
 private:
     constexpr const_iterator(const slot_array<T, N>* container) noexcept
         : _container{container}
-    {
-        const auto occupancy = container->occupancy();
-        const auto first = std::find(occupancy.cbegin(), occupancy.cend(), true);
-        _index = static_cast<std::size_t>(std::distance(occupancy.cbegin(), first));
-    }
+        , _slot{container->occupancy().begin()}
+    {}
 
-    constexpr const_iterator(const slot_array<T, N>* container, std::size_t index) noexcept
+    constexpr const_iterator(const slot_array<T, N>* container, seat_set::iterator slot) noexcept
         : _container{container}
-        , _index{index}
+        , _slot{slot}
     {}
 
 private:
     const slot_array<T, N>* _container = nullptr;
-    std::size_t _index = 0;
+    seat_set::iterator _slot;
 };
 
 template<typename T, std::size_t N>
@@ -232,12 +226,12 @@ constexpr auto slot_array<T, N>::begin() const noexcept -> const_iterator {
 
 template<typename T, std::size_t N>
 constexpr auto slot_array<T, N>::end() noexcept -> iterator {
-    return {this, N};
+    return {this, seat_set::iterator{}};
 }
 
 template<typename T, std::size_t N>
 constexpr auto slot_array<T, N>::end() const noexcept -> const_iterator {
-    return {this, N};
+    return {this, seat_set::iterator{}};
 }
 
 template<typename T, std::size_t N>
@@ -247,7 +241,7 @@ constexpr auto slot_array<T, N>::cbegin() const noexcept -> const_iterator {
 
 template<typename T, std::size_t N>
 constexpr auto slot_array<T, N>::cend() const noexcept -> const_iterator {
-    return {this, N};
+    return {this, seat_set::iterator{}};
 }
 
 template<typename T, std::size_t N>
@@ -264,7 +258,7 @@ constexpr auto operator!=(const slot_array<T, N>& x, const slot_array<T, N>& y)
 
 template<typename T, std::size_t N>
 constexpr auto slot_array<T, N>::size() const noexcept -> size_type {
-    return std::count(_occupancy.begin(), _occupancy.end(), true);
+    return _occupancy.size();
 }
 
 template<typename T, std::size_t N>
@@ -293,11 +287,11 @@ public:
 
     constexpr slot_view(span<T, N> items) noexcept
         : _items{items}
+        , _filter{seat_set::first(N)}
     {
-        std::fill(_filter.begin(), _filter.end(), true);
     }
 
-    constexpr slot_view(span<T, N> items, std::array<bool, N> filter) noexcept
+    constexpr slot_view(span<T, N> items, seat_set filter) noexcept
         : _items{items}
         , _filter{filter}
     {}
@@ -307,15 +301,14 @@ public:
         , _filter{items.occupancy()}
     {}
 
-    constexpr slot_view(slot_array<T, N>& items, std::array<bool, N> filter) noexcept
+    constexpr slot_view(slot_array<T, N>& items, seat_set filter) noexcept
         : _items{items}
         , _filter{filter}
     {
-        const auto occupancy = items.occupancy();
-        assert(std::lexicographical_compare(filter.begin(), filter.end(), occupancy.begin(), occupancy.end(), std::less_equal{}));
+        assert((filter - items.occupancy()).empty());
     }
 
-    constexpr auto filter() const noexcept -> std::array<bool, N> {
+    constexpr auto filter() const noexcept -> seat_set {
         return _filter;
     }
 
@@ -323,7 +316,7 @@ public:
         assert(index < N);
         assert(_filter[index]);
 
-        _filter[index] = false;
+        _filter.erase(index);
     }
 
     constexpr auto operator[](std::size_t index) const noexcept -> const T& {
@@ -342,7 +335,7 @@ public:
 
 private:
     span<T, N> _items = {};
-    std::array<bool, N> _filter = {};
+    seat_set _filter;
 };
 
 template<typename T, std::size_t N>
@@ -359,7 +352,7 @@ public:
     constexpr iterator() = default;
 
     constexpr auto operator*() const noexcept -> reference {
-        return (*_view)[_index];
+        return (*_view)[*_slot];
     }
 
     constexpr auto operator->() const noexcept -> pointer {
@@ -367,9 +360,7 @@ public:
     }
 
     constexpr auto operator++() noexcept -> iterator& {
-        if (_index != N) {
-            while (++_index != N && !_view->filter()[_index]);
-        }
+        ++_slot;
         return *this;
     }
 
@@ -380,7 +371,7 @@ public:
     }
 
     constexpr friend auto operator==(const iterator& x, const iterator& y) noexcept -> bool {
-        return x._view == y._view && x._index == y._index;
+        return x._view == y._view && x._slot == y._slot;
     }
 
     constexpr friend auto operator!=(const iterator& x, const iterator& y) noexcept -> bool {
@@ -390,20 +381,17 @@ public:
 private:
     constexpr iterator(slot_view<T, N>* view) noexcept
         : _view{view}
-    {
-        const auto filter = view->filter();
-        const auto first = std::find(filter.cbegin(), filter.cend(), true);
-        _index = static_cast<std::size_t>(std::distance(filter.cbegin(), first));
-    }
+        , _slot{view->filter().begin()}
+    {}
 
-    constexpr iterator(slot_view<T, N>* view, std::size_t index) noexcept
+    constexpr iterator(slot_view<T, N>* view, seat_set::iterator slot) noexcept
         : _view{view}
-        , _index{index}
+        , _slot{slot}
     {}
 
 private:
     slot_view<T, N>* _view = nullptr;
-    std::size_t _index = 0;
+    seat_set::iterator _slot;
 };
 
 template<typename T, std::size_t N>
@@ -421,11 +409,11 @@ public:
 
     constexpr const_iterator(iterator i) noexcept
         : _view{i._view}
-        , _index{i._index}
+        , _slot{i._slot}
     {}
 
     constexpr auto operator*() const noexcept -> reference {
-        return (*_view)[_index];
+        return (*_view)[*_slot];
     }
 
     constexpr auto operator->() const noexcept -> pointer {
@@ -433,9 +421,7 @@ public:
     }
 
     constexpr auto operator++() noexcept -> const_iterator& {
-        if (_index != N) {
-            while (++_index != N && !_view->filter()[_index]);
-        }
+        ++_slot;
         return *this;
     }
 
@@ -446,7 +432,7 @@ public:
     }
 
     friend constexpr auto operator==(const const_iterator& x, const const_iterator& y) noexcept -> bool {
-        return x._container == y._container && x._index == y._index;
+        return x._container == y._container && x._slot == y._slot;
     }
 
     friend constexpr auto operator!=(const const_iterator& x, const const_iterator& y) noexcept -> bool {
@@ -456,22 +442,17 @@ public:
 private:
     constexpr const_iterator(const slot_view<T, N>* view) noexcept
         : _view{view}
-    {
-        const auto filter = view->filter();
-        const auto first = std::find(filter.cbegin(), filter.cend(), true);
-        _index = static_cast<std::size_t>(std::distance(filter.cbegin(), first));
-    }
+        , _slot{view->filter().begin()}
+    {}
 
-    constexpr const_iterator(const slot_view<T, N>* view, std::size_t index) noexcept
+    constexpr const_iterator(const slot_view<T, N>* view, seat_set::iterator slot) noexcept
         : _view{view}
-        , _index{index}
-    {
-        assert(view->filter()[index]);
-    }
+        , _slot{slot}
+    {}
 
 private:
     const slot_view<T, N>* _view = nullptr;
-    std::size_t _index = 0;
+    seat_set::iterator _slot;
 };
 
 template<typename T, std::size_t N>
@@ -486,12 +467,12 @@ constexpr auto slot_view<T, N>::begin() const noexcept -> const_iterator {
 
 template<typename T, std::size_t N>
 constexpr auto slot_view<T, N>::end() noexcept -> iterator {
-    return {this, N};
+    return {this, seat_set::iterator{}};
 }
 
 template<typename T, std::size_t N>
 constexpr auto slot_view<T, N>::end() const noexcept -> const_iterator {
-    return {this, N};
+    return {this, seat_set::iterator{}};
 }
 
 template<typename T, std::size_t N>
@@ -501,7 +482,7 @@ constexpr auto slot_view<T, N>::cbegin() const noexcept -> const_iterator {
 
 template<typename T, std::size_t N>
 constexpr auto slot_view<T, N>::cend() const noexcept -> const_iterator {
-    return {this, N};
+    return {this, seat_set::iterator{}};
 }
 
 } // namespace poker
@@ -1,22 +1,23 @@
 #pragma once
 
+#include <iterator>
+#include <type_traits>
+
+#include <poker/deal_id.hpp>
 #include <poker/dealer.hpp>
+#include <poker/deck_code.hpp>
 
 #include "poker/detail/error.hpp"
+#include "poker/detail/undo_log.hpp"
 #include "poker/detail/utility.hpp"
 
 namespace poker {
 
-using action = dealer::action;
+using action = dealer_base::action;
 
-/* template<std::size_t num_seats> */
-class table {
+// What does not depend on the number of seats, shared by every basic_table.
+class table_base {
 public:
-    //
-    // Constants
-    //
-    static constexpr auto num_seats = std::size_t{9};
-
     //
     // Types
     //
@@ -29,26 +30,139 @@ public:
         all_in     = 1 << 5
     };
     POKER_DETAIL_DEFINE_FRIEND_FLAG_OPERATIONS(automatic_action)
+};
+
+template<std::size_t N>
+struct basic_table_snapshot;
+
+// The players seated at a table: those of the seat store, but for who stood
+// up or sat down during the hand, which the table only applies to the store
+// when the hand ends. Refers to the table, so it follows later seat changes.
+template<std::size_t N>
+class basic_table_seats {
+public:
+    basic_table_seats(const basic_seat_array<N>& seats, const basic_seat_array<N>& joined, const seat_set& left) noexcept
+        : _seats{&seats}
+        , _joined{&joined}
+        , _left{&left}
+    {
+    }
+
+    auto occupancy() const noexcept -> seat_set {
+        return (_seats->occupancy() - *_left) | _joined->occupancy();
+    }
+
+    auto operator[](seat_index s) const POKER_NOEXCEPT -> const player& {
+        POKER_DETAIL_ASSERT(occupancy()[s], "Given seat must be occupied");
+
+        return _joined->occupancy()[s] ? (*_joined)[s] : (*_seats)[s];
+    }
+
+    // Iterates the occupied seats in order, like the seat store.
+    class iterator {
+    public:
+        using difference_type = std::ptrdiff_t;
+        using value_type = player;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+        using iterator_category = std::forward_iterator_tag;
+
+        iterator() noexcept = default;
+
+        iterator(const basic_seat_array<N>& seats, const basic_seat_array<N>& joined, seat_set::iterator seat) noexcept
+            : _seats{&seats}
+            , _joined{&joined}
+            , _seat{seat}
+        {
+        }
+
+        auto operator*() const noexcept -> const player& {
+            return _joined->occupancy()[*_seat] ? (*_joined)[*_seat] : (*_seats)[*_seat];
+        }
+
+        void operator++() noexcept {
+            ++_seat;
+        }
+
+        auto operator==(const iterator& other) const noexcept -> bool {
+            return _seat == other._seat;
+        }
+
+        auto operator!=(const iterator& other) const noexcept -> bool {
+            return _seat != other._seat;
+        }
+
+        auto index() const noexcept -> std::size_t {
+            return *_seat;
+        }
+
+    private:
+        const basic_seat_array<N>* _seats = nullptr;
+        const basic_seat_array<N>* _joined = nullptr;
+        seat_set::iterator _seat;
+    };
+
+    // Iterators are invalidated by seat changes, like those of a seat_set.
+    auto begin() const noexcept -> iterator {
+        return {*_seats, *_joined, occupancy().begin()};
+    }
+
+    auto end() const noexcept -> iterator {
+        return {*_seats, *_joined, seat_set::iterator{}};
+    }
+
+private:
+    const basic_seat_array<N>* _seats;
+    const basic_seat_array<N>* _joined;
+    const seat_set* _left;
+};
+
+// A table with 'N' seats; 'table' has 9. What happens at the table is told
+// to the sink set with set_event_sink(), if any; see basic_dealer.
+template<std::size_t N, class EventSink = null_event_sink>
+class basic_table : public table_base {
+public:
+    //
+    // Constants
+    //
+    static constexpr auto num_seats = N;
+    static constexpr auto max_undo_depth = basic_dealer<N, EventSink>::max_undo_depth;
+
+    //
+    // Types
+    //
+    using seat_array = basic_seat_array<N>;
+    using seat_array_view = basic_seat_array_view<N>;
+    using dealer = basic_dealer<N, EventSink>;
+    using table_seats = basic_table_seats<N>;
 
     //
     // Special functions
     //
-    table() = default;
-    table(const table&) = delete;
-    table(table&&)      = delete;
-    auto operator=(const table&) -> table& = delete;
-    auto operator=(table&&)      -> table& = delete;
+    basic_table() = default;
+    basic_table(const basic_table&) = delete;
+    basic_table(basic_table&&)      = delete;
+    auto operator=(const basic_table&) -> basic_table& = delete;
+    auto operator=(basic_table&&)      -> basic_table& = delete;
 
     //
     // Constructors
     //
-    explicit table(poker::forced_bets) noexcept;
+    explicit basic_table(poker::forced_bets) noexcept;
 
     //
     // Observers
     //
-    auto seats() const noexcept -> const seat_array&;
+    // Who sits where, as of now: during a hand, players who stood up are gone
+    // and players who sat down are there.
+    auto seats() const noexcept -> table_seats;
     auto forced_bets() const noexcept -> poker::forced_bets;
+    auto all_in_settlement() const noexcept -> poker::all_in_settlement;
+    auto fractional_chips() const noexcept -> span<const double, num_seats>;
+    // The deal of the current or last hand, if it was dealt from one.
+    auto current_deal() const noexcept -> std::optional<deal_id>;
+    // The deal start_hand() will deal, once deals are seeded.
+    auto next_deal() const noexcept -> std::optional<deal_id>;
 
     // Dealer
     auto hand_in_progress()          const noexcept       -> bool;
@@ -59,9 +173,10 @@ public:
     auto player_to_act()             const POKER_NOEXCEPT -> seat_index;
     auto num_active_players()        const POKER_NOEXCEPT -> std::size_t;
     auto pots()                      const POKER_NOEXCEPT -> span<const pot>;
+    auto pot_transactions()          const POKER_NOEXCEPT -> span<const pot_transaction>;
     auto round_of_betting()          const POKER_NOEXCEPT -> poker::round_of_betting;
     auto community_cards()           const POKER_NOEXCEPT -> const poker::community_cards&;
-    auto legal_actions()             const POKER_NOEXCEPT -> dealer::action_range;
+    auto legal_actions()             const POKER_NOEXCEPT -> dealer_base::action_range;
     auto hole_cards()                const POKER_NOEXCEPT -> slot_view<const poker::hole_cards, num_seats>;
 
     // Automatic actions
@@ -69,18 +184,53 @@ public:
     auto can_set_automatic_action(seat_index) const POKER_NOEXCEPT -> bool;
     auto legal_automatic_actions(seat_index)  const POKER_NOEXCEPT -> automatic_action;
 
+    // Undo
+    auto undo_depth() const noexcept -> std::size_t;
+    auto can_undo()   const noexcept -> bool;
+
+    //
+    // Snapshots
+    //
+
+    // The whole state of the table by value, e.g. to search the game tree from
+    // the current hand or to fork it. The deck is kept as the deck_code of
+    // its order; a deck shuffled from the generator of the table is shuffled
+    // to the end from a copy of it first, so that restores deal the same cards.
+    auto snapshot() const noexcept -> basic_table_snapshot<N>;
+    void restore(const basic_table_snapshot<N>&) noexcept;
+
     //
     // Modifiers
     //
     void set_forced_bets(poker::forced_bets) POKER_NOEXCEPT;
+    // Allocates the equity cache the first time equity settlement is chosen.
+    void set_all_in_settlement(poker::all_in_settlement);
+    // The sink must outlive the table, or be replaced first.
+    void set_event_sink(EventSink*) POKER_NOEXCEPT;
+    // Numbers the following hands from 'first_hand_number', each dealt from
+    // deal_id{table_seed, hand_number} by start_hand().
+    void seed_deals(const chacha20::key_type& table_seed, std::uint64_t first_hand_number = 0) noexcept;
 
     // Adding/removing players
     void sit_down(seat_index, chips buy_in) POKER_NOEXCEPT;
     void stand_up(seat_index) POKER_NOEXCEPT;
 
     // Dealer
-    template<class URBG> void start_hand(URBG&&) POKER_NOEXCEPT;
-    template<class URBG> void start_hand(URBG&&, seat_index) POKER_NOEXCEPT;
+    // Small generators passed by value are drawn from as cards are dealt;
+    // see deck.
+    template<class URBG, class = detail::enable_if_urbg_t<URBG, deck, deal_id>> void start_hand(URBG&&) POKER_NOEXCEPT;
+    template<class URBG, class = detail::enable_if_urbg_t<URBG, deck, deal_id>> void start_hand(URBG&&, seat_index) POKER_NOEXCEPT;
+    // Deals from a copy of the given deck, e.g. to replay the same cards.
+    void start_hand(const deck&) POKER_NOEXCEPT;
+    void start_hand(const deck&, seat_index) POKER_NOEXCEPT;
+    // Deals the cards of the given deal, e.g. to reconstruct a past hand. The
+    // table keeps the generator of the deal, and the deck is shuffled from it
+    // as cards are dealt.
+    void start_hand(const deal_id&) POKER_NOEXCEPT;
+    void start_hand(const deal_id&, seat_index) POKER_NOEXCEPT;
+    // Deals the next deal; see seed_deals.
+    void start_hand() POKER_NOEXCEPT;
+    void start_hand(seat_index) POKER_NOEXCEPT;
     void action_taken(action, chips bet = 0) POKER_NOEXCEPT;
     void end_betting_round() POKER_NOEXCEPT;
     void showdown() POKER_NOEXCEPT;
@@ -88,17 +238,43 @@ public:
     // Automatic actions
     void set_automatic_action(seat_index, automatic_action);
 
+    // Undo
+    // Keeps what the last 'depth' calls of action_taken() in a betting round
+    // changed, up to max_undo_depth, so that undo() can take them back. 0
+    // keeps nothing.
+    void set_undo_depth(std::size_t depth) POKER_NOEXCEPT;
+    // Takes back the last call of action_taken(), with the automatic actions
+    // it triggered, and puts the automatic actions back as they were before
+    // it. Ending the betting round or a player standing up forgets the
+    // actions before; to go back further, see snapshot().
+    void undo() POKER_NOEXCEPT;
+
 private:
+    // What a call of action_taken() changed, besides what the dealer keeps.
+    struct undo_record {
+        std::size_t                                              num_actions = 0; // Taken by the dealer.
+        std::array<std::optional<automatic_action>, num_seats>   automatic_actions = {};
+    };
+
+    void act(action, chips bet) noexcept;
+    void take_action(action, chips bet = 0) noexcept;
     void take_automatic_action(automatic_action) noexcept;
     void amend_automatic_actions() noexcept;
     void act_passively() noexcept;
     void increment_button() noexcept;
-    void update_table_players() noexcept;
+    void apply_seat_changes() noexcept;
     auto single_active_player_remaining() const noexcept -> bool;
     void stand_up_busted_players() noexcept;
+    void start_hand_with_current_deck() POKER_NOEXCEPT;
+    void set_button(seat_index) POKER_NOEXCEPT;
+    void emit(hand_event) noexcept;
 
 private:
-    seat_array _hand_players;
+    // The one store of the players, which the dealer plays the hand on. The
+    // seat changes during a hand wait in '_joined' and '_left' until it ends.
+    seat_array _seats;
+    seat_array _joined;
+    seat_set   _left;
     bool                                                  _first_time_button = true;
     bool                                                  _button_set_manually = false; // has the button been set manually
     seat_index _button = 0;
@@ -106,36 +282,78 @@ private:
     deck                                                  _deck;
     poker::community_cards                                _community_cards;
     dealer                                                _dealer;
-
-    // All the players physically present at the table
-    seat_array _table_players;
-    // All players who took a seat or stood up before the .start_hand()
-    std::array<bool,num_seats>                            _staged = {};
     //std::array<bool,num_seats>                            _sitting_out = {}; // NOT USED
     std::array<std::optional<automatic_action>,num_seats> _automatic_actions;
+
+    poker::all_in_settlement                              _all_in_settlement = poker::all_in_settlement::runout;
+    std::optional<all_in_equity_cache>                    _equity_cache;
+    // Chips won by equity beyond the whole chips paid, summed over the hands
+    // since each player sat down.
+    std::array<double,num_seats>                          _fractional_chips = {};
+
+    std::optional<deal_id>                                _current_deal;
+    std::optional<deal_id>                                _next_deal;
+    // Shuffles the deck of a deal, one draw of the dealer at a time.
+    chacha20                                              _deal_generator{chacha20::key_type{}};
+    EventSink*                                            _event_sink = nullptr;
+
+    detail::undo_log<undo_record, max_undo_depth>         _undo_log;
+    // Actions the dealer took, ever.
+    std::size_t                                           _num_actions_taken = 0;
+};
+
+// Trivially copyable, so taking, restoring and copying a snapshot are plain
+// copies without allocations. The dealer gets its pointers back to the
+// players, deck and community cards of the table restoring it.
+template<std::size_t N>
+struct basic_table_snapshot {
+    basic_seat_array<N>                                            seats;
+    basic_seat_array<N>                                            joined;
+    seat_set                                                       left;
+    std::array<std::optional<table_base::automatic_action>, N>     automatic_actions   = {};
+    seat_index                                                     button              = 0;
+    bool                                                           first_time_button   = true;
+    bool                                                           button_set_manually = false;
+    poker::forced_bets                                             forced_bets         = {};
+    poker::all_in_settlement                                       all_in_settlement   = poker::all_in_settlement::runout;
+    std::array<double, N>                                          fractional_chips    = {};
+    // The order of the whole deck, and how many of its cards are not dealt.
+    deck_code                                                      deck_order          = {};
+    std::uint8_t                                                   deck_size           = 0;
+    poker::community_cards                                         community_cards;
+    std::optional<deal_id>                                         current_deal;
+    std::optional<deal_id>                                         next_deal;
+    basic_dealer_snapshot<N>                                       dealer;
 };
 
-inline table::table(poker::forced_bets fb) noexcept
+using table = basic_table<9>;
+using table_snapshot = basic_table_snapshot<9>;
+
+static_assert(std::is_trivially_copyable_v<table_snapshot>);
+
+template<std::size_t N, class EventSink>
+inline basic_table<N, EventSink>::basic_table(poker::forced_bets fb) noexcept
     : _forced_bets{fb}
 {
 }
 
-inline void table::take_automatic_action(automatic_action a) noexcept {
-    const auto& player = _hand_players[_dealer.player_to_act()];
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::take_automatic_action(automatic_action a) noexcept {
+    const auto& player = _seats[_dealer.player_to_act()];
     const auto biggest_bet = _dealer.biggest_bet();
     const auto bet_gap = biggest_bet - player.bet_size();
     const auto total_chips = player.total_chips();
     switch (a) {
-    case automatic_action::fold:       return _dealer.action_taken(action::fold);
-    case automatic_action::check_fold: return _dealer.action_taken(bet_gap == 0 ? action::check : action::fold);
-    case automatic_action::check:      return _dealer.action_taken(action::check);
-    case automatic_action::call:       return _dealer.action_taken(action::call);
-    case automatic_action::call_any:   return _dealer.action_taken(bet_gap == 0 ? action::check : action::call);
+    case automatic_action::fold:       return take_action(action::fold);
+    case automatic_action::check_fold: return take_action(bet_gap == 0 ? action::check : action::fold);
+    case automatic_action::check:      return take_action(action::check);
+    case automatic_action::call:       return take_action(action::call);
+    case automatic_action::call_any:   return take_action(bet_gap == 0 ? action::check : action::call);
     case automatic_action::all_in:
         if (total_chips < biggest_bet) {
-            return _dealer.action_taken(action::call);
+            return take_action(action::call);
         } else {
-            return _dealer.action_taken(action::raise, total_chips);
+            return take_action(action::raise, total_chips);
         }
         break;
     default:
@@ -143,7 +361,8 @@ inline void table::take_automatic_action(automatic_action a) noexcept {
     }
 }
 
-inline void table::amend_automatic_actions() noexcept {
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::amend_automatic_actions() noexcept {
     // fold, all_in -- no need to fallback, always legal
     // check_fold, check -- (if the bet_gap becomes >0 then check is no longer legal)
     // call -- you cannot lose your ability to call if you were able to do it in the first place
@@ -152,7 +371,7 @@ inline void table::amend_automatic_actions() noexcept {
     const auto biggest_bet = _dealer.biggest_bet();
     for (auto s = seat_index{0}; s < num_seats; ++s) {
         if (auto& aa = _automatic_actions[s]) {
-            const auto& player = _hand_players[s];
+            const auto& player = _seats[s];
             const auto bet_gap = biggest_bet - player.bet_size();
             const auto total_chips = player.total_chips();
             if (static_cast<bool>(*aa & automatic_action::check_fold) && bet_gap > 0) {
@@ -166,179 +385,365 @@ inline void table::amend_automatic_actions() noexcept {
     }
 }
 
-inline auto table::player_to_act() const POKER_NOEXCEPT -> seat_index {
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::player_to_act() const POKER_NOEXCEPT -> seat_index {
     POKER_DETAIL_ASSERT(betting_round_in_progress(), "Betting round must be in progress");
 
     return _dealer.player_to_act();
 }
 
-inline auto table::button() const POKER_NOEXCEPT -> seat_index {
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::button() const POKER_NOEXCEPT -> seat_index {
     POKER_DETAIL_ASSERT(hand_in_progress(), "Hand must be in progress");
 
     return _button;
 }
 
-inline auto table::seats() const noexcept -> const seat_array& {
-    return _table_players;
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::seats() const noexcept -> table_seats {
+    return table_seats{_seats, _joined, _left};
 }
 
-inline auto table::hand_players() const POKER_NOEXCEPT -> seat_array_view {
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::hand_players() const POKER_NOEXCEPT -> seat_array_view {
     POKER_DETAIL_ASSERT(hand_in_progress(), "Hand must be in progress");
 
     return _dealer.players();
 }
 
-inline auto table::num_active_players() const POKER_NOEXCEPT -> std::size_t {
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::num_active_players() const POKER_NOEXCEPT -> std::size_t {
     POKER_DETAIL_ASSERT(hand_in_progress(), "Hand must be in progress");
 
     return _dealer.num_active_players();
 }
 
-inline auto table::pots() const POKER_NOEXCEPT -> span<const pot> {
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::pots() const POKER_NOEXCEPT -> span<const pot> {
     POKER_DETAIL_ASSERT(hand_in_progress(), "Hand must be in progress");
 
     return _dealer.pots();
 }
 
-inline auto table::forced_bets() const noexcept -> poker::forced_bets {
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::pot_transactions() const POKER_NOEXCEPT -> span<const pot_transaction> {
+    POKER_DETAIL_ASSERT(hand_in_progress(), "Hand must be in progress");
+
+    return _dealer.pot_transactions();
+}
+
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::forced_bets() const noexcept -> poker::forced_bets {
     return _forced_bets;
 }
 
-inline void table::set_forced_bets(poker::forced_bets fb) POKER_NOEXCEPT {
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::set_forced_bets(poker::forced_bets fb) POKER_NOEXCEPT {
     POKER_DETAIL_ASSERT(!hand_in_progress(), "Hand must not be in progress");
 
     _forced_bets = fb;
 }
 
-inline void table::increment_button() noexcept {
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::all_in_settlement() const noexcept -> poker::all_in_settlement {
+    return _all_in_settlement;
+}
+
+// A player's stack plus their fractional chips is exactly what they won by
+// equity; see all_in_settlement.
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::fractional_chips() const noexcept -> span<const double, num_seats> {
+    return _fractional_chips;
+}
+
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::current_deal() const noexcept -> std::optional<deal_id> {
+    return _current_deal;
+}
+
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::next_deal() const noexcept -> std::optional<deal_id> {
+    return _next_deal;
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::set_all_in_settlement(poker::all_in_settlement s) {
+    POKER_DETAIL_ASSERT(!hand_in_progress(), "Hand must not be in progress");
+
+    if (s == poker::all_in_settlement::equity && !_equity_cache) _equity_cache.emplace();
+    _all_in_settlement = s;
+}
+
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::snapshot() const noexcept -> basic_table_snapshot<N> {
+    auto s = basic_table_snapshot<N>{};
+    s.seats = _seats;
+    s.joined = _joined;
+    s.left = _left;
+    s.automatic_actions = _automatic_actions;
+    s.button = _button;
+    s.first_time_button = _first_time_button;
+    s.button_set_manually = _button_set_manually;
+    s.forced_bets = _forced_bets;
+    s.all_in_settlement = _all_in_settlement;
+    s.fractional_chips = _fractional_chips;
+    auto d = _deck;
+    if (d.needs_generator()) {
+        // The rest of the shuffle, from a copy of where the generator is.
+        auto g = _deal_generator;
+        d.finish_shuffle(g);
+    }
+    s.deck_order = encode_deck_order(d);
+    s.deck_size = static_cast<std::uint8_t>(d.size());
+    s.community_cards = _community_cards;
+    s.current_deal = _current_deal;
+    s.next_deal = _next_deal;
+    s.dealer = _dealer.snapshot();
+    return s;
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::restore(const basic_table_snapshot<N>& s) noexcept {
+    _seats = s.seats;
+    _joined = s.joined;
+    _left = s.left;
+    _automatic_actions = s.automatic_actions;
+    _button = s.button;
+    _first_time_button = s.first_time_button;
+    _button_set_manually = s.button_set_manually;
+    _forced_bets = s.forced_bets;
+    _all_in_settlement = s.all_in_settlement;
+    _fractional_chips = s.fractional_chips;
+    _deck = deck{decode_deck_order(s.deck_order)};
+    while (_deck.size() > s.deck_size) (void)_deck.draw();
+    _community_cards = s.community_cards;
+    _current_deal = s.current_deal;
+    _next_deal = s.next_deal;
+    _dealer.restore(s.dealer, _seats, _deck, _community_cards, _equity_cache ? &*_equity_cache : nullptr, _event_sink);
+    _undo_log.clear();
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::set_event_sink(EventSink* sink) POKER_NOEXCEPT {
+    POKER_DETAIL_ASSERT(!hand_in_progress(), "Hand must not be in progress");
+
+    _event_sink = sink;
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::seed_deals(const chacha20::key_type& table_seed, std::uint64_t first_hand_number) noexcept {
+    _next_deal = deal_id{table_seed, first_hand_number};
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::increment_button() noexcept {
     if (_button_set_manually) {
         _button_set_manually = false;
         _first_time_button = false;
     } else if (_first_time_button) {
-        auto seat = seat_index{_hand_players.begin().index()};
-        assert(seat != num_seats);
-        _button = seat;
+        _button = _seats.occupancy().front();
         _first_time_button = false;
     } else {
-        auto it = seat_array::iterator{_hand_players, _button};
-        ++it;
-        if (it.index() == num_seats) {
-            _button = _hand_players.begin().index();
-        } else {
-            _button = it.index();
-        }
+        _button = _seats.occupancy().next_or_wrap(_button);
     }
 }
 
-inline void table::update_table_players() noexcept {
-    for (auto s = seat_index{0}; s < num_seats; ++s) {
-        if (!_staged[s] && _hand_players.occupancy()[s]) {
-            assert(_table_players.occupancy()[s]);
-            _table_players[s] = _hand_players[s];
-        }
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::apply_seat_changes() noexcept {
+    assert(!hand_in_progress());
+
+    for (auto s : _left) _seats.remove_player(s);
+    for (auto s : _joined.occupancy()) {
+        _seats.add_player(s, _joined[s]);
+        _joined.remove_player(s);
     }
+    _left.clear();
 }
 
 // A player is considered active (in class table context) if
 // he started in the current betting round, has not stood up or folded.
-inline auto table::single_active_player_remaining() const noexcept -> bool {
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::single_active_player_remaining() const noexcept -> bool {
     assert(betting_round_in_progress());
 
     // What dealer::betting_round_players filter returns is all the players
     // who started the current betting round and have not folded. Players who
     // actually fold are manually discarded internally (to help with pot evaluation).
-    const auto& betting_round_players = _dealer.betting_round_players().filter();
-    auto active_player_count = 0;
-    for (auto i = seat_index{0}; i < num_seats; ++i) {
-        active_player_count += (betting_round_players[i] && !_staged[i]);
-    }
-    return active_player_count == 1;
+    return (_dealer.betting_round_players().filter() - _left).size() == 1;
 }
 
-inline void table::stand_up_busted_players() noexcept {
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::stand_up_busted_players() noexcept {
     assert(!hand_in_progress());
 
-    for (auto s = seat_index{}; s < num_seats; ++s) {
-        if (_table_players.occupancy()[s] && _table_players[s].total_chips() == 0) {
-            _table_players.remove_player(s);
-        }
+    for (auto s : _seats.occupancy()) {
+        if (_seats[s].total_chips() == 0) _seats.remove_player(s);
     }
 }
 
-template<class URBG>
-inline void table::start_hand(URBG&& g) POKER_NOEXCEPT {
+template<std::size_t N, class EventSink>
+template<class URBG, class>
+inline void basic_table<N, EventSink>::start_hand(URBG&& g) POKER_NOEXCEPT {
+    POKER_DETAIL_ASSERT(!hand_in_progress(), "Hand must not be in progress");
+
+    _deck.fill_and_shuffle(std::forward<URBG>(g));
+    _current_deal.reset();
+    start_hand_with_current_deck();
+}
+
+template<std::size_t N, class EventSink>
+template<class URBG, class>
+inline void basic_table<N, EventSink>::start_hand(URBG&& g, seat_index s) POKER_NOEXCEPT {
+    set_button(s);
+    start_hand(std::forward<URBG>(g));
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::start_hand(const deck& d) POKER_NOEXCEPT {
+    POKER_DETAIL_ASSERT(!hand_in_progress(), "Hand must not be in progress");
+    POKER_DETAIL_ASSERT(d.size() == 52, "Deck must be whole");
+    POKER_DETAIL_ASSERT(!d.needs_generator(), "Deck must not need the generator of its owner");
+
+    _deck = d;
+    _current_deal.reset();
+    start_hand_with_current_deck();
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::start_hand(const deck& d, seat_index s) POKER_NOEXCEPT {
+    set_button(s);
+    start_hand(d);
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::start_hand(const deal_id& id) POKER_NOEXCEPT {
     POKER_DETAIL_ASSERT(!hand_in_progress(), "Hand must not be in progress");
+
+    // The deck is shuffled from the generator as it deals.
+    _deal_generator.reseed(id.key(), id.hand_number);
+    _deck.fill();
+    _current_deal = id;
+    start_hand_with_current_deck();
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::start_hand(const deal_id& id, seat_index s) POKER_NOEXCEPT {
+    set_button(s);
+    start_hand(id);
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::start_hand() POKER_NOEXCEPT {
+    POKER_DETAIL_ASSERT(_next_deal.has_value(), "Deals must be seeded");
+
+    const auto id = *_next_deal;
+    start_hand(id);
+    ++_next_deal->hand_number;
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::start_hand(seat_index s) POKER_NOEXCEPT {
+    set_button(s);
+    start_hand();
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::set_button(seat_index s) POKER_NOEXCEPT {
+    POKER_DETAIL_ASSERT(s <= num_seats, "Given seat index must be valid");
+    POKER_DETAIL_ASSERT(_seats.occupancy()[s], "Given seat must be occupied");
+    // start_hand will assert the rest
+
+    _button = s;
+    _button_set_manually = true;
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::start_hand_with_current_deck() POKER_NOEXCEPT {
     POKER_DETAIL_ASSERT(
-        std::count(_table_players.occupancy().begin(), _table_players.occupancy().end(), true) >= 2,
+        _seats.occupancy().size() >= 2,
         "There must be at least 2 players at the table"
         );
+    assert(_left.empty() && _joined.occupancy().empty());
 
-    _staged = {};
     _automatic_actions = {};
-    _hand_players = _table_players;
     increment_button();
-    _deck = {std::forward<URBG>(g)};
     _community_cards = {};
-    new (&_dealer) dealer{_hand_players, _button, _forced_bets, _deck, _community_cards};
+    new (&_dealer) dealer{_seats, _button, _forced_bets, _deck, _community_cards, _event_sink};
+    _dealer.set_undo_depth(_undo_log.depth());
+    _undo_log.clear();
+    _dealer.set_all_in_settlement(_all_in_settlement, _equity_cache ? &*_equity_cache : nullptr);
+    _dealer.set_deal_generator(&_deal_generator);
     _dealer.start_hand();
-    update_table_players();
 }
 
-template<class URBG>
-inline void table::start_hand(URBG&& g, seat_index s) POKER_NOEXCEPT {
-    POKER_DETAIL_ASSERT(s <= num_seats, "Given seat index must be valid");
-    POKER_DETAIL_ASSERT(_table_players.occupancy()[s], "Given seat must be occupied");
-    // other overload will assert the rest
-
-    _button = s;
-    _button_set_manually = true;
-    start_hand(std::forward<URBG>(g));
-}
-
-inline auto table::hand_in_progress() const noexcept -> bool {
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::hand_in_progress() const noexcept -> bool {
     return _dealer.hand_in_progress();
 }
 
-inline auto table::betting_round_in_progress() const POKER_NOEXCEPT -> bool {
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::betting_round_in_progress() const POKER_NOEXCEPT -> bool {
     POKER_DETAIL_ASSERT(hand_in_progress(), "Hand must be in progress");
 
     return _dealer.betting_round_in_progress();
 }
 
-inline auto table::betting_rounds_completed() const POKER_NOEXCEPT -> bool {
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::betting_rounds_completed() const POKER_NOEXCEPT -> bool {
     POKER_DETAIL_ASSERT(hand_in_progress(), "Hand must be in progress");
 
     return _dealer.betting_rounds_completed();
 }
 
-inline auto table::round_of_betting() const POKER_NOEXCEPT -> poker::round_of_betting {
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::round_of_betting() const POKER_NOEXCEPT -> poker::round_of_betting {
     POKER_DETAIL_ASSERT(hand_in_progress(), "Hand must be in progress");
 
     return _dealer.round_of_betting();
 }
 
-inline auto table::community_cards() const POKER_NOEXCEPT -> const poker::community_cards& {
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::community_cards() const POKER_NOEXCEPT -> const poker::community_cards& {
     POKER_DETAIL_ASSERT(hand_in_progress(), "Hand must be in progress");
 
     return _community_cards;
 }
 
-inline auto table::legal_actions() const POKER_NOEXCEPT -> dealer::action_range {
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::legal_actions() const POKER_NOEXCEPT -> dealer_base::action_range {
     POKER_DETAIL_ASSERT(betting_round_in_progress(), "Betting round must be in progress");
 
     return _dealer.legal_actions();
 }
 
-inline auto table::hole_cards() const POKER_NOEXCEPT -> slot_view<const poker::hole_cards, num_seats> {
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::hole_cards() const POKER_NOEXCEPT -> slot_view<const poker::hole_cards, num_seats> {
     POKER_DETAIL_ASSERT(hand_in_progress() || betting_rounds_completed(), "Hand must be in progress or showdown must have ended");
 
     return _dealer.hole_cards();
 }
 
-inline void table::action_taken(action a, chips bet) POKER_NOEXCEPT {
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::action_taken(action a, chips bet) POKER_NOEXCEPT {
     POKER_DETAIL_ASSERT(betting_round_in_progress(), "Betting round must be in progress");
 
+    auto r = undo_record{};
+    r.automatic_actions = _automatic_actions;
+    const auto first_action = _num_actions_taken;
+    act(a, bet);
+    r.num_actions = _num_actions_taken - first_action;
+    _undo_log.push(r);
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::take_action(action a, chips bet) noexcept {
     _dealer.action_taken(a, bet);
+    ++_num_actions_taken;
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::act(action a, chips bet) noexcept {
+    take_action(a, bet);
     while (_dealer.betting_round_in_progress()) {
         amend_automatic_actions();
         if (auto& ac = _automatic_actions[player_to_act()]) {
@@ -353,45 +758,49 @@ inline void table::action_taken(action a, chips bet) POKER_NOEXCEPT {
         // We only need to take action for this one player, and the other automatic actions will unfold automatically.
         act_passively();
     }
-
-    update_table_players();
 }
 
-inline void table::end_betting_round() POKER_NOEXCEPT {
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::end_betting_round() POKER_NOEXCEPT {
     POKER_DETAIL_ASSERT(!betting_round_in_progress(), "Betting round must not be in progress");
     POKER_DETAIL_ASSERT(!betting_rounds_completed(), "Betting rounds must not be completed");
 
     _dealer.end_betting_round();
+    _undo_log.clear();
     amend_automatic_actions();
-    update_table_players();
 }
 
-inline void table::showdown() POKER_NOEXCEPT {
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::showdown() POKER_NOEXCEPT {
     POKER_DETAIL_ASSERT(!betting_round_in_progress(), "Betting round must not be in progress");
     POKER_DETAIL_ASSERT(betting_rounds_completed(), "Betting rounds must be completed");
 
     _dealer.showdown();
-    update_table_players();
+    if (_dealer.settled_by_equity()) {
+        for (auto s = seat_index{0}; s < num_seats; ++s) _fractional_chips[s] += _dealer.fractional_chips()[s];
+    }
+    apply_seat_changes();
     stand_up_busted_players();
 }
 
-inline auto table::automatic_actions() const POKER_NOEXCEPT -> span<const std::optional<automatic_action>, num_seats> {
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::automatic_actions() const POKER_NOEXCEPT -> span<const std::optional<automatic_action>, num_seats> {
     POKER_DETAIL_ASSERT(hand_in_progress(), "Hand must be in progress");
 
     return _automatic_actions;
 }
 
-inline auto table::can_set_automatic_action(seat_index s) const POKER_NOEXCEPT -> bool {
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::can_set_automatic_action(seat_index s) const POKER_NOEXCEPT -> bool {
     POKER_DETAIL_ASSERT(betting_round_in_progress(), "Betting round must be in progress");
 
-    // (1) This is only ever true for players that have been in the hand since the start.
-    // Every following sit-down is accompanied by a _staged[s] = true
-    // (2) If a player is not seated at the table, he obviously cannot set his automatic actions.
-    /* return !_staged[s] && _table_players[s]; */
-    return !_staged[s] && _table_players.occupancy()[s];
+    // The store holds the players who started the hand; who sat down since
+    // waits in '_joined'. Who stood up cannot set automatic actions anymore.
+    return (_seats.occupancy() - _left)[s];
 }
 
-inline auto table::legal_automatic_actions(seat_index s) const POKER_NOEXCEPT -> automatic_action {
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::legal_automatic_actions(seat_index s) const POKER_NOEXCEPT -> automatic_action {
     POKER_DETAIL_ASSERT(can_set_automatic_action(s), "Player must be allowed to set automatic actions");
 
     // fold, all_in -- always viable
@@ -404,7 +813,7 @@ inline auto table::legal_automatic_actions(seat_index s) const POKER_NOEXCEPT ->
     // check -> nullopt
     // call_any -> check
     const auto biggest_bet = _dealer.biggest_bet();
-    const auto& player = _table_players[s];
+    const auto& player = _seats[s];
     const auto bet_size = player.bet_size();
     const auto total_chips = player.total_chips();
     auto legal_actions = automatic_action::fold | automatic_action::all_in;
@@ -420,7 +829,8 @@ inline auto table::legal_automatic_actions(seat_index s) const POKER_NOEXCEPT ->
     return legal_actions;
 }
 
-inline void table::set_automatic_action(seat_index s, automatic_action a) {
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::set_automatic_action(seat_index s, automatic_action a) {
     POKER_DETAIL_ASSERT(can_set_automatic_action(s), "Player must be allowed to set automatic actions");
     POKER_DETAIL_ASSERT(s != player_to_act(), "Player must not be the player to act");
     POKER_DETAIL_ASSERT(std::bitset<CHAR_BIT>(static_cast<unsigned char>(a)).count() == 1, "Player must pick one automatic action");
@@ -429,44 +839,52 @@ inline void table::set_automatic_action(seat_index s, automatic_action a) {
     _automatic_actions[s] = a;
 }
 
-inline void table::sit_down(seat_index s, chips buy_in) POKER_NOEXCEPT {
-    POKER_DETAIL_ASSERT(s < table::num_seats, "Given seat index must be valid");
-    POKER_DETAIL_ASSERT(!_table_players.occupancy()[s], "Given seat must not be occupied");
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::sit_down(seat_index s, chips buy_in) POKER_NOEXCEPT {
+    POKER_DETAIL_ASSERT(s < num_seats, "Given seat index must be valid");
+    POKER_DETAIL_ASSERT(!seats().occupancy()[s], "Given seat must not be occupied");
 
-    _table_players.add_player(s, player{buy_in});
-    _staged[s] = true;
+    if (hand_in_progress()) {
+        _joined.add_player(s, player{buy_in});
+    } else {
+        _seats.add_player(s, player{buy_in});
+    }
+    _fractional_chips[s] = 0;
+    auto e = hand_event{hand_event_type::player_sat_down, static_cast<std::uint8_t>(s)};
+    e.amount = buy_in;
+    emit(e);
 }
 
 // Make the current player act passively:
 // - check if possible or;
 // - call if possible.
-inline void table::act_passively() noexcept {
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::act_passively() noexcept {
     const auto legal_actions = _dealer.legal_actions();
     if (static_cast<bool>(legal_actions.action & action::check)) {
-        action_taken(action::check);
+        act(action::check, 0);
     } else {
         assert(static_cast<bool>(legal_actions.action & action::call));
-        action_taken(action::call);
+        act(action::call, 0);
     }
 }
 
 // TODO: return chips?
-inline void table::stand_up(seat_index s) POKER_NOEXCEPT {
-    POKER_DETAIL_ASSERT(s < table::num_seats, "Given seat index must be valid");
-    POKER_DETAIL_ASSERT(_table_players.occupancy()[s], "Given seat must be occupied");
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::stand_up(seat_index s) POKER_NOEXCEPT {
+    POKER_DETAIL_ASSERT(s < num_seats, "Given seat index must be valid");
+    POKER_DETAIL_ASSERT(seats().occupancy()[s], "Given seat must be occupied");
 
     if (hand_in_progress()) {
         assert(betting_round_in_progress());
-        if (s == player_to_act()) {
+        if (_joined.occupancy()[s]) {
+            _joined.remove_player(s);
+        } else if (s == player_to_act()) {
             action_taken(action::fold);
-
-            _table_players.remove_player(s);
-            _staged[s] = true;
-        } else if (_hand_players.occupancy()[s]) {
+            _left.insert(s);
+        } else {
             set_automatic_action(s, automatic_action::fold);
-
-            _table_players.remove_player(s);
-            _staged[s] = true;
+            _left.insert(s);
 
             if (single_active_player_remaining()) {
                 // We only need to take action for this one player, and the other automatic actions will unfold automatically.
@@ -474,8 +892,46 @@ inline void table::stand_up(seat_index s) POKER_NOEXCEPT {
             }
         }
     } else {
-        _table_players.remove_player(s);
+        _seats.remove_player(s);
     }
+    _undo_log.clear();
+    emit(hand_event{hand_event_type::player_stood_up, static_cast<std::uint8_t>(s)});
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::emit(hand_event e) noexcept {
+    if constexpr (!std::is_same_v<EventSink, null_event_sink>) {
+        if (_event_sink) (*_event_sink)(e);
+    }
+}
+
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::undo_depth() const noexcept -> std::size_t {
+    return _undo_log.depth();
+}
+
+// The dealer may have forgotten some of the actions of the last call when
+// they were more than the undo depth.
+template<std::size_t N, class EventSink>
+inline auto basic_table<N, EventSink>::can_undo() const noexcept -> bool {
+    return hand_in_progress() && !_undo_log.empty() && _dealer.num_undoable_actions() >= _undo_log.top().num_actions;
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::set_undo_depth(std::size_t depth) POKER_NOEXCEPT {
+    POKER_DETAIL_ASSERT(!hand_in_progress(), "Hand must not be in progress");
+
+    _undo_log.set_depth(depth);
+    _dealer.set_undo_depth(depth);
+}
+
+template<std::size_t N, class EventSink>
+inline void basic_table<N, EventSink>::undo() POKER_NOEXCEPT {
+    POKER_DETAIL_ASSERT(can_undo(), "There must be an action to undo");
+
+    const auto r = _undo_log.pop();
+    for (auto i = std::size_t{0}; i < r.num_actions; ++i) _dealer.undo();
+    _automatic_actions = r.automatic_actions;
 }
 
 } // namespace poker
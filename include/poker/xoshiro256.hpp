@@ -0,0 +1,132 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace poker {
+
+namespace detail {
+
+constexpr auto rotl(std::uint64_t x, int k) noexcept -> std::uint64_t {
+    return (x << k) | (x >> (64 - k));
+}
+
+// SplitMix64, the recommended way of expanding a 64-bit seed into a state.
+constexpr auto splitmix64(std::uint64_t& state) noexcept -> std::uint64_t {
+    auto z = (state += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+}
+
+} // namespace detail
+
+// xoshiro256** by Blackman and Vigna: a 32-byte, trivially copyable
+// generator with a period of 2^256 - 1, fast to seed and to run, and
+// therefore cheap enough to keep one per table (decks store it inline).
+//
+// Parallel streams come in two flavors:
+// - split() hands out the next 2^128 numbers of this generator and skips
+//   past them, so successive splits never overlap;
+// - xoshiro256{seed, stream} seeds a generator from both numbers, for random
+//   access to e.g. the stream of the n-th deal. Distinct streams are
+//   independent for any practical purpose.
+class xoshiro256 {
+public:
+    //
+    // Types
+    //
+    using result_type = std::uint64_t;
+
+    //
+    // Constants
+    //
+    static constexpr auto min() noexcept -> result_type { return 0; }
+    static constexpr auto max() noexcept -> result_type { return std::numeric_limits<result_type>::max(); }
+
+    //
+    // Constructors
+    //
+    constexpr xoshiro256() noexcept : xoshiro256{0} {}
+
+    constexpr explicit xoshiro256(std::uint64_t seed) noexcept {
+        for (auto& s : _state) s = detail::splitmix64(seed);
+    }
+
+    constexpr xoshiro256(std::uint64_t seed, std::uint64_t stream) noexcept {
+        auto mixed = seed;
+        mixed = detail::splitmix64(mixed) ^ stream;
+        for (auto& s : _state) s = detail::splitmix64(mixed);
+    }
+
+    //
+    // Observers
+    //
+    constexpr auto state() const noexcept -> const std::array<std::uint64_t, 4>& { return _state; }
+
+    //
+    // Modifiers
+    //
+    constexpr auto operator()() noexcept -> result_type {
+        const auto result = detail::rotl(_state[1] * 5, 7) * 9;
+        const auto t = _state[1] << 17;
+        _state[2] ^= _state[0];
+        _state[3] ^= _state[1];
+        _state[1] ^= _state[2];
+        _state[0] ^= _state[3];
+        _state[2] ^= t;
+        _state[3] = detail::rotl(_state[3], 45);
+        return result;
+    }
+
+    constexpr void discard(unsigned long long n) noexcept {
+        while (n-- > 0) (*this)();
+    }
+
+    // Advances the generator by 2^128 numbers.
+    constexpr void jump() noexcept {
+        jump({0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c});
+    }
+
+    // Advances the generator by 2^192 numbers, e.g. to give every thread its
+    // own range of 2^64 jumps.
+    constexpr void long_jump() noexcept {
+        jump({0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635});
+    }
+
+    // Returns this generator as it is, and jumps past the 2^128 numbers the
+    // returned one may use.
+    constexpr auto split() noexcept -> xoshiro256 {
+        auto result = *this;
+        jump();
+        return result;
+    }
+
+    constexpr friend auto operator==(const xoshiro256& x, const xoshiro256& y) noexcept -> bool {
+        return x._state[0] == y._state[0] && x._state[1] == y._state[1] && x._state[2] == y._state[2] && x._state[3] == y._state[3];
+    }
+
+    constexpr friend auto operator!=(const xoshiro256& x, const xoshiro256& y) noexcept -> bool {
+        return !(x == y);
+    }
+
+private:
+    constexpr void jump(const std::array<std::uint64_t, 4>& polynomial) noexcept {
+        auto s = std::array<std::uint64_t, 4>{};
+        for (auto word : polynomial) {
+            for (auto b = 0; b < 64; ++b) {
+                if (word & (std::uint64_t{1} << b)) {
+                    for (auto i = 0; i < 4; ++i) s[i] ^= _state[i];
+                }
+                (*this)();
+            }
+        }
+        _state = s;
+    }
+
+private:
+    std::array<std::uint64_t, 4> _state = {};
+};
+
+} // namespace poker
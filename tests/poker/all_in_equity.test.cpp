@@ -0,0 +1,91 @@
+#include <doctest/doctest.h>
+
+#include <poker/all_in_equity.hpp>
+#include <poker/debug/card.hpp>
+
+using namespace poker;
+
+namespace {
+
+template<std::size_t N>
+auto cards(const char* s) -> card_set {
+    return card_set{debug::make_cards<N>(s)};
+}
+
+} // namespace
+
+TEST_CASE("all-in equities") {
+    GIVEN("a complete board") {
+        const auto board = cards<5>("Ac Kd Qh Jc Ts");
+
+        THEN("players who both play the board split it") {
+            const auto hands = std::array<card_set, 2>{cards<2>("2c 2d"), cards<2>("3h 4h")};
+            const auto equities = all_in_equities(hands, board);
+            REQUIRE_EQ(equities[0], doctest::Approx(0.5));
+            REQUIRE_EQ(equities[1], doctest::Approx(0.5));
+        }
+    }
+
+    GIVEN("a turn where one player has two outs") {
+        const auto board = cards<4>("Ac 7d 2h 3s");
+        const auto hands = std::array<card_set, 2>{cards<2>("Kd Kh"), cards<2>("As 9c")};
+        const auto equities = all_in_equities(hands, board);
+
+        REQUIRE_EQ(equities[0], doctest::Approx(2.0 / 44));
+        REQUIRE_EQ(equities[1], doctest::Approx(42.0 / 44));
+    }
+
+    GIVEN("three players on the flop") {
+        const auto board = cards<3>("9c 8c 2d");
+        const auto hands = std::array<card_set, 3>{cards<2>("Ah Ad"), cards<2>("Tc Jc"), cards<2>("2h 2s")};
+        const auto equities = all_in_equities(hands, board);
+
+        REQUIRE_EQ(equities[0] + equities[1] + equities[2], doctest::Approx(1));
+        REQUIRE_GT(equities[2], equities[0]);
+    }
+
+    GIVEN("aces against kings before the flop") {
+        const auto hands = std::array<card_set, 2>{cards<2>("Ac Ad"), cards<2>("Kh Ks")};
+        const auto equities = all_in_equities(hands, {});
+
+        REQUIRE_EQ(equities[0], doctest::Approx(0.82).epsilon(0.01));
+        REQUIRE_EQ(equities[0] + equities[1], doctest::Approx(1));
+    }
+}
+
+TEST_CASE("all-in equity cache") {
+    auto cache = all_in_equity_cache{8};
+    const auto board = cards<4>("Ac 7d 2h 3s");
+    const auto kings = cards<2>("Kd Kh");
+    const auto aces = cards<2>("As 9c");
+
+    const auto x = cache.equities(std::array<card_set, 2>{kings, aces}, board);
+    const auto y = cache.equities(std::array<card_set, 2>{aces, kings}, board);
+
+    REQUIRE_EQ(cache.size(), 1);
+    REQUIRE_EQ(cache.misses(), 1);
+    REQUIRE_EQ(x[0], y[1]);
+    REQUIRE_EQ(x[1], y[0]);
+    REQUIRE_EQ(x[0], doctest::Approx(2.0 / 44));
+
+    SUBCASE("relabeling the suits is the same situation") {
+        // Clubs and spades swapped, hearts and diamonds swapped.
+        const auto z = cache.equities(std::array<card_set, 2>{cards<2>("Ac 9s"), cards<2>("Kh Kd")}, cards<4>("As 7h 2d 3c"));
+
+        REQUIRE_EQ(cache.size(), 1);
+        REQUIRE_EQ(cache.hits(), 2);
+        REQUIRE_EQ(z[0], x[1]);
+        REQUIRE_EQ(z[1], x[0]);
+    }
+
+    SUBCASE("the cache is bounded") {
+        const char* others[] = {"Qd Qh", "Jd Jh", "Td Th", "9d 9h", "8d 8h", "6d 6h", "5d 5h", "4d 4h", "Kc Ks", "Qc Qs"};
+        for (auto other : others) cache.equities(std::array<card_set, 2>{cards<2>(other), aces}, board);
+
+        REQUIRE_LE(cache.size(), cache.capacity());
+        REQUIRE_EQ(cache.misses(), 11);
+
+        cache.clear();
+        REQUIRE_EQ(cache.size(), 0);
+    }
+}
@@ -0,0 +1,97 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <random>
+
+#include <poker/table.hpp>
+
+#if defined(__GNUC__) && !defined(__clang__)
+#   pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// Replaces the global allocation functions of the test program to count the
+// allocations each thread makes.
+namespace {
+
+thread_local auto num_allocations = std::size_t{0};
+
+} // namespace
+
+auto operator new(std::size_t size) -> void* {
+    ++num_allocations;
+    if (auto p = std::malloc(size == 0 ? 1 : size)) return p;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+
+template<class Table>
+void play_hand(Table& t, std::default_random_engine& g) {
+    t.start_hand(g);
+    while (t.hand_in_progress()) {
+        while (t.betting_round_in_progress()) {
+            const auto legal = t.legal_actions();
+            if (t.player_to_act() % 3 == 0 && static_cast<bool>(legal.action & poker::action::raise)) {
+                t.action_taken(poker::action::raise, legal.chip_range.max);
+            } else if (t.player_to_act() % 3 == 1 && static_cast<bool>(legal.action & poker::action::call)) {
+                t.action_taken(poker::action::fold);
+            } else {
+                t.action_taken(static_cast<bool>(legal.action & poker::action::call) ? poker::action::call : poker::action::check);
+            }
+        }
+        t.end_betting_round();
+        if (t.betting_rounds_completed()) t.showdown();
+    }
+}
+
+} // namespace
+
+TEST_CASE("A hand does not allocate") {
+    auto t = poker::table{poker::forced_bets{poker::blinds{25, 50}, 5}};
+    auto g = std::default_random_engine{11};
+    const auto stacks = {1000, 300, 2000, 150, 800, 5000, 60};
+
+    auto i = poker::seat_index{0};
+    for (auto stack : stacks) t.sit_down(i++, stack);
+
+    const auto before = num_allocations;
+    auto num_hands = 0;
+    for (; num_hands < 20 && t.seats().occupancy().size() >= 2; ++num_hands) {
+        play_hand(t, g);
+    }
+    REQUIRE_GT(num_hands, 1);
+    REQUIRE_EQ(num_allocations - before, 0);
+}
+
+TEST_CASE("A hand settled by equity does not allocate") {
+    auto t = poker::table{poker::forced_bets{poker::blinds{25, 50}, 5}};
+    t.set_all_in_settlement(poker::all_in_settlement::equity);
+    auto g = std::default_random_engine{11};
+    // Everyone who does not fold ends up all-in.
+    const auto stacks = {1000, 300, 200, 1500, 800, 100, 60};
+
+    auto i = poker::seat_index{0};
+    for (auto stack : stacks) t.sit_down(i++, stack);
+
+    const auto before = num_allocations;
+    auto num_hands = 0;
+    for (; num_hands < 20 && t.seats().occupancy().size() >= 2; ++num_hands) {
+        play_hand(t, g);
+    }
+    REQUIRE_GT(num_hands, 1);
+    REQUIRE_EQ(num_allocations - before, 0);
+
+    const auto fractional_chips = t.fractional_chips();
+    REQUIRE(std::any_of(fractional_chips.begin(), fractional_chips.end(), [] (double x) { return x != 0; }));
+}
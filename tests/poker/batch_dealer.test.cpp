@@ -0,0 +1,65 @@
+#include <doctest/doctest.h>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include <poker/batch_dealer.hpp>
+#include <poker/xoshiro256.hpp>
+#include <poker/debug/card.hpp>
+
+using namespace poker;
+
+TEST_CASE("Dealing hands in batches") {
+    constexpr auto num_seats = std::size_t{6};
+    constexpr auto num_hands = std::size_t{1003}; // Not a multiple of the number of lanes.
+    const auto dead = card_set{debug::make_cards<2>("As Ks")};
+    auto dealer = batch_dealer{num_seats, dead};
+    auto rng = xoshiro256{3};
+    auto hole_cards = std::vector<card_set>(num_seats * num_hands);
+    auto boards = std::vector<card_set>(num_hands);
+
+    dealer.deal(hole_cards, boards, rng);
+
+    SUBCASE("every hand gets distinct live cards") {
+        for (auto h = std::size_t{0}; h < num_hands; ++h) {
+            auto dealt = boards[h];
+            REQUIRE_EQ(boards[h].size(), 5);
+            for (auto s = std::size_t{0}; s < num_seats; ++s) {
+                const auto hc = hole_cards[s * num_hands + h];
+                REQUIRE_EQ(hc.size(), 2);
+                REQUIRE((dealt & hc).empty());
+                dealt |= hc;
+            }
+            REQUIRE((dealt & dead).empty());
+        }
+    }
+
+    SUBCASE("the same generator state deals the same hands") {
+        auto other_dealer = batch_dealer{num_seats, dead};
+        auto other_rng = xoshiro256{3};
+        auto other_hole_cards = std::vector<card_set>(num_seats * num_hands);
+        auto other_boards = std::vector<card_set>(num_hands);
+        other_dealer.deal(other_hole_cards, other_boards, other_rng);
+        REQUIRE(other_hole_cards == hole_cards);
+        REQUIRE(other_boards == boards);
+    }
+
+    SUBCASE("cards are dealt uniformly") {
+        for (auto batch = 0; batch < 20; ++batch) {
+            dealer.deal(hole_cards, boards, rng);
+            auto counts = std::array<int, 52>{};
+            for (auto h = std::size_t{0}; h < num_hands; ++h) {
+                boards[h].for_each([&] (card c) { ++counts[card_index(c)]; });
+            }
+            const auto expected = num_hands * 5.0 / 50;
+            for (auto i = std::size_t{0}; i < 52; ++i) {
+                if (dead.contains(card_from_index(i))) {
+                    REQUIRE_EQ(counts[i], 0);
+                } else {
+                    REQUIRE(std::abs(counts[i] - expected) < 5 * std::sqrt(expected));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,108 @@
+#include <doctest/doctest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+
+#include <poker/card_abstraction.hpp>
+
+using namespace poker;
+
+namespace {
+
+// Three well separated groups of histograms over 8 bins: mass at the low end,
+// in the middle and at the high end.
+auto make_histograms(std::size_t rows_per_group) -> std::vector<float> {
+    auto rng = std::mt19937{42};
+    auto noise = std::uniform_real_distribution<float>{0, 0.05f};
+    auto data = std::vector<float>{};
+    for (auto group = 0; group < 3; ++group) {
+        for (auto i = std::size_t{0}; i < rows_per_group; ++i) {
+            for (auto bin = 0; bin < 8; ++bin) {
+                const auto peak = group * 3 + 1;
+                data.push_back((bin == peak || bin == peak - 1 ? 1.0f : 0.0f) + noise(rng));
+            }
+        }
+    }
+    return data;
+}
+
+} // namespace
+
+TEST_CASE("earth mover's distance") {
+    const auto a = std::array<float, 4>{1, 0, 0, 0};
+    const auto b = std::array<float, 4>{0, 0, 0, 2};
+    const auto c = std::array<float, 4>{0, 1, 0, 0};
+
+    REQUIRE_EQ(earth_movers_distance(a, a), 0);
+    REQUIRE_EQ(earth_movers_distance(a, b), 3);
+    REQUIRE_EQ(earth_movers_distance(a, c), 1);
+    REQUIRE_EQ(earth_movers_distance(c, b), 2);
+}
+
+TEST_CASE("k-means separates distinct groups of histograms") {
+    const auto data = make_histograms(200);
+    const auto histograms = histogram_matrix{data, 8};
+    auto options = kmeans_options{};
+    options.num_clusters = 3;
+    options.seed = 7;
+    options.num_threads = 4;
+
+    const auto result = cluster_histograms(histograms, options);
+
+    REQUIRE_EQ(result.buckets.size(), 600);
+    REQUIRE_EQ(result.centroids.size(), 3 * 8);
+    for (auto group = 0; group < 3; ++group) {
+        const auto first = result.buckets.begin() + group * 200;
+        REQUIRE(std::all_of(first, first + 200, [&] (auto b) { return b == *first; }));
+    }
+    REQUIRE_NE(result.buckets[0], result.buckets[200]);
+    REQUIRE_NE(result.buckets[0], result.buckets[400]);
+    REQUIRE_NE(result.buckets[200], result.buckets[400]);
+
+    SUBCASE("the result is reproducible") {
+        options.num_threads = 1;
+        const auto again = cluster_histograms(histograms, options);
+        REQUIRE(again.buckets == result.buckets);
+    }
+}
+
+TEST_CASE("histograms can be clustered straight from a mapped file") {
+    const auto data = make_histograms(50);
+    const auto path = std::string{"card_abstraction.test.bin"};
+    {
+        auto out = std::ofstream{path, std::ios::binary};
+        out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(float)));
+    }
+    {
+        const auto file = histogram_file{path, 8};
+        REQUIRE_EQ(file.histograms().num_rows(), 150);
+
+        auto options = kmeans_options{};
+        options.num_clusters = 3;
+        const auto result = cluster_histograms(file.histograms(), options);
+
+        REQUIRE_NE(result.buckets[0], result.buckets[50]);
+        REQUIRE_NE(result.buckets[50], result.buckets[100]);
+    }
+    std::remove(path.c_str());
+}
+
+TEST_CASE("bucket lookup for live situations") {
+    // An indexer which only looks at the rank of the first hole card.
+    const auto indexer = [] (const hole_cards& hc, const community_cards&) {
+        return static_cast<std::size_t>(hc.first.rank);
+    };
+    auto abstraction = card_abstraction<decltype(indexer)>{indexer};
+    auto preflop_buckets = std::vector<std::uint32_t>(13);
+    for (auto i = 0; i < 13; ++i) preflop_buckets[i] = i < 6 ? 0 : 1;
+    abstraction.set_buckets(round_of_betting::preflop, preflop_buckets);
+    abstraction.set_buckets(round_of_betting::flop, std::vector<std::uint32_t>(13, 2));
+
+    auto cc = community_cards{};
+    REQUIRE_EQ(abstraction.bucket({{card_rank::_3, card_suit::clubs}, {card_rank::_4, card_suit::clubs}}, cc), 0);
+    REQUIRE_EQ(abstraction.bucket({{card_rank::A, card_suit::clubs}, {card_rank::K, card_suit::clubs}}, cc), 1);
+
+    cc.deal(std::array<card, 3>{});
+    REQUIRE_EQ(abstraction.bucket({{card_rank::A, card_suit::clubs}, {card_rank::K, card_suit::clubs}}, cc), 2);
+}
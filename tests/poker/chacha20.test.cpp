@@ -0,0 +1,92 @@
+#include <doctest/doctest.h>
+
+#include <set>
+
+#include <poker/card_set.hpp>
+#include <poker/chacha20.hpp>
+#include <poker/deck.hpp>
+
+using namespace poker;
+
+namespace {
+
+auto counting_key() -> chacha20::key_type {
+    // The bytes 0x00, 0x01, ..., 0x1f, read as little endian words.
+    auto key = chacha20::key_type{};
+    for (auto i = std::uint32_t{0}; i < 8; ++i) {
+        const auto b = 4 * i;
+        key[i] = b | (b + 1) << 8 | (b + 2) << 16 | (b + 3) << 24;
+    }
+    return key;
+}
+
+} // namespace
+
+TEST_CASE("chacha20 generates the reference keystream") {
+    SUBCASE("RFC 7539 block function test vector") {
+        // Counter 1 and nonce 00:00:00:09:00:00:00:4a:00:00:00:00 in the
+        // 64-bit counter, 64-bit nonce layout.
+        auto rng = chacha20{counting_key(), 0x4a000000, 1 | std::uint64_t{0x09000000} << 32};
+        REQUIRE_EQ(rng(), 0xe4e7f110);
+        REQUIRE_EQ(rng(), 0x15593bd1);
+        REQUIRE_EQ(rng(), 0x1fdd0f50);
+        REQUIRE_EQ(rng(), 0xc47120a3);
+    }
+
+    SUBCASE("all-zero key") {
+        auto rng = chacha20{chacha20::key_type{}};
+        REQUIRE_EQ(rng(), 0xade0b876);
+        REQUIRE_EQ(rng(), 0x903df1a0);
+        REQUIRE_EQ(rng(), 0xe56a5d40);
+        REQUIRE_EQ(rng(), 0x28bd8653);
+
+        WHEN("The first block is used up") {
+            rng.discard(12);
+            REQUIRE_EQ(rng.block(), 1);
+            REQUIRE_EQ(rng(), 0xbee7079f);
+        }
+
+        WHEN("The first refill is used up") {
+            rng.discard(60);
+            REQUIRE_EQ(rng.block(), 4);
+            REQUIRE_EQ(rng(), 0x7488a6e5);
+        }
+    }
+}
+
+TEST_CASE("chacha20 reseeding and streams") {
+    auto rng = chacha20{counting_key(), 7};
+    rng.discard(100);
+
+    SUBCASE("seeking to a block reproduces the keystream") {
+        const auto block = rng.block();
+        auto other = chacha20{counting_key(), 7, block};
+        other.discard(100 % chacha20::block_words);
+        REQUIRE(other == rng);
+        REQUIRE_EQ(other(), rng());
+    }
+
+    SUBCASE("reseeding restarts the keystream") {
+        rng.reseed(counting_key(), 7);
+        REQUIRE(rng == chacha20(counting_key(), 7));
+        REQUIRE_EQ(rng.block(), 0);
+    }
+
+    SUBCASE("streams differ") {
+        auto firsts = std::set<std::uint32_t>{};
+        for (auto stream = std::uint64_t{0}; stream < 100; ++stream) firsts.insert(chacha20{counting_key(), stream}());
+        REQUIRE_EQ(firsts.size(), 100);
+    }
+
+    SUBCASE("an entropy seeded generator gets a fresh key") {
+        REQUIRE_NE(chacha20{}.key(), chacha20{}.key());
+    }
+}
+
+TEST_CASE("chacha20 shuffles a deck") {
+    auto rng = chacha20{counting_key()};
+    auto d = deck{rng};
+    auto dealt = card_set{};
+    while (d.size() > 0) dealt.insert(d.draw());
+    REQUIRE_EQ(dealt, card_set::full_deck());
+}
@@ -1,5 +1,6 @@
 #include <doctest/doctest.h>
 
+#include <cmath>
 #include <random>
 
 #include <poker/dealer.hpp>
@@ -309,6 +310,75 @@ TEST_CASE("Showdown") {
     }
 }
 
+TEST_CASE("All-in settlement by equity") {
+    const auto b = forced_bets{blinds{25, 50}};
+    auto dck = deck{std::default_random_engine{std::random_device{}()}};
+    auto cc = community_cards{};
+    auto players = seat_array{};
+    players.add_player(0, player{300});
+    players.add_player(1, player{200});
+    players.add_player(2, player{100});
+    auto d = dealer{players, 0, b, dck, cc};
+    d.set_all_in_settlement(all_in_settlement::equity);
+
+    d.start_hand();
+    d.action_taken(dealer::action::call);
+    d.action_taken(dealer::action::call);
+    d.action_taken(dealer::action::check);
+    d.end_betting_round();
+    REQUIRE_EQ(cc.cards().size(), 3);
+
+    d.action_taken(dealer::action::bet, 150);
+    d.action_taken(dealer::action::call);
+    d.action_taken(dealer::action::call);
+    d.end_betting_round();
+    REQUIRE(d.betting_rounds_completed());
+
+    const auto hc = d.hole_cards();
+    const auto board = card_set{cc.cards()};
+    const auto main_pot = all_in_equities(std::array<card_set, 3>{hc[0], hc[1], hc[2]}, board);
+    const auto side_pot = all_in_equities(std::array<card_set, 2>{hc[0], hc[1]}, board);
+    d.showdown();
+
+    REQUIRE(d.settled_by_equity());
+    REQUIRE_EQ(cc.cards().size(), 3); // The turn and river were never dealt.
+    REQUIRE_EQ(players[0].stack() + players[1].stack() + players[2].stack(), 600);
+    REQUIRE_EQ(players[0].stack() - 100 + d.fractional_chips()[0], doctest::Approx(300 * main_pot[0] + 200 * side_pot[0]));
+    REQUIRE_EQ(players[1].stack() + d.fractional_chips()[1], doctest::Approx(300 * main_pot[1] + 200 * side_pot[1]));
+    REQUIRE_EQ(players[2].stack() + d.fractional_chips()[2], doctest::Approx(300 * main_pot[2]));
+    for (auto s = 0; s < 3; ++s) {
+        REQUIRE_LT(std::abs(d.fractional_chips()[s]), 1);
+    }
+}
+
+TEST_CASE("All-in settlement by equity pays the chips nobody could match back") {
+    const auto b = forced_bets{blinds{25, 50}};
+    auto dck = deck{std::default_random_engine{7}};
+    auto cc = community_cards{};
+    auto players = seat_array{};
+    players.add_player(0, player{500});
+    players.add_player(1, player{200});
+    players.add_player(2, player{100});
+    auto cache = all_in_equity_cache{};
+    auto d = dealer{players, 0, b, dck, cc};
+    d.set_all_in_settlement(all_in_settlement::equity, &cache);
+
+    d.start_hand();
+    d.action_taken(dealer::action::raise, 500);
+    d.action_taken(dealer::action::call);
+    d.action_taken(dealer::action::call);
+    d.end_betting_round();
+    REQUIRE(d.betting_rounds_completed());
+    d.showdown();
+
+    REQUIRE(d.settled_by_equity());
+    // The main pot and the side pot; the 300 chips only seat 0 put in are
+    // not enumerated.
+    REQUIRE_EQ(cache.misses(), 2);
+    REQUIRE_EQ(players[0].stack() + players[1].stack() + players[2].stack(), 800);
+    REQUIRE_GE(players[0].stack(), 300);
+}
+
 TEST_CASE("Calling on the big blind does not cause a crash") {
     // dealer::action_taken did not deduct the bet from the folding player, but only read it.
     // This caused player.bet() to fail, because a smaller bet than the existing one was placed.
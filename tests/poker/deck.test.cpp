@@ -0,0 +1,163 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include <poker/deck.hpp>
+
+using namespace poker;
+
+namespace {
+
+// Counts the numbers it generates, and is too big to be stored in a deck.
+struct counting_engine {
+    using result_type = std::minstd_rand::result_type;
+    static constexpr auto min() { return std::minstd_rand::min(); }
+    static constexpr auto max() { return std::minstd_rand::max(); }
+
+    auto operator()() -> result_type {
+        ++calls;
+        return engine();
+    }
+
+    std::minstd_rand engine;
+    std::size_t calls = 0;
+    char padding[deck::max_inline_generator_size] = {};
+};
+
+// Small enough to be stored in a deck, and counts the numbers it generates
+// outside of it.
+struct counted_engine {
+    using result_type = std::minstd_rand::result_type;
+    static constexpr auto min() { return std::minstd_rand::min(); }
+    static constexpr auto max() { return std::minstd_rand::max(); }
+
+    auto operator()() -> result_type {
+        ++*calls;
+        return engine();
+    }
+
+    std::minstd_rand engine;
+    std::size_t* calls;
+};
+
+auto draw_all(deck& d) -> std::vector<card> {
+    auto cards = std::vector<card>{};
+    while (d.size() > 0) cards.push_back(d.draw());
+    return cards;
+}
+
+} // namespace
+
+TEST_CASE("a deck deals every card once") {
+    auto d = deck{std::minstd_rand{1}};
+    REQUIRE_EQ(d.size(), 52);
+
+    auto cards = draw_all(d);
+    std::sort(cards.begin(), cards.end());
+    REQUIRE(std::adjacent_find(cards.begin(), cards.end()) == cards.end());
+    REQUIRE_EQ(cards.size(), 52);
+}
+
+TEST_CASE("the same generator state deals the same cards") {
+    auto referenced = std::minstd_rand{7};
+    auto by_reference = deck{referenced};
+    auto stored = deck{std::minstd_rand{7}};
+    auto shuffled_up_front = deck{counting_engine{std::minstd_rand{7}}};
+    const auto copy = stored;
+
+    const auto cards = draw_all(by_reference);
+    REQUIRE_EQ(draw_all(stored), cards);
+    REQUIRE_EQ(draw_all(shuffled_up_front), cards);
+
+    SUBCASE("a deck does not refer to a generator passed by reference") {
+        auto g = std::minstd_rand{11};
+        auto d = deck{g};
+        REQUIRE_NE(g, std::minstd_rand{11}); // It shuffled up front.
+        g.discard(100);
+
+        auto same = deck{std::minstd_rand{11}};
+        REQUIRE_EQ(draw_all(d), draw_all(same));
+    }
+
+    SUBCASE("copies of a deck that stores its generator deal the same cards") {
+        auto d = copy;
+        REQUIRE_EQ(draw_all(d), cards);
+    }
+
+    SUBCASE("refilling the deck starts from the cards in order") {
+        auto d = deck{};
+        for (auto i = 0; i < 3; ++i) {
+            d.fill_and_shuffle(std::minstd_rand{7});
+            for (auto j = 0; j < 9; ++j) REQUIRE_EQ(d.draw(), cards[j]);
+        }
+    }
+}
+
+TEST_CASE("the deck only shuffles the cards it deals") {
+    auto calls = std::size_t{0};
+    auto d = deck{counted_engine{std::minstd_rand{}, &calls}};
+
+    for (auto i = 0; i < 9; ++i) (void)d.draw();
+    const auto dealt = calls;
+    REQUIRE_GT(dealt, 0);
+    REQUIRE_LT(dealt, 52);
+
+    while (d.size() > 0) (void)d.draw();
+    REQUIRE_GT(calls, dealt);
+}
+
+TEST_CASE("a deck can be shuffled by the generator of its owner") {
+    auto calls = std::size_t{0};
+    auto g = counted_engine{std::minstd_rand{7}, &calls};
+    auto d = deck{};
+    d.fill();
+    REQUIRE(d.needs_generator());
+
+    auto same = deck{std::minstd_rand{7}};
+    for (auto i = 0; i < 9; ++i) REQUIRE_EQ(d.draw(g), same.draw());
+    REQUIRE_GT(calls, 0);
+    REQUIRE_LT(calls, 52);
+
+    SUBCASE("it finishes the shuffle with a copy of the generator") {
+        auto copy = d;
+        auto h = g;
+        copy.finish_shuffle(h);
+        REQUIRE_FALSE(copy.needs_generator());
+
+        auto rest = std::vector<card>{};
+        while (d.size() > 0) rest.push_back(d.draw(g));
+        REQUIRE_FALSE(d.needs_generator());
+        REQUIRE_EQ(draw_all(copy), rest);
+        REQUIRE_EQ(draw_all(same), rest);
+    }
+}
+
+TEST_CASE("finishing the shuffle detaches the deck from its generator") {
+    auto calls = std::size_t{0};
+    auto d = deck{counted_engine{std::minstd_rand{}, &calls}};
+    auto same = deck{counting_engine{}};
+    (void)d.draw();
+    (void)same.draw();
+
+    d.finish_shuffle();
+    const auto shuffled = calls;
+    REQUIRE_EQ(draw_all(d), draw_all(same));
+    REQUIRE_EQ(calls, shuffled);
+}
+
+TEST_CASE("every card is equally likely to be dealt first") {
+    auto g = std::mt19937{42};
+    auto counts = std::array<int, 52>{};
+    auto d = deck{};
+    for (auto i = 0; i < 52 * 200; ++i) {
+        d.fill_and_shuffle(g);
+        const auto c = d.draw();
+        ++counts[static_cast<std::size_t>(c.suit) * 13 + static_cast<std::size_t>(c.rank)];
+    }
+    for (auto count : counts) {
+        REQUIRE_GT(count, 140);
+        REQUIRE_LT(count, 260);
+    }
+}
@@ -0,0 +1,85 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <array>
+
+#include <poker/card_set.hpp>
+#include <poker/deck_code.hpp>
+#include <poker/xoshiro256.hpp>
+
+using namespace poker;
+
+namespace {
+
+auto ordered() -> std::array<card, 52> {
+    auto cards = std::array<card, 52>{};
+    for (auto i = std::size_t{0}; i < 52; ++i) cards[i] = card_from_index(i);
+    return cards;
+}
+
+} // namespace
+
+TEST_CASE("deck codes") {
+    SUBCASE("the ordered deck has rank 0") {
+        REQUIRE_EQ(encode_deck_order(ordered()), deck_code{});
+        REQUIRE_EQ(decode_deck_order(deck_code{}), ordered());
+    }
+
+    SUBCASE("the reversed deck has the largest rank, 52! - 1") {
+        auto reversed = ordered();
+        std::reverse(reversed.begin(), reversed.end());
+        const auto code = encode_deck_order(reversed);
+        // 52! - 1 = 0x2fde529a...: 226 bits, so the last byte is 0x02.
+        REQUIRE_EQ(code[28], 0x02);
+        REQUIRE_EQ(decode_deck_order(code), reversed);
+    }
+
+    SUBCASE("swapping the last two cards adds one") {
+        auto order = ordered();
+        std::swap(order[50], order[51]);
+        auto expected = deck_code{};
+        expected[0] = 1;
+        REQUIRE_EQ(encode_deck_order(order), expected);
+    }
+
+    SUBCASE("shuffled decks round trip") {
+        auto rng = xoshiro256{9};
+        for (auto i = 0; i < 1000; ++i) {
+            auto d = deck{rng};
+            const auto order = d.order();
+            const auto code = encode_deck_order(d);
+            REQUIRE_EQ(decode_deck_order(code), order);
+
+            auto replay = deck{decode_deck_order(code)};
+            for (auto c : order) REQUIRE_EQ(replay.draw(), c);
+        }
+    }
+}
+
+TEST_CASE("a deck's order") {
+    GIVEN("A deck that has dealt some cards") {
+        auto d = deck{xoshiro256{3}};
+        auto copy = d;
+        const auto first = d.draw();
+        const auto second = d.draw();
+
+        THEN("Its order starts with those cards and deals the rest next") {
+            const auto order = d.order();
+            REQUIRE_EQ(order[0], first);
+            REQUIRE_EQ(order[1], second);
+            REQUIRE_EQ(order, copy.order());
+            REQUIRE_EQ(d.draw(), order[2]);
+        }
+    }
+
+    GIVEN("A deck built from an order") {
+        auto rng = xoshiro256{4};
+        const auto order = deck{rng}.order();
+        auto d = deck{order};
+
+        THEN("Refilling it starts over from the ordered cards") {
+            d.fill_and_shuffle(xoshiro256{4});
+            REQUIRE_EQ(d.order(), order);
+        }
+    }
+}
@@ -0,0 +1,61 @@
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "poker/detail/mpmc_ring.hpp"
+
+using namespace poker::detail;
+
+TEST_CASE("mpmc ring on one thread") {
+    auto ring = mpmc_ring<int>{4};
+    REQUIRE_EQ(ring.capacity(), 4);
+
+    auto value = 0;
+    REQUIRE_FALSE(ring.try_pop(value));
+    for (auto i = 0; i < 4; ++i) REQUIRE(ring.try_push(int{i}));
+    REQUIRE_FALSE(ring.try_push(4));
+    REQUIRE_EQ(ring.size(), 4);
+
+    for (auto i = 0; i < 4; ++i) {
+        REQUIRE(ring.try_pop(value));
+        REQUIRE_EQ(value, i);
+    }
+    REQUIRE_FALSE(ring.try_pop(value));
+    REQUIRE_EQ(ring.size(), 0);
+}
+
+TEST_CASE("mpmc ring on many threads") {
+    constexpr auto num_threads = 4;
+    constexpr auto per_thread = std::uint64_t{20000};
+    auto ring = mpmc_ring<std::uint64_t>{64};
+    auto popped = std::atomic<std::uint64_t>{0};
+    auto sum = std::atomic<std::uint64_t>{0};
+
+    auto threads = std::vector<std::thread>{};
+    for (auto t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t] {
+            for (auto i = std::uint64_t{0}; i < per_thread; ++i) {
+                while (!ring.try_push(t * per_thread + i + 1)) std::this_thread::yield();
+            }
+        });
+        threads.emplace_back([&] {
+            auto value = std::uint64_t{0};
+            while (popped.load() < num_threads * per_thread) {
+                if (ring.try_pop(value)) {
+                    sum += value;
+                    ++popped;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+
+    const auto n = num_threads * per_thread;
+    REQUIRE_EQ(popped.load(), n);
+    REQUIRE_EQ(sum.load(), n * (n + 1) / 2);
+}
@@ -1,5 +1,10 @@
 #include <doctest/doctest.h>
 
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
 #include "poker/detail/pot_manager.hpp"
 
 using namespace poker;
@@ -20,3 +25,103 @@ TEST_CASE("whatever") {
     REQUIRE_EQ(pm.pots()[1].size(), 40);
     REQUIRE_EQ(pm.pots()[2].size(), 20);
 }
+
+TEST_CASE("Collecting bets records who put what into which pot") {
+    auto players = seat_array{};
+    for (auto seat : {1, 3, 5, 7}) players.add_player(seat, player{1000});
+    players[1].bet(50);
+    players[3].bet(200);
+    players[5].bet(200);
+    players[7].bet(120);
+    // A player with a bet of 80 folded.
+    auto pm = pot_manager{};
+    pm.bet_folded(80);
+    pm.collect_bets_from(players);
+
+    REQUIRE_EQ(pm.pots().size(), 3);
+    REQUIRE_EQ(pm.pots()[0].size(), 4 * 50 + 80);
+    REQUIRE_EQ(pm.pots()[1].size(), 3 * 70);
+    REQUIRE_EQ(pm.pots()[2].size(), 2 * 80);
+
+    using t = pot_transaction;
+    const auto transactions = std::vector<std::tuple<int, int, chips>>{
+        {1, 0, 50}, {3, 0, 50}, {5, 0, 50}, {7, 0, 50}, {t::folded_bets, 0, 80},
+        {3, 1, 70}, {5, 1, 70}, {7, 1, 70},
+        {3, 2, 80}, {5, 2, 80}
+    };
+    auto recorded = std::vector<std::tuple<int, int, chips>>{};
+    for (const auto& tx : pm.transactions()) recorded.emplace_back(tx.seat, tx.pot, tx.amount);
+    REQUIRE_EQ(recorded, transactions);
+    for (auto seat : {1, 3, 5, 7}) REQUIRE_EQ(players[seat].bet_size(), 0);
+}
+
+namespace {
+
+// How the pot manager collected bets before, one bet level per pass.
+auto collect_level_by_level(std::vector<pot>& pots, chips& folded_bets, seat_array& players) -> void {
+    for (;;) {
+        const auto min_bet = pots.back().collect_bets_from(players);
+        const auto num_eligible_players = static_cast<chips>(pots.back().eligible_players().size());
+        const auto consumed = std::min(folded_bets, num_eligible_players * min_bet);
+        pots.back().add(consumed);
+        folded_bets -= consumed;
+        if (std::any_of(players.begin(), players.end(), [] (const auto& p) { return p.bet_size() != 0; })) {
+            pots.emplace_back();
+            continue;
+        }
+        pots.back().add(folded_bets);
+        folded_bets = 0;
+        break;
+    }
+}
+
+} // namespace
+
+TEST_CASE("Collecting bets in one pass makes the same pots as level by level") {
+    auto g = std::mt19937{17};
+    for (auto trial = 0; trial < 2000; ++trial) {
+        auto players = seat_array{};
+        for (auto seat = seat_index{0}; seat < 9; ++seat) {
+            if (g() % 4 != 0) players.add_player(seat, player{100000});
+        }
+        auto expected_players = players;
+        auto pm = pot_manager{};
+        auto expected_pots = std::vector<pot>(1);
+        auto folded_bets = chips{0};
+
+        for (auto street = 0; street < 3; ++street) {
+            auto total_bets = chips{0};
+            for (auto seat = seat_index{0}; seat < 9; ++seat) {
+                if (!players.occupancy()[seat]) continue;
+                // Few distinct amounts, so that bets often tie.
+                const auto bet = static_cast<chips>(g() % 4) * 25;
+                total_bets += bet;
+                if (g() % 4 == 0) {
+                    pm.bet_folded(bet);
+                    folded_bets += bet;
+                    players.remove_player(seat);
+                    expected_players.remove_player(seat);
+                } else {
+                    players[seat].bet(bet);
+                    expected_players[seat].bet(bet);
+                }
+            }
+            if (players.occupancy().empty()) break;
+
+            pm.collect_bets_from(players);
+            collect_level_by_level(expected_pots, folded_bets, expected_players);
+
+            REQUIRE_EQ(pm.pots().size(), expected_pots.size());
+            for (auto i = std::size_t{0}; i < expected_pots.size(); ++i) {
+                REQUIRE_EQ(pm.pots()[i].size(), expected_pots[i].size());
+                REQUIRE_EQ(pm.pots()[i].eligible_players().bits(), expected_pots[i].eligible_players().bits());
+            }
+            auto transferred = chips{0};
+            for (const auto& tx : pm.transactions()) transferred += tx.amount;
+            REQUIRE_EQ(transferred, total_bets);
+            for (auto seat = seat_index{0}; seat < 9; ++seat) {
+                if (players.occupancy()[seat]) REQUIRE_EQ(players[seat].bet_size(), 0);
+            }
+        }
+    }
+}
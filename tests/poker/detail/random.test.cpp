@@ -0,0 +1,63 @@
+#include <doctest/doctest.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+#include "poker/detail/random.hpp"
+
+using namespace poker::detail;
+
+namespace {
+
+// Replays the words it is given.
+struct scripted_engine {
+    using result_type = std::uint32_t;
+    static constexpr auto min() -> result_type { return 0; }
+    static constexpr auto max() -> result_type { return 0xffffffff; }
+
+    auto operator()() -> result_type { return words[next++]; }
+
+    std::array<std::uint32_t, 4> words;
+    std::size_t next = 0;
+};
+
+template<class URBG>
+void check_uniform(URBG g, std::uint32_t bound) {
+    auto counts = std::array<int, 64>{};
+    constexpr auto n = 64000;
+    for (auto i = 0; i < n; ++i) {
+        ++counts[uniform_index(g, bound)];
+    }
+    const auto expected = static_cast<double>(n) / bound;
+    for (auto x = std::uint32_t{0}; x < counts.size(); ++x) {
+        if (x < bound) {
+            REQUIRE(std::abs(counts[x] - expected) < 5 * std::sqrt(expected));
+        } else {
+            REQUIRE_EQ(counts[x], 0);
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("uniform indices") {
+    SUBCASE("full word generators") {
+        check_uniform(std::mt19937{1}, 52);
+        check_uniform(std::mt19937_64{2}, 7);
+    }
+
+    SUBCASE("other generators") {
+        check_uniform(std::minstd_rand{3}, 52);
+    }
+
+    SUBCASE("multiply and reject") {
+        // With a bound of 3, the words below 2^32 mod 3 = 1 are rejected.
+        auto g = scripted_engine{{0, 1, 0x80000000, 0}};
+        REQUIRE_EQ(uniform_index(g, 3), 0);
+        REQUIRE_EQ(g.next, 2);
+        REQUIRE_EQ(uniform_index(g, 3), 1);
+        REQUIRE_EQ(g.next, 3);
+    }
+}
@@ -1,6 +1,6 @@
 #include <doctest/doctest.h>
 
-#include <array>
+#include <poker/seat_set.hpp>
 
 #include "poker/detail/round.hpp"
 
@@ -8,7 +8,7 @@ using namespace poker;
 using namespace poker::detail;
 
 TEST_CASE("two leave, one of which is contesting do not result in round being over") {
-    auto players = std::array<bool, 9>{true, true, true};
+    auto players = seat_set::first(3);
     auto r = poker::detail::round{players, 0};
 
     r.action_taken(round::action::aggressive | round::action::leave);
@@ -17,7 +17,7 @@ TEST_CASE("two leave, one of which is contesting do not result in round being ov
 }
 
 TEST_CASE("round construction") {
-    auto players = std::array<bool, 9>{true, true, true};
+    auto players = seat_set::first(3);
     auto r = poker::detail::round{players, 0};
 
     REQUIRE(r.in_progress());
@@ -27,7 +27,7 @@ TEST_CASE("round construction") {
 }
 
 SCENARIO("there are only 2 players in the round") {
-    auto players = std::array<bool, 9>{true, true};
+    auto players = seat_set::first(2);
     auto r = poker::detail::round{players, 0};
 
     GIVEN("there was no action in the round yet") {
@@ -188,7 +188,7 @@ SCENARIO("there are only 2 players in the round") {
 }
 
 SCENARIO("there are more than 2 players in the round") {
-    auto players = std::array<bool, 9>{true, true, true};
+    auto players = seat_set::first(3);
     auto r = poker::detail::round{players, 0};
 
     const auto initial_num_active_players = r.num_active_players();
@@ -485,7 +485,7 @@ SCENARIO("there are more than 2 players in the round") {
 }
 
 SCENARIO("there are 3 players and the first one acts first") {
-    auto players = std::array<bool, 9>{true, true, true};
+    auto players = seat_set::first(3);
     auto current = seat_index{0};
 
     // Test for first action (_is_next_player_contested) exception.
@@ -0,0 +1,44 @@
+#include <doctest/doctest.h>
+
+#include "poker/detail/undo_log.hpp"
+
+using namespace poker::detail;
+
+TEST_CASE("undo log") {
+    auto log = undo_log<int, 8>{};
+
+    GIVEN("A depth of 0") {
+        log.push(1);
+
+        THEN("Nothing is kept") {
+            REQUIRE(log.empty());
+        }
+    }
+
+    GIVEN("A depth of 3") {
+        log.set_depth(3);
+        for (auto i = 1; i <= 2; ++i) log.push(i);
+
+        THEN("The records come back last first") {
+            REQUIRE_EQ(log.size(), 2);
+            REQUIRE_EQ(log.top(), 2);
+            REQUIRE_EQ(log.pop(), 2);
+            REQUIRE_EQ(log.pop(), 1);
+            REQUIRE(log.empty());
+        }
+
+        WHEN("More records are pushed than it keeps") {
+            for (auto i = 3; i <= 7; ++i) log.push(i);
+
+            THEN("The oldest are forgotten") {
+                REQUIRE_EQ(log.size(), 3);
+                REQUIRE_EQ(log.pop(), 7);
+                REQUIRE_EQ(log.pop(), 6);
+                log.push(8);
+                REQUIRE_EQ(log.pop(), 8);
+                REQUIRE_EQ(log.pop(), 5);
+                REQUIRE(log.empty());
+            }
+        }
+    }
+}
@@ -0,0 +1,103 @@
+#include <doctest/doctest.h>
+
+#include <stdexcept>
+
+#include <poker/duplicate.hpp>
+
+using namespace poker;
+
+namespace {
+
+// Checks or calls down to showdown.
+template<class Table>
+void check_down(Table& t, std::size_t, std::size_t) {
+    while (t.hand_in_progress()) {
+        if (t.betting_round_in_progress()) {
+            const auto legal = t.legal_actions();
+            t.action_taken(static_cast<bool>(legal.action & action::check) ? action::check : action::call);
+        } else if (!t.betting_rounds_completed()) {
+            t.end_betting_round();
+        } else {
+            t.showdown();
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("seat rotations") {
+    const auto r = rotations(3);
+    REQUIRE_EQ(r.size(), 3);
+    REQUIRE_EQ(r[0], seating{0, 1, 2});
+    REQUIRE_EQ(r[1], seating{1, 2, 0});
+    REQUIRE_EQ(r[2], seating{2, 0, 1});
+}
+
+TEST_CASE("duplicate deals") {
+    auto options = duplicate_options{};
+    options.forced_bets = forced_bets{blinds{25, 50}};
+    options.starting_stack = 1000;
+    options.seed = 3;
+
+    GIVEN("two players with the same strategy swapping seats") {
+        const auto seatings = rotations(2);
+        const auto results = play_duplicate(300, seatings, check_down<table>, options);
+
+        THEN("every deal cancels out") {
+            REQUIRE_EQ(results.num_deals(), 300);
+            for (auto d = std::size_t{0}; d < results.num_deals(); ++d) {
+                REQUIRE_EQ(results.deal(d)[0], 0);
+                REQUIRE_EQ(results.deal(d)[1], 0);
+            }
+        }
+    }
+
+    GIVEN("a single seating") {
+        const auto seatings = std::vector<seating>{{0, 1, 2}};
+        const auto results = play_duplicate(300, seatings, check_down<table>, options);
+
+        THEN("the deals are played like regular hands") {
+            auto decided = 0;
+            for (auto d = std::size_t{0}; d < results.num_deals(); ++d) {
+                const auto deal = results.deal(d);
+                REQUIRE_EQ(deal[0] + deal[1] + deal[2], 0);
+                decided += deal[0] != 0;
+            }
+            REQUIRE_GT(decided, 0);
+        }
+
+        THEN("the results do not depend on the number of threads") {
+            auto single_threaded_options = options;
+            single_threaded_options.num_threads = 1;
+            const auto single_threaded = play_duplicate(300, seatings, check_down<table>, single_threaded_options);
+            for (auto player = std::size_t{0}; player < 3; ++player) {
+                REQUIRE_EQ(results.total(player), single_threaded.total(player));
+            }
+        }
+    }
+
+    GIVEN("tables of another size") {
+        options.button = 1;
+        const auto seatings = std::vector<seating>{{1, 5}, {5, 1}};
+        const auto results = play_duplicate<6>(50, seatings, check_down<basic_table<6>>, options);
+
+        THEN("every deal cancels out") {
+            for (auto d = std::size_t{0}; d < results.num_deals(); ++d) {
+                REQUIRE_EQ(results.deal(d)[0], 0);
+            }
+        }
+    }
+
+    GIVEN("a hand that throws on a worker thread") {
+        options.num_threads = 2;
+        const auto seatings = rotations(2);
+        const auto play_hand = [] (table& t, std::size_t deal, std::size_t seating_index) {
+            if (deal == 7) throw std::runtime_error{"Bot crashed"};
+            check_down(t, deal, seating_index);
+        };
+
+        THEN("the caller gets the exception") {
+            REQUIRE_THROWS_AS(play_duplicate(8, seatings, play_hand, options), std::runtime_error);
+        }
+    }
+}
@@ -0,0 +1,116 @@
+#include <doctest/doctest.h>
+
+#include <random>
+#include <vector>
+
+#include <poker/hand_event.hpp>
+#include <poker/table.hpp>
+
+namespace {
+
+auto types(poker::span<const poker::hand_event> events) -> std::vector<poker::hand_event_type> {
+    auto result = std::vector<poker::hand_event_type>{};
+    for (const auto& e : events) result.push_back(e.type);
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("A table tells its event sink what happens in a hand") {
+    using type = poker::hand_event_type;
+
+    auto log = poker::hand_event_log<>{};
+    auto t = poker::basic_table<6, poker::hand_event_log<>>{poker::forced_bets{poker::blinds{25, 50}, 5}};
+    t.set_event_sink(&log);
+    t.sit_down(0, 1000);
+    t.sit_down(2, 1000);
+    t.sit_down(4, 100);
+    REQUIRE_EQ(log.size(), 3);
+    REQUIRE_EQ(log.events()[2].type, type::player_sat_down);
+    REQUIRE_EQ(log.events()[2].seat, 4);
+    REQUIRE_EQ(log.events()[2].amount, 100);
+    log.clear();
+
+    t.start_hand(std::default_random_engine{7}, 0);
+
+    THEN("The blinds, antes and hole cards come first") {
+        REQUIRE_EQ(types(log.events()), std::vector<type>{
+            type::hand_started,
+            type::ante_posted, type::ante_posted, type::ante_posted,
+            type::small_blind_posted, type::big_blind_posted,
+            type::hole_cards_dealt, type::hole_cards_dealt, type::hole_cards_dealt
+        });
+        REQUIRE_EQ(log.events()[0].seat, 0);
+        REQUIRE_EQ(log.events()[4].seat, 2);
+        REQUIRE_EQ(log.events()[4].amount, 25);
+        REQUIRE_EQ(log.events()[5].seat, 4);
+        REQUIRE_EQ(log.events()[5].amount, 50);
+        for (auto i = 6; i < 9; ++i) {
+            const auto& e = log.events()[i];
+            REQUIRE_EQ(e.dealt_cards().size(), 2);
+            REQUIRE_EQ(e.cards[0], t.hole_cards()[e.seat].first);
+            REQUIRE_EQ(e.cards[1], t.hole_cards()[e.seat].second);
+        }
+    }
+
+    WHEN("A short stack is all-in and called") {
+        log.clear();
+        t.action_taken(poker::action::raise, 300);
+        t.action_taken(poker::action::fold);
+        t.action_taken(poker::action::call);
+        t.end_betting_round();
+
+        THEN("The actions and both pots are told") {
+            REQUIRE_EQ(types(log.events()), std::vector<type>{
+                type::raise, type::fold, type::call,
+                type::pot_collected, type::pot_collected,
+                type::community_cards_dealt, type::community_cards_dealt, type::community_cards_dealt
+            });
+            REQUIRE_EQ(log.events()[0].amount, 300);
+            REQUIRE_EQ(log.events()[2].seat, 4);
+            REQUIRE_EQ(log.events()[2].amount, 95);
+
+            const auto& main_pot = log.events()[3];
+            REQUIRE_EQ(main_pot.pot, 0);
+            REQUIRE_EQ(main_pot.amount, 95 + 95 + 25);
+            REQUIRE_EQ(main_pot.players, (1 << 0) | (1 << 4));
+            const auto& side_pot = log.events()[4];
+            REQUIRE_EQ(side_pot.pot, 1);
+            REQUIRE_EQ(side_pot.amount, 300 - 95);
+            REQUIRE_EQ(side_pot.players, 1 << 0);
+
+            REQUIRE_EQ(log.events()[5].dealt_cards().size(), 3);
+            REQUIRE_EQ(log.events()[6].dealt_cards().size(), 1);
+            REQUIRE_EQ(log.events()[7].dealt_cards().size(), 1);
+        }
+
+        AND_WHEN("The hand ends") {
+            auto stacks = std::vector<poker::chips>{};
+            for (auto s : {0, 2, 4}) stacks.push_back(t.seats()[s].stack());
+            log.clear();
+            t.showdown();
+
+            THEN("The awards add up to what the stacks won") {
+                REQUIRE_EQ(log.events().back().type, type::hand_ended);
+                auto won = std::vector<poker::chips>(3, 0);
+                for (const auto& e : log.events()) {
+                    if (e.type != type::pot_awarded) continue;
+                    won[e.seat / 2] += e.amount;
+                }
+                for (auto i = 0; i < 3; ++i) {
+                    if (t.seats().occupancy()[2 * i]) REQUIRE_EQ(t.seats()[2 * i].stack() - stacks[i], won[i]);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("The default sink costs nothing") {
+    static_assert(sizeof(poker::hand_event) == 16);
+    static_assert(std::is_empty_v<poker::null_event_sink>);
+    auto t = poker::table{poker::forced_bets{poker::blinds{25, 50}}};
+    t.sit_down(0, 1000);
+    t.sit_down(1, 1000);
+    t.start_hand(std::default_random_engine{1});
+    REQUIRE(t.hand_in_progress());
+}
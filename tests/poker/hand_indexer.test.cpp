@@ -0,0 +1,81 @@
+#include <doctest/doctest.h>
+
+#include <random>
+#include <set>
+
+#include <poker/hand_indexer.hpp>
+
+using namespace poker;
+
+namespace {
+
+auto permute_suits(card c, const std::array<int, 4>& permutation) -> card {
+    return {c.rank, static_cast<card_suit>(permutation[static_cast<std::size_t>(c.suit)])};
+}
+
+auto random_situation(std::mt19937& rng, std::size_t board_size) -> std::pair<hole_cards, std::array<card, 5>> {
+    auto cards = std::array<std::size_t, 52>{};
+    for (auto i = std::size_t{0}; i < 52; ++i) cards[i] = i;
+    std::shuffle(cards.begin(), cards.end(), rng);
+    auto board = std::array<card, 5>{};
+    for (auto i = std::size_t{0}; i < board_size; ++i) board[i] = card_from_index(cards[2 + i]);
+    return {{card_from_index(cards[0]), card_from_index(cards[1])}, board};
+}
+
+} // namespace
+
+TEST_CASE("number of isomorphism classes per street") {
+    const auto indexer = hand_indexer{};
+
+    REQUIRE_EQ(indexer.size(round_of_betting::preflop), 169);
+    REQUIRE_EQ(indexer.size(round_of_betting::flop), 1'286'792);
+    REQUIRE_EQ(indexer.size(round_of_betting::turn), 55'190'538);
+    REQUIRE_EQ(indexer.size(round_of_betting::river), 2'428'287'420);
+}
+
+TEST_CASE("every preflop combination maps onto one of the 169 classes") {
+    const auto indexer = hand_indexer{};
+    auto indices = std::set<std::uint64_t>{};
+    for (auto i = std::size_t{0}; i < 52; ++i) {
+        for (auto j = i + 1; j < 52; ++j) {
+            const auto hc = hole_cards{card_from_index(i), card_from_index(j)};
+            const auto index = indexer.index(hc, community_cards{});
+            REQUIRE_LT(index, 169);
+            REQUIRE_EQ(indexer.index(hole_cards{hc.second, hc.first}, community_cards{}), index);
+            indices.insert(index);
+        }
+    }
+    REQUIRE_EQ(indices.size(), 169);
+}
+
+TEST_CASE("suit permutations share an index") {
+    const auto indexer = hand_indexer{};
+    auto rng = std::mt19937{1};
+    auto permutation = std::array<int, 4>{0, 1, 2, 3};
+    for (auto board_size : {0, 3, 4, 5}) {
+        for (auto n = 0; n < 500; ++n) {
+            const auto [hc, board] = random_situation(rng, board_size);
+            std::shuffle(permutation.begin(), permutation.end(), rng);
+            auto permuted_board = board;
+            for (auto& c : permuted_board) c = permute_suits(c, permutation);
+            const auto permuted_hc = hole_cards{permute_suits(hc.second, permutation), permute_suits(hc.first, permutation)};
+
+            const auto index = indexer.index(hc, span<const card>(board).first(board_size));
+            REQUIRE_EQ(indexer.index(permuted_hc, span<const card>(permuted_board).first(board_size)), index);
+        }
+    }
+}
+
+TEST_CASE("unindexing yields a situation with the same index") {
+    const auto indexer = hand_indexer{};
+    auto rng = std::mt19937_64{2};
+    for (auto rob : {round_of_betting::preflop, round_of_betting::flop, round_of_betting::turn, round_of_betting::river}) {
+        auto pick = std::uniform_int_distribution<std::uint64_t>{0, indexer.size(rob) - 1};
+        for (auto n = 0; n < 2000; ++n) {
+            const auto index = n == 0 ? 0 : n == 1 ? indexer.size(rob) - 1 : pick(rng);
+            const auto s = indexer.unindex(rob, index);
+            REQUIRE_EQ(s.community_cards.cards().size(), static_cast<std::size_t>(rob));
+            REQUIRE_EQ(indexer.index(s.hole_cards, s.community_cards), index);
+        }
+    }
+}
@@ -0,0 +1,80 @@
+#include <doctest/doctest.h>
+
+#include <chrono>
+#include <numeric>
+
+#include <poker/icm.hpp>
+
+using namespace poker;
+
+TEST_CASE("heads-up ICM is proportional to the stacks") {
+    const auto stacks = std::array<chips, 2>{3000, 1000};
+    const auto payouts = std::array<double, 2>{70, 30};
+
+    const auto result = icm_equities(stacks, payouts);
+
+    REQUIRE(result.exact);
+    REQUIRE_EQ(result.equities[0], doctest::Approx(0.75 * 70 + 0.25 * 30));
+    REQUIRE_EQ(result.equities[1], doctest::Approx(0.25 * 70 + 0.75 * 30));
+}
+
+TEST_CASE("three-handed ICM matches the Malmuth-Harville recursion") {
+    const auto stacks = std::array<chips, 3>{5000, 3000, 2000};
+    const auto payouts = std::array<double, 2>{65, 35};
+
+    const auto result = icm_equities(stacks, payouts);
+
+    // P(second | first) summed over every possible winner.
+    const auto second = [&] (std::size_t i) {
+        auto p = 0.0;
+        for (auto w = std::size_t{0}; w < 3; ++w) {
+            if (w != i) p += stacks[w] / 10000.0 * stacks[i] / (10000.0 - stacks[w]);
+        }
+        return p;
+    };
+    for (auto i = std::size_t{0}; i < 3; ++i) {
+        REQUIRE_EQ(result.equities[i], doctest::Approx(stacks[i] / 10000.0 * 65 + second(i) * 35));
+    }
+    REQUIRE_EQ(std::accumulate(result.equities.begin(), result.equities.end(), 0.0), doctest::Approx(100));
+}
+
+TEST_CASE("Monte Carlo ICM agrees with the exact computation within its error bounds") {
+    const auto stacks = std::array<chips, 12>{900, 1700, 400, 2500, 1200, 800, 3100, 600, 1500, 2200, 1000, 300};
+    const auto payouts = std::array<double, 4>{50, 25, 15, 10};
+    auto options = icm_options{};
+    options.exact_player_limit = 12;
+    const auto exact = icm_equities(stacks, payouts, options);
+
+    options.exact_player_limit = 10;
+    options.num_samples = 1 << 18;
+    options.seed = 3;
+    const auto estimate = icm_equities(stacks, payouts, options);
+
+    REQUIRE(exact.exact);
+    REQUIRE_FALSE(estimate.exact);
+    for (auto i = std::size_t{0}; i < stacks.size(); ++i) {
+        REQUIRE_GT(estimate.standard_errors[i], 0);
+        REQUIRE_LT(std::abs(estimate.equities[i] - exact.equities[i]), 5 * estimate.standard_errors[i]);
+    }
+
+    SUBCASE("the estimate does not depend on the number of threads") {
+        options.num_threads = 1;
+        const auto single = icm_equities(stacks, payouts, options);
+        options.num_threads = 3;
+        const auto multi = icm_equities(stacks, payouts, options);
+        REQUIRE(single.equities == multi.equities);
+    }
+}
+
+TEST_CASE("ICM of the players seated at a table") {
+    auto players = seat_array{};
+    players.add_player(2, player{1000});
+    players.add_player(5, player{1000});
+    const auto payouts = std::array<double, 2>{60, 40};
+
+    const auto equities = icm_equities(players, payouts);
+
+    REQUIRE_EQ(equities[0], 0);
+    REQUIRE_EQ(equities[2], doctest::Approx(50));
+    REQUIRE_EQ(equities[5], doctest::Approx(50));
+}
@@ -0,0 +1,119 @@
+#include <doctest/doctest.h>
+
+#include <random>
+
+#include <poker/all_in_equity.hpp>
+#include <poker/hand_event.hpp>
+#include <poker/match_evaluation.hpp>
+
+using namespace poker;
+
+namespace {
+
+// Heads-up all-in before the flop: seat 0 wins 1, loses 1 or ties. The value
+// function is exact from the turn on and knows nothing before that.
+auto all_in_value(const hand_history& h) -> double {
+    if (h.board_size < 4) return 0;
+    const auto hands = std::array<card_set, 2>{card_set{*h.hole_cards[0]}, card_set{*h.hole_cards[1]}};
+    const auto equities = all_in_equities(hands, card_set{h.community_cards()});
+    return equities[0] - equities[1];
+}
+
+auto play_all_in(std::mt19937_64& rng, aivat& evaluator) -> double {
+    auto dck = deck{rng};
+    evaluator.start_hand();
+    const auto hero = hole_cards{dck.draw(), dck.draw()};
+    const auto villain = hole_cards{dck.draw(), dck.draw()};
+    evaluator.hole_cards_dealt(0, hero, all_in_value);
+    evaluator.hole_cards_dealt(1, villain, all_in_value);
+    auto board = std::array<card, 5>{};
+    for (auto& c : board) c = dck.draw();
+    evaluator.community_cards_dealt(board, all_in_value);
+    return all_in_value(evaluator.history());
+}
+
+} // namespace
+
+TEST_CASE("AIVAT corrections") {
+    auto rng = std::mt19937_64{1};
+    auto evaluator = aivat{};
+
+    GIVEN("a value function that is exact from the turn on") {
+        for (auto hand = 0; hand < 20; ++hand) {
+            const auto winnings = play_all_in(rng, evaluator);
+            auto flop = evaluator.history();
+            flop.board_size = 3;
+            const auto hands = std::array<card_set, 2>{card_set{*flop.hole_cards[0]}, card_set{*flop.hole_cards[1]}};
+            const auto equities = all_in_equities(hands, card_set{flop.community_cards()});
+
+            THEN("the corrected winnings are the equity on the flop") {
+                REQUIRE_EQ(evaluator.corrected(winnings), doctest::Approx(equities[0] - equities[1]));
+            }
+        }
+    }
+
+    GIVEN("a player with a known strategy") {
+        evaluator.start_hand();
+        const auto value = [] (const hand_history& h) {
+            return h.actions.empty() ? 0.0 : h.actions.back().action == action::fold ? -1.0 : 3.0;
+        };
+        const auto policy = std::array<weighted_action, 2>{{{action::fold, 0, 0.25}, {action::call, 0, 0.75}}};
+        evaluator.action_taken(0, action::call, 0, policy, value);
+
+        THEN("the decision is corrected by its expected value") {
+            REQUIRE_EQ(evaluator.correction(), doctest::Approx(3.0 - (0.25 * -1.0 + 0.75 * 3.0)));
+            REQUIRE_EQ(evaluator.history().actions.size(), 1);
+        }
+
+        WHEN("the strategy of the next player is unknown") {
+            evaluator.action_taken(1, action::fold, 0, {}, value);
+
+            THEN("the decision is not corrected") {
+                REQUIRE_EQ(evaluator.correction(), doctest::Approx(1));
+                REQUIRE_EQ(evaluator.history().actions.size(), 2);
+            }
+        }
+    }
+}
+
+TEST_CASE("recording what a table of another size dealt") {
+    auto log = hand_event_log<>{};
+    auto t = basic_table<6, hand_event_log<>>{forced_bets{blinds{25, 50}}};
+    t.set_event_sink(&log);
+    t.sit_down(1, 1000);
+    t.sit_down(5, 1000);
+    t.start_hand(std::mt19937{7});
+
+    auto evaluator = basic_aivat<6>{};
+    evaluator.start_hand();
+    const auto value = [] (const basic_hand_history<6>& h) { return static_cast<double>(h.dealt_cards().size()); };
+    evaluator.cards_dealt(t, value);
+
+    REQUIRE_EQ(evaluator.history().hole_cards[1], t.hole_cards()[1]);
+    REQUIRE_EQ(evaluator.history().hole_cards[5], t.hole_cards()[5]);
+    REQUIRE_FALSE(evaluator.history().hole_cards[3].has_value());
+    // Every outcome deals as many cards, so there is nothing to correct.
+    REQUIRE_EQ(evaluator.correction(), 0);
+}
+
+TEST_CASE("evaluating a match in shards") {
+    const auto play_shard = [] (std::size_t shard, match_accumulator& acc) {
+        auto rng = std::mt19937_64{shard};
+        auto evaluator = aivat{};
+        for (auto hand = 0; hand < 100; ++hand) {
+            const auto winnings = play_all_in(rng, evaluator);
+            acc.add(winnings, evaluator.corrected(winnings));
+        }
+    };
+
+    const auto result = evaluate_match(8, play_shard);
+    const auto single_threaded = evaluate_match(8, play_shard, 1);
+
+    REQUIRE_EQ(result.raw.num_hands, 800);
+    REQUIRE_EQ(result.corrected.mean, single_threaded.corrected.mean);
+    REQUIRE_EQ(result.raw.mean, single_threaded.raw.mean);
+    // Both are estimates of zero, the corrected one a tighter one.
+    REQUIRE_LT(std::abs(result.raw.mean), 4 * result.raw.standard_error);
+    REQUIRE_LT(std::abs(result.corrected.mean), 4 * result.corrected.standard_error);
+    REQUIRE_LT(result.corrected.standard_error, 0.8 * result.raw.standard_error);
+}
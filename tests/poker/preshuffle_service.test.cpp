@@ -0,0 +1,73 @@
+#include <doctest/doctest.h>
+
+#include <chrono>
+#include <thread>
+
+#include <poker/card_set.hpp>
+#include <poker/preshuffle_service.hpp>
+#include <poker/table.hpp>
+#include <poker/xoshiro256.hpp>
+
+using namespace poker;
+
+TEST_CASE("Pre-shuffled decks") {
+    auto options = preshuffle_options{};
+    options.capacity = 64;
+    options.num_producers = 2;
+    auto service = preshuffle_service{[] (unsigned producer) { return xoshiro256{7, producer}; }, options};
+
+    // Give the producers time to fill the ring.
+    for (auto i = 0; i < 1000 && service.statistics().ready < options.capacity; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    REQUIRE_EQ(service.statistics().capacity, options.capacity);
+    REQUIRE_EQ(service.statistics().ready, options.capacity);
+
+    SUBCASE("decks are whole and shuffled") {
+        auto fallback = xoshiro256{1};
+        auto first = service.take(fallback);
+        auto second = service.take(fallback);
+        auto dealt = card_set{};
+        auto same = 0;
+        while (first.size() > 0) {
+            const auto c = first.draw();
+            dealt.insert(c);
+            same += c == second.draw();
+        }
+        REQUIRE_EQ(dealt, card_set::full_deck());
+        REQUIRE(same < 10);
+    }
+
+    SUBCASE("every deck comes from the ring or from the fallback") {
+        auto fallback = xoshiro256{1};
+        for (auto i = 0; i < 1000; ++i) {
+            const auto d = service.take(fallback);
+            REQUIRE_EQ(d.size(), 52);
+        }
+        const auto s = service.statistics();
+        REQUIRE_EQ(s.taken + s.stalls, 1000);
+        REQUIRE(s.taken >= options.capacity);
+        REQUIRE(s.produced >= s.taken);
+    }
+
+    SUBCASE("decks shuffled from the fallback do not refer to it") {
+        auto fallback = xoshiro256{1};
+        for (auto i = 0; i < 1000 && service.statistics().stalls == 0; ++i) {
+            auto d = service.take(fallback);
+            if (service.statistics().stalls == 0) continue;
+            auto copy = d;
+            auto same = true;
+            while (d.size() > 0) same &= d.draw() == copy.draw();
+            REQUIRE(same);
+        }
+    }
+
+    SUBCASE("tables start hands from ready decks") {
+        auto t = table{forced_bets{blinds{25, 50}}};
+        t.sit_down(0, 1000);
+        t.sit_down(1, 1000);
+        auto fallback = xoshiro256{1};
+        t.start_hand(service.take(fallback));
+        REQUIRE(t.hand_in_progress());
+    }
+}
@@ -0,0 +1,146 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include <poker/push_fold.hpp>
+#include <poker/debug/card.hpp>
+
+using namespace poker;
+
+namespace {
+
+auto class_of(const char* s) -> std::size_t {
+    const auto cards = debug::make_cards<2>(s);
+    return preflop_class(hole_cards{cards[0], cards[1]});
+}
+
+auto equity_table() -> const preflop_equity& {
+    static const auto equity = preflop_equity{};
+    return equity;
+}
+
+} // namespace
+
+TEST_CASE("hand values") {
+    const auto value = [] (const char* s) {
+        return detail::hand_value(card_set{debug::make_cards<7>(s)});
+    };
+
+    SUBCASE("categories are ordered like hand rankings") {
+        const char* ascending[] = {
+            "Ac Kd 9h 7s 5c 3d 2h",
+            "Ac Ad 9h 7s 5c 3d 2h",
+            "Ac Ad 9h 9s 5c 3d 2h",
+            "Ac Ad Ah 9s 5c 3d 2h",
+            "Ac 2d 3h 4s 5c 9d 9h", // the wheel
+            "6c 2d 3h 4s 5c 9d 9h",
+            "Ac Kc 9c 7c 5c 3d 2h",
+            "Ac Ad Ah 9s 9c 3d 2h",
+            "Ac Ad Ah As 5c 3d 2h",
+            "Ac 2c 3c 4c 5c 9d 9h",
+            "Ac Kc Qc Jc Tc 9d 9h",
+        };
+        for (auto i = std::size_t{1}; i < std::size(ascending); ++i) {
+            REQUIRE_LT(value(ascending[i - 1]), value(ascending[i]));
+        }
+    }
+
+    SUBCASE("ties are broken by the best five cards only") {
+        REQUIRE_EQ(value("Ac Ad Kh Ks 5c 5d 7h"), value("Ac Ad Kh Ks 7c 2d 3h"));
+        REQUIRE_LT(value("Ac Ad Kh Ks 5c 5d 6h"), value("Ac Ad Kh Ks 7c 2d 3h"));
+        REQUIRE_EQ(value("3c 3d 3h Ts Tc Td 2h"), value("Tc Td Th 3s 3c 2d 4h"));
+        REQUIRE_EQ(value("Ac Kc Qc Jc 9c 8c 7h"), value("Ac Kc Qc Jc 9c 2c 7h"));
+    }
+
+    SUBCASE("seven cards are worth their best five") {
+        auto rng = std::mt19937_64{42};
+        auto deck = std::array<card, 52>{};
+        for (auto i = std::size_t{0}; i < 52; ++i) deck[i] = card_from_index(i);
+
+        for (auto trial = 0; trial < 2000; ++trial) {
+            std::shuffle(deck.begin(), deck.end(), rng);
+            auto best = std::uint32_t{0};
+            for (auto skip1 = 0; skip1 < 7; ++skip1) {
+                for (auto skip2 = skip1 + 1; skip2 < 7; ++skip2) {
+                    auto five = card_set{};
+                    for (auto i = 0; i < 7; ++i) {
+                        if (i != skip1 && i != skip2) five.insert(deck[i]);
+                    }
+                    best = std::max(best, detail::hand_value(five));
+                }
+            }
+            REQUIRE_EQ(detail::hand_value(card_set{span<const card>{deck.data(), 7}}), best);
+        }
+    }
+}
+
+TEST_CASE("preflop classes") {
+    REQUIRE_EQ(class_of("Ac Ad"), class_of("Kh Ks") + 14);
+    REQUIRE(is_pair_class(class_of("7c 7d")));
+    REQUIRE(is_suited_class(class_of("Ac Kc")));
+    REQUIRE(is_offsuit_class(class_of("Ac Kd")));
+
+    auto total = 0;
+    for (auto c = std::size_t{0}; c < num_preflop_classes; ++c) {
+        const auto cs = combos(c);
+        REQUIRE_EQ(static_cast<int>(cs.size()), num_combos(c));
+        for (const auto& hc : cs) REQUIRE_EQ(preflop_class(hc), c);
+        total += num_combos(c);
+    }
+    REQUIRE_EQ(total, 1326);
+}
+
+TEST_CASE("preflop equities") {
+    const auto& equity = equity_table();
+    const auto aa = class_of("Ac Ad");
+    const auto kk = class_of("Kc Kd");
+    const auto seven_deuce = class_of("7c 2d");
+    const auto ak = class_of("Ac Kd");
+
+    // Against the published enumerations.
+    REQUIRE_EQ(equity.equity(aa, seven_deuce), doctest::Approx(0.8820).epsilon(0.0001));
+    REQUIRE_EQ(equity.equity(aa, kk), doctest::Approx(0.8195).epsilon(0.0001));
+    REQUIRE_EQ(equity.equity(class_of("Ac Kc"), class_of("Qc Qd")), doctest::Approx(0.4605).epsilon(0.0001));
+    REQUIRE_EQ(equity.equity(aa, kk) + equity.equity(kk, aa), doctest::Approx(1));
+    REQUIRE_EQ(equity.equity(aa, aa), doctest::Approx(0.5));
+    REQUIRE_EQ(equity.weight(aa, aa), 6);
+    REQUIRE_EQ(equity.weight(aa, kk), 36);
+    // Two aces left for AKo: 2 * 3 combos against each of the 6 AA combos.
+    REQUIRE_EQ(equity.weight(aa, ak), 6 * 6);
+}
+
+TEST_CASE("push/fold equilibrium") {
+    const auto& equity = equity_table();
+    const auto fb = forced_bets{blinds{1, 2}};
+    const auto stacks = std::array<chips, 2>{4, 40};
+    auto options = push_fold_options{};
+    options.iterations = 500;
+    const auto charts = solve_push_fold(equity, stacks, fb, options);
+
+    GIVEN("two big blinds") {
+        const auto& chart = charts[0];
+        const auto pushed = std::count_if(chart.push.begin(), chart.push.end(), [] (double p) { return p > 0.5; });
+        REQUIRE_GT(pushed, 150);
+        REQUIRE_LT(chart.exploitability, 0.02);
+    }
+
+    GIVEN("twenty big blinds") {
+        const auto& chart = charts[1];
+        REQUIRE_GT(chart.push[class_of("Ac Ad")], 0.99);
+        REQUIRE_GT(chart.call[class_of("Ac Ad")], 0.99);
+        REQUIRE_GT(chart.push[class_of("Ac Kd")], 0.99);
+        REQUIRE_LT(chart.call[class_of("7c 2d")], 0.01);
+        REQUIRE_LT(chart.exploitability, 0.05);
+    }
+
+    GIVEN("tournament equity instead of chips") {
+        const auto others = std::array<chips, 1>{40};
+        const auto payouts = std::array<double, 2>{65, 35};
+        const auto icm = solve_push_fold(equity, icm_utilities(40, 40, fb, others, payouts), options);
+        // Bubble pressure makes calling tighter than in chip EV.
+        const auto calls = [] (const push_fold_chart& c) { return std::accumulate(c.call.begin(), c.call.end(), 0.0); };
+        REQUIRE_LT(calls(icm), calls(charts[1]));
+    }
+}
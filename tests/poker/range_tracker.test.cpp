@@ -0,0 +1,142 @@
+#include <doctest/doctest.h>
+
+#include <numeric>
+#include <random>
+
+#include <poker/range_tracker.hpp>
+#include <poker/debug/card.hpp>
+
+using namespace poker;
+
+namespace {
+
+auto make_hole_cards(const char* s) -> hole_cards {
+    const auto cards = debug::make_cards<2>(s);
+    return {cards[0], cards[1]};
+}
+
+auto total(span<const float, num_hole_cards_combos> r) -> double {
+    return std::accumulate(r.begin(), r.end(), 0.0);
+}
+
+} // namespace
+
+TEST_CASE("hole cards indices") {
+    for (auto i = std::size_t{0}; i < num_hole_cards_combos; ++i) {
+        const auto hc = hole_cards_from_index(i);
+        REQUIRE_NE(hc.first, hc.second);
+        REQUIRE_EQ(hole_cards_index(hc), i);
+        REQUIRE_EQ(hole_cards_index({hc.second, hc.first}), i);
+    }
+}
+
+TEST_CASE("tracking ranges") {
+    auto tracker = range_tracker{};
+    auto seats = seat_set{};
+    seats.insert(2);
+    seats.insert(5);
+    const auto mine = make_hole_cards("Ac Ad");
+    tracker.start_hand(seats, card_set{mine});
+
+    REQUIRE(tracker.tracked(2));
+    REQUIRE_FALSE(tracker.tracked(3));
+
+    GIVEN("only our own cards are known") {
+        THEN("every other combination is equally likely") {
+            REQUIRE_EQ(tracker.probability(2, mine), 0);
+            REQUIRE_EQ(tracker.probability(2, make_hole_cards("Ac Kc")), 0);
+            REQUIRE_EQ(tracker.probability(5, make_hole_cards("Ah As")), doctest::Approx(1.0 / 1225));
+            REQUIRE_EQ(total(tracker.posterior(5)), doctest::Approx(1));
+        }
+    }
+
+    GIVEN("a player who only ever raises with pairs") {
+        auto likelihood = std::array<float, num_hole_cards_combos>{};
+        for (auto i = std::size_t{0}; i < num_hole_cards_combos; ++i) {
+            const auto hc = hole_cards_from_index(i);
+            likelihood[i] = hc.first.rank == hc.second.rank ? 1.0f : 0.0f;
+        }
+        tracker.action_taken(2, likelihood);
+
+        THEN("the range holds the 73 remaining pairs") {
+            REQUIRE_EQ(tracker.probability(2, make_hole_cards("7c 7h")), doctest::Approx(1.0 / 73));
+            REQUIRE_EQ(tracker.probability(2, make_hole_cards("7c 8h")), 0);
+            REQUIRE_EQ(tracker.probability(5, make_hole_cards("7c 8h")), doctest::Approx(1.0 / 1225));
+        }
+
+        WHEN("a seven falls on the flop") {
+            auto cc = community_cards{};
+            cc.deal(debug::make_cards<3>("7s 2d 9h"));
+            tracker.deal(cc);
+
+            THEN("combinations with board cards are removed") {
+                REQUIRE_EQ(tracker.probability(2, make_hole_cards("7c 7s")), 0);
+                REQUIRE_EQ(tracker.probability(2, make_hole_cards("7c 7h")), doctest::Approx(1.0 / 64));
+                REQUIRE_EQ(total(tracker.posterior(2)), doctest::Approx(1));
+                REQUIRE_EQ(total(tracker.posterior(5)), doctest::Approx(1));
+            }
+        }
+    }
+
+    GIVEN("a likelihood that rules out the whole range") {
+        const auto before = tracker.probability(2, make_hole_cards("7c 7h"));
+        tracker.action_taken(2, std::array<float, num_hole_cards_combos>{});
+
+        THEN("the range is left unchanged") {
+            REQUIRE_EQ(tracker.probability(2, make_hole_cards("7c 7h")), before);
+        }
+    }
+}
+
+TEST_CASE("tracking the ranges at a table") {
+    auto t = table{forced_bets{blinds{25, 50}}};
+    t.sit_down(0, 2000);
+    t.sit_down(1, 2000);
+    t.sit_down(2, 2000);
+    t.start_hand(std::mt19937{7});
+
+    auto tracker = range_tracker{};
+    tracker.start_hand(t);
+    REQUIRE(tracker.tracked(0));
+    REQUIRE(tracker.tracked(1));
+    REQUIRE(tracker.tracked(2));
+    REQUIRE_FALSE(tracker.tracked(3));
+
+    // Folds everything but aces.
+    const auto model = [] (const table&, seat_index, action a, chips, span<float, num_hole_cards_combos> likelihood) {
+        for (auto i = std::size_t{0}; i < num_hole_cards_combos; ++i) {
+            const auto hc = hole_cards_from_index(i);
+            const auto aces = hc.first.rank == card_rank::A && hc.second.rank == card_rank::A;
+            likelihood[i] = aces == (a != action::fold) ? 1.0f : 0.0f;
+        }
+    };
+
+    const auto first = t.player_to_act();
+    tracker.action_taken(t, action::call, 0, model);
+    t.action_taken(action::call);
+    REQUIRE_EQ(tracker.probability(first, make_hole_cards("Ac As")), doctest::Approx(1.0 / 6));
+
+    const auto second = t.player_to_act();
+    tracker.action_taken(t, action::fold, 0, model);
+    t.action_taken(action::fold);
+    REQUIRE_FALSE(tracker.tracked(second));
+}
+
+TEST_CASE("tracking the ranges at a table of another size") {
+    auto t = basic_table<16>{forced_bets{blinds{25, 50}}};
+    t.sit_down(3, 2000);
+    t.sit_down(15, 2000);
+    t.start_hand(std::mt19937{7});
+
+    auto tracker = basic_range_tracker<16>{};
+    tracker.start_hand(t);
+    REQUIRE(tracker.tracked(3));
+    REQUIRE(tracker.tracked(15));
+    REQUIRE_FALSE(tracker.tracked(9));
+
+    const auto first = t.player_to_act();
+    tracker.action_taken(t, action::fold, 0, [] (const basic_table<16>&, seat_index, action, chips, span<float, num_hole_cards_combos> likelihood) {
+        for (auto& l : likelihood) l = 1.0f;
+    });
+    REQUIRE_FALSE(tracker.tracked(first));
+}
@@ -0,0 +1,85 @@
+#include <doctest/doctest.h>
+
+#include <array>
+#include <cmath>
+
+#include <poker/card_set.hpp>
+#include <poker/sampling_deck.hpp>
+#include <poker/xoshiro256.hpp>
+#include <poker/debug/card.hpp>
+
+using namespace poker;
+
+namespace {
+
+template<std::size_t N>
+auto cards(const char* s) -> card_set {
+    return card_set{debug::make_cards<N>(s)};
+}
+
+} // namespace
+
+TEST_CASE("A sampling deck only deals live cards") {
+    const auto dead = cards<5>("Ah Kd 2c 7s Ts");
+    auto rng = xoshiro256{1};
+
+    GIVEN("A deck built from dead cards") {
+        auto d = sampling_deck{dead};
+        REQUIRE_EQ(d.dead(), dead);
+        REQUIRE_EQ(d.size(), 47);
+        REQUIRE_EQ(d.num_live(), 47);
+
+        WHEN("Every card is drawn") {
+            auto drawn = card_set{};
+            while (d.size() > 0) {
+                const auto c = d.draw(rng);
+                REQUIRE_FALSE(drawn.contains(c));
+                drawn.insert(c);
+            }
+
+            THEN("Exactly the live cards were drawn") {
+                REQUIRE_EQ(drawn, card_set::full_deck() - dead);
+            }
+
+            AND_WHEN("The deck is reset") {
+                d.reset();
+
+                THEN("The drawn cards are back") {
+                    REQUIRE_EQ(d.size(), 47);
+                    REQUIRE_EQ(d.draw(47, rng), card_set::full_deck() - dead);
+                }
+            }
+        }
+
+        WHEN("The deck is reset with other dead cards") {
+            (void)d.draw(3, rng);
+            d.reset(cards<1>("As"));
+
+            THEN("Only those cards are missing") {
+                REQUIRE_EQ(d.size(), 51);
+                REQUIRE_EQ(d.draw(51, rng), card_set::full_deck() - cards<1>("As"));
+            }
+        }
+    }
+}
+
+TEST_CASE("A sampling deck draws uniformly after resets") {
+    const auto dead = cards<2>("Ac Ad");
+    auto d = sampling_deck{dead};
+    auto rng = xoshiro256{2};
+    auto counts = std::array<int, 52>{};
+    constexpr auto num_rollouts = 50000;
+    for (auto rollout = 0; rollout < num_rollouts; ++rollout) {
+        d.reset();
+        d.draw(5, rng).for_each([&] (card c) { ++counts[card_index(c)]; });
+    }
+    const auto expected = num_rollouts * 5.0 / 50;
+    for (auto i = std::size_t{0}; i < 52; ++i) {
+        const auto c = card_from_index(i);
+        if (dead.contains(c)) {
+            REQUIRE_EQ(counts[i], 0);
+        } else {
+            REQUIRE(std::abs(counts[i] - expected) < 5 * std::sqrt(expected));
+        }
+    }
+}
@@ -0,0 +1,36 @@
+#include <doctest/doctest.h>
+
+#include <vector>
+
+#include <poker/seat_set.hpp>
+
+using namespace poker;
+
+TEST_CASE("seat sets") {
+    auto seats = seat_set{};
+    seats.insert(1);
+    seats.insert(4);
+    seats.insert(15);
+
+    REQUIRE_EQ(seats.size(), 3);
+    REQUIRE(seats[4]);
+    REQUIRE_FALSE(seats[5]);
+    REQUIRE_EQ(seats.front(), 1);
+    REQUIRE_EQ(std::vector<seat_index>(seats.begin(), seats.end()), std::vector<seat_index>{1, 4, 15});
+
+    THEN("The next seat wraps around past the last one") {
+        REQUIRE_EQ(seats.next_or_wrap(0), 1);
+        REQUIRE_EQ(seats.next_or_wrap(1), 4);
+        REQUIRE_EQ(seats.next_or_wrap(7), 15);
+        REQUIRE_EQ(seats.next_or_wrap(15), 1);
+        REQUIRE_EQ(seat_set::first(1).next_or_wrap(0), 0);
+    }
+
+    THEN("Sets combine like masks") {
+        REQUIRE_EQ((seats - seat_set::first(5)).bits(), 1 << 15);
+        REQUIRE_EQ((seats & seat_set::first(5)).size(), 2);
+        REQUIRE_EQ((seats | seat_set::first(3)).size(), 5);
+        seats.erase(4);
+        REQUIRE_EQ(seats.bits(), (1 << 1) | (1 << 15));
+    }
+}
@@ -0,0 +1,86 @@
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <poker/shuffle_statistics.hpp>
+#include <poker/xoshiro256.hpp>
+
+using namespace poker;
+
+TEST_CASE("chi-square p-values") {
+    REQUIRE_EQ(chi_square_p_value(3.841458820694124, 1), doctest::Approx(0.05));
+    REQUIRE_EQ(chi_square_p_value(5, 2), doctest::Approx(std::exp(-2.5)));
+    REQUIRE_EQ(chi_square_p_value(1, 4), doctest::Approx(std::exp(-0.5) * 1.5));
+    REQUIRE_EQ(chi_square_p_value(10, 4), doctest::Approx(std::exp(-5) * 6));
+    REQUIRE_EQ(chi_square_p_value(0, 10), 1);
+
+    const auto median = chi_square_p_value(2601, 2601);
+    REQUIRE(median > 0.49);
+    REQUIRE(median < 0.5);
+    REQUIRE(chi_square_p_value(3000, 2601) < 1e-6);
+}
+
+TEST_CASE("shuffle tests") {
+    auto options = shuffle_test_options{};
+    options.num_shuffles = 200'000;
+    options.block_size = 10'000;
+
+    GIVEN("Shuffles of a deck") {
+        const auto report = test_deck_shuffles(options, [] (std::size_t block) { return xoshiro256{1, block}; });
+
+        THEN("The shuffles look uniform") {
+            REQUIRE_EQ(report.num_shuffles, options.num_shuffles);
+            REQUIRE(report.positions.p_value > 1e-4);
+            REQUIRE(report.adjacency.p_value > 1e-4);
+            REQUIRE(report.permutations.p_value > 1e-4);
+        }
+
+        THEN("The report does not depend on the number of threads") {
+            options.num_threads = 3;
+            const auto other = test_deck_shuffles(options, [] (std::size_t block) { return xoshiro256{1, block}; });
+            REQUIRE_EQ(other.positions.statistic, report.positions.statistic);
+            REQUIRE_EQ(other.adjacency.statistic, report.adjacency.statistic);
+            REQUIRE_EQ(other.permutations.statistic, report.permutations.statistic);
+        }
+    }
+
+    GIVEN("Short series of shuffles from many seeds") {
+        options.num_shuffles = 2'000;
+        options.block_size = 2'000;
+        options.num_threads = 1;
+        auto p_values = std::vector<double>{};
+        for (auto seed = std::uint64_t{0}; seed < 200; ++seed) {
+            const auto report = test_deck_shuffles(options, [&] (std::size_t block) { return xoshiro256{seed, block}; });
+            p_values.push_back(report.positions.p_value);
+        }
+        std::sort(p_values.begin(), p_values.end());
+
+        THEN("The p-values of the positions are uniform") {
+            // Kolmogorov-Smirnov, at a significance of about 0.001.
+            auto distance = 0.0;
+            const auto n = static_cast<double>(p_values.size());
+            for (auto i = std::size_t{0}; i < p_values.size(); ++i) {
+                distance = std::max({distance, (i + 1) / n - p_values[i], p_values[i] - i / n});
+            }
+            REQUIRE(distance < 1.95 / std::sqrt(n));
+        }
+    }
+
+    GIVEN("The classic broken shuffle swapping every card with any card") {
+        const auto report = test_shuffles(options, [] (std::size_t block) {
+            return [g = xoshiro256{2, block}] (std::array<std::uint8_t, 52>& order) mutable {
+                std::iota(order.begin(), order.end(), std::uint8_t{0});
+                for (auto i = std::size_t{0}; i < order.size(); ++i) std::swap(order[i], order[g() % 52]);
+            };
+        });
+
+        THEN("Its bias is detected") {
+            REQUIRE(report.positions.p_value < 1e-9);
+        }
+    }
+}
@@ -2,13 +2,16 @@
 
 #include <algorithm>
 #include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <poker/table.hpp>
 
 TEST_CASE("table construction") {
     auto t = poker::table{poker::forced_bets{poker::blinds{25, 50}}};
 
-    REQUIRE(std::find(t.seats().occupancy().begin(), t.seats().occupancy().end(), true) == t.seats().occupancy().end());
+    REQUIRE(t.seats().occupancy().empty());
     REQUIRE_EQ(t.forced_bets(), poker::forced_bets{poker::blinds{25, 50}});
     REQUIRE_FALSE(t.hand_in_progress());
 }
@@ -128,6 +131,55 @@ TEST_CASE("adding/removing players") {
     }
 }
 
+TEST_CASE("A seat left during a hand can be taken for the next hand") {
+    auto t = poker::table{poker::forced_bets{poker::blinds{25, 50}}};
+    t.sit_down(4, 2000);
+    t.sit_down(5, 2000);
+    t.sit_down(6, 2000);
+    t.start_hand(std::mt19937{7});
+    REQUIRE_EQ(t.player_to_act(), 4);
+
+    t.stand_up(4);
+    t.sit_down(4, 500);
+
+    THEN("the seat is taken, but the new player waits for the next hand") {
+        REQUIRE(t.seats().occupancy()[4]);
+        REQUIRE_EQ(t.seats()[4].stack(), 500);
+        REQUIRE_FALSE(t.can_set_automatic_action(4));
+        REQUIRE_EQ(t.num_active_players(), 2);
+
+        t.action_taken(poker::action::fold);
+        t.end_betting_round();
+        t.showdown();
+        REQUIRE(t.seats().occupancy()[4]);
+        REQUIRE_EQ(t.seats()[4].stack(), 500);
+        REQUIRE_EQ(t.seats()[6].stack(), 2025);
+
+        t.start_hand(std::mt19937{8});
+        REQUIRE_EQ(t.hand_players().filter().size(), 3);
+        REQUIRE(t.hand_players().filter()[4]);
+    }
+}
+
+TEST_CASE("The seats of a table follow it and can be iterated") {
+    auto t = poker::table{poker::forced_bets{poker::blinds{25, 50}}};
+    t.sit_down(4, 2000);
+    t.sit_down(5, 2000);
+    t.sit_down(6, 2000);
+    t.start_hand(std::mt19937{7});
+    const auto seats = t.seats();
+
+    t.stand_up(5);
+    t.sit_down(2, 300);
+
+    REQUIRE_EQ(seats.occupancy().size(), 3);
+    REQUIRE_FALSE(seats.occupancy()[5]);
+    auto indices = std::vector<std::size_t>{};
+    for (auto it = seats.begin(); it != seats.end(); ++it) indices.push_back(it.index());
+    REQUIRE_EQ(indices, std::vector<std::size_t>{2, 4, 6});
+    REQUIRE_EQ((*seats.begin()).stack(), 300);
+}
+
 TEST_CASE("automatic actions") {
     GIVEN("a table") {
         auto t = poker::table{poker::forced_bets{poker::blinds{25, 50}}};
@@ -567,3 +619,303 @@ TEST_CASE("Heads-up preflop first-to-act all-in does not cause the other player
         REQUIRE_FALSE(t.betting_round_in_progress());
     }
 }
+
+TEST_CASE("Replaying a deck deals the same cards") {
+    const auto d = poker::deck{std::default_random_engine{std::random_device{}()}};
+    auto t1 = poker::table{poker::forced_bets{poker::blinds{25, 50}}};
+    auto t2 = poker::table{poker::forced_bets{poker::blinds{25, 50}}};
+    for (auto* t : {&t1, &t2}) {
+        t->sit_down(3, 1000);
+        t->sit_down(5, 1000);
+        t->start_hand(d, 5);
+    }
+
+    REQUIRE_EQ(t1.button(), 5);
+    REQUIRE_EQ(t2.button(), 5);
+    REQUIRE_EQ(t1.hole_cards()[3], t2.hole_cards()[3]);
+    REQUIRE_EQ(t1.hole_cards()[5], t2.hole_cards()[5]);
+}
+
+TEST_CASE("Seeded hands can be dealt again from their identifier") {
+    auto t = poker::table{poker::forced_bets{poker::blinds{25, 50}}};
+    t.sit_down(2, 1000);
+    t.sit_down(6, 1000);
+    REQUIRE_FALSE(t.next_deal().has_value());
+
+    t.seed_deals({0x5eed}, 10);
+    auto dealt = std::vector<std::pair<poker::deal_id, poker::hole_cards>>{};
+    for (auto hand = 0; hand < 3; ++hand) {
+        t.start_hand();
+        REQUIRE(t.current_deal().has_value());
+        dealt.emplace_back(*t.current_deal(), t.hole_cards()[2]);
+        t.action_taken(poker::action::fold);
+        t.end_betting_round();
+        t.showdown();
+    }
+    REQUIRE_EQ(dealt[0].first, poker::deal_id{{0x5eed}, 10});
+    REQUIRE_EQ(dealt[2].first, poker::deal_id{{0x5eed}, 12});
+    REQUIRE_EQ(*t.next_deal(), poker::deal_id{{0x5eed}, 13});
+
+    GIVEN("Another table") {
+        auto replay = poker::table{poker::forced_bets{poker::blinds{25, 50}}};
+        replay.sit_down(2, 1000);
+        replay.sit_down(6, 1000);
+
+        WHEN("It deals a past hand") {
+            replay.start_hand(dealt[1].first);
+
+            THEN("The same cards are dealt") {
+                REQUIRE_EQ(replay.hole_cards()[2], dealt[1].second);
+                REQUIRE_EQ(*replay.current_deal(), dealt[1].first);
+            }
+        }
+
+        WHEN("It deals from a generator") {
+            replay.start_hand(std::default_random_engine{1}, 6);
+
+            THEN("The hand has no identifier") {
+                REQUIRE_FALSE(replay.current_deal().has_value());
+            }
+        }
+    }
+
+    GIVEN("Different hand numbers") {
+        THEN("They deal different decks") {
+            auto first = poker::make_deck(dealt[0].first);
+            auto second = poker::make_deck(dealt[1].first);
+            auto same = 0;
+            while (first.size() > 0) same += first.draw() == second.draw();
+            REQUIRE(same < 10);
+        }
+    }
+
+    GIVEN("Seeds differing only in their last word") {
+        THEN("They deal different decks") {
+            auto seed = dealt[0].first.table_seed;
+            seed.back() = 1;
+            auto first = poker::make_deck(dealt[0].first);
+            auto second = poker::make_deck(poker::deal_id{seed, dealt[0].first.hand_number});
+            auto same = 0;
+            while (first.size() > 0) same += first.draw() == second.draw();
+            REQUIRE(same < 10);
+        }
+    }
+}
+
+TEST_CASE("Restoring a snapshot resumes the hand") {
+    static_assert(std::is_trivially_copyable_v<poker::table_snapshot>);
+
+    auto t = poker::table{poker::forced_bets{poker::blinds{25, 50}}};
+    t.sit_down(1, 1000);
+    t.sit_down(4, 1000);
+    t.sit_down(7, 1000);
+    t.seed_deals({42});
+    t.start_hand();
+    t.action_taken(poker::action::raise, 150);
+    t.action_taken(poker::action::call);
+    t.action_taken(poker::action::call);
+    t.end_betting_round();
+
+    const auto snapshot = t.snapshot();
+    const auto player_to_act = t.player_to_act();
+    const auto hole_cards = t.hole_cards()[4];
+    const auto flop = std::vector<poker::card>(t.community_cards().cards().begin(), t.community_cards().cards().end());
+
+    // Plays the rest of the hand passively, and returns the board and stacks.
+    auto play_out = [] (poker::table& table) {
+        while (table.betting_round_in_progress()) table.action_taken(poker::action::check);
+        table.end_betting_round();
+        while (!table.betting_rounds_completed()) {
+            while (table.betting_round_in_progress()) table.action_taken(poker::action::check);
+            table.end_betting_round();
+        }
+        auto board = std::vector<poker::card>(table.community_cards().cards().begin(), table.community_cards().cards().end());
+        table.showdown();
+        auto stacks = std::vector<poker::chips>{};
+        for (auto s : {1, 4, 7}) stacks.push_back(table.seats()[s].stack());
+        return std::pair{board, stacks};
+    };
+    const auto first = play_out(t);
+
+    WHEN("It is restored on the same table") {
+        t.restore(snapshot);
+
+        THEN("The hand continues where it was") {
+            REQUIRE(t.hand_in_progress());
+            REQUIRE_EQ(t.player_to_act(), player_to_act);
+            REQUIRE_EQ(t.pots().size(), 1);
+            REQUIRE_EQ(t.pots()[0].size(), 450);
+            REQUIRE(std::equal(flop.begin(), flop.end(), t.community_cards().cards().begin(), t.community_cards().cards().end()));
+            REQUIRE_EQ(play_out(t), first);
+        }
+    }
+
+    WHEN("It is restored on another table") {
+        auto fork = poker::table{};
+        fork.restore(snapshot);
+
+        THEN("The other table deals the same cards") {
+            REQUIRE_EQ(fork.hole_cards()[4], hole_cards);
+            REQUIRE_EQ(play_out(fork), first);
+        }
+    }
+}
+
+TEST_CASE("Taking a snapshot leaves the table as it was") {
+    auto t = poker::table{poker::forced_bets{poker::blinds{25, 50}}};
+    t.sit_down(0, 1000);
+    t.sit_down(1, 1000);
+    // Small enough to be stored in the deck, which only shuffles the cards it deals.
+    t.start_hand(std::minstd_rand{3});
+
+    const auto& const_table = t;
+    const auto snapshot = const_table.snapshot();
+    auto fork = poker::table{};
+    fork.restore(snapshot);
+
+    auto act_passively = [] (poker::table& table) {
+        const auto check = static_cast<bool>(table.legal_actions().action & poker::action::check);
+        table.action_taken(check ? poker::action::check : poker::action::call);
+    };
+    while (!t.betting_rounds_completed()) {
+        while (t.betting_round_in_progress()) act_passively(t);
+        while (fork.betting_round_in_progress()) act_passively(fork);
+        t.end_betting_round();
+        fork.end_betting_round();
+    }
+    REQUIRE(std::equal(t.community_cards().cards().begin(), t.community_cards().cards().end(),
+                       fork.community_cards().cards().begin(), fork.community_cards().cards().end()));
+}
+
+TEST_CASE("Tables of other sizes") {
+    GIVEN("A heads-up table") {
+        auto t = poker::basic_table<2>{poker::forced_bets{poker::blinds{25, 50}}};
+        static_assert(decltype(t)::num_seats == 2);
+        static_assert(sizeof(poker::basic_table<2>) < sizeof(poker::table));
+        t.sit_down(0, 1000);
+        t.sit_down(1, 1000);
+        t.start_hand(std::default_random_engine{1}, 0);
+
+        THEN("The button posts the small blind and acts first") {
+            REQUIRE_EQ(t.player_to_act(), 0);
+            REQUIRE_EQ(t.hand_players()[0].bet_size(), 25);
+            REQUIRE_EQ(t.hand_players()[1].bet_size(), 50);
+        }
+
+        WHEN("The button folds") {
+            t.action_taken(poker::action::fold);
+            t.end_betting_round();
+            t.showdown();
+
+            THEN("The big blind wins the small blind") {
+                REQUIRE_EQ(t.seats()[0].stack(), 975);
+                REQUIRE_EQ(t.seats()[1].stack(), 1025);
+            }
+        }
+    }
+
+    GIVEN("A 10-max table") {
+        auto t = poker::basic_table<10>{poker::forced_bets{poker::blinds{25, 50}}};
+        t.sit_down(0, 1000);
+        t.sit_down(9, 1000);
+        t.start_hand(std::default_random_engine{1}, 9);
+
+        THEN("The tenth seat plays") {
+            REQUIRE_EQ(t.button(), 9);
+            REQUIRE_EQ(t.player_to_act(), 9);
+            REQUIRE_EQ(t.hand_players()[0].bet_size(), 50);
+        }
+
+        WHEN("The hand is checked down") {
+            t.action_taken(poker::action::call);
+            t.action_taken(poker::action::check);
+            t.end_betting_round();
+            while (!t.betting_rounds_completed()) {
+                t.action_taken(poker::action::check);
+                t.action_taken(poker::action::check);
+                t.end_betting_round();
+            }
+            t.showdown();
+
+            THEN("No chips are made or lost") {
+                REQUIRE_EQ(t.seats()[0].stack() + t.seats()[9].stack(), 2000);
+            }
+        }
+    }
+}
+
+TEST_CASE("Undoing actions") {
+    auto t = poker::table{poker::forced_bets{poker::blinds{25, 50}}};
+    t.set_undo_depth(8);
+    t.sit_down(1, 1000);
+    t.sit_down(4, 1000);
+    t.sit_down(7, 300);
+    t.start_hand(std::default_random_engine{3}, 1);
+    REQUIRE_FALSE(t.can_undo());
+
+    const auto stacks = std::vector<poker::chips>{
+        t.hand_players()[1].total_chips(), t.hand_players()[4].total_chips(), t.hand_players()[7].total_chips()
+    };
+    const auto chips_of = [&] {
+        return std::vector<poker::chips>{
+            t.hand_players()[1].total_chips(), t.hand_players()[4].total_chips(), t.hand_players()[7].total_chips()
+        };
+    };
+
+    WHEN("A raise, a call and a fold are taken back") {
+        t.action_taken(poker::action::raise, 400);
+        t.action_taken(poker::action::call);
+        t.action_taken(poker::action::fold);
+        REQUIRE_FALSE(t.betting_round_in_progress());
+        t.undo();
+        t.undo();
+        t.undo();
+
+        THEN("The betting round is as it started") {
+            REQUIRE_FALSE(t.can_undo());
+            REQUIRE(t.betting_round_in_progress());
+            REQUIRE_EQ(t.player_to_act(), 1);
+            REQUIRE_EQ(chips_of(), stacks);
+            REQUIRE_EQ(t.legal_actions().chip_range.min, 100);
+            REQUIRE_EQ(t.seats()[7].stack(), 250);
+        }
+
+        THEN("The hand plays on") {
+            t.action_taken(poker::action::call);
+            t.action_taken(poker::action::call);
+            t.action_taken(poker::action::check);
+            t.end_betting_round();
+            REQUIRE_EQ(t.pots()[0].size(), 150);
+        }
+    }
+
+    WHEN("A folded bet is taken back") {
+        t.action_taken(poker::action::call);
+        t.action_taken(poker::action::fold);
+        t.undo();
+        t.action_taken(poker::action::call);
+        t.action_taken(poker::action::check);
+        t.end_betting_round();
+
+        THEN("It is not in the pot twice") {
+            REQUIRE_EQ(t.pots()[0].size(), 150);
+            REQUIRE_FALSE(t.can_undo());
+        }
+    }
+
+    WHEN("An action triggers automatic actions") {
+        t.set_automatic_action(4, poker::table::automatic_action::call);
+        t.set_automatic_action(7, poker::table::automatic_action::check);
+        t.action_taken(poker::action::call);
+        REQUIRE_FALSE(t.betting_round_in_progress());
+        t.undo();
+
+        THEN("They are taken back with it") {
+            REQUIRE(t.betting_round_in_progress());
+            REQUIRE_EQ(t.player_to_act(), 1);
+            REQUIRE(t.automatic_actions()[4].has_value());
+            REQUIRE(t.automatic_actions()[7].has_value());
+            REQUIRE_EQ(t.hand_players()[4].bet_size(), 25);
+        }
+    }
+}
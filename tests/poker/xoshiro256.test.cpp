@@ -0,0 +1,99 @@
+#include <doctest/doctest.h>
+
+#include <set>
+#include <type_traits>
+#include <vector>
+
+#include <poker/card_set.hpp>
+#include <poker/deck.hpp>
+#include <poker/xoshiro256.hpp>
+
+using namespace poker;
+
+static_assert(sizeof(xoshiro256) == 32);
+static_assert(std::is_trivially_copyable_v<xoshiro256>);
+
+TEST_CASE("xoshiro256 matches the reference implementation") {
+    SUBCASE("seeding goes through splitmix64") {
+        auto state = std::uint64_t{0};
+        REQUIRE_EQ(detail::splitmix64(state), 0xe220a8397b1dcdaf);
+    }
+
+    SUBCASE("outputs") {
+        auto rng = xoshiro256{42};
+        REQUIRE_EQ(rng(), 0x15780b2e0c2ec716);
+        REQUIRE_EQ(rng(), 0x6104d9866d113a7e);
+        REQUIRE_EQ(rng(), 0xae17533239e499a1);
+    }
+
+    SUBCASE("jump") {
+        auto rng = xoshiro256{42};
+        rng.jump();
+        REQUIRE_EQ(rng(), 0x50086ef83cbf4f4a);
+        REQUIRE_EQ(rng(), 0xba285ec21347d703);
+    }
+
+    SUBCASE("long jump") {
+        auto rng = xoshiro256{42};
+        rng.long_jump();
+        REQUIRE_EQ(rng(), 0xa0a4cb7719d49439);
+        REQUIRE_EQ(rng(), 0xa999704410efd911);
+    }
+}
+
+TEST_CASE("xoshiro256 streams") {
+    GIVEN("A generator that is split") {
+        auto master = xoshiro256{7};
+        const auto original = master;
+        const auto first = master.split();
+        const auto second = master.split();
+
+        THEN("The first split continues the original sequence") {
+            REQUIRE(first == original);
+        }
+
+        THEN("Every split is one jump ahead of the previous one") {
+            auto jumped = first;
+            jumped.jump();
+            REQUIRE(second == jumped);
+            jumped.jump();
+            REQUIRE(master == jumped);
+        }
+    }
+
+    GIVEN("Generators seeded with the same seed and different streams") {
+        THEN("They are reproducible and generate different numbers") {
+            auto firsts = std::set<std::uint64_t>{};
+            for (auto stream = std::uint64_t{0}; stream < 1000; ++stream) {
+                auto rng = xoshiro256{123, stream};
+                REQUIRE(rng == xoshiro256(123, stream));
+                firsts.insert(rng());
+            }
+            REQUIRE_EQ(firsts.size(), 1000);
+        }
+    }
+
+    SUBCASE("discard skips numbers") {
+        auto x = xoshiro256{5};
+        auto y = x;
+        x();
+        x();
+        x();
+        y.discard(3);
+        REQUIRE(x == y);
+    }
+}
+
+TEST_CASE("xoshiro256 shuffles a deck") {
+    auto d = deck{xoshiro256{99}};
+    auto e = d;
+    auto cards = std::vector<card>{};
+    while (d.size() > 0) {
+        const auto c = d.draw();
+        REQUIRE_EQ(c, e.draw());
+        cards.push_back(c);
+    }
+    auto unique = std::set<int>{};
+    for (auto c : cards) unique.insert(static_cast<int>(card_index(c)));
+    REQUIRE_EQ(unique.size(), 52);
+}
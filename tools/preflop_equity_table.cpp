@@ -0,0 +1,165 @@
+// Enumerates the heads-up all-in equities between the 169 preflop classes
+// exactly and prints them as the table poker::preflop_equity loads.
+//
+// Usage: poker-preflop-equity-table > include/poker/detail/preflop_equity_table.hpp
+//
+// Every pair of non-conflicting combinations meets on every board of the 48
+// other cards. Relabeling the suits maps each class onto itself, so only one
+// board of each suit-isomorphic class is evaluated, weighted by the size of
+// its class. On a board, the combinations are sorted by hand value; walking
+// them upwards, a combination beats the combinations of each class counted
+// so far, less those sharing one of its cards.
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <vector>
+
+#include <poker/card_set.hpp>
+#include <poker/preflop_class.hpp>
+#include "poker/detail/hand_value.hpp"
+
+namespace {
+
+constexpr auto n = poker::num_preflop_classes;
+constexpr auto boards_per_matchup = std::int64_t{1'712'304}; // 48 choose 5
+
+struct combo {
+    std::uint64_t bits;
+    std::uint8_t first;  // card_index of the cards
+    std::uint8_t second;
+    std::uint8_t preflop_class;
+};
+
+auto canonical(std::uint64_t bits) -> std::uint64_t {
+    auto suits = std::array<int, 4>{0, 1, 2, 3};
+    auto best = bits;
+    do {
+        auto permuted = std::uint64_t{0};
+        for (auto s = 0; s < 4; ++s) permuted |= (bits >> (16 * s) & 0xffff) << (16 * suits[s]);
+        best = std::min(best, permuted);
+    } while (std::next_permutation(suits.begin(), suits.end()));
+    return best;
+}
+
+} // namespace
+
+auto main() -> int {
+    auto combos = std::vector<combo>{};
+    for (auto i = std::size_t{0}; i < 52; ++i) {
+        for (auto j = i + 1; j < 52; ++j) {
+            const auto hc = poker::hole_cards{poker::card_from_index(i), poker::card_from_index(j)};
+            combos.push_back({poker::card_set{hc}.bits(), static_cast<std::uint8_t>(i), static_cast<std::uint8_t>(j),
+                              static_cast<std::uint8_t>(poker::preflop_class(hc))});
+        }
+    }
+
+    auto bits = std::array<std::uint64_t, 52>{};
+    for (auto i = std::size_t{0}; i < 52; ++i) bits[i] = poker::card_set::bit(poker::card_from_index(i));
+    auto keys = std::vector<std::uint64_t>{};
+    keys.reserve(2'598'960);
+    for (auto a = 0; a < 52; ++a)
+    for (auto b = a + 1; b < 52; ++b)
+    for (auto c = b + 1; c < 52; ++c)
+    for (auto d = c + 1; d < 52; ++d)
+    for (auto e = d + 1; e < 52; ++e) {
+        keys.push_back(canonical(bits[a] | bits[b] | bits[c] | bits[d] | bits[e]));
+    }
+    std::sort(keys.begin(), keys.end());
+
+    auto wins = std::vector<std::int64_t>(n * n);
+    auto not_losses = std::vector<std::int64_t>(n * n);
+    auto board_wins = std::vector<std::int32_t>(n * n);
+    auto board_not_losses = std::vector<std::int32_t>(n * n);
+    auto live = std::vector<std::pair<std::uint32_t, std::uint16_t>>{}; // value, combo
+    for (auto first = keys.begin(); first != keys.end();) {
+        const auto last = std::upper_bound(first, keys.end(), *first);
+        const auto board = *first;
+        const auto weight = static_cast<std::int64_t>(last - first);
+        first = last;
+
+        live.clear();
+        for (auto i = std::size_t{0}; i < combos.size(); ++i) {
+            if ((combos[i].bits & board) != 0) continue;
+            const auto value = poker::detail::hand_value(poker::card_set{combos[i].bits | board});
+            live.emplace_back(value, static_cast<std::uint16_t>(i));
+        }
+        std::sort(live.begin(), live.end());
+
+        std::fill(board_wins.begin(), board_wins.end(), 0);
+        std::fill(board_not_losses.begin(), board_not_losses.end(), 0);
+        auto below = std::array<std::int32_t, n>{};                // per class
+        auto below_with = std::array<std::array<std::int32_t, n>, 52>{}; // per card and class
+        const auto beaten = [&] (const combo& x, std::int32_t* row) {
+            const auto& with_first = below_with[x.first];
+            const auto& with_second = below_with[x.second];
+            for (auto v = std::size_t{0}; v < n; ++v) row[v] += below[v] - with_first[v] - with_second[v];
+        };
+        for (auto group = live.begin(); group != live.end();) {
+            auto group_end = group;
+            while (group_end != live.end() && group_end->first == group->first) ++group_end;
+            for (auto it = group; it != group_end; ++it) {
+                const auto& x = combos[it->second];
+                beaten(x, &board_wins[x.preflop_class * n]);
+            }
+            for (auto it = group; it != group_end; ++it) {
+                const auto& x = combos[it->second];
+                ++below[x.preflop_class];
+                ++below_with[x.first][x.preflop_class];
+                ++below_with[x.second][x.preflop_class];
+            }
+            // Now 'x' itself is counted once and taken away twice.
+            for (auto it = group; it != group_end; ++it) {
+                const auto& x = combos[it->second];
+                beaten(x, &board_not_losses[x.preflop_class * n]);
+                ++board_not_losses[x.preflop_class * n + x.preflop_class];
+            }
+            group = group_end;
+        }
+        for (auto i = std::size_t{0}; i < n * n; ++i) {
+            wins[i] += weight * board_wins[i];
+            not_losses[i] += weight * board_not_losses[i];
+        }
+    }
+
+    std::printf("#pragma once\n\n");
+    std::printf("#include <cstdint>\n\n");
+    std::printf("// Generated by tools/preflop_equity_table.cpp; do not edit.\n\n");
+    std::printf("namespace poker::detail {\n\n");
+    std::printf("// For every matchup of preflop classes 'hero <= villain', row by row: over\n");
+    std::printf("// every pair of non-conflicting combinations and every board of the 48\n");
+    std::printf("// other cards, how many the hero wins and how many tie.\n");
+    const auto print = [&] (const char* name, auto&& count) {
+        std::printf("inline constexpr std::uint32_t %s[%zu] = {", name, n * (n + 1) / 2);
+        auto column = 0;
+        for (auto hero = std::size_t{0}; hero < n; ++hero) {
+            for (auto villain = hero; villain < n; ++villain) {
+                std::printf(column++ % 10 == 0 ? "\n    %lld," : " %lld,", static_cast<long long>(count(hero, villain)));
+            }
+        }
+        std::printf("\n};\n\n");
+    };
+    print("preflop_wins", [&] (std::size_t h, std::size_t v) { return wins[h * n + v]; });
+    print("preflop_ties", [&] (std::size_t h, std::size_t v) { return not_losses[h * n + v] - wins[h * n + v]; });
+    std::printf("} // namespace poker::detail\n");
+
+    // Every pair of combinations must have met on every board exactly once.
+    for (auto hero = std::size_t{0}; hero < n; ++hero) {
+        for (auto villain = std::size_t{0}; villain < n; ++villain) {
+            auto pairs = std::int64_t{0};
+            for (const auto& x : poker::combos(hero)) {
+                for (const auto& y : poker::combos(villain)) {
+                    pairs += (poker::card_set{x} & poker::card_set{y}).empty();
+                }
+            }
+            const auto ties = not_losses[hero * n + villain] - wins[hero * n + villain];
+            if (wins[hero * n + villain] + ties + wins[villain * n + hero] != pairs * boards_per_matchup) {
+                std::fprintf(stderr, "Counts of classes %zu and %zu do not add up\n", hero, villain);
+                return EXIT_FAILURE;
+            }
+        }
+    }
+}
@@ -0,0 +1,60 @@
+// Runs the shuffle statistical tests on a generator driving poker::deck.
+//
+// Usage: poker-shuffle-certification [generator] [num_shuffles] [seed] [num_threads]
+//
+// 'generator' is one of xoshiro256 (the default), chacha20 or mt19937_64.
+// Every block of shuffles gets its own stream of the seed, so the report
+// only depends on the arguments, not on the number of threads.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+#include <poker/chacha20.hpp>
+#include <poker/shuffle_statistics.hpp>
+#include <poker/xoshiro256.hpp>
+
+namespace {
+
+void print(const char* name, const poker::chi_square_result& r) {
+    std::printf("%-13s chi2 = %14.2f  df = %5zu  p = %.6f\n", name, r.statistic, r.degrees_of_freedom, r.p_value);
+}
+
+} // namespace
+
+auto main(int argc, char** argv) -> int {
+    const auto generator = argc > 1 ? argv[1] : "xoshiro256";
+    auto options = poker::shuffle_test_options{};
+    options.num_shuffles = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 100'000'000;
+    const auto seed = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 0;
+    options.num_threads = argc > 4 ? static_cast<unsigned>(std::strtoul(argv[4], nullptr, 10)) : 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    auto report = poker::shuffle_test_report{};
+    if (std::strcmp(generator, "xoshiro256") == 0) {
+        report = poker::test_deck_shuffles(options, [&] (std::size_t block) { return poker::xoshiro256{seed, block}; });
+    } else if (std::strcmp(generator, "chacha20") == 0) {
+        const auto key = poker::chacha20::key_type{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)};
+        report = poker::test_deck_shuffles(options, [&] (std::size_t block) { return poker::chacha20{key, block}; });
+    } else if (std::strcmp(generator, "mt19937_64") == 0) {
+        report = poker::test_deck_shuffles(options, [&] (std::size_t block) {
+            auto seq = std::seed_seq{
+                static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32),
+                static_cast<std::uint32_t>(block), static_cast<std::uint32_t>(block >> 32)
+            };
+            return std::mt19937_64{seq};
+        });
+    } else {
+        std::fprintf(stderr, "Unknown generator '%s'\n", generator);
+        return EXIT_FAILURE;
+    }
+    const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf("%s: %llu shuffles in %.1f s\n", generator, static_cast<unsigned long long>(report.num_shuffles), seconds);
+    print("positions", report.positions);
+    print("adjacency", report.adjacency);
+    print("permutations", report.permutations);
+}